@@ -94,6 +94,12 @@ RODUAFrame::addImportOptions() {
     oc.doRegister("weights.expand", new Option_Bool(false));
     oc.addSynonyme("weights.expand", "expand-weights", true);
     oc.addDescription("weights.expand", "Processing", "Expand weights behind the simulation's end");
+
+    oc.doRegister("routing-threads", new Option_Integer(1));
+    oc.addDescription("routing-threads", "Processing", "Defines the number of threads to use for the route computation");
+
+    oc.doRegister("routing-batch-interval", new Option_String("-1", "TIME"));
+    oc.addDescription("routing-batch-interval", "Processing", "Routes vehicles of the same type and origin departing within intervals of the given length together (0 for equal departures only, negative to disable)");
 }
 
 
@@ -118,6 +124,9 @@ RODUAFrame::addDUAOptions() {
     oc.doRegister("skip-new-routes", new Option_Bool(false));
     oc.addDescription("skip-new-routes", "Processing", "Only reuse routes from input, do not calculate new ones");
 
+    oc.doRegister("incremental.tolerance", new Option_Float(-1));
+    oc.addDescription("incremental.tolerance", "Processing", "Reuse the cheapest route from input without searching if its costs changed by at most this fraction (negative to disable)");
+
     oc.doRegister("logit", new Option_Bool(false));
     oc.addDescription("logit", "Processing", "Use c-logit model");
 
@@ -168,10 +177,26 @@ RODUAFrame::checkOptions() {
         ok = false;
     }
 
-    if (oc.getString("routing-algorithm") != "dijkstra" && oc.getString("weight-attribute") != "traveltime") {
+    if (oc.getString("routing-algorithm") != "dijkstra" && oc.getString("routing-algorithm") != "astar" && oc.getString("weight-attribute") != "traveltime") {
         WRITE_ERROR("Routing algorithm '" + oc.getString("routing-algorithm") + "' does not support weight-attribute '" + oc.getString("weight-attribute") + "'.");
         return false;
     }
+    if (oc.getInt("astar.landmarks") < 0) {
+        WRITE_ERROR("The number of landmarks must not be negative.");
+        ok = false;
+    }
+    if ((oc.getInt("astar.landmarks") > 0 || oc.isSet("astar.landmark-distances")) && oc.getString("weight-attribute") != "traveltime") {
+        WRITE_WARNING("Landmarks are only used when routing by travel time.");
+    }
+    if (oc.getInt("routing-threads") < 1) {
+        WRITE_ERROR("The number of routing threads must be positive.");
+        ok = false;
+    }
+#ifndef HAVE_FOX
+    if (oc.getInt("routing-threads") > 1) {
+        WRITE_WARNING("Parallel routing is only possible when compiled with FOX, routing single threaded.");
+    }
+#endif
     return ok;
 }
 
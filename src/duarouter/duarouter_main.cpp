@@ -48,6 +48,8 @@
 #include <utils/common/DijkstraRouterTT.h>
 #include <utils/common/DijkstraRouterEffort.h>
 #include <utils/common/AStarRouter.h>
+#include <utils/common/AStarLookupTable.h>
+#include <utils/common/CHRouter.h>
 #include "RODUAEdgeBuilder.h"
 #include <router/ROFrame.h>
 #include <utils/common/MsgHandler.h>
@@ -58,14 +60,17 @@
 #include <utils/common/SystemFrame.h>
 #include <utils/common/RandHelper.h>
 #include <utils/common/ToString.h>
+#include <utils/common/SUMOTime.h>
 #include <utils/xml/XMLSubSys.h>
 #include "RODUAFrame.h"
 #include <utils/iodevices/OutputDevice.h>
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/MFXMutex.h>
+#endif
+
 #ifdef HAVE_INTERNAL // catchall for internal stuff
 #include <internal/BulkStarRouter.h>
-#include <internal/CHRouter.h>
-#include <internal/CHRouterWrapper.h>
 #endif // have HAVE_INTERNAL
 
 #ifdef CHECK_MEMORY_LEAKS
@@ -101,18 +106,13 @@ initNet(RONet& net, ROLoader& loader, OptionsCont& oc) {
 
 
 /**
- * Computes the routes saving them
+ * Builds the router given by the options
  */
-void
-computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
-    // initialise the loader
-    loader.openRoutes(net);
-    // prepare the output
-    net.openOutput(oc.getString("output-file"), true, oc.getString("vtype-output"));
-    // build the router
-    SUMOAbstractRouter<ROEdge, ROVehicle>* router;
+SUMOAbstractRouter<ROEdge, ROVehicle>*
+buildRouter(RONet& net, OptionsCont& oc, const LandmarkLookupTable<ROEdge, ROVehicle>* const landmarks) {
     const std::string measure = oc.getString("weight-attribute");
     const std::string routingAlgorithm = oc.getString("routing-algorithm");
+    SUMOAbstractRouter<ROEdge, ROVehicle>* router;
     if (measure == "traveltime") {
         if (routingAlgorithm == "dijkstra") {
             if (net.hasRestrictions()) {
@@ -125,10 +125,10 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
         } else if (routingAlgorithm == "astar") {
             if (net.hasRestrictions()) {
                 router = new AStarRouterTT_Direct<ROEdge, ROVehicle, prohibited_withRestrictions<ROEdge, ROVehicle> >(
-                    net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime);
+                    net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime, landmarks);
             } else {
                 router = new AStarRouterTT_Direct<ROEdge, ROVehicle, prohibited_noRestrictions<ROEdge, ROVehicle> >(
-                    net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime);
+                    net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime, landmarks);
             }
 #ifdef HAVE_INTERNAL // catchall for internal stuff
         } else if (routingAlgorithm == "bulkstar") {
@@ -140,35 +140,23 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
                     net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime, &ROEdge::getMinimumTravelTime);
             }
 
-        } else if (routingAlgorithm == "CH") {
-            // defaultVehicle is only in constructor and may be safely deleted
-            // it is mainly needed for its maximum speed. @todo XXX make this configurable
-            ROVehicle defaultVehicle(SUMOVehicleParameter(), 0, net.getVehicleTypeSecure(DEFAULT_VTYPE_ID));
+#endif // have HAVE_INTERNAL
+        } else if (routingAlgorithm == "CH" || routingAlgorithm == "CHWrapper") {
             const SUMOTime begin = string2time(oc.getString("begin"));
             const SUMOTime weightPeriod = (oc.isSet("weight-files") ?
                                            string2time(oc.getString("weight-period")) :
-                                           std::numeric_limits<int>::max());
+                                           SUMOTime_MAX);
             if (net.hasRestrictions()) {
-                router = new CHRouter<ROEdge, ROVehicle, prohibited_withRestrictions<ROEdge, ROVehicle> >(
-                    net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime, &defaultVehicle, begin, weightPeriod, true);
+                // one hierarchy per vehicle class
+                router = new CHRouterWrapper<ROEdge, ROVehicle, CHRouter_Direct<ROEdge, ROVehicle, prohibited_withRestrictions<ROEdge, ROVehicle> > >(
+                    net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime, begin, weightPeriod);
             } else {
-                router = new CHRouter<ROEdge, ROVehicle, prohibited_noRestrictions<ROEdge, ROVehicle> >(
-                    net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime, &defaultVehicle, begin, weightPeriod, false);
-            }
-
-        } else if (routingAlgorithm == "CHWrapper") {
-            const SUMOTime begin = string2time(oc.getString("begin"));
-            const SUMOTime weightPeriod = (oc.isSet("weight-files") ?
-                                           string2time(oc.getString("weight-period")) :
-                                           std::numeric_limits<int>::max());
-
-            if (!net.hasRestrictions()) {
-                WRITE_WARNING("CHWrapper is only needed for a restricted network");
+                if (routingAlgorithm == "CHWrapper") {
+                    WRITE_WARNING("CHWrapper is only needed for a restricted network");
+                }
+                router = new CHRouter_Direct<ROEdge, ROVehicle, prohibited_noRestrictions<ROEdge, ROVehicle> >(
+                    net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime, begin, weightPeriod);
             }
-            router = new CHRouterWrapper<ROEdge, ROVehicle, prohibited_withRestrictions<ROEdge, ROVehicle> >(
-                net.getEdgeNo(), oc.getBool("ignore-errors"), &ROEdge::getTravelTime, begin, weightPeriod);
-
-#endif // have HAVE_INTERNAL
         } else {
             throw ProcessError("Unknown routing Algorithm '" + routingAlgorithm + "'!");
         }
@@ -190,10 +178,18 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
         } else if (measure == "noise") {
             op = &ROEdge::getNoiseEffort;
         } else {
-            net.closeOutput();
             throw ProcessError("Unknown measure (weight attribute '" + measure + "')!");
         }
-        if (net.hasRestrictions()) {
+        if (routingAlgorithm == "astar") {
+            // there is no lower bound for the remaining effort, A* is as fast as Dijkstra here
+            if (net.hasRestrictions()) {
+                router = new AStarRouterEffort_Direct<ROEdge, ROVehicle, prohibited_withRestrictions<ROEdge, ROVehicle> >(
+                    net.getEdgeNo(), oc.getBool("ignore-errors"), op, &ROEdge::getTravelTime);
+            } else {
+                router = new AStarRouterEffort_Direct<ROEdge, ROVehicle, prohibited_noRestrictions<ROEdge, ROVehicle> >(
+                    net.getEdgeNo(), oc.getBool("ignore-errors"), op, &ROEdge::getTravelTime);
+            }
+        } else if (net.hasRestrictions()) {
             router = new DijkstraRouterEffort_Direct<ROEdge, ROVehicle, prohibited_withRestrictions<ROEdge, ROVehicle> >(
                 net.getEdgeNo(), oc.getBool("ignore-errors"), op, &ROEdge::getTravelTime);
         } else {
@@ -201,6 +197,62 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
                 net.getEdgeNo(), oc.getBool("ignore-errors"), op, &ROEdge::getTravelTime);
         }
     }
+    return router;
+}
+
+
+/**
+ * Computes the routes saving them
+ */
+void
+computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
+    const std::string measure = oc.getString("weight-attribute");
+    const std::string routingAlgorithm = oc.getString("routing-algorithm");
+    // build the lower bounds for A*
+    LandmarkLookupTable<ROEdge, ROVehicle>* landmarks = 0;
+    if (measure == "traveltime" && routingAlgorithm == "astar") {
+        if (oc.isSet("astar.landmark-distances")) {
+            PROGRESS_BEGIN_MESSAGE("Loading landmark distances");
+            landmarks = new LandmarkLookupTable<ROEdge, ROVehicle>(net.getEdgeNo(), oc.getString("astar.landmark-distances"));
+            PROGRESS_DONE_MESSAGE();
+        } else if (oc.getInt("astar.landmarks") > 0) {
+            PROGRESS_BEGIN_MESSAGE("Computing landmark distances");
+            landmarks = new LandmarkLookupTable<ROEdge, ROVehicle>(net.getEdgeNo(), oc.getInt("astar.landmarks"), &ROEdge::getMinimumTravelTime);
+            PROGRESS_DONE_MESSAGE();
+        }
+        if (landmarks != 0 && oc.isSet("astar.save-landmark-distances")) {
+            landmarks->save(oc.getString("astar.save-landmark-distances"));
+        }
+    }
+    // initialise the loader
+    loader.openRoutes(net);
+    // prepare the output
+    net.openOutput(oc.getString("output-file"), true, oc.getString("vtype-output"));
+    // build the router
+    SUMOAbstractRouter<ROEdge, ROVehicle>* router;
+    try {
+        router = buildRouter(net, oc, landmarks);
+    } catch (ProcessError&) {
+        net.closeOutput();
+        delete landmarks;
+        throw;
+    }
+    if (routingAlgorithm != "bulkstar") {
+        net.setBatchInterval(string2time(oc.getString("routing-batch-interval")));
+    }
+    // built on first use otherwise, which must not happen within the threads
+    ROCostCalculator::getCalculator();
+#ifdef HAVE_FOX
+    // build the routers of the additional threads, each thread needs its own
+    static MFXMutex messageLock;
+    const int numThreads = oc.getInt("routing-threads");
+    if (numThreads > 1 && routingAlgorithm != "bulkstar") {
+        MsgHandler::assignLock(&messageLock);
+        for (int i = 1; i < numThreads; i++) {
+            net.addRoutingThread(buildRouter(net, oc, landmarks));
+        }
+    }
+#endif
     // process route definitions
     try {
         if (routingAlgorithm == "bulkstar") {
@@ -218,10 +270,12 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
         // end the processing
         net.closeOutput();
         delete router;
+        delete landmarks;
         ROCostCalculator::cleanup();
     } catch (ProcessError&) {
         net.closeOutput();
         delete router;
+        delete landmarks;
         ROCostCalculator::cleanup();
         throw;
     }
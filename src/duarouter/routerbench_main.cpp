@@ -0,0 +1,235 @@
+/****************************************************************************/
+/// @file    routerbench_main.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Main for ROUTERBENCH, times random shortest path queries on a network
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_VERSION_H
+#include <version.h>
+#endif
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <router/ROLoader.h>
+#include <router/RONet.h>
+#include <router/ROEdge.h>
+#include <router/ROVehicle.h>
+#include <utils/common/DijkstraRouterTT.h>
+#include <utils/common/AStarRouter.h>
+#include "RODUAEdgeBuilder.h"
+#include <utils/common/MsgHandler.h>
+#include <utils/options/Option.h>
+#include <utils/options/OptionsCont.h>
+#include <utils/options/OptionsIO.h>
+#include <utils/common/UtilExceptions.h>
+#include <utils/common/SystemFrame.h>
+#include <utils/common/RandHelper.h>
+#include <utils/common/SysUtils.h>
+#include <utils/common/ToString.h>
+#include <utils/common/SUMOVehicleParameter.h>
+#include <utils/xml/XMLSubSys.h>
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// functions
+// ===========================================================================
+/* -------------------------------------------------------------------------
+ * options
+ * ----------------------------------------------------------------------- */
+void
+fillOptions() {
+    OptionsCont& oc = OptionsCont::getOptions();
+    oc.addCallExample("-n NET_FILE --queries 100000", "time 100000 random queries on the network");
+    // insert options sub-topics
+    SystemFrame::addConfigurationOptions(oc);
+    oc.addOptionSubTopic("Input");
+    oc.addOptionSubTopic("Processing");
+    oc.addOptionSubTopic("Report");
+    oc.addOptionSubTopic("Random Number");
+
+    oc.doRegister("net-file", 'n', new Option_FileName());
+    oc.addSynonyme("net-file", "net");
+    oc.addDescription("net-file", "Input", "Use FILE as SUMO-network to route on");
+
+    oc.doRegister("queries", new Option_Integer(100000));
+    oc.addDescription("queries", "Processing", "Computes INT random queries between two edges");
+
+    oc.doRegister("routing-algorithm", new Option_String("dijkstra"));
+    oc.addDescription("routing-algorithm", "Processing",
+                      "Select among routing algorithms ['dijkstra', 'astar']");
+
+    oc.doRegister("begin", 'b', new Option_String("0", "TIME"));
+    oc.addDescription("begin", "Processing", "Defines the departure time of the queries");
+
+    oc.doRegister("ignore-errors", new Option_Bool(true));
+    oc.addDescription("ignore-errors", "Report", "Does not report unreachable destinations");
+
+    oc.doRegister("no-step-log", new Option_Bool(false));
+    oc.addDescription("no-step-log", "Report", "Disable console output of route parsing step");
+
+    SystemFrame::addReportOptions(oc);
+    RandHelper::insertRandOptions();
+}
+
+
+/**
+ * Builds the router given by the options
+ */
+SUMOAbstractRouter<ROEdge, ROVehicle>*
+buildRouter(RONet& net, OptionsCont& oc) {
+    const std::string routingAlgorithm = oc.getString("routing-algorithm");
+    const bool ignoreErrors = oc.getBool("ignore-errors");
+    if (routingAlgorithm == "dijkstra") {
+        if (net.hasRestrictions()) {
+            return new DijkstraRouterTT_Direct<ROEdge, ROVehicle, prohibited_withRestrictions<ROEdge, ROVehicle> >(
+                       net.getEdgeNo(), ignoreErrors, &ROEdge::getTravelTime);
+        }
+        return new DijkstraRouterTT_Direct<ROEdge, ROVehicle, prohibited_noRestrictions<ROEdge, ROVehicle> >(
+                   net.getEdgeNo(), ignoreErrors, &ROEdge::getTravelTime);
+    } else if (routingAlgorithm == "astar") {
+        if (net.hasRestrictions()) {
+            return new AStarRouterTT_Direct<ROEdge, ROVehicle, prohibited_withRestrictions<ROEdge, ROVehicle> >(
+                       net.getEdgeNo(), ignoreErrors, &ROEdge::getTravelTime);
+        }
+        return new AStarRouterTT_Direct<ROEdge, ROVehicle, prohibited_noRestrictions<ROEdge, ROVehicle> >(
+                   net.getEdgeNo(), ignoreErrors, &ROEdge::getTravelTime);
+    }
+    throw ProcessError("Unknown routing Algorithm '" + routingAlgorithm + "'!");
+}
+
+
+/**
+ * Computes the random queries and reports the time needed
+ */
+void
+runQueries(RONet& net, OptionsCont& oc) {
+    // only edges a vehicle may start and end at
+    std::vector<const ROEdge*> edges;
+    for (unsigned int i = 0; i < net.getEdgeNo(); ++i) {
+        const ROEdge* const edge = ROEdge::dictionary(i);
+        if (edge->getType() == ROEdge::ET_NORMAL) {
+            edges.push_back(edge);
+        }
+    }
+    if (edges.size() < 2) {
+        throw ProcessError("The network has less than two edges to route between.");
+    }
+    const int numQueries = oc.getInt("queries");
+    std::vector<std::pair<const ROEdge*, const ROEdge*> > queries;
+    queries.reserve(numQueries);
+    for (int i = 0; i < numQueries; ++i) {
+        queries.push_back(std::make_pair(edges[RandHelper::rand(edges.size())], edges[RandHelper::rand(edges.size())]));
+    }
+    SUMOVehicleParameter pars;
+    pars.id = "routerbench";
+    const ROVehicle vehicle(pars, 0, net.getVehicleTypeSecure(DEFAULT_VTYPE_ID));
+    const SUMOTime begin = string2time(oc.getString("begin"));
+    SUMOAbstractRouter<ROEdge, ROVehicle>* const router = buildRouter(net, oc);
+    std::vector<const ROEdge*> into;
+    size_t found = 0;
+    size_t routeEdges = 0;
+    const long start = SysUtils::getCurrentMillis();
+    for (std::vector<std::pair<const ROEdge*, const ROEdge*> >::const_iterator i = queries.begin(); i != queries.end(); ++i) {
+        into.clear();
+        router->compute(i->first, i->second, &vehicle, begin, into);
+        if (!into.empty()) {
+            ++found;
+            routeEdges += into.size();
+        }
+    }
+    const long duration = SysUtils::getCurrentMillis() - start;
+    delete router;
+    std::cout << "Queries: " << queries.size() << " (" << found << " routes found, "
+              << routeEdges << " edges)\n"
+              << "Duration: " << duration << " ms";
+    if (duration > 0) {
+        std::cout << " (" << (SUMOReal) queries.size() * 1000. / (SUMOReal) duration << " queries/s)";
+    }
+    std::cout << std::endl;
+}
+
+
+/* -------------------------------------------------------------------------
+ * main
+ * ----------------------------------------------------------------------- */
+int
+main(int argc, char** argv) {
+    OptionsCont& oc = OptionsCont::getOptions();
+    // give some application descriptions
+    oc.setApplicationDescription("Times random shortest path queries of the routers on a network.");
+    oc.setApplicationName("routerbench", "SUMO routerbench Version " + (std::string)VERSION_STRING);
+    int ret = 0;
+    RONet* net = 0;
+    try {
+        XMLSubSys::init();
+        fillOptions();
+        OptionsIO::getOptions(true, argc, argv);
+        if (oc.processMetaOptions(argc < 2)) {
+            SystemFrame::close();
+            return 0;
+        }
+        XMLSubSys::setValidation(oc.getBool("xml-validation"));
+        MsgHandler::initOutputOptions();
+        RandHelper::initRandGlobal();
+        // load the net
+        net = new RONet();
+        ROLoader loader(oc, false);
+        RODUAEdgeBuilder builder(true, false);
+        loader.loadNet(*net, builder);
+        runQueries(*net, oc);
+    } catch (const ProcessError& e) {
+        if (std::string(e.what()) != std::string("Process Error") && std::string(e.what()) != std::string("")) {
+            WRITE_ERROR(e.what());
+        }
+        MsgHandler::getErrorInstance()->inform("Quitting (on error).", false);
+        ret = 1;
+#ifndef _DEBUG
+    } catch (const std::exception& e) {
+        if (std::string(e.what()) != std::string("")) {
+            WRITE_ERROR(e.what());
+        }
+        MsgHandler::getErrorInstance()->inform("Quitting (on error).", false);
+        ret = 1;
+    } catch (...) {
+        MsgHandler::getErrorInstance()->inform("Quitting (on unknown error).", false);
+        ret = 1;
+#endif
+    }
+    delete net;
+    SystemFrame::close();
+    return ret;
+}
+
+
+
+/****************************************************************************/
+
@@ -48,6 +48,7 @@
 #include <utils/common/MsgHandler.h>
 #include <utils/foxtools/MFXEventQue.h>
 #include <microsim/MSFrame.h>
+#include <microsim/MSLane.h>
 #include <utils/common/MsgRetrievingFunction.h>
 #include "GUIApplicationWindow.h"
 #include "GUILoadThread.h"
@@ -128,6 +129,7 @@ GUILoadThread::run() {
     // initialise global settings
     RandHelper::initRandGlobal();
     RandHelper::initRandGlobal(&MSVehicleControl::myVehicleParamsRNG);
+    MSLane::initRNGs(oc);
     MSFrame::setMSGlobals(oc);
     gAllowTextures = !oc.getBool("disable-textures");
     MSVehicleControl* vehControl = 0;
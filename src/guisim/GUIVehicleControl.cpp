@@ -84,7 +84,7 @@ void
 GUIVehicleControl::insertVehicleIDs(std::vector<GUIGlID>& into) {
     AbstractMutex::ScopedLocker locker(myLock);
     into.reserve(myVehicleDict.size());
-    for (VehicleDictType::iterator i = myVehicleDict.begin(); i != myVehicleDict.end(); ++i) {
+    for (VehicleDictType::const_iterator i = myVehicleDict.begin(); i != myVehicleDict.end(); ++i) {
         SUMOVehicle* veh = (*i).second;
         if (veh->isOnRoad()) {
             into.push_back(static_cast<GUIVehicle*>((*i).second)->getGlID());
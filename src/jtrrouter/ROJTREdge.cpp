@@ -75,41 +75,80 @@ ROJTREdge::addFollowerProbability(ROJTREdge* follower, SUMOTime begTime,
         return;
     }
     (*i).second->add(begTime, endTime, probability);
+    myTurnTimes.insert(begTime);
+    myTurnTimes.insert(endTime);
 }
 
 
 ROJTREdge*
-ROJTREdge::chooseNext(const ROVehicle* const veh, SUMOTime time) const {
+ROJTREdge::chooseNext(const ROVehicle* const veh, SUMOTime time, MTRand* rng) const {
     // if no usable follower exist, return 0
     //  their probabilities are not yet regarded
     if (myFollowingEdges.size() == 0 || (veh != 0 && allFollowersProhibit(veh))) {
         return 0;
     }
+    // the tables hold all followers, so they can only be used if the vehicle may use all of them
+    bool useTables = !myTurnTables.empty();
+    for (std::vector<ROEdge*>::const_iterator i = myFollowingEdges.begin(); useTables && veh != 0 && i != myFollowingEdges.end(); ++i) {
+        useTables = !(*i)->prohibits(veh);
+    }
+    if (useTables) {
+        const size_t index = std::upper_bound(myTurnTableBegins.begin(), myTurnTableBegins.end(), time) - myTurnTableBegins.begin();
+        const AliasDistributor<ROJTREdge*>& table = myTurnTables[index];
+        if (table.getOverallProb() == 0) {
+            return 0;
+        }
+        return table.get(rng);
+    }
     // gather information about the probabilities at this time
     RandomDistributor<ROJTREdge*> dist;
-    {
-        // use the loaded definitions, first
-        FollowerUsageCont::const_iterator i;
-        for (i = myFollowingDefs.begin(); i != myFollowingDefs.end(); i++) {
-            if ((veh == 0 || !(*i).first->prohibits(veh)) && (*i).second->describesTime(time)) {
-                dist.add((*i).second->getValue(time), (*i).first);
-            }
+    fillTurnDistribution(veh, time, dist);
+    // if still no valid follower exists, return null
+    if (dist.getOverallProb() == 0) {
+        return 0;
+    }
+    // return one of the possible followers
+    return dist.get(rng);
+}
+
+
+void
+ROJTREdge::buildTurnTables() {
+    myTurnTableBegins.assign(myTurnTimes.begin(), myTurnTimes.end());
+    myTurnTables.clear();
+    myTurnTables.reserve(myTurnTableBegins.size() + 1);
+    // the definitions are constant between two of their begin or end times
+    for (size_t i = 0; i <= myTurnTableBegins.size(); ++i) {
+        SUMOTime time = 0;
+        if (i > 0) {
+            time = myTurnTableBegins[i - 1];
+        } else if (!myTurnTableBegins.empty()) {
+            time = myTurnTableBegins[0] - 1;
+        }
+        RandomDistributor<ROJTREdge*> dist;
+        fillTurnDistribution(0, time, dist);
+        myTurnTables.push_back(AliasDistributor<ROJTREdge*>(dist));
+    }
+    myTurnTimes.clear();
+}
+
+
+void
+ROJTREdge::fillTurnDistribution(const ROVehicle* const veh, SUMOTime time, RandomDistributor<ROJTREdge*>& into) const {
+    // use the loaded definitions, first
+    for (FollowerUsageCont::const_iterator i = myFollowingDefs.begin(); i != myFollowingDefs.end(); i++) {
+        if ((veh == 0 || !(*i).first->prohibits(veh)) && (*i).second->describesTime(time)) {
+            into.add((*i).second->getValue(time), (*i).first);
         }
     }
     // if no loaded definitions are valid for this time, try to use the defaults
-    if (dist.getOverallProb() == 0) {
+    if (into.getOverallProb() == 0) {
         for (size_t i = 0; i < myParsedTurnings.size(); ++i) {
             if (veh == 0 || !myFollowingEdges[i]->prohibits(veh)) {
-                dist.add(myParsedTurnings[i], static_cast<ROJTREdge*>(myFollowingEdges[i]));
+                into.add(myParsedTurnings[i], static_cast<ROJTREdge*>(myFollowingEdges[i]));
             }
         }
     }
-    // if still no valid follower exists, return null
-    if (dist.getOverallProb() == 0) {
-        return 0;
-    }
-    // return one of the possible followers
-    return dist.get();
 }
 
 
@@ -33,8 +33,11 @@
 
 #include <string>
 #include <map>
+#include <set>
 #include <vector>
 #include <utils/common/ValueTimeLine.h>
+#include <utils/common/RandomDistributor.h>
+#include <utils/common/AliasDistributor.h>
 #include <router/ROEdge.h>
 
 
@@ -42,6 +45,7 @@
 // class declarations
 // ===========================================================================
 class ROLane;
+class MTRand;
 
 
 // ===========================================================================
@@ -53,6 +57,10 @@ class ROLane;
  *
  * A router edge extended by the definition about the probability a
  *  vehicle chooses a certain following edge over time.
+ *
+ * Once all definitions are loaded, buildTurnTables converts them into an
+ *  alias table per time interval, so that the next edge is drawn in
+ *  constant time unless vehicle classes exclude some of the followers.
  */
 class ROJTREdge : public ROEdge {
 public:
@@ -97,9 +105,19 @@ public:
     /** @brief Returns the next edge to use
      * @param[in] veh The vehicle to choose the next edge for
      * @param[in] time The time at which the next edge shall be entered
+     * @param[in] rng The random number generator to use; the global one if 0 is passed
      * @return The chosen edge
      */
-    ROJTREdge* chooseNext(const ROVehicle* const veh, SUMOTime time) const;
+    ROJTREdge* chooseNext(const ROVehicle* const veh, SUMOTime time, MTRand* rng = 0) const;
+
+
+    /** @brief Builds the tables for drawing the next edge
+     *
+     * Has to be called after the turning definitions and defaults were
+     *  loaded. Builds one table for each interval between the begin and
+     *  end times of the loaded definitions.
+     */
+    void buildTurnTables();
 
 
     /** @brief Sets the turning definition defaults
@@ -108,6 +126,15 @@ public:
     void setTurnDefaults(const std::vector<SUMOReal>& defs);
 
 
+private:
+    /** @brief Fills the distribution of the followers usable at the given time
+     * @param[in] veh The vehicle to choose the next edge for (0 if classes are ignored)
+     * @param[in] time The time at which the next edge shall be entered
+     * @param[filled] into The distribution to fill
+     */
+    void fillTurnDistribution(const ROVehicle* const veh, SUMOTime time, RandomDistributor<ROJTREdge*>& into) const;
+
+
 private:
     /// @brief Definition of a map that stores the probabilities of using a certain follower over time
     typedef std::map<ROJTREdge*, ValueTimeLine<SUMOReal>*> FollowerUsageCont;
@@ -118,6 +145,15 @@ private:
     /// @brief The defaults for turnings
     std::vector<SUMOReal> myParsedTurnings;
 
+    /// @brief The begin and end times of the loaded definitions
+    std::set<SUMOTime> myTurnTimes;
+
+    /// @brief The times at which the tables after the first one become valid
+    std::vector<SUMOTime> myTurnTableBegins;
+
+    /// @brief The tables for drawing the next edge by interval
+    std::vector<AliasDistributor<ROJTREdge*> > myTurnTables;
+
 
 private:
     /// @brief invalidated copy constructor
@@ -94,6 +94,9 @@ ROJTRFrame::fillOptions() {
     oc.doRegister("allow-loops", new Option_Bool(false));
     oc.addDescription("allow-loops", "Processing", "Allow to re-use a road");
 
+    oc.doRegister("routing-threads", new Option_Integer(1));
+    oc.addDescription("routing-threads", "Processing", "Defines the number of threads to use for the route computation");
+
     // add rand options
     RandHelper::insertRandOptions();
 }
@@ -130,6 +133,15 @@ ROJTRFrame::checkOptions() {
         WRITE_ERROR(error);
         ok = false;
     }
+    if (oc.getInt("routing-threads") < 1) {
+        WRITE_ERROR("The number of routing threads must be positive.");
+        ok = false;
+    }
+#ifndef HAVE_FOX
+    if (oc.getInt("routing-threads") > 1) {
+        WRITE_WARNING("Parallel routing is only possible when compiled with FOX, routing single threaded.");
+    }
+#endif
     return ok;
 }
 
@@ -44,11 +44,13 @@
 // method definitions
 // ===========================================================================
 ROJTRRouter::ROJTRRouter(RONet& net, bool unbuildIsWarningOnly, bool acceptAllDestinations,
-                         int maxEdges, bool ignoreClasses, bool allowLoops) :
+                         int maxEdges, bool ignoreClasses, bool allowLoops,
+                         unsigned int streamSeed) :
     SUMOAbstractRouter<ROEdge, ROVehicle>("JTRRouter"),
     myNet(net), myUnbuildIsWarningOnly(unbuildIsWarningOnly),
     myAcceptAllDestination(acceptAllDestinations), myMaxEdges(maxEdges),
-    myIgnoreClasses(ignoreClasses), myAllowLoops(allowLoops)
+    myIgnoreClasses(ignoreClasses), myAllowLoops(allowLoops),
+    myStreamSeed(streamSeed), myRandom(streamSeed)
 { }
 
 
@@ -60,6 +62,13 @@ ROJTRRouter::compute(const ROEdge* from, const ROEdge* /*to*/,
                      const ROVehicle* const vehicle,
                      SUMOTime time, std::vector<const ROEdge*>& into) {
     const ROJTREdge* current = static_cast<const ROJTREdge*>(from);
+    // seed the vehicle's stream with the (FNV-1a) hash of its id
+    unsigned int seed = 2166136261u;
+    const std::string& id = vehicle->getID();
+    for (std::string::const_iterator i = id.begin(); i != id.end(); ++i) {
+        seed = (seed ^ (unsigned char)(*i)) * 16777619u;
+    }
+    myRandom.seed(seed ^ myStreamSeed);
     // route until a sinks has been found
     while (current != 0
             &&
@@ -69,7 +78,7 @@ ROJTRRouter::compute(const ROEdge* from, const ROEdge* /*to*/,
 
         into.push_back(current);
         time += (SUMOTime) current->getTravelTime(vehicle, time);
-        current = current->chooseNext(myIgnoreClasses ? 0 : vehicle, time);
+        current = current->chooseNext(myIgnoreClasses ? 0 : vehicle, time, &myRandom);
         assert(myIgnoreClasses || current == 0 || !current->prohibits(vehicle));
     }
     // check whether no valid ending edge was found
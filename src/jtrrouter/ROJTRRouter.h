@@ -32,6 +32,7 @@
 #endif
 
 #include <utils/common/SUMOAbstractRouter.h>
+#include <utils/common/RandHelper.h>
 
 
 // ===========================================================================
@@ -48,6 +49,11 @@ class ROJTREdge;
 /**
  * @class ROJTRRouter
  * @brief Computes routes using junction turning percentages
+ *
+ * Each vehicle draws its turns from an own random number stream which is
+ *  seeded from its id and the given stream seed. This way, the routes do
+ *  not depend on the order in which the vehicles are routed, and several
+ *  routers may be used in parallel.
  */
 class ROJTRRouter : public SUMOAbstractRouter<ROEdge, ROVehicle> {
 public:
@@ -58,10 +64,11 @@ public:
      * @param[in] maxEdges The maximum number of edges a route may have
      * @param[in] ignoreClasses Whether routing shall be done without regarding vehicle classes
      * @param[in] allowLoops Whether a vehicle may reuse a road
+     * @param[in] streamSeed The seed combined with the vehicle ids for the random number streams
      */
     ROJTRRouter(RONet& net, bool unbuildIsWarningOnly,
                 bool acceptAllDestinations, int maxEdges, bool ignoreClasses,
-                bool allowLoops);
+                bool allowLoops, unsigned int streamSeed);
 
 
     /// @brief Destructor
@@ -114,6 +121,12 @@ private:
     /// @brief Whether a vehicle may reuse a road
     const bool myAllowLoops;
 
+    /// @brief The seed combined with the vehicle ids
+    const unsigned int myStreamSeed;
+
+    /// @brief The random number generator reseeded for each vehicle
+    MTRand myRandom;
+
 };
 
 
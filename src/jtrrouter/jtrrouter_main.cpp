@@ -62,6 +62,10 @@
 #include "ROJTRFrame.h"
 #include <utils/iodevices/OutputDevice.h>
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/MFXMutex.h>
+#endif
+
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
 #endif // CHECK_MEMORY_LEAKS
@@ -136,6 +140,11 @@ loadJTRDefinitions(RONet& net, OptionsCont& oc) {
             edge->setType(ROEdge::ET_SINK);
         }
     }
+    // precompute the turning tables
+    const std::map<std::string, ROEdge*>& edges = net.getEdgeMap();
+    for (std::map<std::string, ROEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+        static_cast<ROJTREdge*>((*i).second)->buildTurnTables();
+    }
 }
 
 
@@ -149,9 +158,22 @@ computeRoutes(RONet& net, ROLoader& loader, OptionsCont& oc) {
     // prepare the output
     net.openOutput(oc.getString("output-file"), false, oc.getString("vtype-output"));
     // build the router
+    const int maxEdges = (int)(((SUMOReal) net.getEdgeNo()) * OptionsCont::getOptions().getFloat("max-edges-factor"));
+    const unsigned int streamSeed = (unsigned int) RandHelper::rand(INT_MAX);
     ROJTRRouter router(net, oc.getBool("ignore-errors"), oc.getBool("accept-all-destinations"),
-                       (int)(((SUMOReal) net.getEdgeNo()) * OptionsCont::getOptions().getFloat("max-edges-factor")),
-                       oc.getBool("ignore-vclasses"), oc.getBool("allow-loops"));
+                       maxEdges, oc.getBool("ignore-vclasses"), oc.getBool("allow-loops"), streamSeed);
+#ifdef HAVE_FOX
+    // build the routers of the additional threads, each thread needs its own
+    static MFXMutex messageLock;
+    const int numThreads = oc.getInt("routing-threads");
+    if (numThreads > 1) {
+        MsgHandler::assignLock(&messageLock);
+        for (int i = 1; i < numThreads; i++) {
+            net.addRoutingThread(new ROJTRRouter(net, oc.getBool("ignore-errors"), oc.getBool("accept-all-destinations"),
+                                                 maxEdges, oc.getBool("ignore-vclasses"), oc.getBool("allow-loops"), streamSeed));
+        }
+    }
+#endif
     if (!oc.getBool("unsorted-input")) {
         // the routes are sorted - process stepwise
         loader.processRoutesStepWise(string2time(oc.getString("begin")), string2time(oc.getString("end")), net, router);
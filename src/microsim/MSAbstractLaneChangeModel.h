@@ -114,13 +114,47 @@ public:
          */
         MSLCMessager(MSVehicle* leader,  MSVehicle* neighLead, MSVehicle* neighFollow)
             : myLeader(leader), myNeighLeader(neighLead),
-              myNeighFollower(neighFollow) { }
+              myNeighFollower(neighFollow), myEdge(0), myDeferred(0) { }
 
 
         /// @brief Destructor
         ~MSLCMessager() { }
 
 
+        /**
+         * @struct Message
+         * @brief A message kept back to be delivered later
+         */
+        struct Message {
+            /// @brief The vehicle to inform
+            MSVehicle* receiver;
+            /// @brief The information to pass
+            void* info;
+            /// @brief The sending vehicle
+            MSVehicle* sender;
+        };
+
+
+        /** @brief Keeps back the messages to vehicles on other edges instead of delivering them
+         *
+         * Used while the lane changes of several edges are computed in parallel.
+         * @param[in] edge The edge of the lane changing vehicle
+         * @param[in] into The container to collect the kept back messages in
+         */
+        void deferForeign(const MSEdge* edge, std::vector<Message>* into) {
+            myEdge = edge;
+            myDeferred = into;
+        }
+
+
+        /** @brief Delivers a message kept back before
+         * @param[in] m The message to deliver
+         */
+        static void deliver(const Message& m) {
+            m.receiver->getLaneChangeModel().inform(m.info, m.sender);
+        }
+
+
         /** @brief Informs the leader on the same lane
          * @param[in] info The information to pass
          * @param[in] sender The sending vehicle (the lane changing vehicle)
@@ -128,7 +162,7 @@ public:
          */
         void* informLeader(void* info, MSVehicle* sender) {
             assert(myLeader != 0);
-            return myLeader->getLaneChangeModel().inform(info, sender);
+            return inform(myLeader, info, sender);
         }
 
 
@@ -139,7 +173,7 @@ public:
          */
         void* informNeighLeader(void* info, MSVehicle* sender) {
             assert(myNeighLeader != 0);
-            return myNeighLeader->getLaneChangeModel().inform(info, sender);
+            return inform(myNeighLeader, info, sender);
         }
 
 
@@ -150,7 +184,22 @@ public:
          */
         void* informNeighFollower(void* info, MSVehicle* sender) {
             assert(myNeighFollower != 0);
-            return myNeighFollower->getLaneChangeModel().inform(info, sender);
+            return inform(myNeighFollower, info, sender);
+        }
+
+
+    private:
+        /// @brief Informs the receiver or keeps the message back if the receiver is on another edge
+        void* inform(MSVehicle* receiver, void* info, MSVehicle* sender) {
+            if (myDeferred != 0 && &receiver->getLane()->getEdge() != myEdge) {
+                Message m;
+                m.receiver = receiver;
+                m.info = info;
+                m.sender = sender;
+                myDeferred->push_back(m);
+                return 0;
+            }
+            return receiver->getLaneChangeModel().inform(info, sender);
         }
 
 
@@ -161,6 +210,10 @@ public:
         MSVehicle* myNeighLeader;
         /// @brief The follower on the lane the vehicle want to change to
         MSVehicle* myNeighFollower;
+        /// @brief The edge of the lane changing vehicle if messages to other edges are kept back
+        const MSEdge* myEdge;
+        /// @brief The container of kept back messages (0 if all messages are delivered at once)
+        std::vector<Message>* myDeferred;
 
     };
 
@@ -31,9 +31,12 @@
 #endif
 
 #include <iostream>
+#include <sstream>
 #include <cassert>
 #include <utils/common/StdDefs.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include "MSVehicleType.h"
 #include "MSEdge.h"
 #include "MSLane.h"
@@ -113,6 +116,12 @@ MSBaseVehicle::getVehicleType() const {
 }
 
 
+SUMOVehicleClass
+MSBaseVehicle::getVClass() const {
+    return myType->getVehicleClass();
+}
+
+
 SUMOReal
 MSBaseVehicle::getMaxSpeed() const {
     return myType->getMaxSpeed();
@@ -263,6 +272,55 @@ MSBaseVehicle::activateReminders(const MSMoveReminder::Notification reason) {
 }
 
 
+void
+MSBaseVehicle::saveState(std::ostream& os) const {
+    FileHelpers::writeUInt(os, (unsigned int)(myCurrEdge - myRoute->begin()));
+    FileHelpers::writeFloat(os, myChosenSpeedFactor);
+    FileHelpers::writeTime(os, myDeparture);
+    FileHelpers::writeFloat(os, myArrivalPos);
+    FileHelpers::writeUInt(os, myNumberReroutes);
+    FileHelpers::writeUInt(os, (unsigned int) myDevices.size());
+    for (std::vector<MSDevice*>::const_iterator dev = myDevices.begin(); dev != myDevices.end(); ++dev) {
+        // each device's state is prefixed by its size so that it may be skipped on loading
+        std::ostringstream devState;
+        (*dev)->saveState(devState);
+        FileHelpers::writeString(os, (*dev)->getID());
+        FileHelpers::writeString(os, devState.str());
+    }
+}
+
+
+void
+MSBaseVehicle::loadState(BinaryInputDevice& bis, const SUMOTime offset) {
+    unsigned int routeIndex;
+    bis >> routeIndex;
+    if (routeIndex >= myRoute->size()) {
+        throw ProcessError("Invalid route position for vehicle '" + getID() + "' in the loaded state.");
+    }
+    myCurrEdge = myRoute->begin() + routeIndex;
+    bis >> myChosenSpeedFactor >> myDeparture >> myArrivalPos >> myNumberReroutes;
+    if (myDeparture != NOT_YET_DEPARTED) {
+        myDeparture += offset;
+    }
+    unsigned int numDevices;
+    bis >> numDevices;
+    for (; numDevices > 0; numDevices--) {
+        std::string id;
+        unsigned int size;
+        bis >> id >> size;
+        std::vector<MSDevice*>::iterator dev = myDevices.begin();
+        while (dev != myDevices.end() && (*dev)->getID() != id) {
+            ++dev;
+        }
+        if (dev != myDevices.end()) {
+            (*dev)->loadState(bis);
+        } else {
+            bis.getIStream().ignore(size);
+        }
+    }
+}
+
+
 void
 MSBaseVehicle::calculateArrivalPos() {
     const SUMOReal lastLaneLength = (myRoute->getLastEdge()->getLanes())[0]->getLength();
@@ -287,5 +345,12 @@ MSBaseVehicle::calculateArrivalPos() {
 }
 
 
+MemoryPool&
+MSBaseVehicle::getPool() {
+    static MemoryPool* const pool = new MemoryPool("vehicles");
+    return *pool;
+}
+
+
 /****************************************************************************/
 
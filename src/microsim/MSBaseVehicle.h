@@ -37,6 +37,7 @@
 #include <utils/common/StdDefs.h>
 #include "MSRoute.h"
 #include "MSMoveReminder.h"
+#include <utils/common/MemoryPool.h>
 
 
 // ===========================================================================
@@ -69,6 +70,24 @@ public:
     virtual ~MSBaseVehicle();
 
 
+#ifndef CHECK_MEMORY_LEAKS
+    /// @name Pooled allocation (see MemoryPool)
+    /// @{
+
+    /// @brief Returns the memory for a new vehicle from the pool
+    static void* operator new(size_t size) {
+        return getPool().allocate(size);
+    }
+
+
+    /// @brief Gives the memory of a deleted vehicle back to the pool
+    static void operator delete(void* p, size_t size) {
+        getPool().deallocate(p, size);
+    }
+    /// @}
+#endif
+
+
     /// Returns the name of the vehicle
     const std::string& getID() const;
 
@@ -91,6 +110,12 @@ public:
     const MSVehicleType& getVehicleType() const;
 
 
+    /** @brief Returns the vehicle's class
+     * @return The class of the vehicle's type
+     */
+    SUMOVehicleClass getVClass() const;
+
+
     /** @brief Returns the maximum speed
      * @return The vehicle's maximum speed
      */
@@ -237,6 +262,27 @@ public:
         return myChosenSpeedFactor;
     }
 
+
+    /// @name State I/O
+    /// @{
+
+    /** @brief Saves the position within the route, the departure information and the devices' states
+     * @param[in] os The stream to write the state into (binary)
+     * @see SUMOVehicle::saveState
+     */
+    virtual void saveState(std::ostream& os) const;
+
+
+    /** @brief Loads the state as written by saveState
+     *
+     * The states of devices the vehicle does not have (anymore) are skipped.
+     * @param[in] bis The input to read the state from (binary)
+     * @param[in] offset The offset to add to the loaded times
+     * @see SUMOVehicle::loadState
+     */
+    virtual void loadState(BinaryInputDevice& bis, const SUMOTime offset);
+    /// @}
+
 protected:
     /** @brief (Re-)Calculates the arrival position from the vehicle parameters
      */
@@ -282,6 +328,14 @@ protected:
     unsigned int myNumberReroutes;
 
 private:
+    /** @brief Returns the pool the memory of vehicles is taken from
+     *
+     * The pool is built on first use and deleted by MemoryPool::releasePools
+     *  after the last of its vehicles was deleted, so that vehicles deleted by
+     *  static destructors still find it.
+     */
+    static MemoryPool& getPool();
+
     /* @brief magic value for undeparted vehicles
      * @note: in previous versions this was -1
      */
@@ -43,6 +43,7 @@
 class MSVehicleType;
 class MSVehicle;
 class MSLane;
+class BinaryInputDevice;
 
 
 // ===========================================================================
@@ -58,7 +59,23 @@ class MSLane;
 class MSCFModel {
 public:
 
+    /** @class VehicleVariables
+     * @brief Model specific values which are stored inside a vehicle
+     */
     class VehicleVariables {
+    public:
+        /// @brief Destructor
+        virtual ~VehicleVariables() {}
+
+        /** @brief Saves the variables into the state
+         * @param[in] os The stream to write the variables into (binary)
+         */
+        virtual void saveState(std::ostream& /*os*/) const {}
+
+        /** @brief Loads the variables from the state
+         * @param[in] bis The input to read the variables from (binary)
+         */
+        virtual void loadState(BinaryInputDevice& /*bis*/) {}
     };
 
     /** @brief Constructor
@@ -109,6 +126,30 @@ public:
     virtual SUMOReal followSpeed(const MSVehicle* const veh, SUMOReal speed, SUMOReal gap2pred, SUMOReal predSpeed, SUMOReal predMaxDecel) const = 0;
 
 
+    /** @brief Computes the safe speeds of several vehicles using this model (no dawdling)
+     *
+     * The values are given as arrays (structure of arrays) so that models may
+     *  compute all follow speeds in a single loop. The results have to be
+     *  identical to calling followSpeed for each vehicle. Models which draw
+     *  random numbers or change vehicle variables within followSpeed must not
+     *  implement this (the default returns false).
+     *
+     * @param[in] vehs The vehicles (EGO)
+     * @param[in] speeds The vehicles' speeds
+     * @param[in] gap2preds The (netto) distances to the LEADERs
+     * @param[in] predSpeeds The speeds of the LEADERs
+     * @param[in] predMaxDecels The maximum decelerations of the LEADERs
+     * @param[out] vSafes The EGOs' safe speeds
+     * @param[in] n The number of vehicles
+     * @return Whether the safe speeds were computed
+     * @see followSpeed
+     */
+    virtual bool followSpeeds(const MSVehicle* const* /*vehs*/, const SUMOReal* /*speeds*/, const SUMOReal* /*gap2preds*/,
+                              const SUMOReal* /*predSpeeds*/, const SUMOReal* /*predMaxDecels*/, SUMOReal* /*vSafes*/, size_t /*n*/) const {
+        return false;
+    }
+
+
     /** @brief Computes the vehicle's safe speed for approaching a non-moving obstacle (no dawdling)
      *
      * Returns the velocity of the vehicle when approaching a static object (such as the end of a lane) assuming no reaction time is needed.
@@ -120,6 +161,26 @@ public:
     virtual SUMOReal stopSpeed(const MSVehicle* const veh, SUMOReal gap2pred) const = 0;
 
 
+    /** @brief Computes the safe speeds of several vehicles approaching non-moving obstacles (no dawdling)
+     *
+     * Is the batch variant of stopSpeed for vehicles of the same type.
+     *  Models which may compute several speeds at once override this method
+     *  and return true, the default implementation returns false and does
+     *  not touch vSafes.
+     * @param[in] vehs The vehicles (EGO)
+     * @param[in] speeds The vehicles' speeds
+     * @param[in] gap2preds The (netto) distances to the obstacles
+     * @param[out] vSafes The EGOs' safe speeds
+     * @param[in] n The number of vehicles
+     * @return Whether the safe speeds were computed
+     * @see stopSpeed
+     */
+    virtual bool stopSpeeds(const MSVehicle* const* /*vehs*/, const SUMOReal* /*speeds*/, const SUMOReal* /*gap2preds*/,
+                            SUMOReal* /*vSafes*/, size_t /*n*/) const {
+        return false;
+    }
+
+
     /** @brief Returns the maximum gap at which an interaction between both vehicles occurs
      *
      * "interaction" means that the LEADER influences EGO's speed.
@@ -131,12 +192,6 @@ public:
     virtual SUMOReal interactionGap(const MSVehicle* const veh, SUMOReal vL) const;
 
 
-    /** @brief Saves the model's definition into the state
-     * @param[in] os The output to write the definition into
-     */
-    virtual void saveState(std::ostream& os);
-
-
     /** @brief Returns the model's ID; the XML-Tag number is used
      * @return The model's ID
      */
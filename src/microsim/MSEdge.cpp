@@ -71,7 +71,11 @@ MSEdge::MSEdge(const std::string& id, int numericalID,
                const EdgeBasicFunction function,
                const std::string& streetName) :
     Named(id), myNumericalID(numericalID), myLanes(0),
-    myLaneChanger(0), myFunction(function), myVaporizationRequests(0),
+    myLaneChanger(0),
+#ifdef HAVE_FOX
+    myLaneChangeTask(*this),
+#endif
+    myFunction(function), myVaporizationRequests(0),
     myLastFailedInsertionTime(-1), myStreetName(streetName) {}
 
 
@@ -380,6 +384,34 @@ MSEdge::changeLanes(SUMOTime t) {
 }
 
 
+void
+MSEdge::computeLaneChanges() {
+    if (myFunction == EDGEFUNCTION_INTERNAL) {
+        return;
+    }
+    assert(myLaneChanger != 0);
+    myLaneChanger->computeChanges();
+}
+
+
+void
+MSEdge::updateLanesAfterLaneChange(SUMOTime t) {
+    if (myFunction == EDGEFUNCTION_INTERNAL) {
+        return;
+    }
+    assert(myLaneChanger != 0);
+    myLaneChanger->updateLanes(t);
+}
+
+
+#ifdef HAVE_FOX
+void
+MSEdge::LaneChangeTask::run(FXWorkerThread* /*context*/) {
+    myEdge.computeLaneChanges();
+}
+#endif
+
+
 
 #ifdef HAVE_INTERNAL_LANES
 const MSEdge*
@@ -47,6 +47,9 @@
 #include <utils/common/UtilExceptions.h>
 #include "MSVehicleType.h"
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 // ===========================================================================
 // class declarations
@@ -378,6 +381,54 @@ public:
     virtual void changeLanes(SUMOTime t);
 
 
+#ifdef HAVE_FOX
+    /**
+     * @class LaneChangeTask
+     * @brief A task computing the lane changes on an edge in a worker thread
+     */
+    class LaneChangeTask : public FXWorkerThread::Task {
+    public:
+        /// @brief Constructor
+        LaneChangeTask(MSEdge& e) : myEdge(e) {}
+
+        /// @brief Calls computeLaneChanges of the edge
+        void run(FXWorkerThread* context);
+
+    private:
+        /// @brief The edge to process
+        MSEdge& myEdge;
+
+    private:
+        /// @brief Invalidated assignment operator.
+        LaneChangeTask& operator=(const LaneChangeTask&);
+
+    };
+
+    /** @brief Returns the task computing the lane changes on this edge
+     * @return The task
+     */
+    LaneChangeTask* getLaneChangeTask() {
+        return &myLaneChangeTask;
+    }
+#endif
+
+
+    /** @brief Computes the lane changes on this edge without giving the results back to the lanes
+     *
+     * Used for computing the lane changes of several edges in parallel,
+     *  "updateLanesAfterLaneChange" has to be called afterwards.
+     *
+     * @see MSLaneChanger::computeChanges
+     */
+    void computeLaneChanges();
+
+
+    /** @brief Gives the results of "computeLaneChanges" back to the lanes
+     * @param[in] t The current time step
+     */
+    void updateLanesAfterLaneChange(SUMOTime t);
+
+
 #ifdef HAVE_INTERNAL_LANES
     /// @todo extension: inner junctions are not filled
     const MSEdge* getInternalFollowingEdge(MSEdge* followerAfterInternal) const;
@@ -529,6 +580,11 @@ protected:
     /// @brief This member will do the lane-change
     MSLaneChanger* myLaneChanger;
 
+#ifdef HAVE_FOX
+    /// @brief The task for computing the lane changes in parallel
+    LaneChangeTask myLaneChangeTask;
+#endif
+
     /// @brief the purpose of the edge
     const EdgeBasicFunction myFunction;
 
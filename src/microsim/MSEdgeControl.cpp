@@ -34,6 +34,7 @@
 #include "MSEdgeControl.h"
 #include "MSEdge.h"
 #include "MSLane.h"
+#include "MSGlobals.h"
 #include <iostream>
 #include <vector>
 
@@ -48,7 +49,12 @@
 MSEdgeControl::MSEdgeControl(const std::vector< MSEdge* >& edges)
     : myEdges(edges),
       myLanes(MSLane::dictSize()),
-      myLastLaneChange(MSEdge::dictSize()) {
+      myActiveLanes(MSLane::dictSize()),
+      myLastLaneChange(MSEdge::dictSize())
+#ifdef HAVE_FOX
+    , myThreadPool(MSGlobals::gNumSimThreads > 1 ? MSGlobals::gNumSimThreads : 0)
+#endif
+{
     // build the usage definitions for lanes
     for (std::vector< MSEdge* >::const_iterator i = myEdges.begin(); i != myEdges.end(); ++i) {
         const std::vector<MSLane*>& lanes = (*i)->getLanes();
@@ -57,7 +63,6 @@ MSEdgeControl::MSEdgeControl(const std::vector< MSEdge* >& edges)
             myLanes[pos].lane = *(lanes.begin());
             myLanes[pos].firstNeigh = lanes.end();
             myLanes[pos].lastNeigh = lanes.end();
-            myLanes[pos].amActive = false;
             myLanes[pos].haveNeighbors = false;
         } else {
             for (std::vector<MSLane*>::const_iterator j = lanes.begin(); j != lanes.end(); ++j) {
@@ -65,7 +70,6 @@ MSEdgeControl::MSEdgeControl(const std::vector< MSEdge* >& edges)
                 myLanes[pos].lane = *j;
                 myLanes[pos].firstNeigh = (j + 1);
                 myLanes[pos].lastNeigh = lanes.end();
-                myLanes[pos].amActive = false;
                 myLanes[pos].haveNeighbors = true;
             }
             myLastLaneChange[(*i)->getNumericalID()] = -1;
@@ -81,16 +85,10 @@ MSEdgeControl::~MSEdgeControl() {
 void
 MSEdgeControl::patchActiveLanes() {
     for (std::set<MSLane*, Named::ComparatorIdLess>::iterator i = myChangedStateLanes.begin(); i != myChangedStateLanes.end(); ++i) {
-        LaneUsage& lu = myLanes[(*i)->getNumericalID()];
         // if the lane was inactive but is now...
-        if (!lu.amActive && (*i)->getVehicleNumber() > 0) {
-            // ... add to active lanes and mark as such
-            if (lu.haveNeighbors) {
-                myActiveLanes.push_front(*i);
-            } else {
-                myActiveLanes.push_back(*i);
-            }
-            lu.amActive = true;
+        if ((*i)->getVehicleNumber() > 0) {
+            // ... add to active lanes
+            addActiveLane(*i);
         }
     }
     myChangedStateLanes.clear();
@@ -98,39 +96,49 @@ MSEdgeControl::patchActiveLanes() {
 
 void
 MSEdgeControl::moveCritical(SUMOTime t) {
-    for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
-        if ((*i)->getVehicleNumber() == 0 || (*i)->moveCritical(t)) {
-            myLanes[(*i)->getNumericalID()].amActive = false;
-            i = myActiveLanes.erase(i);
-        } else {
-            ++i;
+#ifdef HAVE_FOX
+    if (myThreadPool.size() > 0) {
+        for (size_t i = 0; i < myActiveLanes.size(); ++i) {
+            MSLane* const lane = myActiveLanes[i];
+            if (lane->getVehicleNumber() > 0) {
+                myThreadPool.add(lane->getPlanMoveTask(t), (int)(lane->getRNGIndex() % myThreadPool.size()));
+            }
+        }
+        myThreadPool.waitAll(false);
+    } else {
+#endif
+        for (size_t i = 0; i < myActiveLanes.size(); ++i) {
+            MSLane* const lane = myActiveLanes[i];
+            if (lane->getVehicleNumber() > 0) {
+                lane->planMovements(t);
+            }
         }
+#ifdef HAVE_FOX
     }
+#endif
+    for (size_t i = 0; i < myActiveLanes.size(); ++i) {
+        MSLane* const lane = myActiveLanes[i];
+        if (lane->getVehicleNumber() == 0 || lane->moveCritical(t)) {
+            myActiveLanes.remove(lane);
+        }
+    }
+    myActiveLanes.compact();
 }
 
 
 void
 MSEdgeControl::moveFirst(SUMOTime t) {
     myWithVehicles2Integrate.clear();
-    for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
-        if ((*i)->getVehicleNumber() == 0 || (*i)->setCritical(t, myWithVehicles2Integrate)) {
-            myLanes[(*i)->getNumericalID()].amActive = false;
-            i = myActiveLanes.erase(i);
-        } else {
-            ++i;
+    for (size_t i = 0; i < myActiveLanes.size(); ++i) {
+        MSLane* const lane = myActiveLanes[i];
+        if (lane->getVehicleNumber() == 0 || lane->setCritical(t, myWithVehicles2Integrate)) {
+            myActiveLanes.remove(lane);
         }
     }
+    myActiveLanes.compact();
     for (std::vector<MSLane*>::iterator i = myWithVehicles2Integrate.begin(); i != myWithVehicles2Integrate.end(); ++i) {
         if ((*i)->integrateNewVehicle(t)) {
-            LaneUsage& lu = myLanes[(*i)->getNumericalID()];
-            if (!lu.amActive) {
-                if (lu.haveNeighbors) {
-                    myActiveLanes.push_front(*i);
-                } else {
-                    myActiveLanes.push_back(*i);
-                }
-                lu.amActive = true;
-            }
+            addActiveLane(*i);
         }
     }
 }
@@ -138,30 +146,45 @@ MSEdgeControl::moveFirst(SUMOTime t) {
 
 void
 MSEdgeControl::changeLanes(SUMOTime t) {
+    myEdges2Change.clear();
+    // lanes of multi-lane edges are stored at the front
+    for (size_t i = 0; i < myActiveLanes.frontSize(); ++i) {
+        MSEdge& edge = myActiveLanes[i]->getEdge();
+        if (myLastLaneChange[edge.getNumericalID()] != t) {
+            myLastLaneChange[edge.getNumericalID()] = t;
+            myEdges2Change.push_back(&edge);
+        }
+    }
+#ifdef HAVE_FOX
+    if (MSGlobals::gParallelLaneChange && myThreadPool.size() > 0) {
+        // edges sharing a random number generator are processed by the same thread
+        for (std::vector<MSEdge*>::iterator i = myEdges2Change.begin(); i != myEdges2Change.end(); ++i) {
+            const size_t rngIndex = (*i)->getLanes()[0]->getRNGIndex();
+            myThreadPool.add((*i)->getLaneChangeTask(), (int)(rngIndex % myThreadPool.size()));
+        }
+        myThreadPool.waitAll(false);
+        for (std::vector<MSEdge*>::iterator i = myEdges2Change.begin(); i != myEdges2Change.end(); ++i) {
+            (*i)->updateLanesAfterLaneChange(t);
+        }
+    } else {
+#endif
+        for (std::vector<MSEdge*>::iterator i = myEdges2Change.begin(); i != myEdges2Change.end(); ++i) {
+            (*i)->changeLanes(t);
+        }
+#ifdef HAVE_FOX
+    }
+#endif
     std::vector<MSLane*> toAdd;
-    for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end();) {
-        LaneUsage& lu = myLanes[(*i)->getNumericalID()];
-        if (lu.haveNeighbors) {
-            MSEdge& edge = (*i)->getEdge();
-            if (myLastLaneChange[edge.getNumericalID()] != t) {
-                myLastLaneChange[edge.getNumericalID()] = t;
-                edge.changeLanes(t);
-                const std::vector<MSLane*>& lanes = edge.getLanes();
-                for (std::vector<MSLane*>::const_iterator i = lanes.begin(); i != lanes.end(); ++i) {
-                    LaneUsage& lu = myLanes[(*i)->getNumericalID()];
-                    if ((*i)->getVehicleNumber() > 0 && !lu.amActive) {
-                        toAdd.push_back(*i);
-                        lu.amActive = true;
-                    }
-                }
+    for (std::vector<MSEdge*>::iterator i = myEdges2Change.begin(); i != myEdges2Change.end(); ++i) {
+        const std::vector<MSLane*>& lanes = (*i)->getLanes();
+        for (std::vector<MSLane*>::const_iterator j = lanes.begin(); j != lanes.end(); ++j) {
+            if ((*j)->getVehicleNumber() > 0 && !myActiveLanes.contains(*j)) {
+                toAdd.push_back(*j);
             }
-            ++i;
-        } else {
-            i = myActiveLanes.end();
         }
     }
     for (std::vector<MSLane*>::iterator i = toAdd.begin(); i != toAdd.end(); ++i) {
-        myActiveLanes.push_front(*i);
+        myActiveLanes.pushFront(*i);
     }
 }
 
@@ -169,8 +192,18 @@ MSEdgeControl::changeLanes(SUMOTime t) {
 void
 MSEdgeControl::detectCollisions(SUMOTime timestep) {
     // Detections is made by the edge's lanes, therefore hand over.
-    for (std::list<MSLane*>::iterator i = myActiveLanes.begin(); i != myActiveLanes.end(); ++i) {
-        (*i)->detectCollisions(timestep);
+    for (size_t i = 0; i < myActiveLanes.size(); ++i) {
+        myActiveLanes[i]->detectCollisions(timestep);
+    }
+}
+
+
+void
+MSEdgeControl::addActiveLane(MSLane* l) {
+    if (myLanes[l->getNumericalID()].haveNeighbors) {
+        myActiveLanes.pushFront(l);
+    } else {
+        myActiveLanes.pushBack(l);
     }
 }
 
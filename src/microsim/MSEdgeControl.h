@@ -39,10 +39,14 @@
 #include <map>
 #include <string>
 #include <iostream>
-#include <list>
 #include <set>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/Named.h>
+#include <utils/common/ActiveSet.h>
+
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -108,10 +112,18 @@ public:
      *  all first vehicles. They are not moved, in fact, but their speed along
      *  the next path is precomputed.
      *
-     * This method goes through all active lanes calling their "moveCritical"
-     *  implementation. If this call returns true, the lane is removed from the
-     *  list of active lanes.
+     * This method goes through all active lanes calling their "planMovements"
+     *  implementation, using the thread pool if more than one thread is
+     *  configured. Each lane is assigned to the thread given by its random
+     *  number generator, so the results do not depend on the number of threads.
+     *  There is no work stealing, an idle thread does not take over the lanes
+     *  of a busy one because this would change the order of the random numbers.
+     *
+     * Afterwards, the lanes' "moveCritical" is called in the order of the
+     *  active lanes list, registering the vehicles at the approached links.
+     *  If this call returns true, the lane is removed from the list of active lanes.
      *
+     * @see MSLane::planMovements
      * @see MSLane::moveCritical
      */
     void moveCritical(SUMOTime t);
@@ -142,10 +154,14 @@ public:
     /** @brief Moves (precomputes) critical vehicles
      *
      * Calls "changeLanes" of each of the multi-lane edges. Check then for this
-     *  edge whether a lane got active, adding it to "myActiveLanes" and marking
-     *  it as active in such cases.
+     *  edge whether a lane got active, adding it to "myActiveLanes" in such cases.
+     *
+     * If parallel lane changing is enabled, the edges compute their lane changes
+     *  in the thread pool, the results are given back to the lanes afterwards
+     *  in the order of the active lanes.
      *
      * @see MSEdge::changeLanes
+     * @see MSEdge::computeLaneChanges
      */
     void changeLanes(SUMOTime t);
 
@@ -186,6 +202,19 @@ public:
     void gotActive(MSLane* l);
 
 
+#ifdef HAVE_FOX
+    /** @brief Returns the pool of threads computing the lane update
+     *
+     * The pool is idle outside of the lane update and may be used for other
+     *  tasks then (the pool is empty if running single threaded).
+     * @return The thread pool
+     */
+    FXWorkerThread::Pool& getThreadPool() {
+        return myThreadPool;
+    }
+#endif
+
+
 public:
     /**
      * @struct LaneUsage
@@ -205,12 +234,21 @@ public:
         std::vector<MSLane*>::const_iterator firstNeigh;
         /// @brief The end of this lane's edge's lane container
         std::vector<MSLane*>::const_iterator lastNeigh;
-        /// @brief Information whether this lane is active
-        bool amActive;
         /// @brief Information whether this lane belongs to a multi-lane edge
         bool haveNeighbors;
     };
 
+private:
+    /** @brief Adds the given lane to the active lanes
+     *
+     * Lanes of multi-lane edges are added at the front, others at the back.
+     *  Nothing is done if the lane is already active.
+     *
+     * @param[in] l The lane to add
+     */
+    void addActiveLane(MSLane* l);
+
+
 private:
     /// @brief Loaded edges
     std::vector<MSEdge*> myEdges;
@@ -221,18 +259,30 @@ private:
     /// @brief Information about lanes' number of vehicles and neighbors
     LaneUsageVector myLanes;
 
-    /// @brief The list of active (not empty) lanes
-    std::list<MSLane*> myActiveLanes;
+    /** @brief The set of active (not empty) lanes
+     *
+     * Lanes of multi-lane edges are added at the front, all other lanes at the
+     *  back, so the lanes which may change lanes come first.
+     */
+    ActiveSet<MSLane> myActiveLanes;
 
     /// @brief A storage for lanes which shall be integrated because vehicles have moved onto them
     std::vector<MSLane*> myWithVehicles2Integrate;
 
+    /// @brief A storage for the edges which perform lane changing in the current step
+    std::vector<MSEdge*> myEdges2Change;
+
     /// @brief Lanes which changed the state without informing the control
     std::set<MSLane*, Named::ComparatorIdLess> myChangedStateLanes;
 
     /// @brief The list of active (not empty) lanes
     std::vector<SUMOTime> myLastLaneChange;
 
+#ifdef HAVE_FOX
+    /// @brief The pool of threads computing the vehicles' movement plans and lane changes
+    FXWorkerThread::Pool myThreadPool;
+#endif
+
 private:
     /// @brief Copy constructor.
     MSEdgeControl(const MSEdgeControl&);
@@ -33,9 +33,11 @@
 #endif
 
 #include <cassert>
+#include <algorithm>
 #include "MSEventControl.h"
 #include <utils/common/MsgHandler.h>
 #include <utils/common/Command.h>
+#include <utils/common/StdDefs.h>
 #include "MSNet.h"
 
 #ifdef CHECK_MEMORY_LEAKS
@@ -47,15 +49,21 @@
 // member definitions
 // ===========================================================================
 MSEventControl::MSEventControl()
-    : currentTimeStep(-1), myEvents() {}
+    : currentTimeStep(-1), myStepLength(DELTA_T), myCurrentStep(0),
+      myWheel(WHEEL_SIZE), myWheelSize(0), myFutureEvents() {}
 
 
 MSEventControl::~MSEventControl() {
     // delete the events
-    while (! myEvents.empty()) {
-        Event e = myEvents.top();
+    for (std::vector<Bucket>::iterator i = myWheel.begin(); i != myWheel.end(); ++i) {
+        for (Bucket::iterator j = (*i).begin(); j != (*i).end(); ++j) {
+            delete(*j).first;
+        }
+    }
+    while (! myFutureEvents.empty()) {
+        Event e = myFutureEvents.top();
         delete e.first;
-        myEvents.pop();
+        myFutureEvents.pop();
     }
 }
 
@@ -68,56 +76,103 @@ MSEventControl::addEvent(Command* operation,
     if (type == ADAPT_AFTER_EXECUTION && execTimeStep <= currTimeStep) {
         execTimeStep = currTimeStep;
     }
-    Event newEvent = Event(operation, execTimeStep);
-    myEvents.push(newEvent);
+    insertEvent(Event(operation, execTimeStep));
     return execTimeStep;
 }
 
 
+void
+MSEventControl::insertEvent(const Event& event) {
+    const SUMOTime step = MAX2(getStep(event.second), myCurrentStep);
+    if (step - myCurrentStep >= WHEEL_SIZE) {
+        myFutureEvents.push(event);
+    } else {
+        myWheel[step & (WHEEL_SIZE - 1)].push_back(event);
+        myWheelSize++;
+    }
+}
+
+
 void
 MSEventControl::execute(SUMOTime execTime) {
-    // Execute all events that are scheduled for execTime.
-    for (; !myEvents.empty();) {
-        Event currEvent = myEvents.top();
-        if (currEvent.second == execTime || currEvent.second < execTime + DELTA_T) {
-            Command* command = currEvent.first;
-            myEvents.pop();
-            SUMOTime time = 0;
-            try {
-                time = command->execute(execTime);
-            } catch (...) {
-                delete command;
-                throw;
+    // Execute all events that are scheduled before execTime + DELTA_T.
+    //  If execTime is not a multiple of the step length, the last
+    //  step's bucket is only executed in part and stays the current one.
+    const SUMOTime lastStep = getStep(execTime + myStepLength - 1);
+    const bool partial = getStep(execTime) != lastStep;
+    while (true) {
+        if (myWheelSize == 0) {
+            // skip the empty buckets
+            SUMOTime next = lastStep;
+            if (!myFutureEvents.empty()) {
+                next = MIN2(next, getStep(myFutureEvents.top().second));
             }
+            myCurrentStep = MAX2(myCurrentStep, next);
+        }
+        // move the events which came into reach into the wheel
+        while (!myFutureEvents.empty() && getStep(myFutureEvents.top().second) - myCurrentStep < WHEEL_SIZE) {
+            insertEvent(myFutureEvents.top());
+            myFutureEvents.pop();
+        }
+        if (myCurrentStep > lastStep) {
+            break;
+        }
+        executeBucket(myWheel[myCurrentStep & (WHEEL_SIZE - 1)], execTime);
+        if (partial && myCurrentStep == lastStep) {
+            break;
+        }
+        myCurrentStep++;
+    }
+}
+
+
+void
+MSEventControl::executeBucket(Bucket& bucket, SUMOTime execTime) {
+    const SUMOTime limit = execTime + myStepLength;
+    for (size_t i = 1; i < bucket.size(); ++i) {
+        if (bucket[i - 1].second > bucket[i].second) {
+            std::stable_sort(bucket.begin(), bucket.end(), EventTimeSortCrit());
+            break;
+        }
+    }
+    // events may be appended to the bucket while it is executed
+    size_t kept = 0;
+    for (size_t i = 0; i < bucket.size(); ++i) {
+        Event currEvent = bucket[i];
+        if (currEvent.second >= limit) {
+            bucket[kept++] = currEvent;
+            continue;
+        }
+        myWheelSize--;
+        Command* command = currEvent.first;
+        SUMOTime time = 0;
+        try {
+            time = command->execute(execTime);
+        } catch (...) {
+            bucket.erase(bucket.begin() + kept, bucket.begin() + i + 1);
+            delete command;
+            throw;
+        }
 
-            // Delete nonrecurring events, reinsert recurring ones
-            // with new execution time = execTime + returned offset.
-            if (time <= 0) {
-                if (time < 0) {
-                    WRITE_WARNING("Command returned negative repeat number; will be deleted.");
-                }
-                delete currEvent.first;
-            } else {
-                currEvent.second = execTime + time;
-                myEvents.push(currEvent);
+        // Delete nonrecurring events, reinsert recurring ones
+        // with new execution time = execTime + returned offset.
+        if (time <= 0) {
+            if (time < 0) {
+                WRITE_WARNING("Command returned negative repeat number; will be deleted.");
             }
+            delete currEvent.first;
         } else {
-            if (currEvent.second < execTime) {
-                // !!! more verbose information
-                WRITE_WARNING("Could not execute scheduled event.");
-                delete currEvent.first;
-                myEvents.pop();
-            } else {
-                break;
-            }
+            currEvent.second = execTime + time;
+            insertEvent(currEvent);
         }
     }
+    bucket.resize(kept);
 }
 
 
 bool
 MSEventControl::isEmpty() {
-    return myEvents.empty();
+    return myWheelSize == 0 && myFutureEvents.empty();
 }
 
 void
@@ -53,6 +53,15 @@ class Command;
 /**
  * @class MSEventControl
  * @brief Stores time-dependant events and executes them at the proper time
+ *
+ * The events are kept in a time wheel: a ring of buckets, one per simulation
+ *  step, covering the next WHEEL_SIZE steps. Adding an event and collecting
+ *  the events of a step are both O(1) as almost all events are scheduled
+ *  for multiples of DELTA_T. Events lying beyond the wheel's horizon are
+ *  kept in a heap and moved into the wheel once they come into reach.
+ *
+ * Events of the same step are executed in the order of their execution
+ *  time; events with the same execution time in the order they were added.
  */
 class MSEventControl {
 public:
@@ -101,10 +110,8 @@ public:
 
     /** @brief Executes time-dependant commands
      *
-     * Loops over all stored events, continuing until the first event which
-     *  execution time lies beyond the given time + deltaT. If the event
-     *  had to be executed before the given time, a warning is generated and
-     *  the event deleted. Otherwise (the event is valid), the event is executed.
+     * Executes all stored events which execution time lies before the given
+     *  time + deltaT, including the ones which were due before.
      *
      * Each executed event must return the time that has to pass until it shall
      *  be executed again. If the returned time is 0, the event is deleted.
@@ -149,20 +156,78 @@ protected:
     };
 
 
+    /** @brief Sort-criterion for events within a bucket.
+     *
+     * Sorts events by their execution time, ascending
+     */
+    class EventTimeSortCrit {
+    public:
+        /// @brief compares two events
+        bool operator()(const Event& e1, const Event& e2) const {
+            return e1.second < e2.second;
+        }
+    };
+
+
 private:
     /// @brief Container for time-dependant events, e.g. traffic-light-change.
     typedef std::priority_queue< Event, std::vector< Event >, EventSortCrit > EventCont;
 
+    /// @brief A bucket of the time wheel, holds the events of one step
+    typedef std::vector< Event > Bucket;
+
+    /// @brief The number of steps covered by the time wheel (a power of two)
+    static const SUMOTime WHEEL_SIZE = 1024;
+
     /// The Current TimeStep
     SUMOTime currentTimeStep;
 
-    /// @brief Event-container, holds executable events.
-    EventCont myEvents;
+    /// @brief The step length the buckets are computed with
+    const SUMOTime myStepLength;
+
+    /// @brief The number of the step to be executed next (its bucket is the first one of the wheel)
+    SUMOTime myCurrentStep;
+
+    /// @brief The time wheel, holds the events of the steps myCurrentStep to myCurrentStep + WHEEL_SIZE - 1
+    std::vector< Bucket > myWheel;
+
+    /// @brief The number of events stored in the time wheel
+    size_t myWheelSize;
+
+    /// @brief Event-container, holds the events beyond the time wheel's horizon
+    EventCont myFutureEvents;
 
     /// get the Current TimeStep used in addEvent.
     SUMOTime getCurrentTimeStep();
 
 
+    /** @brief Returns the number of the step the given time lies in
+     * @param[in] time The time to compute the step for
+     * @return The step (rounded towards minus infinity)
+     */
+    SUMOTime getStep(SUMOTime time) const {
+        return time >= 0 ? time / myStepLength : -((myStepLength - 1 - time) / myStepLength);
+    }
+
+
+    /** @brief Stores the event in the time wheel or, if it lies beyond the wheel's horizon, in the heap
+     *
+     * Events which are already due are stored in the bucket of the current step.
+     * @param[in] event The event to store
+     */
+    void insertEvent(const Event& event);
+
+
+    /** @brief Executes the events of the given bucket which are due at the given time
+     *
+     * Events which lie beyond the given time + step length stay in the bucket.
+     * @param[in] bucket The bucket to process
+     * @param[in] execTime The current simulation time
+     * @exception ProcessError From an executed Command
+     */
+    void executeBucket(Bucket& bucket, SUMOTime execTime);
+
+
 private:
     /// @brief invalid copy constructor.
     MSEventControl(const MSEventControl&);
@@ -45,6 +45,7 @@
 #include <utils/common/ToString.h>
 #include <utils/geom/GeoConvHelper.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/OutputDevice_AsyncFile.h>
 #include <microsim/MSJunction.h>
 #include <microsim/MSRoute.h>
 #include <microsim/MSNet.h>
@@ -101,12 +102,10 @@ MSFrame::fillOptions() {
     oc.addSynonyme("weight-attribute", "measure", true);
     oc.addDescription("weight-attribute", "Input", "Name of the xml attribute which gives the edge weight");
 
-#ifdef HAVE_INTERNAL
-    oc.doRegister("load-state", new Option_FileName());//!!! check, describe
+    oc.doRegister("load-state", new Option_FileName());
     oc.addDescription("load-state", "Input", "Loads a network state from FILE");
-    oc.doRegister("load-state.offset", new Option_String("0", "TIME"));//!!! check, describe
-    oc.addDescription("load-state.offset", "Input", "Sets the time offset for vehicle segment exit times.");
-#endif
+    oc.doRegister("load-state.offset", new Option_String("0", "TIME"));
+    oc.addDescription("load-state.offset", "Input", "Sets the time offset for the absolute times (departures, stops, segment exit times) stored in the state");
 
     //  register output options
     oc.doRegister("netstate-dump", new Option_FileName());
@@ -125,6 +124,8 @@ MSFrame::fillOptions() {
     oc.addDescription("fcd-output", "Output", "Save the Floating Car Data");
     oc.doRegister("fcd-output.geo", new Option_Bool(false));
     oc.addDescription("fcd-output.geo", "Output", "Save the Floating Car Data using geo-coordinates (lon/lat)");
+    oc.doRegister("fcd-output.format", new Option_String("xml"));
+    oc.addDescription("fcd-output.format", "Output", "Save the Floating Car Data as 'xml' or 'columnar' (binary blocks per time step)");
     oc.doRegister("full-output", new Option_FileName());
     oc.addDescription("full-output", "Output", "Save a lot of information for each timestep (very redundant)");
     oc.doRegister("queue-output", new Option_FileName());
@@ -162,16 +163,23 @@ MSFrame::fillOptions() {
     oc.doRegister("vehroute-output.write-unfinished", new Option_Bool(false));
     oc.addDescription("vehroute-output.write-unfinished", "Output", "Write vehroute output for vehicles which have not arrived at simulation end");
 
+    oc.doRegister("output.async", new Option_Bool(false));
+    oc.addDescription("output.async", "Output", "Write the output files in a background thread");
 
+    oc.doRegister("output.async.buffer", new Option_Integer(1024));
+    oc.addDescription("output.async.buffer", "Output", "The size in kB of the buffers handed over to the background thread");
 
-#ifdef HAVE_INTERNAL
-    oc.doRegister("save-state.times", new Option_IntVector(IntVector()));//!!! check, describe
+    oc.doRegister("output.async.memory", new Option_Integer(64));
+    oc.addDescription("output.async.memory", "Output", "The maximum size in MB of the output waiting to be written");
+
+
+
+    oc.doRegister("save-state.times", new Option_IntVector(IntVector()));
     oc.addDescription("save-state.times", "Output", "Use INT[] as times at which a network state written");
-    oc.doRegister("save-state.prefix", new Option_FileName("state"));//!!! check, describe
+    oc.doRegister("save-state.prefix", new Option_FileName("state"));
     oc.addDescription("save-state.prefix", "Output", "Prefix for network states");
-    oc.doRegister("save-state.files", new Option_FileName());//!!! check, describe
+    oc.doRegister("save-state.files", new Option_FileName());
     oc.addDescription("save-state.files", "Output", "Files for network states");
-#endif
 
     // register the simulation settings
     oc.doRegister("begin", 'b', new Option_String("0", "TIME"));
@@ -226,12 +234,34 @@ MSFrame::fillOptions() {
 
     oc.doRegister("routing-algorithm", new Option_String("dijkstra"));
     oc.addDescription("routing-algorithm", "Processing",
-                      "Select among routing algorithms ['dijkstra', 'astar']");
+                      "Select among routing algorithms ['dijkstra', 'astar', 'CH', 'CHWrapper']");
+
+    oc.doRegister("astar.landmarks", new Option_Integer(0));
+    oc.addDescription("astar.landmarks", "Processing", "Use INT landmarks for the lower bounds of the 'astar' routing algorithm of the rerouting devices");
+
+    oc.doRegister("astar.landmark-distances", new Option_FileName());
+    oc.addDescription("astar.landmark-distances", "Processing", "Load the landmark distances for the 'astar' routing algorithm from FILE");
+
+    oc.doRegister("astar.save-landmark-distances", new Option_FileName());
+    oc.addDescription("astar.save-landmark-distances", "Processing", "Save the computed landmark distances to FILE");
 
     oc.doRegister("routeDist.maxsize", new Option_Integer());
     oc.addDescription("routeDist.maxsize", "Processing",
                       "Restrict the maximum size of route distributions");
 
+    oc.doRegister("threads", new Option_Integer(1));
+    oc.addDescription("threads", "Processing", "Defines the number of threads to use for the parallel lane update");
+
+    oc.doRegister("lanechange.parallel", new Option_Bool(false));
+    oc.addDescription("lanechange.parallel", "Processing", "Whether the lane changes of different edges shall be computed in parallel (needs threads > 1)");
+
+    oc.doRegister("meandata.parallel", new Option_Bool(false));
+    oc.addDescription("meandata.parallel", "Processing", "Whether the edges of the edge and lane data outputs shall be aggregated and written in parallel (needs threads > 1)");
+
+    oc.doRegister("thread-rngs", new Option_Integer(64));
+    oc.addDescription("thread-rngs", "Processing",
+                      "Number of random number generators to use for the parallel lane update (threads > 1), the results depend on this number but not on the number of threads");
+
     // devices
     MSDevice_Routing::insertOptions();
     MSDevice_HBEFA::insertOptions();
@@ -308,13 +338,28 @@ MSFrame::fillOptions() {
 
 void
 MSFrame::buildStreams() {
+    const OptionsCont& oc = OptionsCont::getOptions();
+#ifdef HAVE_FOX
+    // all files opened from now on are written by the background thread
+    if (oc.getBool("output.async")) {
+        OutputDevice_AsyncFile::enable((size_t) oc.getInt("output.async.buffer") << 10, (size_t) oc.getInt("output.async.memory") << 20);
+    } else {
+        OutputDevice::setFileDeviceBuilder(0);
+    }
+#endif
     // standard outputs
     OutputDevice::createDeviceByOption("netstate-dump", "sumo-netstate");
     OutputDevice::createDeviceByOption("summary-output", "summary");
     OutputDevice::createDeviceByOption("tripinfo-output", "tripinfos");
 
     //extended
-    OutputDevice::createDeviceByOption("fcd-output", "fcd-export");
+    if (oc.getString("fcd-output.format") == "columnar") {
+        if (oc.isSet("fcd-output")) {
+            OutputDevice::getDevice(oc.getString("fcd-output"), "", true);
+        }
+    } else {
+        OutputDevice::createDeviceByOption("fcd-output", "fcd-export");
+    }
     OutputDevice::createDeviceByOption("emission-output", "emission-export");
     OutputDevice::createDeviceByOption("full-output", "full-export");
     OutputDevice::createDeviceByOption("queue-output", "queue-export");
@@ -358,6 +403,48 @@ MSFrame::checkOptions() {
         WRITE_ERROR("routeDist.maxsize must be positive");
         ok = false;
     }
+    if (oc.getInt("threads") < 1) {
+        WRITE_ERROR("The number of threads must be positive.");
+        ok = false;
+    }
+#ifndef HAVE_FOX
+    if (oc.getInt("threads") > 1) {
+        WRITE_WARNING("Parallel simulation is only possible when compiled with FOX, running single threaded.");
+    }
+#endif
+    if (oc.getInt("device.rerouting.cache.memory") < 0) {
+        WRITE_ERROR("The memory of the route cache must not be negative.");
+        ok = false;
+    }
+    if (oc.getInt("device.rerouting.threads") < 0) {
+        WRITE_ERROR("The number of rerouting threads must not be negative.");
+        ok = false;
+    }
+#ifndef HAVE_FOX
+    if (oc.getInt("device.rerouting.threads") > 0) {
+        WRITE_WARNING("Background rerouting is only possible when compiled with FOX, rerouting immediately.");
+    }
+#endif
+    if (oc.getInt("output.async.buffer") < 1 || oc.getInt("output.async.memory") < 1) {
+        WRITE_ERROR("The buffer and memory sizes for asynchronous output must be positive.");
+        ok = false;
+    }
+#ifndef HAVE_FOX
+    if (oc.getBool("output.async")) {
+        WRITE_WARNING("Asynchronous output is only possible when compiled with FOX, writing directly.");
+    }
+#endif
+    if (oc.getString("fcd-output.format") != "xml" && oc.getString("fcd-output.format") != "columnar") {
+        WRITE_ERROR("Unknown fcd output format '" + oc.getString("fcd-output.format") + "'.");
+        ok = false;
+    }
+    if (oc.getBool("lanechange.parallel") && oc.getBool("lanechange.allow-swap")) {
+        WRITE_WARNING("Swapping vehicles is not possible with parallel lane changing, computing lane changes sequentially.");
+    }
+    if (oc.getInt("thread-rngs") < 1) {
+        WRITE_ERROR("The number of random number generators for the lane update must be positive.");
+        ok = false;
+    }
 #ifdef HAVE_INTERNAL
     if (oc.getBool("meso-junction-control.limited") && !oc.getBool("meso-junction-control")) {
         oc.set("meso-junction-control", "true");
@@ -382,8 +469,17 @@ MSFrame::setMSGlobals(OptionsCont& oc) {
     MSGlobals::gTimeToGridlock = string2time(oc.getString("time-to-teleport")) < 0 ? 0 : string2time(oc.getString("time-to-teleport"));
     MSGlobals::gCheck4Accidents = !oc.getBool("ignore-accidents");
     MSGlobals::gCheckRoutes = !oc.getBool("ignore-route-errors");
-#ifdef HAVE_INTERNAL
+#ifdef HAVE_FOX
+    MSGlobals::gNumSimThreads = oc.getInt("threads");
+    MSGlobals::gParallelLaneChange = oc.getBool("lanechange.parallel") && !oc.getBool("lanechange.allow-swap");
+    MSGlobals::gParallelMeanData = oc.getBool("meandata.parallel");
+#else
+    MSGlobals::gNumSimThreads = 1;
+    MSGlobals::gParallelLaneChange = false;
+    MSGlobals::gParallelMeanData = false;
+#endif
     MSGlobals::gStateLoaded = oc.isSet("load-state");
+#ifdef HAVE_INTERNAL
     MSGlobals::gUseMesoSim = oc.getBool("mesosim");
     MSGlobals::gMesoLimitedJunctionControl = oc.getBool("meso-junction-control.limited");
     if (MSGlobals::gUseMesoSim) {
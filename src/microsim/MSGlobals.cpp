@@ -49,8 +49,13 @@ bool MSGlobals::gCheck4Accidents;
 
 bool MSGlobals::gCheckRoutes;
 
-#ifdef HAVE_INTERNAL
+int MSGlobals::gNumSimThreads;
+bool MSGlobals::gParallelLaneChange;
+bool MSGlobals::gParallelMeanData;
+
 bool MSGlobals::gStateLoaded;
+
+#ifdef HAVE_INTERNAL
 bool MSGlobals::gUseMesoSim;
 bool MSGlobals::gMesoLimitedJunctionControl;
 MELoop* MSGlobals::gMesoNet;
@@ -72,10 +72,19 @@ public:
     /** information whether the routes shall be checked for connectivity */
     static bool gCheckRoutes;
 
-#ifdef HAVE_INTERNAL
+    /// @brief The number of threads to use for the parallel parts of the simulation step
+    static int gNumSimThreads;
+
+    /// @brief Whether the lane changes of different edges shall be computed in parallel
+    static bool gParallelLaneChange;
+
+    /// @brief Whether the edges of the mean data outputs shall be written in parallel
+    static bool gParallelMeanData;
+
     /// Information whether a state has been loaded
     static bool gStateLoaded;
 
+#ifdef HAVE_INTERNAL
     /** Information whether mesosim shall be used */
     static bool gUseMesoSim;
 
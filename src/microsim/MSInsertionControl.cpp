@@ -39,6 +39,7 @@
 #include "MSVehicle.h"
 #include "MSLane.h"
 #include "MSEdge.h"
+#include "MSGlobals.h"
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -51,7 +52,7 @@
 MSInsertionControl::MSInsertionControl(MSVehicleControl& vc,
                                        SUMOTime maxDepartDelay,
                                        bool checkEdgesOnce)
-    : myVehicleControl(vc), myMaxDepartDelay(maxDepartDelay),
+    : myVehicleControl(vc), myWaitingVehicleNo(0), myMaxDepartDelay(maxDepartDelay),
       myCheckEdgesOnce(checkEdgesOnce) {}
 
 
@@ -101,38 +102,30 @@ unsigned int
 MSInsertionControl::emitVehicles(SUMOTime time) {
     checkPrevious(time);
     // check whether any vehicles shall be emitted within this time step
-    if (!myAllVeh.anyWaitingFor(time) && myRefusedEmits1.empty() && myRefusedEmits2.empty() && myFlows.empty()) {
+    if (!myAllVeh.anyWaitingFor(time) && myWaitingVehicleNo == 0 && myFlows.empty()) {
         return 0;
     }
     unsigned int noEmitted = 0;
-    // we use buffering for the refused emits to save time
-    //  for this, we have two lists; one contains previously refused emits, the second
-    //  will be used to append those vehicles that will not be able to depart in this
-    //  time step
-    assert(myRefusedEmits1.size() == 0 || myRefusedEmits2.size() == 0);
-    MSVehicleContainer::VehicleVector& refusedEmits =
-        myRefusedEmits1.size() == 0 ? myRefusedEmits1 : myRefusedEmits2;
-    MSVehicleContainer::VehicleVector& previousRefused =
-        myRefusedEmits2.size() == 0 ? myRefusedEmits1 : myRefusedEmits2;
-
-    // go through the list of previously refused vehicles, first
-    MSVehicleContainer::VehicleVector::const_iterator veh;
-    for (veh = previousRefused.begin(); veh != previousRefused.end(); veh++) {
-        noEmitted += tryInsert(time, *veh, refusedEmits);
+    // go through the queues of previously refused vehicles, first
+    for (DepartQueueMap::iterator i = myDepartQueues.begin(); i != myDepartQueues.end();) {
+        noEmitted += processQueue(time, i->second);
+        if (i->second.empty()) {
+            myDepartQueues.erase(i++);
+        } else {
+            ++i;
+        }
     }
-    // clear previously refused vehicle container
-    previousRefused.clear();
 
     // Insert vehicles from myTrips into the net until the next vehicle's
     //  departure time is greater than the current time.
     // Retrieve the list of vehicles to emit within this time step
 
-    noEmitted += checkFlows(time, refusedEmits);
+    noEmitted += checkFlows(time);
     while (myAllVeh.anyWaitingFor(time)) {
         const MSVehicleContainer::VehicleVector& next = myAllVeh.top();
         // go through the list and try to emit
-        for (veh = next.begin(); veh != next.end(); veh++) {
-            noEmitted += tryInsert(time, *veh, refusedEmits);
+        for (MSVehicleContainer::VehicleVector::const_iterator veh = next.begin(); veh != next.end(); veh++) {
+            noEmitted += tryInsert(time, *veh);
         }
         // let the MSVehicleContainer clear the vehicles
         myAllVeh.pop();
@@ -143,21 +136,119 @@ MSInsertionControl::emitVehicles(SUMOTime time) {
 
 
 unsigned int
-MSInsertionControl::tryInsert(SUMOTime time, SUMOVehicle* veh,
-                              MSVehicleContainer::VehicleVector& refusedEmits) {
+MSInsertionControl::tryInsert(SUMOTime time, SUMOVehicle* veh) {
     assert(veh->getParameter().depart < time + DELTA_T);
+    DepartQueueMap::const_iterator i = myDepartQueues.find(getQueueKey(veh));
+    if (i != myDepartQueues.end() && !i->second.empty()) {
+        // vehicles which departed earlier wait at the same place; keep their order
+        veh->getEdge()->setLastFailedInsertionTime(time);
+        if (!removeRefused(time, veh)) {
+            enqueue(veh);
+        }
+        return 0;
+    }
+    if (insertIntoEdge(time, veh)) {
+        return 1;
+    }
+    if (!removeRefused(time, veh)) {
+        // let the vehicle wait one step, we'll retry then
+        enqueue(veh);
+    }
+    return 0;
+}
+
+
+unsigned int
+MSInsertionControl::processQueue(SUMOTime time, DepartQueue& queue) {
+    unsigned int noEmitted = 0;
+    while (!queue.empty()) {
+        SUMOVehicle* veh = queue.front();
+        if (insertIntoEdge(time, veh)) {
+            noEmitted++;
+        } else if (!removeRefused(time, veh)) {
+            // the first vehicle waits; so do the ones behind it
+            break;
+        }
+        queue.pop_front();
+        myWaitingVehicleNo--;
+    }
+    if (queue.size() > 1) {
+        // the vehicles behind the first one are not tried, but removed if they shall not be inserted anymore
+        DepartQueue::iterator kept = queue.begin() + 1;
+        for (DepartQueue::iterator i = kept; i != queue.end(); ++i) {
+            if (removeRefused(time, *i)) {
+                myWaitingVehicleNo--;
+            } else {
+                *kept++ = *i;
+            }
+        }
+        queue.erase(kept, queue.end());
+    }
+    return noEmitted;
+}
+
+
+bool
+MSInsertionControl::insertIntoEdge(SUMOTime time, SUMOVehicle* veh) {
     const MSEdge& edge = *veh->getEdge();
-    if ((!myCheckEdgesOnce || edge.getLastFailedInsertionTime() != time) && edge.insertVehicle(*veh, time)) {
+    if ((!myCheckEdgesOnce || edge.getLastFailedInsertionTime() != time)
+            && !isInsertionBlocked(veh) && edge.insertVehicle(*veh, time)) {
         // Successful emission.
         checkFlowWait(veh);
         veh->onDepart();
-        return 1;
+        return true;
     }
+    edge.setLastFailedInsertionTime(time);
+    return false;
+}
+
+
+bool
+MSInsertionControl::isInsertionBlocked(const SUMOVehicle* veh) const {
+#ifdef HAVE_INTERNAL
+    if (MSGlobals::gUseMesoSim) {
+        return false;
+    }
+#endif
+    const SUMOVehicleParameter& pars = veh->getParameter();
+    if ((pars.departPosProcedure != DEPART_POS_BASE && pars.departPosProcedure != DEPART_POS_DEFAULT)
+            || pars.departSpeedProcedure == DEPART_SPEED_GIVEN) {
+        return false;
+    }
+    const std::vector<MSLane*>& lanes = veh->getEdge()->getLanes();
+    std::vector<MSLane*>::const_iterator begin = lanes.begin();
+    std::vector<MSLane*>::const_iterator end = lanes.end();
+    if (pars.departLaneProcedure == DEPART_LANE_GIVEN) {
+        if (pars.departLane < 0 || pars.departLane >= (int) lanes.size()) {
+            return false;
+        }
+        begin += pars.departLane;
+        end = begin + 1;
+    } else if (pars.departLaneProcedure == DEPART_LANE_DEFAULT) {
+        end = begin + 1;
+    }
+    const MSVehicleType& type = veh->getVehicleType();
+    for (std::vector<MSLane*>::const_iterator i = begin; i != end; ++i) {
+        // the insertion position as computed by MSLane::insertVehicle
+        const SUMOReal pos = MIN2(static_cast<SUMOReal>(type.getLength() + POSITION_EPS), (*i)->getLength());
+        const MSVehicle* const last = (*i)->getLastVehicle();
+        // the last vehicle is the leader and does not leave the minimum gap
+        if (last == 0 || last->getPositionOnLane() < pos
+                || last->getPositionOnLane() - last->getVehicleType().getLength() >= pos + type.getMinGap()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+bool
+MSInsertionControl::removeRefused(SUMOTime time, SUMOVehicle* veh) {
     if (myMaxDepartDelay >= 0 && time - veh->getParameter().depart > myMaxDepartDelay) {
         // remove vehicles waiting too long for departure
         checkFlowWait(veh);
         myVehicleControl.deleteVehicle(veh, true);
-    } else if (edge.isVaporizing()) {
+    } else if (veh->getEdge()->isVaporizing()) {
         // remove vehicles if the edge shall be empty
         checkFlowWait(veh);
         myVehicleControl.deleteVehicle(veh, true);
@@ -167,11 +258,35 @@ MSInsertionControl::tryInsert(SUMOTime time, SUMOVehicle* veh,
         checkFlowWait(veh);
         myVehicleControl.deleteVehicle(veh, true);
     } else {
-        // let the vehicle wait one step, we'll retry then
-        refusedEmits.push_back(veh);
+        return false;
     }
-    edge.setLastFailedInsertionTime(time);
-    return 0;
+    return true;
+}
+
+
+void
+MSInsertionControl::enqueue(SUMOVehicle* veh) {
+    DepartQueue& queue = myDepartQueues[getQueueKey(veh)];
+    const SUMOTime depart = veh->getParameter().depart;
+    if (queue.empty() || queue.back()->getParameter().depart <= depart) {
+        queue.push_back(veh);
+    } else {
+        // a vehicle which should have departed earlier (e.g. loaded late)
+        DepartQueue::iterator i = queue.end();
+        while (i != queue.begin() && (*(i - 1))->getParameter().depart > depart) {
+            --i;
+        }
+        queue.insert(i, veh);
+    }
+    myWaitingVehicleNo++;
+}
+
+
+MSInsertionControl::DepartQueueKey
+MSInsertionControl::getQueueKey(const SUMOVehicle* veh) {
+    const SUMOVehicleParameter& pars = veh->getParameter();
+    return DepartQueueKey(veh->getEdge()->getNumericalID(),
+                          pars.departLaneProcedure == DEPART_LANE_GIVEN ? pars.departLane : -1);
 }
 
 
@@ -188,20 +303,18 @@ MSInsertionControl::checkFlowWait(SUMOVehicle* veh) {
 
 void
 MSInsertionControl::checkPrevious(SUMOTime time) {
-    // check to which list append to
-    MSVehicleContainer::VehicleVector& previousRefused =
-        myRefusedEmits2.size() == 0 ? myRefusedEmits1 : myRefusedEmits2;
     while (!myAllVeh.isEmpty() && myAllVeh.topTime() < time) {
         const MSVehicleContainer::VehicleVector& top = myAllVeh.top();
-        copy(top.begin(), top.end(), back_inserter(previousRefused));
+        for (MSVehicleContainer::VehicleVector::const_iterator i = top.begin(); i != top.end(); ++i) {
+            enqueue(*i);
+        }
         myAllVeh.pop();
     }
 }
 
 
 unsigned int
-MSInsertionControl::checkFlows(SUMOTime time,
-                               MSVehicleContainer::VehicleVector& refusedEmits) {
+MSInsertionControl::checkFlows(SUMOTime time) {
     MSVehicleControl& vehControl = MSNet::getInstance()->getVehicleControl();
     unsigned int noEmitted = 0;
     for (std::vector<Flow>::iterator i = myFlows.begin(); i != myFlows.end();) {
@@ -223,7 +336,7 @@ MSInsertionControl::checkFlows(SUMOTime time,
                 i->vehicle = vehControl.buildVehicle(newPars, route, vtype);
                 if (vehControl.isInQuota()) {
                     vehControl.addVehicle(newPars->id, i->vehicle);
-                    noEmitted += tryInsert(time, i->vehicle, refusedEmits);
+                    noEmitted += tryInsert(time, i->vehicle);
                     if (!i->isVolatile && i->vehicle != 0) {
                         break;
                     }
@@ -233,11 +346,9 @@ MSInsertionControl::checkFlows(SUMOTime time,
                 }
             } else {
                 // strange: another vehicle with the same id already exists
-#ifdef HAVE_INTERNAL
                 if (MSGlobals::gStateLoaded) {
                     break;
                 }
-#endif
                 throw ProcessError("Another vehicle with the id '" + newPars->id + "' exists.");
             }
         }
@@ -254,7 +365,7 @@ MSInsertionControl::checkFlows(SUMOTime time,
 
 unsigned int
 MSInsertionControl::getWaitingVehicleNo() const {
-    return (unsigned int)(myRefusedEmits1.size() + myRefusedEmits2.size());
+    return myWaitingVehicleNo;
 }
 
 
@@ -34,7 +34,9 @@
 
 #include "MSVehicleContainer.h"
 #include <vector>
+#include <deque>
 #include <map>
+#include <set>
 #include <string>
 
 
@@ -43,6 +45,7 @@
 // ===========================================================================
 class MSVehicle;
 class MSVehicleControl;
+class MSLane;
 
 
 // ===========================================================================
@@ -57,6 +60,13 @@ class MSVehicleControl;
  *  network as soon this time is reached and keeps them as long the insertion
  *  fails.
  *
+ * Vehicles which could not be inserted are kept in queues, one per departure
+ *  edge (and departure lane, if given), sorted by their departure time. Within
+ *  a step, the vehicles of a queue are tried in order until the first one is
+ *  refused. A queue is not tried at all as long as its first vehicle could
+ *  not be placed because the departure lane's last vehicle still occupies
+ *  the insertion position; it wakes up once that vehicle has moved far enough.
+ *
  * If a vehicle is emitted, the control about it is given to the lanes.
  *
  * Vehicles are not controlled (created, deleted) by this class.
@@ -85,9 +95,10 @@ public:
      *  wait for being emitted due they could not be inserted in previous
      *  steps.
      *
-     * For each vehicle, tryInsert is called. If this fails, a vehicle
-     *  keeps within the refused emit containers ("myRefusedEmits1",
-     *  "myRefusedEmits2") so that it may be emitted within the next steps.
+     * The queues of previously refused vehicles are processed first, then
+     *  the new vehicles are tried using tryInsert. If a vehicle is refused, it
+     *  is kept in the queue of its departure edge so that it may be emitted
+     *  within the next steps.
      *
      * Returns the number of vehicles that could be inserted into the net.
      *
@@ -115,8 +126,7 @@ public:
 
     /** @brief Returns the number of waiting vehicles
      *
-     * The sizes of refused emits (sum of vehicles in "myRefusedEmits1" and
-     *  "myRefusedEmits2") is returned.
+     * The number of vehicles within the departure queues is returned.
      *
      * @return The number of vehicles that could not (yet) be inserted into the net
      */
@@ -135,22 +145,98 @@ public:
 
 
 private:
+    /** @brief Key of a departure queue: the numerical id of the edge and the given departure lane (-1 if not given)
+     *
+     * The numerical id is used instead of the edge's pointer so that the queues
+     *  are processed in a reproducible order.
+     */
+    typedef std::pair<int, int> DepartQueueKey;
+
+    /// @brief Vehicles waiting for insertion at the same place, sorted by their departure time
+    typedef std::deque<SUMOVehicle*> DepartQueue;
+
+    /// @brief Definition of the container of the departure queues
+    typedef std::map<DepartQueueKey, DepartQueue> DepartQueueMap;
+
+
     /** @brief Tries to emit the vehicle
      *
-     * If the insertion fails, it is examined whether the reason was a vaporizing
-     *  edge. If so, the vehicle is deleted. Otherwise, it is checked whether the
-     *  time the vehicle had to wait so far is larger than the maximum allowed
-     *  waiting time. If so, the vehicle is deleted, too. If both does not match,
-     *  the vehicle is reinserted to "refusedEmits" in order to be emitted in
-     *  next steps.
+     * The vehicle is not tried if other vehicles wait within its departure
+     *  queue. If the insertion fails, handleRefused is called.
      *
      * @param[in] time The current simulation time
      * @param[in] veh The vehicle to emit
-     * @param[in] refusedEmits Container to insert vehicles that could not be emitted into
      * @return The number of emitted vehicles (0 or 1)
      */
-    unsigned int tryInsert(SUMOTime time, SUMOVehicle* veh,
-                           MSVehicleContainer::VehicleVector& refusedEmits);
+    unsigned int tryInsert(SUMOTime time, SUMOVehicle* veh);
+
+
+    /** @brief Tries to emit the vehicles of the given departure queue
+     *
+     * The vehicles are tried in their order until the first one is refused.
+     *  Refused vehicles which shall not be inserted anymore are removed and
+     *  the next one is tried. The vehicles behind a refused one are not tried,
+     *  but all of them which shall not be inserted anymore (see removeRefused)
+     *  are removed as well.
+     *
+     * @param[in] time The current simulation time
+     * @param[in] queue The queue to process
+     * @return The number of emitted vehicles
+     */
+    unsigned int processQueue(SUMOTime time, DepartQueue& queue);
+
+
+    /** @brief Tries to insert the vehicle into its departure edge
+     *
+     * The insertion is not tried if the edge already refused a vehicle in this
+     *  step and only one try is allowed (see myCheckEdgesOnce) or if
+     *  isInsertionBlocked tells that the vehicle does not fit.
+     *
+     * @param[in] time The current simulation time
+     * @param[in] veh The vehicle to insert
+     * @return Whether the vehicle was inserted
+     */
+    bool insertIntoEdge(SUMOTime time, SUMOVehicle* veh);
+
+
+    /** @brief Returns whether the vehicle can certainly not be inserted because its departure lanes are occupied
+     *
+     * This is the case if the last vehicle of each possible departure lane
+     *  still overlaps the space the vehicle would be inserted into (including
+     *  the minimum gap). Only the default departure position at the lane's
+     *  begin is regarded, and only if the departure speed is not given.
+     *
+     * @param[in] veh The vehicle to check
+     * @return Whether an insertion try would fail
+     */
+    bool isInsertionBlocked(const SUMOVehicle* veh) const;
+
+
+    /** @brief Removes the refused vehicle if it shall not be inserted anymore
+     *
+     * This is the case if the vehicle waits longer than the maximum departure
+     *  delay, its departure edge is vaporizing or its departure was descheduled.
+     *
+     * @param[in] time The current simulation time
+     * @param[in] veh The refused vehicle
+     * @return Whether the vehicle was removed (deleted)
+     */
+    bool removeRefused(SUMOTime time, SUMOVehicle* veh);
+
+
+    /** @brief Adds the vehicle to its departure queue, keeping the order of departure times
+     *
+     * @param[in] veh The vehicle to add
+     */
+    void enqueue(SUMOVehicle* veh);
+
+
+    /** @brief Returns the key of the vehicle's departure queue
+     *
+     * @param[in] veh The vehicle
+     * @return The key of the queue the vehicle waits in
+     */
+    static DepartQueueKey getQueueKey(const SUMOVehicle* veh);
 
 
     /** @brief Checks whether any flow is blocked due to this vehicle and clears the block
@@ -160,7 +246,7 @@ private:
     void checkFlowWait(SUMOVehicle* veh);
 
 
-    /** @brief Adds all vehicles that should have been emitted earlier to the refuse container
+    /** @brief Adds all vehicles that should have been emitted earlier to the departure queues
      *
      * @param[in] time The current simulation time
      * @todo recheck
@@ -171,11 +257,9 @@ private:
     /** @brief Checks for all vehicles coming from flows whether they can be emitted
      *
      * @param[in] time The current simulation time
-     * @param[in] refusedEmits Container to insert vehicles that could not be emitted into
      * @return The number of emitted vehicles
      */
-    unsigned int checkFlows(SUMOTime time,
-                            MSVehicleContainer::VehicleVector& refusedEmits);
+    unsigned int checkFlows(SUMOTime time);
 
 
 private:
@@ -185,8 +269,11 @@ private:
     /// @brief All loaded vehicles sorted by their departure time
     MSVehicleContainer myAllVeh;
 
-    /// @brief Buffers for vehicles that could not be inserted
-    MSVehicleContainer::VehicleVector myRefusedEmits1, myRefusedEmits2;
+    /// @brief Queues of vehicles that could not be inserted, by departure edge and lane
+    DepartQueueMap myDepartQueues;
+
+    /// @brief The number of vehicles within the departure queues
+    unsigned int myWaitingVehicleNo;
 
     /// @brief Set of vehicles which shall not be inserted anymore
     std::set<SUMOVehicle*> myAbortedEmits;
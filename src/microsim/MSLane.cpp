@@ -61,7 +61,10 @@
 #include <set>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/ToString.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/common/RandHelper.h>
 #include <utils/options/OptionsCont.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include <utils/common/HelpersHarmonoise.h>
 #include <utils/geom/Line.h>
 #include <utils/geom/GeomHelper.h>
@@ -75,6 +78,7 @@
 // static member definitions
 // ===========================================================================
 MSLane::DictType MSLane::myDict;
+std::vector<MTRand> MSLane::myRNGs;
 
 
 // ===========================================================================
@@ -89,7 +93,12 @@ MSLane::MSLane(const std::string& id, SUMOReal maxSpeed, SUMOReal length, MSEdge
     myPermissions(permissions),
     myLogicalPredecessorLane(0),
     myVehicleLengthSum(0), myInlappingVehicleEnd(10000), myInlappingVehicle(0),
-    myLengthGeometryFactor(myShape.length() / myLength) {}
+    myLengthGeometryFactor(myShape.length() / myLength),
+    myKinematicsOutdated(true), myKinematicsTypeChanges(0)
+#ifdef HAVE_FOX
+    , myPlanMoveTask(*this)
+#endif
+{}
 
 
 MSLane::~MSLane() {
@@ -128,6 +137,7 @@ MSLane::incorporateVehicle(MSVehicle* veh, SUMOReal pos, SUMOReal speed, const M
     } else {
         myVehicles.insert(at, veh);
     }
+    myKinematicsOutdated = true;
     myVehicleLengthSum += veh->getVehicleType().getLengthWithGap();
     if (wasInactive) {
         MSNet::getInstance()->getEdgeControl().gotActive(this);
@@ -657,27 +667,115 @@ MSLane::getLastVehicleInformation() const {
 
 
 // ------  ------
+void
+MSLane::planMovements(SUMOTime t) {
+    assert(myVehicles.size() != 0);
+    updateKinematics();
+    VehCont::iterator lastBeforeEnd = myVehicles.end() - 1;
+    VehCont::iterator veh;
+    size_t i = 0;
+    // Plan the movement of all vehicles beside the first
+    for (veh = myVehicles.begin(); veh != lastBeforeEnd; ++veh, ++i) {
+        VehCont::const_iterator pred(veh + 1);
+        (*veh)->planMove(t, this, *pred, 0, myKinematics.leaderGap[i], myKinematics.haveVSafe[i] ? &myKinematics.vSafe[i] : 0);
+    }
+    (*veh)->planMove(t, this, 0, 0, 0, 0);
+}
+
+
+void
+MSLane::updateKinematics() {
+    const size_t n = myVehicles.size();
+    VehicleKinematics& k = myKinematics;
+    if (myKinematicsOutdated || myKinematicsTypeChanges != MSVehicleType::getChangeCount()) {
+        // the vehicles on the lane or their types changed
+        k.vehicles.resize(n);
+        k.pos.resize(n);
+        k.speed.resize(n);
+        k.length.resize(n);
+        k.minGap.resize(n);
+        k.maxDecel.resize(n);
+        k.leaderGap.resize(n);
+        k.vSafe.resize(n);
+        k.haveVSafe.resize(n);
+        k.runBegins.clear();
+        size_t i = 0;
+        for (VehCont::const_iterator veh = myVehicles.begin(); veh != myVehicles.end(); ++veh, ++i) {
+            const MSVehicle* const v = *veh;
+            const MSVehicleType& type = v->getVehicleType();
+            k.vehicles[i] = v;
+            k.length[i] = type.getLength();
+            k.minGap[i] = type.getMinGap();
+            k.maxDecel[i] = type.getCarFollowModel().getMaxDecel();
+            // runs of vehicles sharing the same model (the first vehicle has no leader)
+            if (i + 1 < n && (i == 0 || &type.getCarFollowModel() != &k.vehicles[i - 1]->getCarFollowModel())) {
+                k.runBegins.push_back(i);
+            }
+        }
+        k.runBegins.push_back(n > 0 ? n - 1 : 0);
+        myKinematicsOutdated = false;
+        myKinematicsTypeChanges = MSVehicleType::getChangeCount();
+    }
+    assert(k.vehicles.size() == n);
+    // positions and speeds change in every step
+    size_t i = 0;
+    for (VehCont::const_iterator veh = myVehicles.begin(); veh != myVehicles.end(); ++veh, ++i) {
+        assert(k.vehicles[i] == *veh);
+        k.pos[i] = (*veh)->getPositionOnLane();
+        k.speed[i] = (*veh)->getSpeed();
+    }
+    if (n < 2) {
+        return;
+    }
+    // gaps to the leaders (see MSVehicle::gap2pred)
+    for (i = 0; i < n - 1; ++i) {
+        SUMOReal gap = k.pos[i + 1] - k.length[i + 1] - k.pos[i] - k.minGap[i];
+        if (gap < 0 && gap > -1.0e-12) {
+            gap = 0;
+        }
+        k.leaderGap[i] = gap;
+    }
+    // safe speeds for each run of vehicles sharing the same model
+    for (size_t run = 0; run + 1 < k.runBegins.size(); ++run) {
+        const size_t begin = k.runBegins[run];
+        const size_t end = k.runBegins[run + 1];
+        const MSCFModel& cfModel = k.vehicles[begin]->getCarFollowModel();
+        const bool computed = cfModel.followSpeeds(&k.vehicles[begin], &k.speed[begin], &k.leaderGap[begin],
+                              &k.speed[begin + 1], &k.maxDecel[begin + 1], &k.vSafe[begin], end - begin);
+        for (i = begin; i < end; ++i) {
+            k.haveVSafe[i] = computed;
+        }
+    }
+}
+
+
 bool
-MSLane::moveCritical(SUMOTime t) {
+MSLane::moveCritical(SUMOTime /* t */) {
     myLeftVehLength = myVehicleLengthSum;
     assert(myVehicles.size() != 0);
-    std::vector<MSVehicle*> collisions;
     VehCont::iterator lastBeforeEnd = myVehicles.end() - 1;
     VehCont::iterator veh;
     // Move all next vehicles beside the first
     for (veh = myVehicles.begin(); veh != lastBeforeEnd; ++veh) {
         myLeftVehLength -= (*veh)->getVehicleType().getLengthWithGap();
-        VehCont::const_iterator pred(veh + 1);
-        (*veh)->move(t, this, *pred, 0, myLeftVehLength);
+        (*veh)->move(myLeftVehLength);
     }
     myLeftVehLength -= (*veh)->getVehicleType().getLengthWithGap();
-    (*veh)->move(t, this, 0, 0, myLeftVehLength);
+    (*veh)->move(myLeftVehLength);
     assert((*veh)->getPositionOnLane() <= myLength);
     assert((*veh)->getLane() == this);
     return myVehicles.size() == 0;
 }
 
 
+#ifdef HAVE_FOX
+void
+MSLane::PlanMoveTask::run(FXWorkerThread* /*context*/) {
+    myLane.planMovements(myTime);
+}
+#endif
+
+
 void
 MSLane::detectCollisions(SUMOTime timestep) {
     if (myVehicles.size() < 2) {
@@ -697,6 +795,7 @@ MSLane::detectCollisions(SUMOTime timestep) {
             myVehicleLengthSum -= vehV->getVehicleType().getLengthWithGap();
             MSVehicleTransfer::getInstance()->addVeh(timestep, vehV);
             veh = myVehicles.erase(veh); // remove current vehicle
+            myKinematicsOutdated = true;
             lastVeh = myVehicles.end() - 1;
             if (veh == myVehicles.end()) {
                 break;
@@ -767,6 +866,7 @@ MSLane::setCritical(SUMOTime t, std::vector<MSLane*>& into) {
         }
         myVehicleLengthSum -= length;
         i = myVehicles.erase(i);
+        myKinematicsOutdated = true;
     }
     if (myVehicles.size() > 0) {
         if (MSGlobals::gTimeToGridlock > 0
@@ -775,6 +875,7 @@ MSLane::setCritical(SUMOTime t, std::vector<MSLane*>& into) {
             MSVehicle* veh = *(myVehicles.end() - 1);
             myVehicleLengthSum -= veh->getVehicleType().getLengthWithGap();
             myVehicles.erase(myVehicles.end() - 1);
+            myKinematicsOutdated = true;
             WRITE_WARNING("Teleporting vehicle '" + veh->getID() + "'; waited too long, lane='" + getID() + "', time=" + time2string(MSNet::getInstance()->getCurrentTimeStep()) + ".");
             MSNet::getInstance()->getVehicleControl().registerTeleport();
             MSVehicleTransfer::getInstance()->addVeh(t, veh);
@@ -816,6 +917,57 @@ MSLane::clear() {
 }
 
 
+size_t
+MSLane::getRNGIndex() const {
+    return myRNGs.empty() ? 0 : (size_t)myEdge->getNumericalID() % myRNGs.size();
+}
+
+
+void
+MSLane::initRNGs(const OptionsCont& oc) {
+    myRNGs.clear();
+#ifdef HAVE_FOX
+    // a single thread keeps using the global generator like the serial lane update always did
+    const int numRNGs = oc.getInt("threads") > 1 ? oc.getInt("thread-rngs") : 0;
+#else
+    const int numRNGs = 0;
+#endif
+    const bool random = oc.getBool("random");
+    const unsigned long seed = oc.getInt("seed");
+    myRNGs.resize(numRNGs);
+    for (int i = 0; i < numRNGs; i++) {
+        if (random) {
+            myRNGs[i].seed();
+        } else {
+            myRNGs[i].seed(seed + i);
+        }
+    }
+}
+
+
+void
+MSLane::saveRNGStates(std::ostream& os) {
+    FileHelpers::writeUInt(os, (unsigned int) myRNGs.size());
+    for (std::vector<MTRand>::const_iterator i = myRNGs.begin(); i != myRNGs.end(); ++i) {
+        RandHelper::saveState(os, &(*i));
+    }
+}
+
+
+void
+MSLane::loadRNGStates(BinaryInputDevice& bis) {
+    unsigned int numRNGs;
+    bis >> numRNGs;
+    if (numRNGs != myRNGs.size()) {
+        WRITE_WARNING("The number of lane random number generators differs from the loaded state; the saved generator states are ignored.");
+    }
+    MTRand dummy(1);
+    for (unsigned int i = 0; i < numRNGs; i++) {
+        RandHelper::loadState(bis, i < myRNGs.size() && numRNGs == myRNGs.size() ? &myRNGs[i] : &dummy);
+    }
+}
+
+
 void
 MSLane::insertIDs(std::vector<std::string>& into) {
     for (DictType::iterator i = myDict.begin(); i != myDict.end(); ++i) {
@@ -842,6 +994,7 @@ MSLane::integrateNewVehicle(SUMOTime) {
         MSVehicle* veh = *i;
         myVehicles.push_front(veh);
         myVehicleLengthSum += veh->getVehicleType().getLengthWithGap();
+        myKinematicsOutdated = true;
     }
     myVehBuffer.clear();
     return wasInactive && myVehicles.size() != 0;
@@ -952,6 +1105,9 @@ MSLane::getLinkCont() const {
 
 void
 MSLane::swapAfterLaneChange(SUMOTime) {
+    if (myVehicles != myTmpVehicles) {
+        myKinematicsOutdated = true;
+    }
     myVehicles = myTmpVehicles;
     myTmpVehicles.clear();
 }
@@ -972,6 +1128,7 @@ MSLane::removeVehicle(MSVehicle* remVehicle) {
             remVehicle->leaveLane(MSMoveReminder::NOTIFICATION_ARRIVED);
             myVehicles.erase(it);
             myVehicleLengthSum -= remVehicle->getVehicleType().getLengthWithGap();
+            myKinematicsOutdated = true;
             break;
         }
     }
@@ -1338,6 +1495,32 @@ MSLane::getHarmonoise_NoiseEmissions() const {
 }
 
 
+void
+MSLane::saveState(std::ostream& os) const {
+    FileHelpers::writeUInt(os, (unsigned int) myVehicles.size());
+    for (VehCont::const_iterator i = myVehicles.begin(); i != myVehicles.end(); ++i) {
+        FileHelpers::writeString(os, (*i)->getID());
+    }
+}
+
+
+void
+MSLane::loadState(BinaryInputDevice& bis, MSVehicleControl& vc) {
+    unsigned int numVehicles;
+    bis >> numVehicles;
+    for (; numVehicles > 0; numVehicles--) {
+        std::string id;
+        bis >> id;
+        MSVehicle* v = dynamic_cast<MSVehicle*>(vc.getVehicle(id));
+        if (v == 0) {
+            throw ProcessError("Unknown vehicle '" + id + "' on lane '" + getID() + "' in the loaded state.");
+        }
+        // the vehicles were saved in the container's order (from the lane's begin to the junction), so appending keeps it
+        incorporateVehicle(v, v->getPositionOnLane(), v->getSpeed(), myVehicles.end(), MSMoveReminder::NOTIFICATION_LOAD_STATE);
+    }
+}
+
+
 bool
 MSLane::VehPosition::operator()(const MSVehicle* cmp, SUMOReal pos) const {
     return cmp->getPositionOnLane() >= pos;
@@ -44,8 +44,12 @@
 #include <utils/common/SUMOVehicleClass.h>
 #include <utils/common/SUMOVehicle.h>
 #include <utils/geom/PositionVector.h>
+#include <foreign/mersenne/MersenneTwister.h>
 #include "MSLinkCont.h"
 #include "MSMoveReminder.h"
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 
 // ===========================================================================
@@ -58,6 +62,9 @@ class MSLink;
 class GUILaneWrapper;
 class MSVehicleTransfer;
 class OutputDevice;
+class OptionsCont;
+class BinaryInputDevice;
+class MSVehicleControl;
 
 
 // ===========================================================================
@@ -376,6 +383,30 @@ public:
     /// @name Vehicle movement (longitudinal)
     /// @{
 
+    /** @brief Computes the movement plans of all vehicles on this lane
+     *
+     * Only the vehicles' own state is modified, the approached links are
+     *  informed in moveCritical. Therefore, this method may be called
+     *  concurrently for different lanes as long as lanes sharing a random
+     *  number generator are processed by the same thread.
+     *
+     * The gaps to the leaders on this lane and (where the car-following model
+     *  supports it) the resulting safe speeds are computed beforehand for all
+     *  vehicles using the structure of arrays in myKinematics.
+     *
+     * @param[in] t The current time step
+     * @see MSVehicle::planMove
+     */
+    void planMovements(SUMOTime t);
+
+    /** @brief Registers the planned movements of the vehicles at the approached links
+     *
+     * planMovements has to be called before.
+     *
+     * @param[in] t The current time step
+     * @return Whether the lane is empty
+     * @see MSVehicle::move
+     */
     virtual bool moveCritical(SUMOTime t);
 
     /** Moves the critical vehicles
@@ -441,6 +472,89 @@ public:
 
     static void insertIDs(std::vector<std::string>& into);
 
+    /** @brief Initialises the random number generators used for the parallel lane update
+     *
+     * The number of generators is given by the option "thread-rngs", each is
+     *  seeded with the global seed plus its index. If the lanes are updated by
+     *  a single thread, no generators are built and the vehicles use the
+     *  global one.
+     *
+     * @param[in] oc The options to read the seed and number of generators from
+     */
+    static void initRNGs(const OptionsCont& oc);
+
+    /** @brief Returns the random number generator of this lane
+     * @return The generator to use for vehicles on this lane (0 for the global one)
+     */
+    MTRand* getRNG() const {
+        return myRNGs.empty() ? 0 : &myRNGs[getRNGIndex()];
+    }
+
+    /** @brief Returns the index of this lane's random number generator
+     *
+     * All lanes of an edge share the same generator, so the vehicles keep
+     *  their generator when changing lanes and the edges may be processed
+     *  in parallel.
+     *
+     * @return The generator's index
+     */
+    size_t getRNGIndex() const;
+
+    /** @brief Saves the states of the lanes' random number generators
+     * @param[in] os The stream to write the states into (binary)
+     */
+    static void saveRNGStates(std::ostream& os);
+
+    /** @brief Restores the states of the lanes' random number generators
+     *
+     * If the number of generators differs from the saved one, the saved
+     *  states are skipped and a warning is given.
+     *
+     * @param[in] bis The input to read the states from (binary)
+     */
+    static void loadRNGStates(BinaryInputDevice& bis);
+
+#ifdef HAVE_FOX
+    /**
+     * @class PlanMoveTask
+     * @brief A task computing the movement plans of a lane's vehicles in a worker thread
+     */
+    class PlanMoveTask : public FXWorkerThread::Task {
+    public:
+        /// @brief Constructor
+        PlanMoveTask(MSLane& l) : myLane(l), myTime(0) {}
+
+        /// @brief Calls planMovements of the lane
+        void run(FXWorkerThread* context);
+
+        /// @brief Sets the time step to compute
+        void init(const SUMOTime t) {
+            myTime = t;
+        }
+
+    private:
+        /// @brief The lane to process
+        MSLane& myLane;
+
+        /// @brief The current time step
+        SUMOTime myTime;
+
+    private:
+        /// @brief Invalidated assignment operator.
+        PlanMoveTask& operator=(const PlanMoveTask&);
+
+    };
+
+    /** @brief Returns the task computing the movement plans of this lane
+     * @param[in] t The current time step
+     * @return The initialised task
+     */
+    PlanMoveTask* getPlanMoveTask(const SUMOTime t) {
+        myPlanMoveTask.init(t);
+        return &myPlanMoveTask;
+    }
+#endif
+
     /// Container for vehicles.
     typedef std::deque< MSVehicle* > VehCont;
 
@@ -617,6 +731,26 @@ public:
     /// @}
 
 
+    /// @name State saving/loading
+    /// @{
+
+    /** @brief Saves the ids of the vehicles on this lane (in lane order)
+     * @param[in] os The stream to write the information into (binary)
+     */
+    void saveState(std::ostream& os) const;
+
+    /** @brief Puts the already loaded vehicles with the given ids onto this lane
+     *
+     * The vehicles keep the position and speed they were loaded with.
+     *
+     * @param[in] bis The input to read the vehicle ids from (binary)
+     * @param[in] vc The vehicle control to retrieve the vehicles from
+     * @exception ProcessError If a vehicle is not known
+     */
+    void loadState(BinaryInputDevice& bis, MSVehicleControl& vc);
+    /// @}
+
+
 protected:
     /// moves myTmpVehicles int myVehicles after a lane change procedure
     virtual void swapAfterLaneChange(SUMOTime t);
@@ -707,6 +841,63 @@ protected:
     /// Static dictionary to associate string-ids with objects.
     static DictType myDict;
 
+    /// @brief The random number generators used during the lane update
+    static std::vector<MTRand> myRNGs;
+
+    /**
+     * @struct VehicleKinematics
+     * @brief The kinematic state of the lane's vehicles as a structure of arrays
+     *
+     * The entries are in the order of myVehicles (the vehicle nearest to the
+     *  lane's begin first), so the leader of entry i is entry i + 1.
+     */
+    struct VehicleKinematics {
+        /// @brief The vehicles
+        std::vector<const MSVehicle*> vehicles;
+        /// @brief The vehicles' positions on the lane
+        std::vector<SUMOReal> pos;
+        /// @brief The vehicles' speeds
+        std::vector<SUMOReal> speed;
+        /// @brief The vehicles' lengths
+        std::vector<SUMOReal> length;
+        /// @brief The vehicles' minimum gaps
+        std::vector<SUMOReal> minGap;
+        /// @brief The vehicles' maximum decelerations
+        std::vector<SUMOReal> maxDecel;
+        /// @brief The (netto) gaps to the leaders
+        std::vector<SUMOReal> leaderGap;
+        /// @brief The safe speeds regarding the leaders
+        std::vector<SUMOReal> vSafe;
+        /// @brief Whether the safe speed was computed
+        std::vector<char> haveVSafe;
+        /// @brief The first entries of the runs of vehicles sharing the same model, followed by the end of the last run
+        std::vector<size_t> runBegins;
+    };
+
+    /// @brief The kinematic state of this lane's vehicles, refreshed in planMovements
+    VehicleKinematics myKinematics;
+
+    /// @brief Whether the vehicles on the lane changed since myKinematics was built
+    bool myKinematicsOutdated;
+
+    /// @brief The count of vehicle type changes when myKinematics was built
+    unsigned int myKinematicsTypeChanges;
+
+    /** @brief Refreshes myKinematics from the vehicles
+     *
+     * The vehicles, their type values and the runs of vehicles sharing the
+     *  same model are only collected again if the vehicles on the lane or
+     *  any vehicle type changed. Afterwards the positions and speeds are
+     *  copied, the gaps to the leaders are computed and the car-following
+     *  models compute the safe speeds for each run.
+     */
+    void updateKinematics();
+
+#ifdef HAVE_FOX
+    /// @brief The task for computing the movement plans in parallel
+    PlanMoveTask myPlanMoveTask;
+#endif
+
 private:
     /// @brief This lane's move reminder
     std::vector< MSMoveReminder* > myMoveReminders;
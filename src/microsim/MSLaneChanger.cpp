@@ -59,7 +59,7 @@
 // member method definitions
 // ===========================================================================
 MSLaneChanger::MSLaneChanger(std::vector<MSLane*>* lanes, bool allowSwap)
-    : myAllowsSwap(allowSwap) {
+    : myAllowsSwap(allowSwap), myAmParallel(false) {
     assert(lanes->size() > 1);
 
     // Fill the changer with the lane-data.
@@ -96,6 +96,18 @@ MSLaneChanger::laneChange(SUMOTime t) {
 }
 
 
+void
+MSLaneChanger::computeChanges() {
+    myAmParallel = true;
+    initChanger();
+    while (vehInChanger()) {
+        bool haveChanged = change();
+        updateChanger(haveChanged);
+    }
+    myAmParallel = false;
+}
+
+
 void
 MSLaneChanger::initChanger() {
     // Prepare myChanger with a safe state.
@@ -163,10 +175,7 @@ MSLaneChanger::change() {
 #endif
             (myCandi - 1)->hoppedVeh = vehicle;
             (myCandi - 1)->lane->myTmpVehicles.push_front(vehicle);
-            vehicle->leaveLane(MSMoveReminder::NOTIFICATION_LANE_CHANGE);
-            myCandi->lane->leftByLaneChange(vehicle);
-            vehicle->enterLaneAtLaneChange((myCandi - 1)->lane);
-            (myCandi - 1)->lane->enteredByLaneChange(vehicle);
+            changedLane(vehicle, myCandi->lane, (myCandi - 1)->lane);
             vehicle->myLastLaneChangeOffset = 0;
             vehicle->getLaneChangeModel().changed();
             (myCandi - 1)->dens += (myCandi - 1)->hoppedVeh->getVehicleType().getLengthWithGap();
@@ -198,10 +207,7 @@ MSLaneChanger::change() {
 #endif
             (myCandi + 1)->hoppedVeh = veh(myCandi);
             (myCandi + 1)->lane->myTmpVehicles.push_front(veh(myCandi));
-            vehicle->leaveLane(MSMoveReminder::NOTIFICATION_LANE_CHANGE);
-            myCandi->lane->leftByLaneChange(vehicle);
-            vehicle->enterLaneAtLaneChange((myCandi + 1)->lane);
-            (myCandi + 1)->lane->enteredByLaneChange(vehicle);
+            changedLane(vehicle, myCandi->lane, (myCandi + 1)->lane);
             vehicle->myLastLaneChangeOffset = 0;
             vehicle->getLaneChangeModel().changed();
             (myCandi + 1)->dens += (myCandi + 1)->hoppedVeh->getVehicleType().getLengthWithGap();
@@ -433,6 +439,38 @@ MSLaneChanger::updateLanes(SUMOTime t) {
 
         ce->lane->swapAfterLaneChange(t);
     }
+    // apply what was kept back while computing in parallel
+    for (std::vector<DeferredChange>::iterator i = myDeferredChanges.begin(); i != myDeferredChanges.end(); ++i) {
+        moveVehicle((*i).vehicle, (*i).from, (*i).to);
+    }
+    myDeferredChanges.clear();
+    for (std::vector<MSAbstractLaneChangeModel::MSLCMessager::Message>::iterator i = myDeferredMessages.begin(); i != myDeferredMessages.end(); ++i) {
+        MSAbstractLaneChangeModel::MSLCMessager::deliver(*i);
+    }
+    myDeferredMessages.clear();
+}
+
+
+void
+MSLaneChanger::changedLane(MSVehicle* vehicle, MSLane* from, MSLane* to) {
+    if (!myAmParallel) {
+        moveVehicle(vehicle, from, to);
+    } else {
+        DeferredChange change;
+        change.vehicle = vehicle;
+        change.from = from;
+        change.to = to;
+        myDeferredChanges.push_back(change);
+    }
+}
+
+
+void
+MSLaneChanger::moveVehicle(MSVehicle* vehicle, MSLane* from, MSLane* to) {
+    vehicle->leaveLane(MSMoveReminder::NOTIFICATION_LANE_CHANGE);
+    from->leftByLaneChange(vehicle);
+    vehicle->enterLaneAtLaneChange(to);
+    to->enteredByLaneChange(vehicle);
 }
 
 
@@ -466,7 +504,7 @@ int
 MSLaneChanger::change2right(const std::pair<MSVehicle* const, SUMOReal>& leader,
                             const std::pair<MSVehicle* const, SUMOReal>& rLead,
                             const std::pair<MSVehicle* const, SUMOReal>& rFollow,
-                            const std::vector<MSVehicle::LaneQ>& preb) const {
+                            const std::vector<MSVehicle::LaneQ>& preb) {
     ChangerIt target = myCandi - 1;
     int blocked = overlapWithHopped(target)
                   ? target->hoppedVeh->getPositionOnLane() < veh(myCandi)->getPositionOnLane()
@@ -497,6 +535,9 @@ MSLaneChanger::change2right(const std::pair<MSVehicle* const, SUMOReal>& leader,
     }
 
     MSAbstractLaneChangeModel::MSLCMessager msg(leader.first, rLead.first, rFollow.first);
+    if (myAmParallel) {
+        msg.deferForeign(&myCandi->lane->getEdge(), &myDeferredMessages);
+    }
     return blocked | veh(myCandi)->getLaneChangeModel().wantsChangeToRight(
                msg, blocked, leader, rLead, rFollow, *(myCandi - 1)->lane, preb, &(myCandi->lastBlocked));
 }
@@ -506,7 +547,7 @@ int
 MSLaneChanger::change2left(const std::pair<MSVehicle* const, SUMOReal>& leader,
                            const std::pair<MSVehicle* const, SUMOReal>& rLead,
                            const std::pair<MSVehicle* const, SUMOReal>& rFollow,
-                           const std::vector<MSVehicle::LaneQ>& preb) const {
+                           const std::vector<MSVehicle::LaneQ>& preb) {
     ChangerIt target = myCandi + 1;
     int blocked = overlapWithHopped(target)
                   ? target->hoppedVeh->getPositionOnLane() < veh(myCandi)->getPositionOnLane()
@@ -535,6 +576,9 @@ MSLaneChanger::change2left(const std::pair<MSVehicle* const, SUMOReal>& leader,
         }
     }
     MSAbstractLaneChangeModel::MSLCMessager msg(leader.first, rLead.first, rFollow.first);
+    if (myAmParallel) {
+        msg.deferForeign(&myCandi->lane->getEdge(), &myDeferredMessages);
+    }
     return blocked | veh(myCandi)->getLaneChangeModel().wantsChangeToLeft(
                msg, blocked, leader, rLead, rFollow, *(myCandi + 1)->lane, preb, &(myCandi->lastBlocked));
 }
@@ -35,6 +35,7 @@
 #include "MSLane.h"
 #include "MSEdge.h"
 #include "MSVehicle.h"
+#include "MSAbstractLaneChangeModel.h"
 #include <vector>
 #include <utils/iodevices/OutputDevice.h>
 
@@ -43,7 +44,6 @@
 // class declarations
 // ===========================================================================
 
-
 // ===========================================================================
 // class definitions
 // ===========================================================================
@@ -62,6 +62,22 @@ public:
     /// Start lane-change-process for all vehicles on the edge'e lanes.
     void laneChange(SUMOTime t);
 
+    /** @brief Computes the lane changes of all vehicles on the edge's lanes without giving the results back to the lanes
+     *
+     * Used if several edges change lanes in parallel. Everything other edges
+     *  may see is kept back: the lanes' vehicle containers and length sums,
+     *  the lane the changing vehicles are on, their move reminder
+     *  notifications, the lanes they partially occupy and the messages to
+     *  vehicles on other edges. "updateLanes" applies all of it, so every
+     *  edge sees the state of the begin of the lane change phase.
+     */
+    void computeChanges();
+
+    /** During lane-change a temporary vehicle container is filled within
+        the lanes (bad pratice to modify foreign members, I know). Swap
+        this container with the real one. */
+    void updateLanes(SUMOTime t);
+
 public:
     /** Structure used for lane-change. For every lane you have to
         know four vehicles, the change-candidate veh and it's follower
@@ -130,11 +146,6 @@ protected:
     /** After the possible change, update the changer. */
     void updateChanger(bool vehHasChanged);
 
-    /** During lane-change a temporary vehicle container is filled within
-        the lanes (bad pratice to modify foreign members, I know). Swap
-        this container with the real one. */
-    void updateLanes(SUMOTime t);
-
     /** @brief Find current candidate.
         If there is none, myChanger.end() is returned. */
     ChangerIt findCandidate();
@@ -143,13 +154,13 @@ protected:
         const std::pair<MSVehicle* const, SUMOReal>& leader,
         const std::pair<MSVehicle* const, SUMOReal>& rLead,
         const std::pair<MSVehicle* const, SUMOReal>& rFollow,
-        const std::vector<MSVehicle::LaneQ>& preb) const;
+        const std::vector<MSVehicle::LaneQ>& preb);
 
     int change2left(
         const std::pair<MSVehicle* const, SUMOReal>& leader,
         const std::pair<MSVehicle* const, SUMOReal>& rLead,
         const std::pair<MSVehicle* const, SUMOReal>& rFollow,
-        const std::vector<MSVehicle::LaneQ>& preb) const;
+        const std::vector<MSVehicle::LaneQ>& preb);
 
 
 
@@ -171,6 +182,33 @@ protected:
 
     std::pair<MSVehicle* const, SUMOReal> getRealLeader(const ChangerIt& target) const;
 
+    /** @brief Moves the vehicle from one lane to the other, informing the lanes and the move reminders
+     *
+     * If the changes are computed in parallel, this is deferred to "updateLanes".
+     *
+     * @param[in] vehicle The vehicle which changed the lane
+     * @param[in] from The lane the vehicle left
+     * @param[in] to The lane the vehicle entered
+     */
+    void changedLane(MSVehicle* vehicle, MSLane* from, MSLane* to);
+
+    /// @brief Moves the vehicle from one lane to the other, informing the lanes and the move reminders
+    static void moveVehicle(MSVehicle* vehicle, MSLane* from, MSLane* to);
+
+protected:
+    /**
+     * @struct DeferredChange
+     * @brief A lane change the lanes are informed about after the parallel computation
+     */
+    struct DeferredChange {
+        /// @brief The vehicle which changed the lane
+        MSVehicle* vehicle;
+        /// @brief The lane the vehicle left
+        MSLane* from;
+        /// @brief The lane the vehicle entered
+        MSLane* to;
+    };
+
 protected:
     /// Container for ChangeElemements, one for every lane in the edge.
     Changer   myChanger;
@@ -183,6 +221,15 @@ protected:
     /// @brief Whether blocking vehicles may be swapped
     bool myAllowsSwap;
 
+    /// @brief Whether the changes are computed in parallel to the ones of other edges
+    bool myAmParallel;
+
+    /// @brief The lane changes computed in parallel which are not applied yet
+    std::vector<DeferredChange> myDeferredChanges;
+
+    /// @brief The messages to vehicles on other edges which are not delivered yet
+    std::vector<MSAbstractLaneChangeModel::MSLCMessager::Message> myDeferredMessages;
+
 private:
     /// Default constructor.
     MSLaneChanger();
@@ -99,6 +99,8 @@ public:
         NOTIFICATION_SEGMENT,
         /// @brief The vehicle changes lanes (micro only)
         NOTIFICATION_LANE_CHANGE,
+        /// @brief The vehicle was put onto its lane while loading a simulation state
+        NOTIFICATION_LOAD_STATE,
         /// @brief The vehicle is being teleported
         NOTIFICATION_TELEPORT,
         /// @brief The vehicle starts or ends parking
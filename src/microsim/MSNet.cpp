@@ -81,6 +81,7 @@
 #include "output/MSXMLRawOut.h"
 #include <utils/iodevices/OutputDevice.h>
 #include <utils/common/SysUtils.h>
+#include <utils/common/MemoryPool.h>
 #include <utils/common/WrappingCommand.h>
 #include <utils/options/OptionsCont.h>
 #include "MSGlobals.h"
@@ -88,6 +89,11 @@
 #include <ctime>
 #include "MSPerson.h"
 #include "MSEdgeWeightsStorage.h"
+#include "MSVehicleTransfer.h"
+#include <utils/common/FileHelpers.h>
+#include <utils/common/RandHelper.h>
+#include <utils/iodevices/BinaryInputDevice.h>
+#include <microsim/output/MSDetectorControl.h>
 
 
 #ifdef _MESSAGES
@@ -96,7 +102,6 @@
 
 #ifdef HAVE_INTERNAL
 #include <mesosim/MELoop.h>
-#include <utils/iodevices/BinaryInputDevice.h>
 #endif
 
 #ifndef NO_TRACI
@@ -165,7 +170,10 @@ MSNet::MSNet(MSVehicleControl* vc, MSEventControl* beginOfTimestepEvents,
     myRouterTTInitialized(false),
     myRouterTTDijkstra(0),
     myRouterTTAStar(0),
-    myRouterEffort(0) {
+    myRouterTTCH(0),
+    myRouterEffort(0),
+    myLandmarksInitialized(false),
+    myLandmarks(0) {
     if (myInstance != 0) {
         throw ProcessError("A network was already constructed.");
     }
@@ -225,6 +233,16 @@ MSNet::closeBuilding(MSEdgeControl* edges, MSJunctionControl* junctions,
 
 
 MSNet::~MSNet() {
+#ifdef HAVE_FOX
+    // let the last state be written completely
+    try {
+        myStateWriter.waitAll();
+    } catch (ProcessError& e) {
+        WRITE_ERROR(e.what());
+    }
+#endif
+    // no background rerouting may use the vehicles deleted below
+    MSDevice_Routing::cancelReroutes();
     // delete events first maybe they do some cleanup
     delete myBeginOfTimestepEvents;
     delete myEndOfTimestepEvents;
@@ -249,7 +267,9 @@ MSNet::~MSNet() {
     delete myEdgeWeights;
     delete myRouterTTDijkstra;
     delete myRouterTTAStar;
+    delete myRouterTTCH;
     delete myRouterEffort;
+    delete myLandmarks;
 #ifdef HAVE_INTERNAL
     if (MSGlobals::gUseMesoSim) {
         delete MSGlobals::gMesoNet;
@@ -306,6 +326,10 @@ MSNet::simulate(SUMOTime start, SUMOTime stop) {
 
 void
 MSNet::closeSimulation(SUMOTime start) {
+#ifdef HAVE_FOX
+    // report a failure of the last state written
+    myStateWriter.waitAll();
+#endif
     if (myLogExecutionTime) {
         long duration = SysUtils::getCurrentMillis() - mySimBeginMillis;
         std::ostringstream msg;
@@ -331,6 +355,23 @@ MSNet::closeSimulation(SUMOTime start) {
             << " Running: " << myVehicleControl->getRunningVehicleNo() << "\n"
             << " Waiting: " << myInserter->getWaitingVehicleNo() << "\n"
             << teleportNotice;
+        const MSDevice_Routing::MSRouteCache* const routeCache = MSDevice_Routing::getRouteCache();
+        if (routeCache != 0) {
+            msg << "Route cache: " << "\n"
+                << " Hits: " << routeCache->getHitNo() << "\n"
+                << " Misses: " << routeCache->getMissNo() << "\n"
+                << " Invalidated: " << routeCache->getInvalidatedNo() << ", evicted: " << routeCache->getEvictedNo() << "\n";
+        }
+        // report the reuse of memory by the pooled objects
+        const std::vector<MemoryPool*>& pools = MemoryPool::getPools();
+        for (std::vector<MemoryPool*>::const_iterator i = pools.begin(); i != pools.end(); ++i) {
+            if (i == pools.begin()) {
+                msg << "Memory pools: " << "\n";
+            }
+            msg << " " << (*i)->getName() << ": " << (*i)->getAllocationNo() << " allocated ("
+                << (*i)->getReuseNo() << " reused), max. " << (*i)->getMaxInUseNo() << " in use, "
+                << (*i)->getReservedBytes() / 1024 << " kB reserved" << "\n";
+        }
         WRITE_MESSAGE(msg.str());
     }
     myDetectorControl->close(myStep);
@@ -345,6 +386,8 @@ MSNet::closeSimulation(SUMOTime start) {
 
 void
 MSNet::simulationStep() {
+    // assign the routes computed in the background during the last step
+    MSDevice_Routing::applyPendingReroutes(myStep);
 #ifndef NO_TRACI
     traci::TraCIServer::processCommandsUntilSimStep(myStep);
 #endif
@@ -352,15 +395,12 @@ MSNet::simulationStep() {
     if (myLogExecutionTime) {
         mySimStepBegin = SysUtils::getCurrentMillis();
     }
-#ifdef HAVE_INTERNAL
-    // netstate output
+    // state output
     std::vector<SUMOTime>::iterator timeIt = find(myStateDumpTimes.begin(), myStateDumpTimes.end(), myStep);
     if (timeIt != myStateDumpTimes.end()) {
-        const int dist = distance(myStateDumpTimes.begin(), timeIt);
-        std::ofstream strm(myStateDumpFiles[dist].c_str(), std::fstream::out | std::fstream::binary);
-        saveState(strm);
+        const int dist = (int) distance(myStateDumpTimes.begin(), timeIt);
+        writeState(myStateDumpFiles[dist]);
     }
-#endif
     myBeginOfTimestepEvents->execute(myStep);
     if (MSGlobals::gCheck4Accidents) {
         myEdges->detectCollisions(myStep);
@@ -484,13 +524,15 @@ MSNet::getStateMessage(MSNet::SimulationState state) {
 
 void
 MSNet::clearAll() {
+    // release the cached routes before the routes are deleted
+    MSDevice_Routing::cleanup();
     // clear container
     MSEdge::clear();
     MSLane::clear();
     MSRoute::clear();
     delete MSVehicleTransfer::getInstance();
-    MSDevice_Routing::cleanup();
     MSTrigger::cleanup();
+    MSFCDExport::cleanup();
 }
 
 
@@ -512,7 +554,11 @@ MSNet::writeOutput() {
 
     // check fcd dumps
     if (OptionsCont::getOptions().isSet("fcd-output")) {
-        MSFCDExport::write(OutputDevice::getDeviceByOption("fcd-output"), myStep);
+        if (OptionsCont::getOptions().getString("fcd-output.format") == "columnar") {
+            MSFCDExport::writeColumnar(OutputDevice::getDeviceByOption("fcd-output"), myStep);
+        } else {
+            MSFCDExport::write(OutputDevice::getDeviceByOption("fcd-output"), myStep);
+        }
     }
 
     // check emission dumps
@@ -578,7 +624,6 @@ MSNet::logSimulationDuration() const {
 }
 
 
-#ifdef HAVE_INTERNAL
 void
 MSNet::saveState(std::ostream& os) {
     FileHelpers::writeString(os, VERSION_STRING);
@@ -588,9 +633,38 @@ MSNet::saveState(std::ostream& os) {
     FileHelpers::writeTime(os, myStep);
     MSRoute::dict_saveState(os);
     myVehicleControl->saveState(os);
+#ifdef HAVE_INTERNAL
     if (MSGlobals::gUseMesoSim) {
         MSGlobals::gMesoNet->saveState(os);
     }
+#endif
+    // the vehicles on the lanes, in the order given by the edge control
+    const std::vector<MSEdge*>& edges = myEdges->getEdges();
+    for (std::vector<MSEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+        const std::vector<MSLane*>& lanes = (*i)->getLanes();
+        for (std::vector<MSLane*>::const_iterator j = lanes.begin(); j != lanes.end(); ++j) {
+            (*j)->saveState(os);
+        }
+    }
+    MSVehicleTransfer::getInstance()->saveState(os);
+    myLogics->saveState(os, myStep);
+    myDetectorControl->saveState(os);
+    // the random number generators come last as loading the rest may use them
+    RandHelper::saveState(os);
+    RandHelper::saveState(os, &MSVehicleControl::myVehicleParamsRNG);
+    MSLane::saveRNGStates(os);
+}
+
+
+void
+MSNet::checkStateSaving() const {
+    if (myPersonControl != 0 && myPersonControl->hasPersons()) {
+        throw ProcessError("The state can not be saved as the state of persons is not saved.");
+    }
+    const std::string detector = myDetectorControl->getUnsavableDetectorID();
+    if (detector != "") {
+        throw ProcessError("The state can not be saved as the state of detector '" + detector + "' is not saved.");
+    }
 }
 
 
@@ -614,15 +688,114 @@ MSNet::loadState(BinaryInputDevice& bis) {
         WRITE_WARNING("State was written with a different precision for SUMOReal!");
     }
     if (numEdges != MSEdge::dictSize()) {
-        WRITE_WARNING("State was written for a different net!");
+        throw ProcessError("State was written for a different net!");
     }
-    const SUMOTime offset = string2time(OptionsCont::getOptions().getString("load-state.offset"));
     MSRoute::dict_loadState(bis);
+    return step;
+}
+
+
+void
+MSNet::loadDynamicState(BinaryInputDevice& bis, SUMOTime step) {
+    const SUMOTime offset = string2time(OptionsCont::getOptions().getString("load-state.offset"));
     myVehicleControl->loadState(bis, offset);
+#ifdef HAVE_INTERNAL
     if (MSGlobals::gUseMesoSim) {
         MSGlobals::gMesoNet->loadState(bis, *myVehicleControl, offset);
     }
-    return step;
+#endif
+    const std::vector<MSEdge*>& edges = myEdges->getEdges();
+    for (std::vector<MSEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+        const std::vector<MSLane*>& lanes = (*i)->getLanes();
+        for (std::vector<MSLane*>::const_iterator j = lanes.begin(); j != lanes.end(); ++j) {
+            (*j)->loadState(bis, *myVehicleControl);
+        }
+    }
+    MSVehicleTransfer::getInstance()->loadState(bis, offset, *myVehicleControl);
+    myLogics->loadState(bis, step);
+    myDetectorControl->loadState(bis, offset);
+    RandHelper::loadState(bis);
+    RandHelper::loadState(bis, &MSVehicleControl::myVehicleParamsRNG);
+    MSLane::loadRNGStates(bis);
+}
+
+
+void
+MSNet::writeState(const std::string& file) {
+    checkStateSaving();
+#ifdef HAVE_FOX
+    // report a failure of the previous state and do not let the pending states pile up
+    myStateWriter.waitAll();
+#endif
+    std::ofstream* out = new std::ofstream(file.c_str(), std::fstream::out | std::fstream::binary);
+    if (!out->good()) {
+        delete out;
+        throw ProcessError("Could not write state to '" + file + "'.");
+    }
+#ifdef HAVE_FOX
+    // the state is serialized within the simulation step, only the file output may run in parallel
+    StateWriteTask* task = new StateWriteTask(out, file);
+    try {
+        std::ostream strm(task);
+        saveState(strm);
+        if (!strm.good()) {
+            throw ProcessError("Could not serialize the state for '" + file + "'.");
+        }
+    } catch (...) {
+        delete task;
+        throw;
+    }
+    if (myStateWriter.size() == 0) {
+        new FXWorkerThread(myStateWriter);
+    }
+    myStateWriter.add(task);
+#else
+    saveState(*out);
+    out->close();
+    const bool failed = out->fail();
+    delete out;
+    if (failed) {
+        throw ProcessError("Could not write state to '" + file + "'.");
+    }
+#endif
+}
+
+
+#ifdef HAVE_FOX
+MSNet::StateWriteTask::StateWriteTask(std::ofstream* strm, const std::string& file)
+    : myStream(strm), myFile(file) {}
+
+
+MSNet::StateWriteTask::~StateWriteTask() {
+    for (std::vector<char*>::iterator i = myChunks.begin(); i != myChunks.end(); ++i) {
+        delete[] *i;
+    }
+    delete myStream;
+}
+
+
+void
+MSNet::StateWriteTask::run(FXWorkerThread* /*context*/) {
+    for (size_t i = 0; i < myChunks.size(); ++i) {
+        const std::streamsize size = i + 1 < myChunks.size() ? (std::streamsize) CHUNK_SIZE : (std::streamsize)(pptr() - pbase());
+        myStream->write(myChunks[i], size);
+    }
+    myStream->close();
+    if (myStream->fail()) {
+        throw ProcessError("Could not write state to '" + myFile + "'.");
+    }
+}
+
+
+MSNet::StateWriteTask::int_type
+MSNet::StateWriteTask::overflow(int_type c) {
+    if (traits_type::eq_int_type(c, traits_type::eof())) {
+        return traits_type::not_eof(c);
+    }
+    char* const chunk = new char[CHUNK_SIZE];
+    myChunks.push_back(chunk);
+    setp(chunk, chunk + CHUNK_SIZE);
+    return sputc(traits_type::to_char_type(c));
 }
 #endif
 
@@ -736,10 +909,15 @@ MSNet::getRouterTT(const std::vector<MSEdge*>& prohibited) const {
         if (routingAlgorithm == "dijkstra") {
             myRouterTTDijkstra = new DijkstraRouterTT_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> >(
                 MSEdge::numericalDictSize(), true, &MSNet::getTravelTime);
+        } else if (routingAlgorithm == "CH" || routingAlgorithm == "CHWrapper") {
+            // the hierarchies are built once; travel times set later on (e.g. via TraCI) are not regarded
+            myRouterTTCH = new CHRouterWrapper<MSEdge, SUMOVehicle, CHRouter_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> > >(
+                MSEdge::numericalDictSize(), true, &MSNet::getTravelTime, string2time(OptionsCont::getOptions().getString("begin")), SUMOTime_MAX);
         } else {
             if (routingAlgorithm != "astar") {
                 WRITE_WARNING("TraCI and Triggers cannot use routing algorithm '" + routingAlgorithm + "'. using 'astar' instead.");
             }
+            // no landmarks; the loaded travel times (and those set via TraCI) may be below the free-flow ones
             myRouterTTAStar = new AStarRouterTT_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> >(
                 MSEdge::numericalDictSize(), true, &MSNet::getTravelTime);
         }
@@ -747,6 +925,9 @@ MSNet::getRouterTT(const std::vector<MSEdge*>& prohibited) const {
     if (myRouterTTDijkstra != 0) {
         myRouterTTDijkstra->prohibit(prohibited);
         return *myRouterTTDijkstra;
+    } else if (myRouterTTCH != 0) {
+        myRouterTTCH->prohibit(prohibited);
+        return *myRouterTTCH;
     } else {
         assert(myRouterTTAStar != 0);
         myRouterTTAStar->prohibit(prohibited);
@@ -755,6 +936,28 @@ MSNet::getRouterTT(const std::vector<MSEdge*>& prohibited) const {
 }
 
 
+const AbstractLookupTable<MSEdge>*
+MSNet::getLandmarkLookupTable() const {
+    if (!myLandmarksInitialized) {
+        myLandmarksInitialized = true;
+        const OptionsCont& oc = OptionsCont::getOptions();
+        if (oc.isSet("astar.landmark-distances")) {
+            PROGRESS_BEGIN_MESSAGE("Loading landmark distances");
+            myLandmarks = new LandmarkLookupTable<MSEdge, SUMOVehicle>(MSEdge::numericalDictSize(), oc.getString("astar.landmark-distances"));
+            PROGRESS_DONE_MESSAGE();
+        } else if (oc.getInt("astar.landmarks") > 0) {
+            PROGRESS_BEGIN_MESSAGE("Computing landmark distances");
+            myLandmarks = new LandmarkLookupTable<MSEdge, SUMOVehicle>(MSEdge::numericalDictSize(), oc.getInt("astar.landmarks"), &MSEdge::getMinimumTravelTime);
+            PROGRESS_DONE_MESSAGE();
+        }
+        if (myLandmarks != 0 && oc.isSet("astar.save-landmark-distances")) {
+            myLandmarks->save(oc.getString("astar.save-landmark-distances"));
+        }
+    }
+    return myLandmarks;
+}
+
+
 SUMOAbstractRouter<MSEdge, SUMOVehicle>&
 MSNet::getRouterEffort(const std::vector<MSEdge*>& prohibited) const {
     if (myRouterEffort == 0) {
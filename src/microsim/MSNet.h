@@ -44,6 +44,7 @@
 #include <iostream>
 #include <cmath>
 #include <iomanip>
+#include <streambuf>
 #include "MSVehicleControl.h"
 #include "MSEventControl.h"
 #include <utils/geom/Boundary.h>
@@ -56,6 +57,12 @@
 #include <utils/common/DijkstraRouterTT.h>
 #include <utils/common/DijkstraRouterEffort.h>
 #include <utils/common/AStarRouter.h>
+#include <utils/common/AStarLookupTable.h>
+#include <utils/common/CHRouter.h>
+
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
 
 // ===========================================================================
 // class declarations
@@ -239,24 +246,54 @@ public:
 
 
 
-#ifdef HAVE_INTERNAL
-    /// @name State I/O (mesosim only)
+    /// @name State I/O
     /// @{
 
     /** @brief Saves the current state
+     *
+     * Writes the routes, vehicle types and vehicles, the vehicles' positions
+     *  on the lanes, the teleporting vehicles, the traffic lights' phases,
+     *  the detectors' states and finally the random number generators.
      *
      * @param[in] os The stream to write the state into (binary)
      */
     void saveState(std::ostream& os);
 
 
-    /** @brief Loads the network state
+    /** @brief Checks whether the complete state can be saved
+     *
+     * Persons, the values detectors collect within an interval (but those of
+     *  induction loops) and the mean data are not saved. As the simulation
+     *  would continue differently from such a state, saving it is refused.
+     * @exception ProcessError If such state exists
+     */
+    void checkStateSaving() const;
+
+
+    /** @brief Loads the header and the routes of a saved state
+     *
+     * This has to be done before the routes are loaded from the route files
+     *  so that the saved routes keep their reference counters.
      *
      * @param[in] bis The input to read the state from (binary)
+     * @return The time step the state was saved at
+     * @exception ProcessError If the state was saved for a different network
      */
     SUMOTime loadState(BinaryInputDevice& bis);
+
+
+    /** @brief Loads the remaining state following the routes
+     *
+     * Has to be called after the additional files were loaded, as the
+     *  vehicles may use vehicle types and routes from these files and the
+     *  detectors must exist.
+     *
+     * @param[in] bis The input to read the state from, positioned behind the routes (binary)
+     * @param[in] step The time step the simulation begins at
+     * @exception ProcessError If a referenced vehicle, route or type is not known
+     */
+    void loadDynamicState(BinaryInputDevice& bis, SUMOTime step);
     /// @}
-#endif
 
     /// @name Retrieval of references to substructures
     /// @{
@@ -505,6 +542,12 @@ public:
      */
     SUMOAbstractRouter<MSEdge, SUMOVehicle>& getRouterTT(
         const std::vector<MSEdge*>& prohibited = std::vector<MSEdge*>()) const;
+    /** @brief Returns the lower bounds for the A* routers of the rerouting devices, initializes them on first use
+     * @return The landmark distances, 0 if no landmarks shall be used
+     * @see LandmarkLookupTable
+     */
+    const AbstractLookupTable<MSEdge>* getLandmarkLookupTable() const;
+
     SUMOAbstractRouter<MSEdge, SUMOVehicle>& getRouterEffort(
         const std::vector<MSEdge*>& prohibited = std::vector<MSEdge*>()) const;
 
@@ -537,6 +580,70 @@ public:
 #endif
 
 protected:
+    /** @brief Serializes the current state and writes it into the given file
+     *
+     * If FOX is available, the state is serialized into memory chunks which are
+     *  written by a separate thread, otherwise it is streamed into the file directly.
+     *  A failure of the previously started writing is reported here.
+     *
+     * The events of the event controls are not part of the state, they are
+     *  rebuilt from the configuration (and by the devices) when the state is loaded.
+     *
+     * @param[in] file The name of the file to write the state into
+     * @exception ProcessError If the file could not be opened or written
+     */
+    void writeState(const std::string& file);
+
+
+#ifdef HAVE_FOX
+    /**
+     * @class StateWriteTask
+     * @brief A task writing a serialized state into its file
+     *
+     * The task is the buffer of the stream the state is serialized into. The
+     *  serialized state is kept in chunks of fixed size so it is neither copied
+     *  nor reallocated while growing.
+     */
+    class StateWriteTask : public FXWorkerThread::Task, public std::streambuf {
+    public:
+        /// @brief Constructor; the task takes ownership of the stream
+        StateWriteTask(std::ofstream* strm, const std::string& file);
+
+        /// @brief Destructor; frees the chunks and the stream
+        ~StateWriteTask();
+
+        /** @brief Writes the chunks and closes the stream
+         * @exception ProcessError If the file could not be written
+         */
+        void run(FXWorkerThread* context);
+
+    protected:
+        /// @brief Starts a new chunk when the current one is full
+        int_type overflow(int_type c);
+
+    private:
+        /// @brief The stream to write into
+        std::ofstream* myStream;
+
+        /// @brief The name of the file written
+        const std::string myFile;
+
+        /// @brief The chunks of the serialized state, only the last one may be used partially
+        std::vector<char*> myChunks;
+
+        /// @brief The size of a chunk
+        static const int CHUNK_SIZE = 1 << 20;
+
+    private:
+        /// @brief Invalidated copy constructor.
+        StateWriteTask(const StateWriteTask&);
+
+        /// @brief Invalidated assignment operator.
+        StateWriteTask& operator=(const StateWriteTask&);
+    };
+#endif
+
+
     /// @brief Unique instance of MSNet
     static MSNet* myInstance;
 
@@ -607,6 +714,10 @@ protected:
     std::vector<SUMOTime> myStateDumpTimes;
     /// @brief The names for the state files
     std::vector<std::string> myStateDumpFiles;
+#ifdef HAVE_FOX
+    /// @brief The thread writing the serialized states to their files
+    FXWorkerThread::Pool myStateWriter;
+#endif
     /// @}
 
 
@@ -636,8 +747,13 @@ protected:
     mutable bool myRouterTTInitialized;
     mutable DijkstraRouterTT_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> >* myRouterTTDijkstra;
     mutable AStarRouterTT_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> >* myRouterTTAStar;
+    mutable CHRouterWrapper<MSEdge, SUMOVehicle, CHRouter_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> > >* myRouterTTCH;
     mutable DijkstraRouterEffort_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> >* myRouterEffort;
 
+    /// @brief The landmark distances for the A* routers
+    mutable bool myLandmarksInitialized;
+    mutable LandmarkLookupTable<MSEdge, SUMOVehicle>* myLandmarks;
+
 
 private:
     /// @brief Invalidated copy constructor.
@@ -220,7 +220,6 @@ MSRoute::operator[](unsigned index) const {
 }
 
 
-#ifdef HAVE_INTERNAL
 void
 MSRoute::dict_saveState(std::ostream& os) {
     FileHelpers::writeUInt(os, (unsigned int) myDict.size());
@@ -290,7 +289,6 @@ MSRoute::dict_loadState(BinaryInputDevice& bis) {
     WRITE_MESSAGE("    " + toString(myDict.size()) + " routes");
     WRITE_MESSAGE("    " + toString(myDistDict.size()) + " route distributions");
 }
-#endif
 
 
 SUMOReal
@@ -361,5 +359,12 @@ MSRoute::getStops() const {
 }
 
 
+MemoryPool&
+MSRoute::getPool() {
+    static MemoryPool* const pool = new MemoryPool("routes");
+    return *pool;
+}
+
+
 /****************************************************************************/
 
@@ -41,6 +41,7 @@
 #include <utils/common/RandomDistributor.h>
 #include <utils/common/RGBColor.h>
 #include <utils/common/SUMOVehicleParameter.h>
+#include <utils/common/MemoryPool.h>
 
 
 // ===========================================================================
@@ -71,6 +72,24 @@ public:
     /// Destructor
     virtual ~MSRoute();
 
+#ifndef CHECK_MEMORY_LEAKS
+    /// @name Pooled allocation (see MemoryPool)
+    /// @{
+
+    /// @brief Returns the memory for a new route from the pool
+    static void* operator new(size_t size) {
+        return getPool().allocate(size);
+    }
+
+
+    /// @brief Gives the memory of a deleted route back to the pool
+    static void operator delete(void* p, size_t size) {
+        getPool().deallocate(p, size);
+    }
+    /// @}
+#endif
+
+
     /// Returns the begin of the list of edges to pass
     MSRouteIterator begin() const;
 
@@ -105,8 +124,7 @@ public:
 
     const MSEdge* operator[](unsigned index) const;
 
-#ifdef HAVE_INTERNAL
-    /// @name State I/O (mesosim only)
+    /// @name State I/O
     /// @{
 
     /** @brief Saves all known routes into the given stream
@@ -122,7 +140,6 @@ public:
      */
     static void dict_loadState(BinaryInputDevice& bis);
     /// @}
-#endif
 
     const MSEdgeVector& getEdges() const {
         return myEdges;
@@ -235,6 +252,14 @@ private:
     /// @brief the maximum size for each routeDistribution
     static unsigned int MaxRouteDistSize;
 
+    /** @brief Returns the pool the memory of routes is taken from
+     *
+     * The pool is built on first use and deleted by MemoryPool::releasePools
+     *  after the last of its routes was deleted, so that routes deleted by
+     *  static destructors still find it.
+     */
+    static MemoryPool& getPool();
+
 private:
     /** invalid assignment operator */
     MSRoute& operator=(const MSRoute& s);
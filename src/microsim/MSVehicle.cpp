@@ -637,27 +637,88 @@ MSVehicle::processNextStop(SUMOReal currentVelocity) {
 
 
 void
-MSVehicle::move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUMOReal lengthsInFront) {
-#ifdef _MESSAGES
-    if (myHBMsgEmitter != 0) {
-        if (isOnRoad()) {
-            SUMOReal timeStep = MSNet::getInstance()->getCurrentTimeStep();
-            myHBMsgEmitter->writeHeartBeatEvent(myParameter->id, timeStep, myLane, myState.pos(), myState.speed(), getPosition().x(), getPosition().y());
+MSVehicle::saveState(std::ostream& os) const {
+    MSBaseVehicle::saveState(os);
+    FileHelpers::writeTime(os, myLastLaneChangeOffset);
+    FileHelpers::writeTime(os, myWaitingTime);
+    FileHelpers::writeFloat(os, myState.myPos);
+    FileHelpers::writeFloat(os, myState.mySpeed);
+    FileHelpers::writeFloat(os, myAcceleration);
+    FileHelpers::writeInt(os, mySignals);
+    FileHelpers::writeString(os, myLane == 0 ? "" : myLane->getID());
+    FileHelpers::writeByte(os, myAmOnNet);
+    FileHelpers::writeByte(os, myHaveToWaitOnNextLink);
+    FileHelpers::writeUInt(os, (unsigned int) myStops.size());
+    for (std::list<Stop>::const_iterator i = myStops.begin(); i != myStops.end(); ++i) {
+        FileHelpers::writeUInt(os, (unsigned int)(i->edge - myRoute->begin()));
+        FileHelpers::writeString(os, i->lane->getID());
+        FileHelpers::writeString(os, i->busstop == 0 ? "" : i->busstop->getID());
+        FileHelpers::writeFloat(os, i->startPos);
+        FileHelpers::writeFloat(os, i->endPos);
+        FileHelpers::writeTime(os, i->duration);
+        FileHelpers::writeTime(os, i->until);
+        FileHelpers::writeByte(os, i->triggered);
+        FileHelpers::writeByte(os, i->parking);
+        FileHelpers::writeByte(os, i->reached);
+    }
+    FileHelpers::writeByte(os, myCFVariables != 0);
+    if (myCFVariables != 0) {
+        myCFVariables->saveState(os);
+    }
+}
+
+
+void
+MSVehicle::loadState(BinaryInputDevice& bis, const SUMOTime offset) {
+    MSBaseVehicle::loadState(bis, offset);
+    std::string laneID;
+    bis >> myLastLaneChangeOffset >> myWaitingTime;
+    bis >> myState.myPos >> myState.mySpeed >> myAcceleration >> mySignals;
+    bis >> laneID >> myAmOnNet >> myHaveToWaitOnNextLink;
+    myLane = laneID == "" ? 0 : MSLane::dictionary(laneID);
+    // the stops given by the parameter and the route were added by the constructor
+    //  but may have been reached already
+    myStops.clear();
+    unsigned int numStops;
+    bis >> numStops;
+    for (; numStops > 0; numStops--) {
+        Stop stop;
+        unsigned int edgeIndex;
+        std::string stopLaneID, busStopID;
+        bis >> edgeIndex >> stopLaneID >> busStopID;
+        bis >> stop.startPos >> stop.endPos >> stop.duration >> stop.until;
+        bis >> stop.triggered >> stop.parking >> stop.reached;
+        stop.edge = myRoute->begin() + edgeIndex;
+        stop.lane = MSLane::dictionary(stopLaneID);
+        stop.busstop = busStopID == "" ? 0 : MSNet::getInstance()->getBusStop(busStopID);
+        if (stop.until >= 0) {
+            stop.until += offset;
         }
+        if (stop.lane == 0 || edgeIndex >= myRoute->size()) {
+            throw ProcessError("Invalid stop for vehicle '" + getID() + "' in the loaded state.");
+        }
+        myStops.push_back(stop);
     }
-#endif
+    bool hasCFVariables;
+    bis >> hasCFVariables;
+    if (hasCFVariables) {
+        if (myCFVariables == 0) {
+            throw ProcessError("The car-following model of vehicle '" + getID() + "' differs from the one in the loaded state.");
+        }
+        myCFVariables->loadState(bis);
+    }
+}
+
+
+void
+MSVehicle::planMove(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh,
+                    SUMOReal predGap, const SUMOReal* predVSafe) {
 #ifdef DEBUG_VEHICLE_GUI_SELECTION
     if (gSelected.isSelected(GLO_VEHICLE, static_cast<const GUIVehicle*>(this)->getGlID())) {
         int bla = 0;
     }
 #endif
-    // remove information about approaching links, will be reset later in this step
-    for (DriveItemVector::iterator i = myLFLinkLanes.begin(); i != myLFLinkLanes.end(); ++i) {
-        if ((*i).myLink != 0) {
-            (*i).myLink->removeApproaching(this);
-        }
-    }
-    myLFLinkLanes.clear();
+    myLFLinkLanesNext.clear();
     //
     const MSCFModel& cfModel = getCarFollowModel();
     // vBeg is the initial maximum velocity of this vehicle in this step
@@ -686,7 +747,7 @@ MSVehicle::move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUM
     unsigned int view = 0;
     bool firstLane = true;
     int lastLink = -1;
-    std::pair<MSVehicle*, SUMOReal> leaderInfo = pred != 0 ? std::pair<MSVehicle*, SUMOReal>(pred, gap2pred(*pred)) : std::pair<MSVehicle*, SUMOReal>((MSVehicle*) 0, 0);
+    std::pair<MSVehicle*, SUMOReal> leaderInfo = pred != 0 ? std::pair<MSVehicle*, SUMOReal>(pred, predGap) : std::pair<MSVehicle*, SUMOReal>((MSVehicle*) 0, 0);
     while (true) {
         SUMOReal laneStopOffset = lane->getLength() > getVehicleType().getMinGap() ? getVehicleType().getMinGap() : POSITION_EPS;
         SUMOReal stopDist = MAX2(SUMOReal(0), seen - laneStopOffset);
@@ -704,14 +765,18 @@ MSVehicle::move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUM
         if (leaderInfo.first != 0) {
             SUMOReal vsafeLeader = 0;
             if (leaderInfo.second >= 0) {
-                vsafeLeader = cfModel.followSpeed(this, getSpeed(), leaderInfo.second, leaderInfo.first->getSpeed(), leaderInfo.first->getCarFollowModel().getMaxDecel());
+                if (firstLane && pred != 0 && predVSafe != 0) {
+                    vsafeLeader = *predVSafe;
+                } else {
+                    vsafeLeader = cfModel.followSpeed(this, getSpeed(), leaderInfo.second, leaderInfo.first->getSpeed(), leaderInfo.first->getCarFollowModel().getMaxDecel());
+                }
             } else {
                 // the leading, in-lapping vehicle is occupying the complete next lane
                 // stop before entering this lane
                 vsafeLeader = cfModel.stopSpeed(this, seen - lane->getLength() - POSITION_EPS);
             }
             if (lastLink > 0) {
-                myLFLinkLanes[lastLink].adaptLeaveSpeed(vsafeLeader);
+                myLFLinkLanesNext[lastLink].adaptLeaveSpeed(vsafeLeader);
             }
             v = MIN2(v, vsafeLeader);
         }
@@ -723,10 +788,10 @@ MSVehicle::move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUM
             SUMOReal stopDist = stop.busstop == 0 ? seen + stop.endPos - lane->getLength() : seen + stop.busstop->getLastFreePos(*this) - POSITION_EPS - lane->getLength();
             SUMOReal stopSpeed = cfModel.stopSpeed(this, stopDist);
             if (lastLink > 0) {
-                myLFLinkLanes[lastLink].adaptLeaveSpeed(stopSpeed);
+                myLFLinkLanesNext[lastLink].adaptLeaveSpeed(stopSpeed);
             }
             v = MIN2(v, stopSpeed);
-            myLFLinkLanes.push_back(DriveProcessItem(0, v, v, false, 0, 0, stopDist));
+            myLFLinkLanesNext.push_back(DriveProcessItem(0, v, v, false, 0, 0, stopDist));
             break;
         }
 
@@ -742,9 +807,9 @@ MSVehicle::move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUM
             const SUMOReal va = cfModel.freeSpeed(this, getSpeed(), seen + myArrivalPos - lane->getLength(), arrivalSpeed);
             v = MIN2(v, va);
             if (lastLink > 0) {
-                myLFLinkLanes[lastLink].adaptLeaveSpeed(va);
+                myLFLinkLanesNext[lastLink].adaptLeaveSpeed(va);
             }
-            myLFLinkLanes.push_back(DriveProcessItem(0, v, v, false, 0, 0, seen));
+            myLFLinkLanesNext.push_back(DriveProcessItem(0, v, v, false, 0, 0, seen));
             break;
         }
         // check whether the lane is a dead end
@@ -752,11 +817,11 @@ MSVehicle::move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUM
             if (!routeEnds) {
                 SUMOReal va = MIN2(cfModel.stopSpeed(this, stopDist), lane->getVehicleMaxSpeed(this));
                 if (lastLink > 0) {
-                    myLFLinkLanes[lastLink].adaptLeaveSpeed(va);
+                    myLFLinkLanesNext[lastLink].adaptLeaveSpeed(va);
                 }
                 v = MIN2(va, v);
             }
-            myLFLinkLanes.push_back(DriveProcessItem(0, v, v, false, 0, 0, seen));
+            myLFLinkLanesNext.push_back(DriveProcessItem(0, v, v, false, 0, 0, seen));
             break;
         }
 
@@ -767,15 +832,15 @@ MSVehicle::move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUM
         SUMOReal vLinkWait = MIN2(v, cfModel.stopSpeed(this, stopDist));
         if ((yellow || red) && seen > cfModel.brakeGap(myState.mySpeed) - myState.mySpeed * cfModel.getHeadwayTime()) {
             // the vehicle is able to brake in front of a yellow/red traffic light
-            myLFLinkLanes.push_back(DriveProcessItem(*link, vLinkWait, vLinkWait, false, t + TIME2STEPS(seen / vLinkPass), vLinkPass, stopDist));
+            myLFLinkLanesNext.push_back(DriveProcessItem(*link, vLinkWait, vLinkWait, false, t + TIME2STEPS(seen / vLinkPass), vLinkPass, stopDist));
             break;
         }
         SUMOReal va = firstLane ? v : lane->getVehicleMaxSpeed(this);
         if (lastLink > 0) {
-            myLFLinkLanes[lastLink].adaptLeaveSpeed(va);
+            myLFLinkLanesNext[lastLink].adaptLeaveSpeed(va);
         } //if(!myLFLinkLanes.empty()) { myLFLinkLanes.back().accelV = va; }
-        lastLink = (int)myLFLinkLanes.size();
-        myLFLinkLanes.push_back(DriveProcessItem(*link, vLinkPass, vLinkWait, setRequest, t + TIME2STEPS(seen / vLinkPass), vLinkPass, stopDist));
+        lastLink = (int)myLFLinkLanesNext.size();
+        myLFLinkLanesNext.push_back(DriveProcessItem(*link, vLinkPass, vLinkWait, setRequest, t + TIME2STEPS(seen / vLinkPass), vLinkPass, stopDist));
 
         // get the following lane
         lane = (*link)->getViaLaneOrLane();
@@ -790,7 +855,7 @@ MSVehicle::move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUM
         // estimate leave speed for passing time computation
         SUMOReal v1 = 2 * (*link)->getLength() * getVehicleType().getCarFollowModel().getMaxAccel() + vLinkPass;
         SUMOReal leaveSpeed = MIN2(lane->getVehicleMaxSpeed(this), (SUMOReal)sqrt(v1));
-        myLFLinkLanes[lastLink].adaptLeaveSpeed(leaveSpeed);
+        myLFLinkLanesNext[lastLink].adaptLeaveSpeed(leaveSpeed);
 
         firstLane = false;
         if (!setRequest || ((vLinkPass <= 0 || seen > dist) && hadNonInternal && seenNonInternal > vehicleLength * 2)) {
@@ -804,10 +869,37 @@ MSVehicle::move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUM
         seenNonInternal += lane->getEdge().getPurpose() == MSEdge::EDGEFUNCTION_INTERNAL ? 0 : lane->getLength();
         seen += lane->getLength();
     }
+}
+
+
+void
+MSVehicle::move(SUMOReal lengthsInFront) {
+#ifdef _MESSAGES
+    if (myHBMsgEmitter != 0) {
+        if (isOnRoad()) {
+            SUMOReal timeStep = MSNet::getInstance()->getCurrentTimeStep();
+            myHBMsgEmitter->writeHeartBeatEvent(myParameter->id, timeStep, myLane, myState.pos(), myState.speed(), getPosition().x(), getPosition().y());
+        }
+    }
+#endif
+    // remove information about approaching links, will be reset later in this step
+    for (DriveItemVector::iterator i = myLFLinkLanes.begin(); i != myLFLinkLanes.end(); ++i) {
+        if ((*i).myLink != 0) {
+            (*i).myLink->removeApproaching(this);
+        }
+    }
+    myLFLinkLanes.swap(myLFLinkLanesNext);
+    myLFLinkLanesNext.clear();
     checkRewindLinkLanes(lengthsInFront);
 }
 
 
+MTRand*
+MSVehicle::getRNG() const {
+    return myLane == 0 ? 0 : myLane->getRNG();
+}
+
+
 bool
 MSVehicle::moveChecked() {
 #ifdef DEBUG_VEHICLE_GUI_SELECTION
@@ -1292,7 +1384,9 @@ MSVehicle::enterLaneAtInsertion(MSLane* enteredLane, SUMOReal pos, SUMOReal spee
     myState = State(pos, speed);
     assert(myState.myPos >= 0);
     assert(myState.mySpeed >= 0);
-    myWaitingTime = 0;
+    if (notification != MSMoveReminder::NOTIFICATION_LOAD_STATE) {
+        myWaitingTime = 0;
+    }
     myLane = enteredLane;
     // set and activate the new lane's reminders
     for (std::vector< MSMoveReminder* >::const_iterator rem = enteredLane->getMoveReminders().begin(); rem != enteredLane->getMoveReminders().end(); ++rem) {
@@ -1381,7 +1475,6 @@ MSVehicle::getBestLanes(bool forceRebuild, MSLane* startLane) const {
     }
     // start rebuilding
     myLastBestLanesEdge = &startLane->getEdge();
-    myBestLanes.clear();
 
     // get information about the next stop
     const MSEdge* nextStopEdge = 0;
@@ -1404,7 +1497,11 @@ MSVehicle::getBestLanes(bool forceRebuild, MSLane* startLane) const {
     SUMOReal seenLength = 0;
     bool progress = true;
     for (MSRouteIterator ce = myCurrEdge; progress;) {
-        std::vector<LaneQ> currentLanes;
+        // the lane information is built in place, reusing the vectors of the last rebuild
+        if (seen == (int) myBestLanes.size()) {
+            myBestLanes.push_back(std::vector<LaneQ>());
+        }
+        std::vector<LaneQ>& currentLanes = myBestLanes[seen];
         const std::vector<MSLane*>* allowed = 0;
         const MSEdge* nextEdge = 0;
         if (ce != myRoute->end() && ce + 1 != myRoute->end()) {
@@ -1412,15 +1509,18 @@ MSVehicle::getBestLanes(bool forceRebuild, MSLane* startLane) const {
             allowed = (*ce)->allowedLanes(*nextEdge, myType->getVehicleClass());
         }
         const std::vector<MSLane*>& lanes = (*ce)->getLanes();
-        for (std::vector<MSLane*>::const_iterator i = lanes.begin(); i != lanes.end(); ++i) {
-            LaneQ q;
+        currentLanes.resize(lanes.size());
+        std::vector<LaneQ>::iterator laneQ = currentLanes.begin();
+        for (std::vector<MSLane*>::const_iterator i = lanes.begin(); i != lanes.end(); ++i, ++laneQ) {
             MSLane* cl = *i;
-            q.lane = cl;
-            q.bestContinuations.push_back(cl);
-            q.bestLaneOffset = 0;
-            q.length = cl->getLength();
-            q.allowsContinuation = allowed == 0 || find(allowed->begin(), allowed->end(), cl) != allowed->end();
-            currentLanes.push_back(q);
+            laneQ->lane = cl;
+            laneQ->occupation = 0;
+            laneQ->nextOccupation = 0;
+            laneQ->bestContinuations.clear();
+            laneQ->bestContinuations.push_back(cl);
+            laneQ->bestLaneOffset = 0;
+            laneQ->length = cl->getLength();
+            laneQ->allowsContinuation = allowed == 0 || find(allowed->begin(), allowed->end(), cl) != allowed->end();
         }
         //
         if (nextStopEdge == *ce) {
@@ -1433,13 +1533,15 @@ MSVehicle::getBestLanes(bool forceRebuild, MSLane* startLane) const {
             }
         }
 
-        myBestLanes.push_back(currentLanes);
         ++seen;
         seenLength += currentLanes[0].lane->getLength();
         ++ce;
         progress &= (seen <= 4 || seenLength < 3000);
         progress &= seen <= 8;
         progress &= ce != myRoute->end();
+        if (!progress) {
+            myBestLanes.resize(seen);
+        }
         /*
         if(progress) {
         	progress &= (currentLanes.size()!=1||(*ce)->getLanes().size()!=1);
@@ -1715,6 +1817,7 @@ MSVehicle::replaceVehicleType(MSVehicleType* type) {
         delete myType;
     }
     myType = type;
+    MSVehicleType::countChange();
 }
 
 unsigned int
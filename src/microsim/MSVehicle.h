@@ -277,14 +277,37 @@ public:
 
 
 
-    /** @brief Moves vehicles
+    /** @brief Computes the safe velocities along the vehicle's upcoming lanes
+     *
+     * The resulting plan is stored until move is called. Only the vehicle's
+     *  own state is modified, so vehicles on different lanes may plan
+     *  concurrently.
      *
+     * @param[in] t The current time step
      * @param[in] lane The lane the vehicle is on
      * @param[in] pred The leader (may be 0)
      * @param[in] neigh The neighbor vehicle (may be 0)
+     * @param[in] predGap The (netto) gap to the leader (see gap2pred)
+     * @param[in] predVSafe The precomputed safe speed regarding the leader (0 if not computed)
+     */
+    void planMove(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh,
+                  SUMOReal predGap, const SUMOReal* predVSafe);
+
+
+    /** @brief Moves vehicles
+     *
+     * Replaces the plan of the previous step by the one computed in planMove
+     *  and registers the vehicle at the approached links.
+     *
      * @param[in] lengthsInFront Sum of vehicle lengths in front of the vehicle
      */
-    void move(SUMOTime t, MSLane* lane, MSVehicle* pred, MSVehicle* neigh, SUMOReal lengthsInFront);
+    void move(SUMOReal lengthsInFront);
+
+
+    /** @brief Returns the random number generator to use for this vehicle's decisions
+     * @return The generator of the vehicle's lane (0 for the global one)
+     */
+    MTRand* getRNG() const;
 
     /// @name state setter/getter
     //@{
@@ -612,6 +635,31 @@ public:
     SUMOReal processNextStop(SUMOReal currentVelocity);
 
 
+    /// @name State I/O
+    //@{
+
+    /** @brief Saves the vehicle's dynamic state
+     *
+     * Besides the values saved by MSBaseVehicle these are the position, speed
+     *  and lane, the remaining stops and the car-following variables.
+     * @param[in] os The stream to write the state into (binary)
+     * @see MSBaseVehicle::saveState
+     */
+    void saveState(std::ostream& os) const;
+
+
+    /** @brief Loads the vehicle's dynamic state as written by saveState
+     *
+     * The vehicle is not put onto its lane, this is done when the lane's
+     *  state is loaded (see MSLane::loadState).
+     * @param[in] bis The input to read the state from (binary)
+     * @param[in] offset The offset to add to the loaded times
+     * @see MSBaseVehicle::loadState
+     */
+    void loadState(BinaryInputDevice& bis, const SUMOTime offset);
+    //@}
+
+
     /// @name Emission retrieval
     //@{
 
@@ -992,6 +1040,9 @@ protected:
     /// Container for used Links/visited Lanes during lookForward.
     DriveItemVector myLFLinkLanes;
 
+    /// @brief The plan computed by planMove which is not yet registered at the links
+    DriveItemVector myLFLinkLanesNext;
+
 
 private:
     /* @brief The vehicle's knowledge about edge efforts/travel times; @see MSEdgeWeightsStorage
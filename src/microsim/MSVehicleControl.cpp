@@ -30,11 +30,15 @@
 #include <config.h>
 #endif
 
+#include <algorithm>
 #include "MSVehicleControl.h"
 #include "MSVehicle.h"
 #include "MSLane.h"
 #include "MSNet.h"
+#include "MSRoute.h"
+#include "MSInsertionControl.h"
 #include <microsim/devices/MSDevice.h>
+#include <microsim/devices/MSDevice_Routing.h>
 #include <utils/common/FileHelpers.h>
 #include <utils/common/RGBColor.h>
 #include <utils/common/SUMOVTypeParameter.h>
@@ -65,6 +69,8 @@ MSVehicleControl::MSVehicleControl() :
     myTeleports(0),
     myTotalDepartureDelay(0),
     myTotalTravelTime(0),
+    myRemovedRunning(0),
+    mySortedRunning(0),
     myDefaultVTypeMayBeDeleted(true),
     myWaitingForPerson(0),
     myScale(-1) {
@@ -82,10 +88,11 @@ MSVehicleControl::MSVehicleControl() :
 
 MSVehicleControl::~MSVehicleControl() {
     // delete vehicles
-    for (VehicleDictType::iterator i = myVehicleDict.begin(); i != myVehicleDict.end(); ++i) {
+    for (VehicleDictType::const_iterator i = myVehicleDict.begin(); i != myVehicleDict.end(); ++i) {
         delete(*i).second;
     }
     myVehicleDict.clear();
+    myRunningVehicles.clear();
     // delete vehicle type distributions
     for (VTypeDistDictType::iterator i = myVTypeDistDict.begin(); i != myVTypeDistDict.end(); ++i) {
         delete(*i).second;
@@ -149,40 +156,154 @@ MSVehicleControl::printMeanTravelTime(OutputDevice& od) const {
 void
 MSVehicleControl::vehicleDeparted(const SUMOVehicle& v) {
     ++myRunningVehNo;
+    addRunning(myVehicleDict.find(v.getID()));
     myTotalDepartureDelay += STEPS2TIME(v.getDeparture() - STEPFLOOR(v.getParameter().depart));
     MSNet::getInstance()->informVehicleStateListener(&v, MSNet::VEHICLE_STATE_DEPARTED);
 }
 
 
 void
-MSVehicleControl::saveState(std::ostream& /*os*/) {
+MSVehicleControl::saveState(std::ostream& os) {
+    // vehicle types and distributions
+    unsigned int numTypes = 0;
+    for (VTypeDictType::const_iterator i = myVTypeDict.begin(); i != myVTypeDict.end(); ++i) {
+        if (!i->second->amVehicleSpecific()) {
+            numTypes++;
+        }
+    }
+    FileHelpers::writeUInt(os, numTypes);
+    for (VTypeDictType::const_iterator i = myVTypeDict.begin(); i != myVTypeDict.end(); ++i) {
+        if (!i->second->amVehicleSpecific()) {
+            i->second->saveState(os);
+        }
+    }
+    FileHelpers::writeUInt(os, (unsigned int) myVTypeDistDict.size());
+    for (VTypeDistDictType::const_iterator i = myVTypeDistDict.begin(); i != myVTypeDistDict.end(); ++i) {
+        FileHelpers::writeString(os, i->first);
+        const unsigned int size = (unsigned int) i->second->getVals().size();
+        FileHelpers::writeUInt(os, size);
+        for (unsigned int j = 0; j < size; ++j) {
+            FileHelpers::writeString(os, i->second->getVals()[j]->getID());
+            FileHelpers::writeFloat(os, i->second->getProbs()[j]);
+        }
+    }
+    // vehicles which are running or waiting for insertion
+    const SUMOTime now = MSNet::getInstance()->getCurrentTimeStep();
+    std::vector<const SUMOVehicle*> vehicles;
+    for (VehicleDictType::const_iterator i = myVehicleDict.begin(); i != myVehicleDict.end(); ++i) {
+        const SUMOVehicle* const veh = i->second;
+        if (veh->hasDeparted() || (veh->getParameter().departProcedure == DEPART_GIVEN && veh->getParameter().depart < now)) {
+            vehicles.push_back(veh);
+        }
+    }
+    FileHelpers::writeUInt(os, (unsigned int) vehicles.size());
+    for (std::vector<const SUMOVehicle*>::const_iterator i = vehicles.begin(); i != vehicles.end(); ++i) {
+        const MSVehicleType& type = (*i)->getVehicleType();
+        FileHelpers::writeString(os, (*i)->getRoute().getID());
+        FileHelpers::writeString(os, type.amVehicleSpecific() ? type.getOriginalType()->getID() : type.getID());
+        (*i)->getParameter().saveState(os);
+        (*i)->saveState(os);
+    }
+    // statistics
+    FileHelpers::writeUInt(os, myLoadedVehNo);
+    FileHelpers::writeUInt(os, myRunningVehNo);
+    FileHelpers::writeUInt(os, myEndedVehNo);
+    FileHelpers::writeUInt(os, myDiscarded);
+    FileHelpers::writeUInt(os, myCollisions);
+    FileHelpers::writeUInt(os, myTeleports);
+    FileHelpers::writeFloat(os, myTotalDepartureDelay);
+    FileHelpers::writeFloat(os, myTotalTravelTime);
 }
 
 
 void
-MSVehicleControl::loadState(BinaryInputDevice& /*bis*/, const SUMOTime /*offset*/) {
+MSVehicleControl::loadState(BinaryInputDevice& bis, const SUMOTime offset) {
+    // vehicle types and distributions
+    unsigned int numTypes;
+    bis >> numTypes;
+    for (; numTypes > 0; numTypes--) {
+        SUMOVTypeParameter typePars;
+        typePars.loadState(bis);
+        if (myVTypeDict.find(typePars.id) == myVTypeDict.end() || (typePars.id == DEFAULT_VTYPE_ID && myDefaultVTypeMayBeDeleted)) {
+            addVType(MSVehicleType::build(typePars));
+        }
+    }
+    unsigned int numTypeDists;
+    bis >> numTypeDists;
+    for (; numTypeDists > 0; numTypeDists--) {
+        std::string id;
+        unsigned int size;
+        bis >> id >> size;
+        RandomDistributor<MSVehicleType*>* dist = hasVTypeDistribution(id) ? 0 : new RandomDistributor<MSVehicleType*>();
+        for (; size > 0; size--) {
+            std::string typeID;
+            SUMOReal prob;
+            bis >> typeID >> prob;
+            VTypeDictType::const_iterator type = myVTypeDict.find(typeID);
+            if (dist != 0 && type != myVTypeDict.end()) {
+                dist->add(prob, type->second, false);
+            }
+        }
+        if (dist != 0 && !addVTypeDistribution(id, dist)) {
+            delete dist;
+        }
+    }
+    // vehicles
+    unsigned int numVehicles;
+    bis >> numVehicles;
+    for (; numVehicles > 0; numVehicles--) {
+        std::string routeID, typeID;
+        bis >> routeID >> typeID;
+        SUMOVehicleParameter* pars = new SUMOVehicleParameter();
+        pars->loadState(bis);
+        pars->depart += offset;
+        for (std::vector<SUMOVehicleParameter::Stop>::iterator i = pars->stops.begin(); i != pars->stops.end(); ++i) {
+            if (i->until >= 0) {
+                i->until += offset;
+            }
+        }
+        const MSRoute* route = MSRoute::dictionary(routeID);
+        const MSVehicleType* type = getVType(typeID);
+        if (route == 0 || type == 0) {
+            const std::string vehID = pars->id;
+            delete pars;
+            throw ProcessError("Unknown route or type for vehicle '" + vehID + "' in the loaded state.");
+        }
+        if (getVehicle(pars->id) != 0) {
+            const std::string vehID = pars->id;
+            delete pars;
+            throw ProcessError("Another vehicle with the id '" + vehID + "' exists.");
+        }
+        SUMOVehicle* veh = buildVehicle(pars, route, type);
+        // the route's reference counter was saved including this vehicle
+        route->release();
+        veh->loadState(bis, offset);
+        addVehicle(pars->id, veh);
+        if (veh->hasDeparted()) {
+            addRunning(myVehicleDict.find(pars->id));
+        } else {
+            MSNet::getInstance()->getInsertionControl().add(veh);
+        }
+    }
+    // statistics (overwriting the ones changed by building the vehicles)
+    bis >> myLoadedVehNo >> myRunningVehNo >> myEndedVehNo >> myDiscarded >> myCollisions >> myTeleports;
+    bis >> myTotalDepartureDelay >> myTotalTravelTime;
 }
 
 
 bool
 MSVehicleControl::addVehicle(const std::string& id, SUMOVehicle* v) {
-    VehicleDictType::iterator it = myVehicleDict.find(id);
-    if (it == myVehicleDict.end()) {
-        // id not in myVehicleDict.
-        myVehicleDict[id] = v;
-        return true;
-    }
-    return false;
+    return myVehicleDict.insert(id, v) != VehicleDictType::INVALID_HANDLE;
 }
 
 
 SUMOVehicle*
 MSVehicleControl::getVehicle(const std::string& id) const {
-    VehicleDictType::const_iterator it = myVehicleDict.find(id);
-    if (it == myVehicleDict.end()) {
+    const VehicleDictType::Handle handle = myVehicleDict.find(id);
+    if (handle == VehicleDictType::INVALID_HANDLE) {
         return 0;
     }
-    return it->second;
+    return myVehicleDict.get(handle);
 }
 
 
@@ -192,7 +313,13 @@ MSVehicleControl::deleteVehicle(SUMOVehicle* veh, bool discard) {
     if (discard) {
         myDiscarded++;
     }
-    myVehicleDict.erase(veh->getID());
+    const VehicleDictType::Handle handle = myVehicleDict.find(veh->getID());
+    // the vehicle may not have been added (e.g. because of a duplicate id)
+    if (handle != VehicleDictType::INVALID_HANDLE && myVehicleDict.get(handle) == veh) {
+        removeRunning(handle);
+        myVehicleDict.erase(veh->getID());
+    }
+    MSDevice_Routing::cancelReroute(*veh);
     delete veh;
 }
 
@@ -209,6 +336,94 @@ MSVehicleControl::loadedVehEnd() const {
 }
 
 
+const std::vector<SUMOVehicle*>&
+MSVehicleControl::getRunningVehicles() {
+    compactRunning();
+    sortRunning();
+    return myRunningVehicles;
+}
+
+
+void
+MSVehicleControl::addRunning(VehicleDictType::Handle handle) {
+    assert(handle != VehicleDictType::INVALID_HANDLE);
+    if (handle >= myRunningIndex.size()) {
+        myRunningIndex.resize(myVehicleDict.handleCount(), VehicleDictType::INVALID_HANDLE);
+    }
+    myRunningIndex[handle] = (unsigned int) myRunningVehicles.size();
+    myRunningVehicles.push_back(myVehicleDict.get(handle));
+    myRunningHandles.push_back(handle);
+}
+
+
+void
+MSVehicleControl::removeRunning(VehicleDictType::Handle handle) {
+    if (handle < myRunningIndex.size() && myRunningIndex[handle] != VehicleDictType::INVALID_HANDLE) {
+        myRunningVehicles[myRunningIndex[handle]] = 0;
+        myRunningIndex[handle] = VehicleDictType::INVALID_HANDLE;
+        myRemovedRunning++;
+        // keep the memory bounded even if nobody asks for the running vehicles
+        if (myRemovedRunning > myRunningVehicles.size() / 2) {
+            compactRunning();
+        }
+    }
+}
+
+
+void
+MSVehicleControl::compactRunning() {
+    if (myRemovedRunning == 0) {
+        return;
+    }
+    unsigned int to = 0;
+    unsigned int sorted = 0;
+    for (unsigned int from = 0; from < myRunningVehicles.size(); ++from) {
+        if (myRunningVehicles[from] != 0) {
+            myRunningVehicles[to] = myRunningVehicles[from];
+            myRunningHandles[to] = myRunningHandles[from];
+            myRunningIndex[myRunningHandles[to]] = to;
+            ++to;
+            if (from < mySortedRunning) {
+                ++sorted;
+            }
+        }
+    }
+    myRunningVehicles.resize(to);
+    myRunningHandles.resize(to);
+    myRemovedRunning = 0;
+    mySortedRunning = sorted;
+}
+
+
+void
+MSVehicleControl::sortRunning() {
+    if (mySortedRunning == myRunningVehicles.size()) {
+        return;
+    }
+    std::vector<std::pair<SUMOVehicle*, VehicleDictType::Handle> > entries;
+    entries.reserve(myRunningVehicles.size());
+    for (unsigned int i = 0; i < myRunningVehicles.size(); ++i) {
+        entries.push_back(std::make_pair(myRunningVehicles[i], myRunningHandles[i]));
+    }
+    // only the vehicles which departed since the last call need to be sorted
+    std::sort(entries.begin() + mySortedRunning, entries.end(), by_id_sorter());
+    std::inplace_merge(entries.begin(), entries.begin() + mySortedRunning, entries.end(), by_id_sorter());
+    for (unsigned int i = 0; i < entries.size(); ++i) {
+        myRunningVehicles[i] = entries[i].first;
+        myRunningHandles[i] = entries[i].second;
+        myRunningIndex[entries[i].second] = i;
+    }
+    mySortedRunning = (unsigned int) myRunningVehicles.size();
+}
+
+
+bool
+MSVehicleControl::by_id_sorter::operator()(const std::pair<SUMOVehicle*, VehicleDictType::Handle>& e1,
+        const std::pair<SUMOVehicle*, VehicleDictType::Handle>& e2) const {
+    return e1.first->getID() < e2.first->getID();
+}
+
+
 bool
 MSVehicleControl::checkVType(const std::string& id) {
     if (id == DEFAULT_VTYPE_ID) {
@@ -318,7 +533,7 @@ MSVehicleControl::getWaitingVehicle(const MSEdge* const edge, const std::set<std
 
 void
 MSVehicleControl::abortWaiting() {
-    for (VehicleDictType::iterator i = myVehicleDict.begin(); i != myVehicleDict.end(); ++i) {
+    for (VehicleDictType::const_iterator i = myVehicleDict.begin(); i != myVehicleDict.end(); ++i) {
         WRITE_WARNING("Vehicle " + i->first + " aborted waiting for a person that will never come.");
     }
 }
@@ -38,6 +38,7 @@
 #include <set>
 #include "MSGlobals.h"
 #include <utils/common/RandHelper.h>
+#include <utils/common/IDHandleMap.h>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/RandomDistributor.h>
 #include <utils/common/SUMOVehicleParameter.h>
@@ -68,6 +69,12 @@ class MSEdge;
  *  generated when a vehicle is removed from the simulation, see
  *  scheduleVehicleRemoval.
  *
+ * The vehicles are stored in a hash map which gives each vehicle a dense
+ *  numerical handle. In addition, the departed vehicles which have not yet
+ *  arrived are kept in a compact vector so that outputs may iterate over the
+ *  running vehicles only. It is sorted by id when requested, merging in the
+ *  vehicles which departed since the last request.
+ *
  * Use this class for the pure microsim and GUIVehicleControl within the gui.
  *
  * @see GUIVehicleControl
@@ -75,7 +82,7 @@ class MSEdge;
 class MSVehicleControl {
 public:
     /// @brief Definition of the internal vehicles map iterator
-    typedef std::map<std::string, SUMOVehicle*>::const_iterator constVehIt;
+    typedef IDHandleMap<SUMOVehicle*>::const_iterator constVehIt;
 
 public:
     /// @brief Constructor
@@ -159,6 +166,7 @@ public:
 
     /** @brief Returns the begin of the internal vehicle map
      *
+     * The vehicles are visited in the order of their handles, not sorted by id.
      * @return The begin of the internal vehicle map
      */
     constVehIt loadedVehBegin() const;
@@ -169,6 +177,27 @@ public:
      * @return The end of the internal vehicle map
      */
     constVehIt loadedVehEnd() const;
+
+
+    /** @brief Returns the vehicles which have departed and not yet arrived
+     *
+     * The vehicles are sorted by their ids, as the outputs and TraCI list them
+     *  in this order. This includes teleporting and parking vehicles, so the
+     *  callers still have to check whether a vehicle is on the road.
+     * @return The running vehicles
+     */
+    const std::vector<SUMOVehicle*>& getRunningVehicles();
+
+
+    /** @brief Returns the handles of the running vehicles
+     *
+     * The handles are in the order of the vehicles returned by the last call
+     *  of getRunningVehicles. A handle may be reused after its vehicle was removed.
+     * @return The handles of the running vehicles
+     */
+    const std::vector<unsigned int>& getRunningHandles() const {
+        return myRunningHandles;
+    }
     /// @}
 
 
@@ -359,16 +388,28 @@ public:
         myTeleports++;
     }
 
-    /// @name State I/O (mesosim only)
+    /// @name State I/O
     /// @{
 
-    /** @brief Loads the state of this control from the given stream
-     * @todo Does not work for microsim
+    /** @brief Saves the current state into the given stream
+     *
+     * Saves the statistics, the vehicle types and distributions and all
+     *  vehicles which have departed or should have departed already.
+     *  Vehicles which depart later are loaded from the route files again.
+     *
+     * @param[in] os The stream to write the state into (binary)
      */
     virtual void saveState(std::ostream& os);
 
-    /** @brief Saves the current state into the given stream
-     * @todo Does not work for microsim
+    /** @brief Loads the state of this control from the given stream
+     *
+     * Vehicle types and distributions which exist already are kept. The
+     *  loaded vehicles are built using buildVehicle; those which did not
+     *  depart yet are given to the insertion control, the others have to be
+     *  put onto their lanes by the caller (see MSLane::loadState).
+     *
+     * @param[in] bis The input to read the state from (binary)
+     * @param[in] offset The offset to add to the loaded times
      */
     virtual void loadState(BinaryInputDevice& bis, const SUMOTime offset);
     /// @}
@@ -433,12 +474,58 @@ protected:
     /// @{
 
     /// @brief Vehicle dictionary type
-    typedef std::map< std::string, SUMOVehicle* > VehicleDictType;
+    typedef IDHandleMap<SUMOVehicle*> VehicleDictType;
     /// @brief Dictionary of vehicles
     VehicleDictType myVehicleDict;
+
+    /// @brief The running vehicles (0 for the ones removed since the last compaction)
+    std::vector<SUMOVehicle*> myRunningVehicles;
+
+    /// @brief The handles of the vehicles in myRunningVehicles
+    std::vector<VehicleDictType::Handle> myRunningHandles;
+
+    /// @brief The position of each vehicle within myRunningVehicles, indexed by handle
+    std::vector<unsigned int> myRunningIndex;
+
+    /// @brief The number of removed entries in myRunningVehicles
+    unsigned int myRemovedRunning;
+
+    /// @brief The number of leading entries in myRunningVehicles which are sorted by id
+    unsigned int mySortedRunning;
     /// @}
 
 
+    /** @brief Adds the vehicle to the running vehicles
+     * @param[in] handle The vehicle's handle
+     */
+    void addRunning(VehicleDictType::Handle handle);
+
+
+    /** @brief Removes the vehicle from the running vehicles if it is contained
+     * @param[in] handle The vehicle's handle
+     */
+    void removeRunning(VehicleDictType::Handle handle);
+
+
+    /// @brief Removes the entries of removed vehicles from the running vehicles, keeping the order
+    void compactRunning();
+
+
+    /// @brief Sorts the vehicles added since the last call and merges them into the sorted running vehicles
+    void sortRunning();
+
+
+    /** @class by_id_sorter
+     * @brief Sorts running vehicles (together with their handles) by id
+     */
+    class by_id_sorter {
+    public:
+        /// @brief Comparing operator
+        bool operator()(const std::pair<SUMOVehicle*, VehicleDictType::Handle>& e1,
+                        const std::pair<SUMOVehicle*, VehicleDictType::Handle>& e2) const;
+    };
+
+
     /// @name Vehicle type container
     /// @{
 
@@ -32,6 +32,8 @@
 
 #include <iostream>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include "MSNet.h"
 #include "MSLane.h"
 #include "MSEdge.h"
@@ -140,6 +142,34 @@ MSVehicleTransfer::hasPending() const {
 }
 
 
+void
+MSVehicleTransfer::saveState(std::ostream& os) const {
+    FileHelpers::writeUInt(os, (unsigned int) myVehicles.size());
+    for (VehicleInfVector::const_iterator i = myVehicles.begin(); i != myVehicles.end(); ++i) {
+        FileHelpers::writeString(os, i->myVeh->getID());
+        FileHelpers::writeTime(os, i->myProceedTime);
+        FileHelpers::writeByte(os, i->myParking);
+    }
+}
+
+
+void
+MSVehicleTransfer::loadState(BinaryInputDevice& bis, const SUMOTime offset, MSVehicleControl& vc) {
+    unsigned int numVehicles;
+    bis >> numVehicles;
+    for (; numVehicles > 0; numVehicles--) {
+        std::string id;
+        SUMOTime proceedTime;
+        bool parking;
+        bis >> id >> proceedTime >> parking;
+        MSVehicle* veh = dynamic_cast<MSVehicle*>(vc.getVehicle(id));
+        if (veh == 0) {
+            throw ProcessError("Unknown teleporting vehicle '" + id + "' in the loaded state.");
+        }
+        myVehicles.push_back(VehicleInformation(veh, proceedTime + offset, parking));
+    }
+}
+
 MSVehicleTransfer*
 MSVehicleTransfer::getInstance() {
     if (myInstance == 0) {
@@ -34,6 +34,8 @@
 
 #include <string>
 #include <vector>
+#include <iostream>
+#include <utils/common/SUMOTime.h>
 
 
 // ===========================================================================
@@ -41,6 +43,8 @@
 // ===========================================================================
 class MSVehicle;
 class MSEdge;
+class MSVehicleControl;
+class BinaryInputDevice;
 
 
 // ===========================================================================
@@ -96,6 +100,24 @@ public:
     bool hasPending() const;
 
 
+    /** @brief Saves the information about the stored vehicles
+     * @param[in] os The stream to write the information into (binary)
+     */
+    void saveState(std::ostream& os) const;
+
+
+    /** @brief Loads the information about the stored vehicles
+     *
+     * The vehicles must have been loaded before.
+     *
+     * @param[in] bis The input to read the information from (binary)
+     * @param[in] offset The offset to add to the stored times
+     * @param[in] vc The vehicle control to retrieve the vehicles from
+     * @exception ProcessError If a vehicle is not known
+     */
+    void loadState(BinaryInputDevice& bis, const SUMOTime offset, MSVehicleControl& vc);
+
+
     /** @brief Returns the instance of this object
      * @return The singleton instance
      */
@@ -53,6 +53,12 @@
 #endif // CHECK_MEMORY_LEAKS
 
 
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+unsigned int MSVehicleType::myChangeCount = 0;
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
@@ -79,24 +85,8 @@ MSVehicleType::computeChosenSpeedDeviation(MTRand& rng) const {
 
 
 void
-MSVehicleType::saveState(std::ostream& os) {
-    FileHelpers::writeString(os, myParameter.id);
-    FileHelpers::writeFloat(os, myParameter.length);
-    FileHelpers::writeFloat(os, myParameter.minGap);
-    FileHelpers::writeFloat(os, getMaxSpeed());
-    FileHelpers::writeInt(os, (int) myParameter.vehicleClass);
-    FileHelpers::writeInt(os, (int) myParameter.emissionClass);
-    FileHelpers::writeInt(os, (int) myParameter.shape);
-    FileHelpers::writeFloat(os, myParameter.width);
-    FileHelpers::writeFloat(os, myParameter.defaultProbability);
-    FileHelpers::writeFloat(os, myParameter.speedFactor);
-    FileHelpers::writeFloat(os, myParameter.speedDev);
-    FileHelpers::writeFloat(os, myParameter.color.red());
-    FileHelpers::writeFloat(os, myParameter.color.green());
-    FileHelpers::writeFloat(os, myParameter.color.blue());
-    FileHelpers::writeInt(os, myCarFollowModel->getModelID());
-    FileHelpers::writeString(os, myParameter.lcModel);
-    //myCarFollowModel->saveState(os);
+MSVehicleType::saveState(std::ostream& os) const {
+    myParameter.saveState(os);
 }
 
 
@@ -109,6 +99,7 @@ MSVehicleType::setLength(const SUMOReal& length) {
     } else {
         myParameter.length = length;
     }
+    myChangeCount++;
 }
 
 
@@ -120,6 +111,7 @@ MSVehicleType::setMinGap(const SUMOReal& minGap) {
     } else {
         myParameter.minGap = minGap;
     }
+    myChangeCount++;
 }
 
 
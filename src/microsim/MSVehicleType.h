@@ -256,8 +256,12 @@ public:
 
 
 
-    /// Saves the states of a vehicle
-    void saveState(std::ostream& os);
+    /** @brief Saves the type's definition into the state
+     *
+     * The type is rebuilt from the loaded SUMOVTypeParameter using build().
+     * @param[in] os The stream to write the definition into (binary)
+     */
+    void saveState(std::ostream& os) const;
 
 
 
@@ -388,6 +392,30 @@ public:
     }
 
 
+    /** @brief Returns the type this vehicle specific type was built from
+     * @return The original type, 0 if this type is not vehicle specific
+     */
+    const MSVehicleType* getOriginalType() const {
+        return myOriginalType;
+    }
+
+
+    /** @brief Returns how often the length, minimum gap or deceleration of a type or the type of a vehicle changed
+     *
+     * Allows to refresh values copied from the types (see MSLane::updateKinematics).
+     * @return The number of changes so far
+     */
+    static unsigned int getChangeCount() {
+        return myChangeCount;
+    }
+
+
+    /// @brief Counts a change of the deceleration of a type or of the type of a vehicle
+    static void countChange() {
+        myChangeCount++;
+    }
+
+
 private:
     /// @brief the parameter container
     SUMOVTypeParameter myParameter;
@@ -398,6 +426,9 @@ private:
     /// @brief The original type
     const MSVehicleType* myOriginalType;
 
+    /// @brief The number of changes of types and of the types of vehicles
+    static unsigned int myChangeCount;
+
 
 private:
     /// @brief Invalidated copy constructor
@@ -30,10 +30,13 @@
 #include <config.h>
 #endif
 
+#include <vector>
 #include "MSCFModel_IDM.h"
+#include "MSCFModel_SIMD.h"
 #include <microsim/MSVehicle.h>
 #include <microsim/MSLane.h>
 #include <utils/common/RandHelper.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include <utils/common/SUMOTime.h>
 
 
@@ -85,6 +88,14 @@ MSCFModel_IDM::followSpeed(const MSVehicle* const veh, SUMOReal speed, SUMOReal
 }
 
 
+bool
+MSCFModel_IDM::followSpeeds(const MSVehicle* const* vehs, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                            const SUMOReal* predSpeeds, const SUMOReal* /*predMaxDecels*/, SUMOReal* vSafes, size_t n) const {
+    _vs(vehs, gap2preds, speeds, predSpeeds, vSafes, n);
+    return true;
+}
+
+
 SUMOReal
 MSCFModel_IDM::stopSpeed(const MSVehicle* const veh, SUMOReal gap2pred) const {
     if (gap2pred < 0.01) {
@@ -94,6 +105,23 @@ MSCFModel_IDM::stopSpeed(const MSVehicle* const veh, SUMOReal gap2pred) const {
 }
 
 
+bool
+MSCFModel_IDM::stopSpeeds(const MSVehicle* const* vehs, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                          SUMOReal* vSafes, size_t n) const {
+    if (n == 0) {
+        return true;
+    }
+    const std::vector<SUMOReal> predSpeeds(n, 0);
+    _vs(vehs, gap2preds, speeds, &predSpeeds[0], vSafes, n);
+    for (size_t i = 0; i < n; ++i) {
+        if (gap2preds[i] < 0.01) {
+            vSafes[i] = 0;
+        }
+    }
+    return true;
+}
+
+
 /// @todo update interactionGap logic to IDM
 SUMOReal
 MSCFModel_IDM::interactionGap(const MSVehicle* const veh, SUMOReal vL) const {
@@ -111,11 +139,7 @@ MSCFModel_IDM::interactionGap(const MSVehicle* const veh, SUMOReal vL) const {
 
 SUMOReal
 MSCFModel_IDM::_v(const MSVehicle* const veh, SUMOReal gap2pred, SUMOReal egoSpeed, SUMOReal predSpeed, SUMOReal desSpeed) const {
-    SUMOReal headwayTime = myHeadwayTime;
-    if (myExpFactor > 0.) {
-        const VehicleVariables* vars = (VehicleVariables*)veh->getCarFollowVariables();
-        headwayTime *= myAdaptationFactor + vars->levelOfService * (1. - myAdaptationFactor);
-    }
+    const SUMOReal headwayTime = adaptedHeadwayTime(veh);
     for (int i = 0; i < myIterations; i++) {
         const SUMOReal delta_v = egoSpeed - predSpeed;
         const SUMOReal s = myType->getMinGap() + MAX2(SUMOReal(0), egoSpeed * headwayTime + egoSpeed * delta_v / myTwoSqrtAccelDecel);
@@ -127,7 +151,53 @@ MSCFModel_IDM::_v(const MSVehicle* const veh, SUMOReal gap2pred, SUMOReal egoSpe
 }
 
 
+void
+MSCFModel_IDM::_vs(const MSVehicle* const* vehs, const SUMOReal* gap2preds, const SUMOReal* speeds, const SUMOReal* predSpeeds,
+                   SUMOReal* vSafes, size_t n) const {
+    if (n == 0) {
+        return;
+    }
+    std::vector<SUMOReal> desSpeeds(n);
+    std::vector<SUMOReal> headwayTimes(n);
+    for (size_t i = 0; i < n; ++i) {
+        desSpeeds[i] = desiredSpeed(vehs[i]);
+        headwayTimes[i] = adaptedHeadwayTime(vehs[i]);
+    }
+    MSCFModel_SIMD::IDMParameter p;
+    p.accel = myAccel;
+    p.minGap = myType->getMinGap();
+    p.delta = myDelta;
+    p.twoSqrtAccelDecel = myTwoSqrtAccelDecel;
+    p.iterations = myIterations;
+    p.stepLength = TS;
+    MSCFModel_SIMD::idmFollowSpeeds(p, speeds, gap2preds, predSpeeds, &desSpeeds[0], &headwayTimes[0], vSafes, n);
+}
+
+
+SUMOReal
+MSCFModel_IDM::adaptedHeadwayTime(const MSVehicle* const veh) const {
+    SUMOReal headwayTime = myHeadwayTime;
+    if (myExpFactor > 0.) {
+        const VehicleVariables* vars = (VehicleVariables*)veh->getCarFollowVariables();
+        headwayTime *= myAdaptationFactor + vars->levelOfService * (1. - myAdaptationFactor);
+    }
+    return headwayTime;
+}
+
+
 MSCFModel*
 MSCFModel_IDM::duplicate(const MSVehicleType* vtype) const {
     return new MSCFModel_IDM(vtype, myAccel, myDecel, myHeadwayTime, myDelta, TS / myIterations);
 }
+
+
+void
+MSCFModel_IDM::VehicleVariables::saveState(std::ostream& os) const {
+    FileHelpers::writeFloat(os, levelOfService);
+}
+
+
+void
+MSCFModel_IDM::VehicleVariables::loadState(BinaryInputDevice& bis) {
+    bis >> levelOfService;
+}
@@ -97,6 +97,13 @@ public:
     SUMOReal followSpeed(const MSVehicle* const veh, SUMOReal speed, SUMOReal gap2pred, SUMOReal predSpeed, SUMOReal predMaxDecel) const;
 
 
+    /** @brief Computes the safe speeds of several vehicles using this model (no dawdling)
+     * @see MSCFModel::followSpeeds
+     */
+    bool followSpeeds(const MSVehicle* const* vehs, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                      const SUMOReal* predSpeeds, const SUMOReal* predMaxDecels, SUMOReal* vSafes, size_t n) const;
+
+
     /** @brief Computes the vehicle's safe speed for approaching a non-moving obstacle (no dawdling)
      * @param[in] veh The vehicle (EGO)
      * @param[in] gap2pred The (netto) distance to the the obstacle
@@ -107,6 +114,13 @@ public:
     SUMOReal stopSpeed(const MSVehicle* const veh, SUMOReal gap2pred) const;
 
 
+    /** @brief Computes the safe speeds of several vehicles approaching non-moving obstacles (no dawdling)
+     * @see MSCFModel::stopSpeeds
+     */
+    bool stopSpeeds(const MSVehicle* const* vehs, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                    SUMOReal* vSafes, size_t n) const;
+
+
     /** @brief Returns the maximum gap at which an interaction between both vehicles occurs
      *
      * "interaction" means that the LEADER influences EGO's speed.
@@ -149,6 +163,8 @@ private:
     class VehicleVariables : public MSCFModel::VehicleVariables {
     public:
         VehicleVariables() : levelOfService(1.) {}
+        void saveState(std::ostream& os) const;
+        void loadState(BinaryInputDevice& bis);
         /// @brief state variable for remembering speed deviation history (lambda)
         SUMOReal levelOfService;
     };
@@ -157,6 +173,13 @@ private:
 private:
     SUMOReal _v(const MSVehicle* const veh, SUMOReal gap2pred, SUMOReal mySpeed, SUMOReal predSpeed, SUMOReal desSpeed) const;
 
+    /// @brief Computes _v for several vehicles using MSCFModel_SIMD
+    void _vs(const MSVehicle* const* vehs, const SUMOReal* gap2preds, const SUMOReal* speeds, const SUMOReal* predSpeeds,
+             SUMOReal* vSafes, size_t n) const;
+
+    /// @brief Returns the vehicle's headway time (adapted for IDMM)
+    SUMOReal adaptedHeadwayTime(const MSVehicle* const veh) const;
+
     SUMOReal desiredSpeed(const MSVehicle* const veh) const {
         return MIN2(myType->getMaxSpeed(), veh->getLane()->getVehicleMaxSpeed(veh));
     }
@@ -100,11 +100,12 @@ public:
 
 private:
     /** @brief Returns the "safe" velocity
+     * @param[in] veh The vehicle (EGO), used for drawing random numbers
      * @param[in] gap2pred The (netto) distance to the LEADER
      * @param[in] predSpeed The LEADER's speed
      * @return the safe velocity
      */
-    SUMOReal _v(SUMOReal speed, SUMOReal vfree, SUMOReal gap, SUMOReal predSpeed) const;
+    SUMOReal _v(const MSVehicle* const veh, SUMOReal speed, SUMOReal vfree, SUMOReal gap, SUMOReal predSpeed) const;
 
 
 
@@ -57,6 +57,22 @@ MSCFModel_Krauss::followSpeed(const MSVehicle* const /*veh*/, SUMOReal speed, SU
 }
 
 
+bool
+MSCFModel_Krauss::followSpeeds(const MSVehicle* const* /*vehs*/, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                               const SUMOReal* predSpeeds, const SUMOReal* predMaxDecels, SUMOReal* vSafes, size_t n) const {
+    MSCFModel_SIMD::kraussFollowSpeeds(getSIMDParameter(), speeds, gap2preds, predSpeeds, predMaxDecels, vSafes, n);
+    return true;
+}
+
+
+bool
+MSCFModel_Krauss::stopSpeeds(const MSVehicle* const* /*vehs*/, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                             SUMOReal* vSafes, size_t n) const {
+    MSCFModel_SIMD::kraussStopSpeeds(getSIMDParameter(), speeds, gap2preds, vSafes, n);
+    return true;
+}
+
+
 SUMOReal
 MSCFModel_Krauss::stopSpeed(const MSVehicle* const veh, SUMOReal gap) const {
     return MIN2(_vsafe(gap, 0, 0), maxNextSpeed(veh->getSpeed()));
@@ -80,6 +96,19 @@ MSCFModel_Krauss::dawdle(SUMOReal speed) const {
 }
 
 
+MSCFModel_SIMD::KraussParameter
+MSCFModel_Krauss::getSIMDParameter() const {
+    MSCFModel_SIMD::KraussParameter p;
+    p.decel = myDecel;
+    p.headwayTime = myHeadwayTime;
+    p.tauDecel = myTauDecel;
+    // same as maxNextSpeed
+    p.accelStep = (SUMOReal) ACCEL2SPEED(getMaxAccel());
+    p.maxSpeed = myType->getMaxSpeed();
+    return p;
+}
+
+
 /** Returns the SK-vsafe. */
 SUMOReal
 MSCFModel_Krauss::_vsafe(SUMOReal gap, SUMOReal predSpeed, SUMOReal predMaxDecel) const {
@@ -114,5 +143,4 @@ MSCFModel_Krauss::duplicate(const MSVehicleType* vtype) const {
 }
 
 
-//void MSCFModel::saveState(std::ostream &os) {}
 
@@ -33,6 +33,7 @@
 #endif
 
 #include "MSCFModel_KraussOrig1.h"
+#include "MSCFModel_SIMD.h"
 #include <utils/xml/SUMOXMLDefinitions.h>
 
 
@@ -72,6 +73,13 @@ public:
     SUMOReal followSpeed(const MSVehicle* const veh, SUMOReal speed, SUMOReal gap2pred, SUMOReal predSpeed, SUMOReal predMaxDecel) const;
 
 
+    /** @brief Computes the safe speeds of several vehicles using this model (no dawdling)
+     * @see MSCFModel::followSpeeds
+     */
+    bool followSpeeds(const MSVehicle* const* vehs, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                      const SUMOReal* predSpeeds, const SUMOReal* predMaxDecels, SUMOReal* vSafes, size_t n) const;
+
+
     /** @brief Computes the vehicle's safe speed for approaching a non-moving obstacle (no dawdling)
      * @param[in] veh The vehicle (EGO)
      * @param[in] gap2pred The (netto) distance to the the obstacle
@@ -82,6 +90,13 @@ public:
     SUMOReal stopSpeed(const MSVehicle* const veh, SUMOReal gap2pred) const;
 
 
+    /** @brief Computes the safe speeds of several vehicles approaching non-moving obstacles (no dawdling)
+     * @see MSCFModel::stopSpeeds
+     */
+    bool stopSpeeds(const MSVehicle* const* vehs, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                    SUMOReal* vSafes, size_t n) const;
+
+
     /** @brief Returns the model's name
      * @return The model's name
      * @see MSCFModel::getModelName
@@ -108,6 +123,12 @@ private:
     SUMOReal _vsafe(SUMOReal gap, SUMOReal predSpeed, SUMOReal predMaxDecel) const;
 
 
+    /** @brief Returns the parameters for the batch computation
+     * @return The model parameters as used by MSCFModel_SIMD
+     */
+    MSCFModel_SIMD::KraussParameter getSIMDParameter() const;
+
+
     /** @brief Applies driver imperfection (dawdling / sigma)
      * @param[in] speed The speed with no dawdling
      * @return The speed after dawdling
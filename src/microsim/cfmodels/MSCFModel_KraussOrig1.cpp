@@ -78,6 +78,19 @@ MSCFModel_KraussOrig1::followSpeed(const MSVehicle* const /*veh*/, SUMOReal spee
 }
 
 
+bool
+MSCFModel_KraussOrig1::followSpeeds(const MSVehicle* const* /*vehs*/, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                                    const SUMOReal* predSpeeds, const SUMOReal* /*predMaxDecels*/, SUMOReal* vSafes, size_t n) const {
+    // maxNextSpeed with the acceleration and maximum speed fetched once for all vehicles
+    const SUMOReal accel = (SUMOReal) ACCEL2SPEED(getMaxAccel());
+    const SUMOReal maxSpeed = myType->getMaxSpeed();
+    for (size_t i = 0; i < n; ++i) {
+        vSafes[i] = MIN2(_vsafe(gap2preds[i], predSpeeds[i]), MIN2(speeds[i] + accel, maxSpeed));
+    }
+    return true;
+}
+
+
 SUMOReal
 MSCFModel_KraussOrig1::stopSpeed(const MSVehicle* const veh, SUMOReal gap) const {
     return MIN2(_vsafe(gap, 0), maxNextSpeed(veh->getSpeed()));
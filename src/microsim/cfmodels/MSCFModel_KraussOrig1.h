@@ -80,6 +80,13 @@ public:
     virtual SUMOReal followSpeed(const MSVehicle* const veh, SUMOReal speed, SUMOReal gap2pred, SUMOReal predSpeed, SUMOReal predMaxDecel) const;
 
 
+    /** @brief Computes the safe speeds of several vehicles using this model (no dawdling)
+     * @see MSCFModel::followSpeeds
+     */
+    virtual bool followSpeeds(const MSVehicle* const* vehs, const SUMOReal* speeds, const SUMOReal* gap2preds,
+                      const SUMOReal* predSpeeds, const SUMOReal* predMaxDecels, SUMOReal* vSafes, size_t n) const;
+
+
     /** @brief Computes the vehicle's safe speed for approaching a non-moving obstacle (no dawdling)
      * @param[in] veh The vehicle (EGO)
      * @param[in] gap2pred The (netto) distance to the the obstacle
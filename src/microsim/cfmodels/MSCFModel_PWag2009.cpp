@@ -34,6 +34,7 @@
 #include <microsim/MSLane.h>
 #include "MSCFModel_PWag2009.h"
 #include <utils/common/RandHelper.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 
 
 // ===========================================================================
@@ -73,11 +74,11 @@ MSCFModel_PWag2009::followSpeed(const MSVehicle* const veh, SUMOReal speed, SUMO
     const SUMOReal asafe = SPEED2ACCEL(vsafe - speed);
     VehicleVariables* vars = (VehicleVariables*)veh->getCarFollowVariables();
     SUMOReal apref = vars->aOld;
-    if (apref <= asafe && RandHelper::rand() <= myActionPointProbability * TS) {
+    if (apref <= asafe && RandHelper::rand(veh->getRNG()) <= myActionPointProbability * TS) {
         apref = myDecelDivTau * (gap + (predSpeed - speed) * myHeadwayTime - speed * myHeadwayTime) / (speed + myTauDecel);
         apref = MIN2(apref, myAccel);
         apref = MAX2(apref, -myDecel);
-        apref += myDawdle * RandHelper::rand((SUMOReal) - 1., (SUMOReal)1.);
+        apref += myDawdle * RandHelper::rand((SUMOReal) - 1., (SUMOReal)1., veh->getRNG());
     }
     if (apref > asafe) {
         apref = asafe;
@@ -140,3 +141,15 @@ MSCFModel*
 MSCFModel_PWag2009::duplicate(const MSVehicleType* vtype) const {
     return new MSCFModel_PWag2009(vtype, myAccel, myDecel, myDawdle, myHeadwayTime, myTauLastDecel / myDecel, myActionPointProbability);
 }
+
+
+void
+MSCFModel_PWag2009::VehicleVariables::saveState(std::ostream& os) const {
+    FileHelpers::writeFloat(os, aOld);
+}
+
+
+void
+MSCFModel_PWag2009::VehicleVariables::loadState(BinaryInputDevice& bis) {
+    bis >> aOld;
+}
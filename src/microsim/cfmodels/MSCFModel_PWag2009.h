@@ -125,6 +125,8 @@ public:
 private:
     class VehicleVariables : public MSCFModel::VehicleVariables {
     public:
+        void saveState(std::ostream& os) const;
+        void loadState(BinaryInputDevice& bis);
         SUMOReal aOld;
     };
 
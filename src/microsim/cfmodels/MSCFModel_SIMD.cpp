@@ -0,0 +1,471 @@
+/****************************************************************************/
+/// @file    MSCFModel_SIMD.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Batch computation of car-following speeds using SIMD instructions
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cmath>
+#include <utils/common/StdDefs.h>
+#include "MSCFModel_SIMD.h"
+
+// The vectorized kernels are compiled for x86 only. With gcc / clang they
+//  are compiled for their instruction set using function attributes, so
+//  the rest of the program does not need any special compiler flags.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CF_SIMD_X86
+#define CF_TARGET_SSE2 __attribute__((target("sse2")))
+#define CF_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define CF_SIMD_X86
+#define CF_TARGET_SSE2
+#define CF_TARGET_AVX2
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+MSCFModel_SIMD::Implementation MSCFModel_SIMD::myImplementation = MSCFModel_SIMD::getBestImplementation();
+
+
+// ===========================================================================
+// scalar kernels
+// ===========================================================================
+// The scalar kernels are written exactly like the corresponding methods of
+//  the models; the vectorized ones have to perform the same operations.
+namespace {
+
+inline SUMOReal
+kraussVSafe(const MSCFModel_SIMD::KraussParameter& p, SUMOReal gap, SUMOReal predSpeed, SUMOReal predMaxDecel) {
+    if (predSpeed < predMaxDecel) {
+        predSpeed = 0;
+    }
+    if (predSpeed == 0) {
+        if (gap < 0.01) {
+            return 0;
+        }
+        return (SUMOReal)(-p.tauDecel + sqrt(p.tauDecel * p.tauDecel + 2. * p.decel * gap));
+    }
+    if (predMaxDecel == 0) {
+        return (SUMOReal)sqrt(2 * gap * p.decel + predSpeed * predSpeed);
+    }
+    return (SUMOReal)(0.5 * sqrt(4.0 * p.decel * (2.0 * gap + predSpeed * predSpeed / predMaxDecel - predSpeed - 1.0) +
+                                 (p.decel * (2.0 * p.headwayTime - 1.0))
+                                 * (p.decel * (2.0 * p.headwayTime - 1.0)))
+                      + p.decel * (0.5 - p.headwayTime));
+}
+
+
+void
+kraussFollowScalar(const MSCFModel_SIMD::KraussParameter& p, const SUMOReal* speeds, const SUMOReal* gaps,
+                   const SUMOReal* predSpeeds, const SUMOReal* predMaxDecels, SUMOReal* vSafes, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        vSafes[i] = MIN2(kraussVSafe(p, gaps[i], predSpeeds[i], predMaxDecels[i]), MIN2(speeds[i] + p.accelStep, p.maxSpeed));
+    }
+}
+
+
+void
+kraussStopScalar(const MSCFModel_SIMD::KraussParameter& p, const SUMOReal* speeds, const SUMOReal* gaps,
+                 SUMOReal* vSafes, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        vSafes[i] = MIN2(kraussVSafe(p, gaps[i], 0, 0), MIN2(speeds[i] + p.accelStep, p.maxSpeed));
+    }
+}
+
+
+void
+idmFollowScalar(const MSCFModel_SIMD::IDMParameter& p, const SUMOReal* speeds, const SUMOReal* gaps,
+                const SUMOReal* predSpeeds, const SUMOReal* desiredSpeeds, const SUMOReal* headwayTimes,
+                SUMOReal* vSafes, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        SUMOReal egoSpeed = speeds[i];
+        SUMOReal gap2pred = gaps[i];
+        const SUMOReal predSpeed = predSpeeds[i];
+        for (int j = 0; j < p.iterations; j++) {
+            const SUMOReal delta_v = egoSpeed - predSpeed;
+            const SUMOReal s = p.minGap + MAX2(SUMOReal(0), egoSpeed * headwayTimes[i] + egoSpeed * delta_v / p.twoSqrtAccelDecel);
+            const SUMOReal acc = p.accel * (1. - pow(egoSpeed / desiredSpeeds[i], p.delta) - (s * s) / (gap2pred * gap2pred));
+            egoSpeed += acc * p.stepLength / p.iterations;
+            gap2pred -= MAX2(SUMOReal(0), (egoSpeed - predSpeed) * p.stepLength / p.iterations);
+        }
+        vSafes[i] = MAX2(SUMOReal(0), egoSpeed);
+    }
+}
+
+
+#ifdef CF_SIMD_X86
+// ===========================================================================
+// SSE2 kernels
+// ===========================================================================
+/// @brief Returns mask ? a : b
+CF_TARGET_SSE2 inline __m128d
+select2(__m128d mask, __m128d a, __m128d b) {
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+}
+
+
+CF_TARGET_SSE2 size_t
+kraussSSE2(const MSCFModel_SIMD::KraussParameter& p, const double* speeds, const double* gaps,
+           const double* predSpeeds, const double* predMaxDecels, double* vSafes, size_t n) {
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d minGap = _mm_set1_pd(0.01);
+    const __m128d negTauDecel = _mm_set1_pd(-p.tauDecel);
+    const __m128d tauDecel2 = _mm_set1_pd(p.tauDecel * p.tauDecel);
+    const __m128d twoDecel = _mm_set1_pd(2. * p.decel);
+    const __m128d two = _mm_set1_pd(2.0);
+    const __m128d decel = _mm_set1_pd(p.decel);
+    const __m128d fourDecel = _mm_set1_pd(4.0 * p.decel);
+    const __m128d one = _mm_set1_pd(1.0);
+    const __m128d half = _mm_set1_pd(0.5);
+    const double c = p.decel * (2.0 * p.headwayTime - 1.0);
+    const __m128d c2 = _mm_set1_pd(c * c);
+    const __m128d offset = _mm_set1_pd(p.decel * (0.5 - p.headwayTime));
+    const __m128d accelStep = _mm_set1_pd(p.accelStep);
+    const __m128d maxSpeed = _mm_set1_pd(p.maxSpeed);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        const __m128d gap = _mm_loadu_pd(gaps + i);
+        const __m128d predMaxDecel = predMaxDecels == 0 ? zero : _mm_loadu_pd(predMaxDecels + i);
+        __m128d predSpeed = predSpeeds == 0 ? zero : _mm_loadu_pd(predSpeeds + i);
+        predSpeed = _mm_andnot_pd(_mm_cmplt_pd(predSpeed, predMaxDecel), predSpeed);
+        // standing leader
+        __m128d vStop = _mm_add_pd(negTauDecel, _mm_sqrt_pd(_mm_add_pd(tauDecel2, _mm_mul_pd(twoDecel, gap))));
+        vStop = _mm_andnot_pd(_mm_cmplt_pd(gap, minGap), vStop);
+        // leader without deceleration (end of lane)
+        const __m128d twoGap = _mm_mul_pd(two, gap);
+        const __m128d predSpeed2 = _mm_mul_pd(predSpeed, predSpeed);
+        const __m128d vLane = _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(twoGap, decel), predSpeed2));
+        // following
+        __m128d term = _mm_add_pd(twoGap, _mm_div_pd(predSpeed2, predMaxDecel));
+        term = _mm_sub_pd(_mm_sub_pd(term, predSpeed), one);
+        const __m128d vFollow = _mm_add_pd(_mm_mul_pd(half, _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(fourDecel, term), c2))), offset);
+        __m128d v = select2(_mm_cmpeq_pd(predMaxDecel, zero), vLane, vFollow);
+        v = select2(_mm_cmpeq_pd(predSpeed, zero), vStop, v);
+        const __m128d vMax = _mm_min_pd(_mm_add_pd(_mm_loadu_pd(speeds + i), accelStep), maxSpeed);
+        _mm_storeu_pd(vSafes + i, _mm_min_pd(v, vMax));
+    }
+    return i;
+}
+
+
+CF_TARGET_SSE2 size_t
+idmSSE2(const MSCFModel_SIMD::IDMParameter& p, const double* speeds, const double* gaps,
+        const double* predSpeeds, const double* desiredSpeeds, const double* headwayTimes,
+        double* vSafes, size_t n) {
+    const __m128d zero = _mm_setzero_pd();
+    const __m128d one = _mm_set1_pd(1.);
+    const __m128d accel = _mm_set1_pd(p.accel);
+    const __m128d minGap = _mm_set1_pd(p.minGap);
+    const __m128d twoSqrtAccelDecel = _mm_set1_pd(p.twoSqrtAccelDecel);
+    const __m128d stepLength = _mm_set1_pd(p.stepLength);
+    const __m128d iterations = _mm_set1_pd((double)p.iterations);
+    double ratio[2];
+    double power[2];
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        __m128d egoSpeed = _mm_loadu_pd(speeds + i);
+        __m128d gap2pred = _mm_loadu_pd(gaps + i);
+        const __m128d predSpeed = _mm_loadu_pd(predSpeeds + i);
+        const __m128d desiredSpeed = _mm_loadu_pd(desiredSpeeds + i);
+        const __m128d headwayTime = _mm_loadu_pd(headwayTimes + i);
+        for (int j = 0; j < p.iterations; j++) {
+            const __m128d delta_v = _mm_sub_pd(egoSpeed, predSpeed);
+            const __m128d sDyn = _mm_add_pd(_mm_mul_pd(egoSpeed, headwayTime), _mm_div_pd(_mm_mul_pd(egoSpeed, delta_v), twoSqrtAccelDecel));
+            const __m128d s = _mm_add_pd(minGap, _mm_max_pd(zero, sDyn));
+            _mm_storeu_pd(ratio, _mm_div_pd(egoSpeed, desiredSpeed));
+            power[0] = pow(ratio[0], p.delta);
+            power[1] = pow(ratio[1], p.delta);
+            const __m128d interaction = _mm_div_pd(_mm_mul_pd(s, s), _mm_mul_pd(gap2pred, gap2pred));
+            const __m128d acc = _mm_mul_pd(accel, _mm_sub_pd(_mm_sub_pd(one, _mm_loadu_pd(power)), interaction));
+            egoSpeed = _mm_add_pd(egoSpeed, _mm_div_pd(_mm_mul_pd(acc, stepLength), iterations));
+            const __m128d dist = _mm_div_pd(_mm_mul_pd(_mm_sub_pd(egoSpeed, predSpeed), stepLength), iterations);
+            gap2pred = _mm_sub_pd(gap2pred, _mm_max_pd(zero, dist));
+        }
+        _mm_storeu_pd(vSafes + i, _mm_max_pd(zero, egoSpeed));
+    }
+    return i;
+}
+
+
+// ===========================================================================
+// AVX2 kernels
+// ===========================================================================
+/// @brief Returns mask ? a : b
+CF_TARGET_AVX2 inline __m256d
+select4(__m256d mask, __m256d a, __m256d b) {
+    return _mm256_blendv_pd(b, a, mask);
+}
+
+
+CF_TARGET_AVX2 size_t
+kraussAVX2(const MSCFModel_SIMD::KraussParameter& p, const double* speeds, const double* gaps,
+           const double* predSpeeds, const double* predMaxDecels, double* vSafes, size_t n) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d minGap = _mm256_set1_pd(0.01);
+    const __m256d negTauDecel = _mm256_set1_pd(-p.tauDecel);
+    const __m256d tauDecel2 = _mm256_set1_pd(p.tauDecel * p.tauDecel);
+    const __m256d twoDecel = _mm256_set1_pd(2. * p.decel);
+    const __m256d two = _mm256_set1_pd(2.0);
+    const __m256d decel = _mm256_set1_pd(p.decel);
+    const __m256d fourDecel = _mm256_set1_pd(4.0 * p.decel);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d half = _mm256_set1_pd(0.5);
+    const double c = p.decel * (2.0 * p.headwayTime - 1.0);
+    const __m256d c2 = _mm256_set1_pd(c * c);
+    const __m256d offset = _mm256_set1_pd(p.decel * (0.5 - p.headwayTime));
+    const __m256d accelStep = _mm256_set1_pd(p.accelStep);
+    const __m256d maxSpeed = _mm256_set1_pd(p.maxSpeed);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const __m256d gap = _mm256_loadu_pd(gaps + i);
+        const __m256d predMaxDecel = predMaxDecels == 0 ? zero : _mm256_loadu_pd(predMaxDecels + i);
+        __m256d predSpeed = predSpeeds == 0 ? zero : _mm256_loadu_pd(predSpeeds + i);
+        predSpeed = _mm256_andnot_pd(_mm256_cmp_pd(predSpeed, predMaxDecel, _CMP_LT_OQ), predSpeed);
+        // standing leader
+        __m256d vStop = _mm256_add_pd(negTauDecel, _mm256_sqrt_pd(_mm256_add_pd(tauDecel2, _mm256_mul_pd(twoDecel, gap))));
+        vStop = _mm256_andnot_pd(_mm256_cmp_pd(gap, minGap, _CMP_LT_OQ), vStop);
+        // leader without deceleration (end of lane)
+        const __m256d twoGap = _mm256_mul_pd(two, gap);
+        const __m256d predSpeed2 = _mm256_mul_pd(predSpeed, predSpeed);
+        const __m256d vLane = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(twoGap, decel), predSpeed2));
+        // following
+        __m256d term = _mm256_add_pd(twoGap, _mm256_div_pd(predSpeed2, predMaxDecel));
+        term = _mm256_sub_pd(_mm256_sub_pd(term, predSpeed), one);
+        const __m256d vFollow = _mm256_add_pd(_mm256_mul_pd(half, _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(fourDecel, term), c2))), offset);
+        __m256d v = select4(_mm256_cmp_pd(predMaxDecel, zero, _CMP_EQ_OQ), vLane, vFollow);
+        v = select4(_mm256_cmp_pd(predSpeed, zero, _CMP_EQ_OQ), vStop, v);
+        const __m256d vMax = _mm256_min_pd(_mm256_add_pd(_mm256_loadu_pd(speeds + i), accelStep), maxSpeed);
+        _mm256_storeu_pd(vSafes + i, _mm256_min_pd(v, vMax));
+    }
+    return i;
+}
+
+
+CF_TARGET_AVX2 size_t
+idmAVX2(const MSCFModel_SIMD::IDMParameter& p, const double* speeds, const double* gaps,
+        const double* predSpeeds, const double* desiredSpeeds, const double* headwayTimes,
+        double* vSafes, size_t n) {
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d one = _mm256_set1_pd(1.);
+    const __m256d accel = _mm256_set1_pd(p.accel);
+    const __m256d minGap = _mm256_set1_pd(p.minGap);
+    const __m256d twoSqrtAccelDecel = _mm256_set1_pd(p.twoSqrtAccelDecel);
+    const __m256d stepLength = _mm256_set1_pd(p.stepLength);
+    const __m256d iterations = _mm256_set1_pd((double)p.iterations);
+    double ratio[4];
+    double power[4];
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d egoSpeed = _mm256_loadu_pd(speeds + i);
+        __m256d gap2pred = _mm256_loadu_pd(gaps + i);
+        const __m256d predSpeed = _mm256_loadu_pd(predSpeeds + i);
+        const __m256d desiredSpeed = _mm256_loadu_pd(desiredSpeeds + i);
+        const __m256d headwayTime = _mm256_loadu_pd(headwayTimes + i);
+        for (int j = 0; j < p.iterations; j++) {
+            const __m256d delta_v = _mm256_sub_pd(egoSpeed, predSpeed);
+            const __m256d sDyn = _mm256_add_pd(_mm256_mul_pd(egoSpeed, headwayTime), _mm256_div_pd(_mm256_mul_pd(egoSpeed, delta_v), twoSqrtAccelDecel));
+            const __m256d s = _mm256_add_pd(minGap, _mm256_max_pd(zero, sDyn));
+            _mm256_storeu_pd(ratio, _mm256_div_pd(egoSpeed, desiredSpeed));
+            for (int k = 0; k < 4; k++) {
+                power[k] = pow(ratio[k], p.delta);
+            }
+            const __m256d interaction = _mm256_div_pd(_mm256_mul_pd(s, s), _mm256_mul_pd(gap2pred, gap2pred));
+            const __m256d acc = _mm256_mul_pd(accel, _mm256_sub_pd(_mm256_sub_pd(one, _mm256_loadu_pd(power)), interaction));
+            egoSpeed = _mm256_add_pd(egoSpeed, _mm256_div_pd(_mm256_mul_pd(acc, stepLength), iterations));
+            const __m256d dist = _mm256_div_pd(_mm256_mul_pd(_mm256_sub_pd(egoSpeed, predSpeed), stepLength), iterations);
+            gap2pred = _mm256_sub_pd(gap2pred, _mm256_max_pd(zero, dist));
+        }
+        _mm256_storeu_pd(vSafes + i, _mm256_max_pd(zero, egoSpeed));
+    }
+    return i;
+}
+#endif
+
+
+/// @brief Returns the implementation to use for the current SUMOReal type
+inline MSCFModel_SIMD::Implementation
+usable(MSCFModel_SIMD::Implementation impl) {
+    // the vectorized kernels work on doubles only
+    return sizeof(SUMOReal) == sizeof(double) ? impl : MSCFModel_SIMD::IMPL_SCALAR;
+}
+
+}
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+MSCFModel_SIMD::Implementation
+MSCFModel_SIMD::getImplementation() {
+    return myImplementation;
+}
+
+
+MSCFModel_SIMD::Implementation
+MSCFModel_SIMD::getBestImplementation() {
+    if (isSupported(IMPL_AVX2)) {
+        return IMPL_AVX2;
+    }
+    if (isSupported(IMPL_SSE2)) {
+        return IMPL_SSE2;
+    }
+    return IMPL_SCALAR;
+}
+
+
+bool
+MSCFModel_SIMD::isSupported(Implementation impl) {
+    switch (impl) {
+        case IMPL_SCALAR:
+            return true;
+#if defined(CF_SIMD_X86) && defined(__GNUC__)
+        case IMPL_SSE2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("sse2") != 0;
+        case IMPL_AVX2:
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+#elif defined(CF_SIMD_X86)
+        case IMPL_SSE2: {
+            int info[4];
+            __cpuid(info, 1);
+            return (info[3] & (1 << 26)) != 0;
+        }
+        case IMPL_AVX2: {
+            int info[4];
+            __cpuid(info, 1);
+            // AVX support of processor and operating system
+            if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6) {
+                return false;
+            }
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+
+bool
+MSCFModel_SIMD::setImplementation(Implementation impl) {
+    if (!isSupported(impl)) {
+        return false;
+    }
+    myImplementation = impl;
+    return true;
+}
+
+
+std::string
+MSCFModel_SIMD::getName(Implementation impl) {
+    switch (impl) {
+        case IMPL_SSE2:
+            return "sse2";
+        case IMPL_AVX2:
+            return "avx2";
+        default:
+            return "scalar";
+    }
+}
+
+
+void
+MSCFModel_SIMD::kraussFollowSpeeds(const KraussParameter& p, const SUMOReal* speeds, const SUMOReal* gaps,
+                                   const SUMOReal* predSpeeds, const SUMOReal* predMaxDecels, SUMOReal* vSafes, size_t n) {
+    size_t done = 0;
+#ifdef CF_SIMD_X86
+    // the casts are only executed if SUMOReal is double
+    switch (usable(myImplementation)) {
+        case IMPL_AVX2:
+            done = kraussAVX2(p, (const double*)speeds, (const double*)gaps, (const double*)predSpeeds, (const double*)predMaxDecels, (double*)vSafes, n);
+            break;
+        case IMPL_SSE2:
+            done = kraussSSE2(p, (const double*)speeds, (const double*)gaps, (const double*)predSpeeds, (const double*)predMaxDecels, (double*)vSafes, n);
+            break;
+        default:
+            break;
+    }
+#endif
+    kraussFollowScalar(p, speeds + done, gaps + done, predSpeeds + done, predMaxDecels + done, vSafes + done, n - done);
+}
+
+
+void
+MSCFModel_SIMD::kraussStopSpeeds(const KraussParameter& p, const SUMOReal* speeds, const SUMOReal* gaps,
+                                 SUMOReal* vSafes, size_t n) {
+    size_t done = 0;
+#ifdef CF_SIMD_X86
+    switch (usable(myImplementation)) {
+        case IMPL_AVX2:
+            done = kraussAVX2(p, (const double*)speeds, (const double*)gaps, 0, 0, (double*)vSafes, n);
+            break;
+        case IMPL_SSE2:
+            done = kraussSSE2(p, (const double*)speeds, (const double*)gaps, 0, 0, (double*)vSafes, n);
+            break;
+        default:
+            break;
+    }
+#endif
+    kraussStopScalar(p, speeds + done, gaps + done, vSafes + done, n - done);
+}
+
+
+void
+MSCFModel_SIMD::idmFollowSpeeds(const IDMParameter& p, const SUMOReal* speeds, const SUMOReal* gaps,
+                                const SUMOReal* predSpeeds, const SUMOReal* desiredSpeeds, const SUMOReal* headwayTimes,
+                                SUMOReal* vSafes, size_t n) {
+    size_t done = 0;
+#ifdef CF_SIMD_X86
+    switch (usable(myImplementation)) {
+        case IMPL_AVX2:
+            done = idmAVX2(p, (const double*)speeds, (const double*)gaps, (const double*)predSpeeds,
+                           (const double*)desiredSpeeds, (const double*)headwayTimes, (double*)vSafes, n);
+            break;
+        case IMPL_SSE2:
+            done = idmSSE2(p, (const double*)speeds, (const double*)gaps, (const double*)predSpeeds,
+                           (const double*)desiredSpeeds, (const double*)headwayTimes, (double*)vSafes, n);
+            break;
+        default:
+            break;
+    }
+#endif
+    idmFollowScalar(p, speeds + done, gaps + done, predSpeeds + done, desiredSpeeds + done, headwayTimes + done, vSafes + done, n - done);
+}
+
+
+/****************************************************************************/
+
@@ -0,0 +1,196 @@
+/****************************************************************************/
+/// @file    MSCFModel_SIMD.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Batch computation of car-following speeds using SIMD instructions
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef MSCFModel_SIMD_h
+#define MSCFModel_SIMD_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MSCFModel_SIMD
+ * @brief Batch computation of car-following speeds using SIMD instructions
+ *
+ * The kernels compute the safe speeds of many vehicles sharing the same model
+ *  parameters (vehicles of the same type) at once. Each kernel exists as a
+ *  scalar, an SSE2 and an AVX2 variant; the variant is chosen at runtime
+ *  depending on the capabilities of the processor. All variants perform the
+ *  same floating point operations in the same order as the scalar car-following
+ *  code, so the results are identical.
+ *
+ * The vectorized variants are only used if SUMOReal is double.
+ */
+class MSCFModel_SIMD {
+public:
+    /// @brief The available implementations of the kernels
+    enum Implementation {
+        /// @brief plain C++
+        IMPL_SCALAR = 0,
+        /// @brief two doubles per instruction
+        IMPL_SSE2 = 1,
+        /// @brief four doubles per instruction
+        IMPL_AVX2 = 2
+    };
+
+
+    /**
+     * @struct KraussParameter
+     * @brief The parameters of the Krauss model (MSCFModel_Krauss)
+     */
+    struct KraussParameter {
+        /// @brief The maximum deceleration
+        SUMOReal decel;
+        /// @brief The driver's reaction time
+        SUMOReal headwayTime;
+        /// @brief The product of deceleration and reaction time
+        SUMOReal tauDecel;
+        /// @brief The speed gain within one step at maximum acceleration
+        SUMOReal accelStep;
+        /// @brief The vehicle type's maximum speed
+        SUMOReal maxSpeed;
+    };
+
+
+    /**
+     * @struct IDMParameter
+     * @brief The parameters of the intelligent driver model (MSCFModel_IDM)
+     */
+    struct IDMParameter {
+        /// @brief The maximum acceleration
+        SUMOReal accel;
+        /// @brief The vehicle type's minimum gap
+        SUMOReal minGap;
+        /// @brief The IDM delta exponent
+        SUMOReal delta;
+        /// @brief 2 * sqrt(accel * decel)
+        SUMOReal twoSqrtAccelDecel;
+        /// @brief The number of internal iterations
+        int iterations;
+        /// @brief The length of a simulation step in s
+        SUMOReal stepLength;
+    };
+
+
+public:
+    /** @brief Returns the implementation currently used
+     * @return The implementation in use
+     */
+    static Implementation getImplementation();
+
+
+    /** @brief Returns the fastest implementation supported by this processor
+     * @return The best available implementation
+     */
+    static Implementation getBestImplementation();
+
+
+    /** @brief Returns whether the given implementation may be used on this processor
+     * @param[in] impl The implementation to check
+     * @return Whether the implementation is available
+     */
+    static bool isSupported(Implementation impl);
+
+
+    /** @brief Sets the implementation to use (for testing and benchmarking)
+     * @param[in] impl The implementation to use
+     * @return Whether the implementation is available (and was set)
+     */
+    static bool setImplementation(Implementation impl);
+
+
+    /** @brief Returns the name of the given implementation
+     * @param[in] impl The implementation
+     * @return The implementation's name
+     */
+    static std::string getName(Implementation impl);
+
+
+    /** @brief Computes the Krauss safe speeds of vehicles following their leaders
+     *
+     * Same as MSCFModel_Krauss::followSpeed for each vehicle.
+     *
+     * @param[in] p The model parameters
+     * @param[in] speeds The vehicles' speeds
+     * @param[in] gaps The (netto) distances to the leaders
+     * @param[in] predSpeeds The leaders' speeds
+     * @param[in] predMaxDecels The leaders' maximum decelerations
+     * @param[out] vSafes The resulting safe speeds
+     * @param[in] n The number of vehicles
+     */
+    static void kraussFollowSpeeds(const KraussParameter& p, const SUMOReal* speeds, const SUMOReal* gaps,
+                                   const SUMOReal* predSpeeds, const SUMOReal* predMaxDecels, SUMOReal* vSafes, size_t n);
+
+
+    /** @brief Computes the Krauss safe speeds of vehicles approaching a non-moving obstacle
+     *
+     * Same as MSCFModel_Krauss::stopSpeed for each vehicle.
+     *
+     * @param[in] p The model parameters
+     * @param[in] speeds The vehicles' speeds
+     * @param[in] gaps The (netto) distances to the obstacles
+     * @param[out] vSafes The resulting safe speeds
+     * @param[in] n The number of vehicles
+     */
+    static void kraussStopSpeeds(const KraussParameter& p, const SUMOReal* speeds, const SUMOReal* gaps,
+                                 SUMOReal* vSafes, size_t n);
+
+
+    /** @brief Computes the IDM safe speeds of vehicles following their leaders
+     *
+     * Same as MSCFModel_IDM::_v for each vehicle. The exponentiation is done
+     *  using the scalar pow function in all variants.
+     *
+     * @param[in] p The model parameters
+     * @param[in] speeds The vehicles' speeds
+     * @param[in] gaps The (netto) distances to the leaders
+     * @param[in] predSpeeds The leaders' speeds (0 for a non-moving obstacle)
+     * @param[in] desiredSpeeds The vehicles' desired speeds
+     * @param[in] headwayTimes The vehicles' (possibly adapted) headway times
+     * @param[out] vSafes The resulting safe speeds
+     * @param[in] n The number of vehicles
+     */
+    static void idmFollowSpeeds(const IDMParameter& p, const SUMOReal* speeds, const SUMOReal* gaps,
+                                const SUMOReal* predSpeeds, const SUMOReal* desiredSpeeds, const SUMOReal* headwayTimes,
+                                SUMOReal* vSafes, size_t n);
+
+
+private:
+    /// @brief The implementation in use
+    static Implementation myImplementation;
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
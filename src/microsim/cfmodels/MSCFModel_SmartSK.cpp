@@ -33,6 +33,7 @@
 #include "MSCFModel_SmartSK.h"
 #include <microsim/MSAbstractLaneChangeModel.h>
 #include <utils/common/RandHelper.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 
 
 // ===========================================================================
@@ -172,3 +173,30 @@ MSCFModel_SmartSK::duplicate(const MSVehicleType* vtype) const {
     return new MSCFModel_SmartSK(vtype, myAccel, myDecel, myDawdle, myHeadwayTime,
                                  myTmp1, myTmp2, myTmp3, myTmp4, myTmp5);
 }
+
+
+void
+MSCFModel_SmartSK::SSKVehicleVariables::saveState(std::ostream& os) const {
+    FileHelpers::writeFloat(os, gOld);
+    FileHelpers::writeFloat(os, myHeadway);
+    FileHelpers::writeUInt(os, (unsigned int) ggOld.size());
+    for (std::map<int, SUMOReal>::const_iterator i = ggOld.begin(); i != ggOld.end(); ++i) {
+        FileHelpers::writeInt(os, i->first);
+        FileHelpers::writeFloat(os, i->second);
+    }
+}
+
+
+void
+MSCFModel_SmartSK::SSKVehicleVariables::loadState(BinaryInputDevice& bis) {
+    bis >> gOld >> myHeadway;
+    unsigned int size;
+    bis >> size;
+    ggOld.clear();
+    for (; size > 0; size--) {
+        int key;
+        SUMOReal value;
+        bis >> key >> value;
+        ggOld[key] = value;
+    }
+}
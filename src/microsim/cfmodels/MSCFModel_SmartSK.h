@@ -180,6 +180,8 @@ private:
 private:
     class SSKVehicleVariables : public MSCFModel::VehicleVariables {
     public:
+        void saveState(std::ostream& os) const;
+        void loadState(BinaryInputDevice& bis);
         SUMOReal gOld, myHeadway;
         std::map<int, SUMOReal> ggOld;
     };
@@ -38,6 +38,7 @@
 #include <microsim/MSVehicle.h>
 #include <microsim/MSLane.h>
 #include <utils/common/RandHelper.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 
 
 // ===========================================================================
@@ -106,6 +107,18 @@ MSCFModel_Wiedemann::duplicate(const MSVehicleType* vtype) const {
 }
 
 
+void
+MSCFModel_Wiedemann::VehicleVariables::saveState(std::ostream& os) const {
+    FileHelpers::writeFloat(os, accelSign);
+}
+
+
+void
+MSCFModel_Wiedemann::VehicleVariables::loadState(BinaryInputDevice& bis) {
+    bis >> accelSign;
+}
+
+
 SUMOReal
 MSCFModel_Wiedemann::_v(const MSVehicle* veh, SUMOReal predSpeed, SUMOReal gap) const {
     const VehicleVariables* vars = (VehicleVariables*)veh->getCarFollowVariables();
@@ -119,7 +132,7 @@ MSCFModel_Wiedemann::_v(const MSVehicle* veh, SUMOReal predSpeed, SUMOReal gap)
     const SUMOReal sdv_root = (dx - myAX) / myCX;
     const SUMOReal sdv = sdv_root * sdv_root;
     const SUMOReal cldv = sdv * ex * ex;
-    const SUMOReal opdv = cldv * (-1 - 2 * RandHelper::randNorm(0.5, 0.15));
+    const SUMOReal opdv = cldv * (-1 - 2 * RandHelper::randNorm(0.5, 0.15, veh->getRNG()));
     // select the regime, get new acceleration, compute new speed based
     SUMOReal accel;
     if (dx <= bx) {
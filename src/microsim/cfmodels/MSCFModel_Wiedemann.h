@@ -136,6 +136,8 @@ private:
     class VehicleVariables : public MSCFModel::VehicleVariables {
     public:
         VehicleVariables() : accelSign(1) {}
+        void saveState(std::ostream& os) const;
+        void loadState(BinaryInputDevice& bis);
         /// @brief state variable for remembering the drift direction
         SUMOReal accelSign;
     };
@@ -0,0 +1,48 @@
+/****************************************************************************/
+/// @file    MSDevice.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Abstract in-vehicle device
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include "MSDevice.h"
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+MemoryPool&
+MSDevice::getPool() {
+    static MemoryPool* const pool = new MemoryPool("devices");
+    return *pool;
+}
+
+
+/****************************************************************************/
+
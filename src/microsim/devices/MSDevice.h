@@ -36,6 +36,7 @@
 #include <microsim/MSMoveReminder.h>
 #include <utils/common/Named.h>
 #include <utils/common/UtilExceptions.h>
+#include <utils/common/MemoryPool.h>
 
 
 // ===========================================================================
@@ -43,6 +44,7 @@
 // ===========================================================================
 class OutputDevice;
 class SUMOVehicle;
+class BinaryInputDevice;
 
 
 // ===========================================================================
@@ -78,6 +80,24 @@ public:
     virtual ~MSDevice() { }
 
 
+#ifndef CHECK_MEMORY_LEAKS
+    /// @name Pooled allocation (see MemoryPool)
+    /// @{
+
+    /// @brief Returns the memory for a new device from the pool
+    static void* operator new(size_t size) {
+        return getPool().allocate(size);
+    }
+
+
+    /// @brief Gives the memory of a deleted device back to the pool
+    static void operator delete(void* p, size_t size) {
+        getPool().deallocate(p, size);
+    }
+    /// @}
+#endif
+
+
     /** @brief Returns the vehicle that holds this device
      *
      * @return The vehicle that holds this device
@@ -103,12 +123,42 @@ public:
     }
 
 
+    /// @name State I/O
+    /// @{
+
+    /** @brief Saves the device's state
+     *
+     * The default implementation saves nothing.
+     *
+     * @param[in] os The stream to write the state into (binary)
+     */
+    virtual void saveState(std::ostream& /*os*/) const {
+    }
+
+
+    /** @brief Loads the device's state as written by saveState
+     *
+     * @param[in] bis The input to read the state from (binary)
+     */
+    virtual void loadState(BinaryInputDevice& /*bis*/) {
+    }
+    /// @}
+
+
 protected:
     /// @brief The vehicle that stores the device
     SUMOVehicle& myHolder;
 
 
 private:
+    /** @brief Returns the pool the memory of devices is taken from
+     *
+     * The pool is built on first use and deleted by MemoryPool::releasePools
+     *  after the last of its devices was deleted, so that devices deleted by
+     *  static destructors still find it.
+     */
+    static MemoryPool& getPool();
+
     /// @brief Invalidated copy constructor.
     MSDevice(const MSDevice&);
 
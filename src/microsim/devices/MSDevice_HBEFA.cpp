@@ -35,7 +35,9 @@
 #include <microsim/MSVehicleControl.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/common/HelpersHBEFA.h>
+#include <utils/common/FileHelpers.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -129,6 +131,22 @@ MSDevice_HBEFA::generateOutput() const {
 }
 
 
+void
+MSDevice_HBEFA::saveState(std::ostream& os) const {
+    FileHelpers::writeFloat(os, myCO2);
+    FileHelpers::writeFloat(os, myCO);
+    FileHelpers::writeFloat(os, myHC);
+    FileHelpers::writeFloat(os, myPMx);
+    FileHelpers::writeFloat(os, myNOx);
+    FileHelpers::writeFloat(os, myFuel);
+}
+
+
+void
+MSDevice_HBEFA::loadState(BinaryInputDevice& bis) {
+    bis >> myCO2 >> myCO >> myHC >> myPMx >> myNOx >> myFuel;
+}
+
 
 /****************************************************************************/
 
@@ -113,6 +113,24 @@ public:
     void generateOutput() const;
 
 
+    /// @name State I/O, overwriting MSDevice
+    /// @{
+
+    /** @brief Saves the device's state
+     * @param[in] os The stream to write the state into (binary)
+     * @see MSDevice::saveState
+     */
+    void saveState(std::ostream& os) const;
+
+
+    /** @brief Loads the device's state
+     * @param[in] bis The input to read the state from (binary)
+     * @see MSDevice::loadState
+     */
+    void loadState(BinaryInputDevice& bis);
+    /// @}
+
+
     /// @brief Destructor.
     ~MSDevice_HBEFA();
 
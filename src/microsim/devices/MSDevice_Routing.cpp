@@ -30,6 +30,9 @@
 #include <config.h>
 #endif
 
+#include <cassert>
+#include <cmath>
+#include <algorithm>
 #include "MSDevice_Routing.h"
 #include <microsim/MSNet.h>
 #include <microsim/MSLane.h>
@@ -40,6 +43,7 @@
 #include <utils/common/StaticCommand.h>
 #include <utils/common/DijkstraRouterTT.h>
 #include <utils/common/AStarRouter.h>
+#include <utils/common/CHRouter.h>
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -53,10 +57,21 @@ std::map<const MSEdge*, SUMOReal> MSDevice_Routing::myEdgeEfforts;
 Command* MSDevice_Routing::myEdgeWeightSettingCommand = 0;
 SUMOReal MSDevice_Routing::myAdaptationWeight;
 SUMOTime MSDevice_Routing::myAdaptationInterval;
+SUMOTime MSDevice_Routing::myLastAdaptation = -1;
 bool MSDevice_Routing::myWithTaz;
-std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*> MSDevice_Routing::myCachedRoutes;
+MSDevice_Routing::MSRouteCache* MSDevice_Routing::myRouteCache = 0;
+bool MSDevice_Routing::myCacheAll;
+SUMOReal MSDevice_Routing::myCacheThreshold;
+std::vector<std::pair<SUMOReal, SUMOReal> > MSDevice_Routing::myCacheEffortRanges;
+unsigned int MSDevice_Routing::myCacheEpoch = 0;
 SUMOAbstractRouter<MSEdge, SUMOVehicle>* MSDevice_Routing::myRouter = 0;
 std::set<std::string> MSDevice_Routing::myExplicitIDs;
+#ifdef HAVE_FOX
+FXWorkerThread::Pool MSDevice_Routing::myThreadPool;
+std::vector<MSDevice_Routing*> MSDevice_Routing::myPendingReroutes;
+#endif
+std::vector<MSDevice_Routing::EdgeSnapshot> MSDevice_Routing::myEdgeSnapshot;
+SUMOTime MSDevice_Routing::mySnapshotTime = -1;
 
 
 // ===========================================================================
@@ -105,6 +120,18 @@ MSDevice_Routing::insertOptions() {
     oc.doRegister("device.rerouting.init-with-loaded-weights", new Option_Bool(false));
     oc.addDescription("device.rerouting.init-with-loaded-weights", "Routing", "Use given weight files for initializing edge weights");
 
+    oc.doRegister("device.rerouting.cache", new Option_Bool(false));
+    oc.addDescription("device.rerouting.cache", "Routing", "Reuse the routes of vehicles with the same origin, destination and vehicle class (always done for zones)");
+
+    oc.doRegister("device.rerouting.cache.memory", new Option_Integer(64));
+    oc.addDescription("device.rerouting.cache.memory", "Routing", "The maximum memory in MB used by the route cache");
+
+    oc.doRegister("device.rerouting.cache.threshold", new Option_Float(.1));
+    oc.addDescription("device.rerouting.cache.threshold", "Routing", "The relative change of an edge weight which invalidates the cached routes over the edge; negative values invalidate all cached routes with each adaptation");
+
+    oc.doRegister("device.rerouting.threads", new Option_Integer(0));
+    oc.addDescription("device.rerouting.threads", "Routing", "The number of threads computing the periodic reroutings in the background (0 reroutes immediately)");
+
     myEdgeWeightSettingCommand = 0;
     myEdgeEfforts.clear();
 }
@@ -158,6 +185,19 @@ MSDevice_Routing::buildVehicleDevices(SUMOVehicle& v, std::vector<MSDevice*>& in
                 myEdgeWeightSettingCommand, 0, MSEventControl::ADAPT_AFTER_EXECUTION);
             myAdaptationWeight = oc.getFloat("device.rerouting.adaptation-weight");
             myAdaptationInterval = string2time(oc.getString("device.rerouting.adaptation-interval"));
+            myCacheAll = oc.getBool("device.rerouting.cache");
+            if (myWithTaz || myCacheAll) {
+                myRouteCache = new MSRouteCache((size_t) oc.getInt("device.rerouting.cache.memory") * 1024 * 1024, &MSRoute::releaseRoute);
+                myCacheThreshold = oc.getFloat("device.rerouting.cache.threshold");
+                if (myCacheThreshold >= 0) {
+                    myCacheEffortRanges.assign(MSEdge::numericalDictSize(), std::pair<SUMOReal, SUMOReal>(-1, -1));
+                }
+            }
+#ifdef HAVE_FOX
+            for (int i = 0; i < oc.getInt("device.rerouting.threads"); i++) {
+                new RoutingThread(myThreadPool, buildRouter(&MSDevice_Routing::getSnapshotEffort));
+            }
+#endif
         }
         if (myWithTaz) {
             if (MSEdge::dictionary(v.getParameter().fromTaz + "-source") == 0) {
@@ -178,7 +218,11 @@ MSDevice_Routing::buildVehicleDevices(SUMOVehicle& v, std::vector<MSDevice*>& in
 // ---------------------------------------------------------------------------
 MSDevice_Routing::MSDevice_Routing(SUMOVehicle& holder, const std::string& id,
                                    SUMOTime period, SUMOTime preInsertionPeriod)
-    : MSDevice(holder, id), myPeriod(period), myPreInsertionPeriod(preInsertionPeriod), myRerouteCommand(0) {
+    : MSDevice(holder, id), myPeriod(period), myPreInsertionPeriod(preInsertionPeriod), myRerouteCommand(0)
+#ifdef HAVE_FOX
+    , myReroutePending(false)
+#endif
+{
     if (myWithTaz) {
         myRerouteCommand = new WrappingCommand< MSDevice_Routing >(this, &MSDevice_Routing::preInsertionReroute);
         MSNet::getInstance()->getInsertionEvents().addEvent(
@@ -193,6 +237,10 @@ MSDevice_Routing::~MSDevice_Routing() {
     if (myRerouteCommand != 0) {
         myRerouteCommand->deschedule();
     }
+#ifdef HAVE_FOX
+    // the holder is already destroyed partially, see cancelReroute
+    assert(!myReroutePending);
+#endif
 }
 
 
@@ -220,18 +268,42 @@ MSDevice_Routing::notifyEnter(SUMOVehicle& /*veh*/, MSMoveReminder::Notification
 }
 
 
+void
+MSDevice_Routing::loadState(BinaryInputDevice& /*bis*/) {
+    if (!myHolder.hasDeparted()) {
+        return;
+    }
+    if (myRerouteCommand != 0) {
+        // the constructor scheduled the rerouting before insertion
+        myRerouteCommand->deschedule();
+        myRerouteCommand = 0;
+    }
+    if (myPeriod > 0) {
+        const SUMOTime currentTime = MSNet::getInstance()->getCurrentTimeStep();
+        const SUMOTime sinceLast = (currentTime - myHolder.getDeparture()) % myPeriod;
+        myRerouteCommand = new WrappingCommand< MSDevice_Routing >(this, &MSDevice_Routing::wrappedRerouteCommandExecute);
+        MSNet::getInstance()->getBeginOfTimestepEvents().addEvent(
+            myRerouteCommand, sinceLast == 0 ? currentTime : currentTime + myPeriod - sinceLast,
+            MSEventControl::ADAPT_AFTER_EXECUTION);
+    }
+}
+
+
 SUMOTime
 MSDevice_Routing::preInsertionReroute(SUMOTime currentTime) {
     const MSEdge* source = MSEdge::dictionary(myHolder.getParameter().fromTaz + "-source");
     const MSEdge* dest = MSEdge::dictionary(myHolder.getParameter().toTaz + "-sink");
     if (source && dest) {
-        const std::pair<const MSEdge*, const MSEdge*> key = std::make_pair(source, dest);
-        if (myCachedRoutes.find(key) == myCachedRoutes.end()) {
-            myHolder.reroute(currentTime, getRouter(), true);
-            myCachedRoutes[key] = &myHolder.getRoute();
-            myHolder.getRoute().addReference();
+        const MSRouteCache::Key key = buildCacheKey(source, dest);
+        const MSRoute* cached;
+        if (myRouteCache->get(key, cached)) {
+            myHolder.replaceRoute(cached, true);
         } else {
-            myHolder.replaceRoute(myCachedRoutes[key], true);
+            const unsigned int numReroutes = myHolder.getNumberReroutes();
+            myHolder.reroute(currentTime, getRouter(), true);
+            if (myHolder.getNumberReroutes() > numReroutes) {
+                cacheCurrentRoute(key, false);
+            }
         }
     }
     return myPreInsertionPeriod;
@@ -240,11 +312,94 @@ MSDevice_Routing::preInsertionReroute(SUMOTime currentTime) {
 
 SUMOTime
 MSDevice_Routing::wrappedRerouteCommandExecute(SUMOTime currentTime) {
+    if (myCacheAll) {
+        const MSRouteCache::Key key = buildCacheKey(myHolder.getEdge(), myHolder.getRoute().getLastEdge());
+        const MSRoute* cached;
+        // a hit counts as rerouting like a computed route; if it cannot be assigned, the route is computed
+        if (myRouteCache->get(key, cached) && myHolder.replaceRouteEdges(cached->getEdges())) {
+            return myPeriod;
+        }
+#ifdef HAVE_FOX
+        if (myThreadPool.size() > 0) {
+            // the computed route is cached when it is applied
+            requestReroute(currentTime);
+            return myPeriod;
+        }
+#endif
+        const unsigned int numReroutes = myHolder.getNumberReroutes();
+        myHolder.reroute(currentTime, getRouter());
+        if (myHolder.getNumberReroutes() > numReroutes) {
+            cacheCurrentRoute(key, false);
+        }
+        return myPeriod;
+    }
+#ifdef HAVE_FOX
+    if (myThreadPool.size() > 0) {
+        requestReroute(currentTime);
+        return myPeriod;
+    }
+#endif
     myHolder.reroute(currentTime, getRouter());
     return myPeriod;
 }
 
 
+MSDevice_Routing::MSRouteCache::Key
+MSDevice_Routing::buildCacheKey(const MSEdge* const from, const MSEdge* const to) const {
+    MSRouteCache::Key key;
+    key.from = from;
+    key.to = to;
+    key.vClass = myHolder.getVClass();
+    key.epoch = myCacheEpoch;
+    return key;
+}
+
+
+void
+MSDevice_Routing::cacheCurrentRoute(const MSRouteCache::Key& key, const bool fromSnapshot) {
+    if (key.epoch != myCacheEpoch) {
+        // the efforts were adapted after the route was requested, it would not be found anymore
+        return;
+    }
+    const MSRoute& route = myHolder.getRoute();
+    if (!myCacheEffortRanges.empty()) {
+        // the efforts of the snapshot may already differ too much from the current ones
+        if (fromSnapshot) {
+            for (MSRouteIterator i = route.begin(); i != route.end(); ++i) {
+                const SUMOReal effort = myEdgeSnapshot[(*i)->getNumericalID()].effort;
+                if (effort >= 0 && fabs(myEdgeEfforts[*i] - effort) > myCacheThreshold * effort) {
+                    return;
+                }
+            }
+        }
+        // remember the efforts the route was computed with, see adaptEdgeEfforts
+        for (MSRouteIterator i = route.begin(); i != route.end(); ++i) {
+            SUMOReal effort = -1;
+            if (fromSnapshot) {
+                effort = myEdgeSnapshot[(*i)->getNumericalID()].effort;
+            } else if (myEdgeEfforts.find(*i) != myEdgeEfforts.end()) {
+                effort = myEdgeEfforts.find(*i)->second;
+            }
+            if (effort < 0) {
+                // the edge has no effort which could change
+                continue;
+            }
+            std::pair<SUMOReal, SUMOReal>& range = myCacheEffortRanges[(*i)->getNumericalID()];
+            if (range.first < 0) {
+                range.first = effort;
+                range.second = effort;
+            } else {
+                range.first = MIN2(range.first, effort);
+                range.second = MAX2(range.second, effort);
+            }
+        }
+    }
+    // the cache holds a reference which is released on removal
+    route.addReference();
+    myRouteCache->insert(key, &route, route.getEdges());
+}
+
+
 SUMOReal
 MSDevice_Routing::getEffort(const MSEdge* const e, const SUMOVehicle* const v, SUMOReal) {
     if (myEdgeEfforts.find(e) != myEdgeEfforts.end()) {
@@ -254,18 +409,44 @@ MSDevice_Routing::getEffort(const MSEdge* const e, const SUMOVehicle* const v, S
 }
 
 
+SUMOReal
+MSDevice_Routing::getSnapshotEffort(const MSEdge* const e, const SUMOVehicle* const v, SUMOReal) {
+    const EdgeSnapshot& snapshot = myEdgeSnapshot[e->getNumericalID()];
+    if (snapshot.effort < 0) {
+        return 0;
+    }
+    // the minimum travel time as in MSEdge::getMinimumTravelTime but with the speed limit of the snapshot
+    if (v == 0) {
+        return MAX2(snapshot.effort, e->getLength() / snapshot.speedLimit);
+    }
+    return MAX2(snapshot.effort, e->getLength() / MIN2(v->getMaxSpeed(), snapshot.speedLimit * v->getChosenSpeedFactor()));
+}
+
+
 SUMOTime
-MSDevice_Routing::adaptEdgeEfforts(SUMOTime /*currentTime*/) {
-    std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*>::iterator it = myCachedRoutes.begin();
-    for (; it != myCachedRoutes.end(); ++it) {
-        it->second->release();
+MSDevice_Routing::adaptEdgeEfforts(SUMOTime currentTime) {
+    const bool invalidateEdges = myRouteCache != 0 && myCacheThreshold >= 0;
+    if (myRouteCache != 0 && !invalidateEdges) {
+        // the routes computed with the previous efforts are not found anymore and are evicted when memory is needed
+        myCacheEpoch++;
     }
-    myCachedRoutes.clear();
     SUMOReal newWeight = (SUMOReal)(1. - myAdaptationWeight);
     const std::vector<MSEdge*>& edges = MSNet::getInstance()->getEdgeControl().getEdges();
     for (std::vector<MSEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
-        myEdgeEfforts[*i] = myEdgeEfforts[*i] * myAdaptationWeight + (*i)->getCurrentTravelTime() * newWeight;
+        SUMOReal& effort = myEdgeEfforts[*i];
+        effort = effort * myAdaptationWeight + (*i)->getCurrentTravelTime() * newWeight;
+        if (invalidateEdges) {
+            // comparing with the smallest and the largest effort suffices as the relative change is largest for one of them
+            std::pair<SUMOReal, SUMOReal>& range = myCacheEffortRanges[(*i)->getNumericalID()];
+            if (range.first >= 0 && (fabs(effort - range.first) > myCacheThreshold * range.first
+                                     || fabs(effort - range.second) > myCacheThreshold * range.second)) {
+                myRouteCache->invalidate(*i);
+                range.first = -1;
+                range.second = -1;
+            }
+        }
     }
+    myLastAdaptation = currentTime;
     return myAdaptationInterval;
 }
 
@@ -273,23 +454,151 @@ MSDevice_Routing::adaptEdgeEfforts(SUMOTime /*currentTime*/) {
 SUMOAbstractRouter<MSEdge, SUMOVehicle>&
 MSDevice_Routing::getRouter() {
     if (myRouter == 0) {
-        const std::string routingAlgorithm = OptionsCont::getOptions().getString("routing-algorithm");
-        if (routingAlgorithm == "dijkstra") {
-            myRouter = new DijkstraRouterTT_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> >(
-                MSEdge::numericalDictSize(), true, &MSDevice_Routing::getEffort);
-        } else if (routingAlgorithm == "astar") {
-            myRouter = new AStarRouterTT_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> >(
-                MSEdge::numericalDictSize(), true, &MSDevice_Routing::getEffort);
-        } else {
-            throw ProcessError("Unknown routing Algorithm '" + routingAlgorithm + "'!");
-        }
+        myRouter = buildRouter(&MSDevice_Routing::getEffort);
     }
     return *myRouter;
 }
 
 
+SUMOAbstractRouter<MSEdge, SUMOVehicle>*
+MSDevice_Routing::buildRouter(SUMOReal(* effortOperation)(const MSEdge* const, const SUMOVehicle* const, SUMOReal)) {
+    const std::string routingAlgorithm = OptionsCont::getOptions().getString("routing-algorithm");
+    if (routingAlgorithm == "dijkstra") {
+        return new DijkstraRouterTT_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> >(
+                   MSEdge::numericalDictSize(), true, effortOperation);
+    } else if (routingAlgorithm == "astar") {
+        return new AStarRouterTT_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> >(
+                   MSEdge::numericalDictSize(), true, effortOperation, MSNet::getInstance()->getLandmarkLookupTable());
+    } else if (routingAlgorithm == "CH" || routingAlgorithm == "CHWrapper") {
+        // the efforts are adapted at the end of a step and are used from the next step on
+        const SUMOTime begin = myLastAdaptation + DELTA_T;
+        const SUMOTime weightPeriod = myAdaptationInterval > 0 ? myAdaptationInterval : SUMOTime_MAX;
+        // one hierarchy per vehicle class, the edges may be restricted
+        return new CHRouterWrapper<MSEdge, SUMOVehicle, CHRouter_ByProxi<MSEdge, SUMOVehicle, prohibited_withRestrictions<MSEdge, SUMOVehicle> > >(
+                   MSEdge::numericalDictSize(), true, effortOperation, begin, weightPeriod);
+    }
+    throw ProcessError("Unknown routing Algorithm '" + routingAlgorithm + "'!");
+}
+
+
+#ifdef HAVE_FOX
+void
+MSDevice_Routing::requestReroute(SUMOTime currentTime) {
+    if (myReroutePending) {
+        return;
+    }
+    if (mySnapshotTime != currentTime) {
+        // no thread is running, the previous requests were applied at the begin of the step
+        assert(myPendingReroutes.empty());
+        const std::vector<MSEdge*>& edges = MSNet::getInstance()->getEdgeControl().getEdges();
+        EdgeSnapshot none;
+        none.effort = -1;
+        none.speedLimit = 0;
+        myEdgeSnapshot.assign(MSEdge::numericalDictSize(), none);
+        for (std::vector<MSEdge*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+            EdgeSnapshot& snapshot = myEdgeSnapshot[(*i)->getNumericalID()];
+            snapshot.effort = myEdgeEfforts[*i];
+            snapshot.speedLimit = (*i)->getSpeedLimit();
+        }
+        mySnapshotTime = currentTime;
+    }
+    myReroutePending = true;
+    myPendingRoute.clear();
+    myPendingKey = buildCacheKey(myHolder.getEdge(), myHolder.getRoute().getLastEdge());
+    myPendingReroutes.push_back(this);
+    myThreadPool.add(new RoutingTask(*this, myHolder.getEdge(), myHolder.getRoute().getLastEdge(), currentTime));
+}
+
+
+void
+MSDevice_Routing::applyPendingReroute(SUMOTime currentTime) {
+    myReroutePending = false;
+    if (myPendingRoute.empty()) {
+        WRITE_WARNING("No route for vehicle '" + myHolder.getID() + "' found.");
+        return;
+    }
+    if (!myHolder.replaceRouteEdges(myPendingRoute)) {
+        // the vehicle has left the edges of the new route in the meantime
+        myHolder.reroute(currentTime, getRouter());
+    } else if (myCacheAll) {
+        cacheCurrentRoute(myPendingKey, true);
+    }
+    myPendingRoute.clear();
+}
+
+
+void
+MSDevice_Routing::RoutingTask::run(FXWorkerThread* context) {
+    static_cast<RoutingThread*>(context)->getRouter().compute(myFrom, myTo, &myDevice.myHolder, myTime, myDevice.myPendingRoute);
+}
+#endif
+
+
+void
+MSDevice_Routing::applyPendingReroutes(SUMOTime currentTime) {
+#ifdef HAVE_FOX
+    if (myPendingReroutes.empty()) {
+        return;
+    }
+    myThreadPool.waitAll();
+    // the list may not change while applying (the devices are not deleted here)
+    std::vector<MSDevice_Routing*> pending;
+    pending.swap(myPendingReroutes);
+    for (std::vector<MSDevice_Routing*>::const_iterator i = pending.begin(); i != pending.end(); ++i) {
+        (*i)->applyPendingReroute(currentTime);
+    }
+#else
+    UNUSED_PARAMETER(currentTime);
+#endif
+}
+
+
+void
+MSDevice_Routing::cancelReroute(const SUMOVehicle& veh) {
+#ifdef HAVE_FOX
+    if (myPendingReroutes.empty()) {
+        return;
+    }
+    for (std::vector<MSDevice*>::const_iterator i = veh.getDevices().begin(); i != veh.getDevices().end(); ++i) {
+        MSDevice_Routing* const device = dynamic_cast<MSDevice_Routing*>(*i);
+        if (device != 0 && device->myReroutePending) {
+            // a thread may still be routing the vehicle
+            myThreadPool.waitAll();
+            device->myReroutePending = false;
+            myPendingReroutes.erase(std::find(myPendingReroutes.begin(), myPendingReroutes.end(), device));
+        }
+    }
+#else
+    UNUSED_PARAMETER(veh);
+#endif
+}
+
+
+void
+MSDevice_Routing::cancelReroutes() {
+#ifdef HAVE_FOX
+    myThreadPool.waitAll();
+    for (std::vector<MSDevice_Routing*>::const_iterator i = myPendingReroutes.begin(); i != myPendingReroutes.end(); ++i) {
+        (*i)->myReroutePending = false;
+    }
+    myPendingReroutes.clear();
+#endif
+}
+
+
 void
 MSDevice_Routing::cleanup() {
+    cancelReroutes();
+#ifdef HAVE_FOX
+    myThreadPool.clear();
+#endif
+    myEdgeSnapshot.clear();
+    mySnapshotTime = -1;
+    // releases the cached routes
+    delete myRouteCache;
+    myRouteCache = 0;
+    myCacheEffortRanges.clear();
+    myCacheEpoch = 0;
     delete myRouter;
     myRouter = 0;
 }
@@ -37,9 +37,14 @@
 #include <utils/common/SUMOTime.h>
 #include <utils/common/WrappingCommand.h>
 #include <utils/common/SUMOAbstractRouter.h>
+#include <utils/common/RouteCache.h>
 #include <microsim/MSVehicle.h>
 #include "MSDevice.h"
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
+
 
 // ===========================================================================
 // class declarations
@@ -62,13 +67,33 @@ class MSLane;
  *
  * A device is assigned to a vehicle using the common explicit/probability - procedure.
  *
+ * Routes are reused from a cache (see RouteCache) keyed by origin, destination,
+ *  vehicle class and the epoch of the edge weights. The cache is always used for
+ *  the routes between zones and optionally (option "device.rerouting.cache") for
+ *  all reroutings, including the ones computed in the background. Cached routes
+ *  are invalidated per edge when its weight differs by more than a threshold from
+ *  the weights the routes over the edge were computed with, or, for a negative
+ *  threshold, all at once with each weight adaptation (by a new epoch). The
+ *  vehicles' maximum speeds are not part of the key. Assigning a cached route
+ *  counts as rerouting like assigning a computed one.
+ *
  * A device computes a new route for a vehicle as soon as the vehicle is inserted
  *  (within "enterLaneAtInsertion") - and, if the given period is larger than 0 - each
  *  x time steps where x is the period. This is triggered by an event that executes
  *  "wrappedRerouteCommandExecute".
+ *
+ * If routing threads are used (option "device.rerouting.threads"), these reroutings
+ *  are computed in the background using a snapshot of the edge efforts taken with
+ *  the first request of a step. The new routes are assigned at the begin of the
+ *  next step (see applyPendingReroutes) in the order of the requests, so that the
+ *  results do not depend on the thread scheduling.
  */
 class MSDevice_Routing : public MSDevice {
 public:
+    /// @brief The cache of computed routes
+    typedef RouteCache<MSEdge, const MSRoute*> MSRouteCache;
+
+
     /** @brief Inserts MSDevice_Routing-options
      */
     static void insertOptions();
@@ -96,6 +121,41 @@ public:
     /// @brief deletes the router instance
     static void cleanup();
 
+
+    /** @brief Assigns the routes computed in the background during the last step
+     *
+     * Waits for the routing threads and replaces the routes of the vehicles in
+     *  the order of their requests. If a vehicle has meanwhile left the new
+     *  route's edges, it is rerouted immediately instead.
+     *
+     * Does nothing if no routing threads are used.
+     *
+     * @param[in] currentTime The current simulation time
+     */
+    static void applyPendingReroutes(SUMOTime currentTime);
+
+
+    /** @brief Discards the background rerouting of the given vehicle
+     *
+     * Waits for the routing threads if the vehicle's rerouting is pending, so
+     *  that the vehicle may be deleted afterwards.
+     *
+     * @param[in] veh The vehicle to be deleted
+     */
+    static void cancelReroute(const SUMOVehicle& veh);
+
+
+    /// @brief Discards all background reroutings, so that the vehicles may be deleted
+    static void cancelReroutes();
+
+
+    /** @brief Returns the route cache (for statistics)
+     * @return The route cache, 0 if no routes are cached
+     */
+    static const MSRouteCache* getRouteCache() {
+        return myRouteCache;
+    }
+
 public:
     /// @name Methods called on vehicle movement / state change, overwriting MSDevice
     /// @{
@@ -122,6 +182,22 @@ public:
     /// @}
 
 
+    /// @name State I/O, overwriting MSDevice
+    /// @{
+
+    /** @brief Rebuilds the rerouting trigger of a vehicle from a loaded state
+     *
+     * Nothing is read; the periodic rerouting takes place each period after
+     *  the (loaded) departure of the holder, so the next rerouting is
+     *  scheduled from that. The rerouting before insertion is dropped for
+     *  vehicles which have already departed.
+     * @param[in] bis The input to read the state from (binary)
+     * @see MSDevice::loadState
+     */
+    void loadState(BinaryInputDevice& bis);
+    /// @}
+
+
     /// @brief Destructor.
     ~MSDevice_Routing();
 
@@ -186,6 +262,19 @@ private:
     static SUMOReal getEffort(const MSEdge* const e, const SUMOVehicle* const v, SUMOReal t);
 
 
+    /** @brief Returns the effort to pass an edge using the snapshot of the routing threads
+     *
+     * Same as getEffort, but based on the edge efforts and speed limits which
+     *  were valid when the first rerouting of the current step was requested.
+     *
+     * @param[in] e The edge for which the effort to be passed shall be returned
+     * @param[in] v The vehicle that is rerouted
+     * @param[in] t The time for which the effort shall be returned
+     * @return The effort (time to pass in this case) for an edge
+     */
+    static SUMOReal getSnapshotEffort(const MSEdge* const e, const SUMOVehicle* const v, SUMOReal t);
+
+
     /// @name Network state adaptation
     /// @{
 
@@ -207,6 +296,114 @@ private:
     /// @brief get the router, initialize on first use
     static SUMOAbstractRouter<MSEdge, SUMOVehicle>& getRouter();
 
+
+    /** @brief Builds a router as given by the options
+     * @param[in] effortOperation The method to retrieve the edge efforts
+     * @return The built router
+     */
+    static SUMOAbstractRouter<MSEdge, SUMOVehicle>* buildRouter(
+        SUMOReal(* effortOperation)(const MSEdge* const, const SUMOVehicle* const, SUMOReal));
+
+
+    /** @brief Builds the key of the holder's route between the given edges in the route cache
+     * @param[in] from The first edge of the route
+     * @param[in] to The last edge of the route
+     * @return The cache key
+     */
+    MSRouteCache::Key buildCacheKey(const MSEdge* const from, const MSEdge* const to) const;
+
+
+    /** @brief Stores the holder's current route in the route cache
+     *
+     * The efforts of the route's edges are remembered for the invalidation of
+     *  the route. A route computed in the background with efforts which are
+     *  already outdated is not stored.
+     *
+     * @param[in] key The key of the route
+     * @param[in] fromSnapshot Whether the route was computed using the snapshot of the routing threads
+     */
+    void cacheCurrentRoute(const MSRouteCache::Key& key, const bool fromSnapshot);
+
+#ifdef HAVE_FOX
+    /** @brief Requests a background rerouting of the holder
+     *
+     * The edge efforts snapshot is updated if this is the first request of the step.
+     *
+     * @param[in] currentTime The current simulation time
+     */
+    void requestReroute(SUMOTime currentTime);
+
+
+    /// @brief Assigns the route computed in the background to the holder
+    void applyPendingReroute(SUMOTime currentTime);
+
+
+    /**
+     * @class RoutingThread
+     * @brief A worker thread owning a router which uses the edge efforts snapshot
+     */
+    class RoutingThread : public FXWorkerThread {
+    public:
+        /// @brief Constructor; adds the thread to the pool and starts it
+        RoutingThread(FXWorkerThread::Pool& pool, SUMOAbstractRouter<MSEdge, SUMOVehicle>* router)
+            : FXWorkerThread(pool), myRouter(router) {}
+
+        /// @brief Destructor; stops the thread before deleting the router
+        virtual ~RoutingThread() {
+            stop();
+            delete myRouter;
+        }
+
+        /// @brief Returns the thread's router
+        SUMOAbstractRouter<MSEdge, SUMOVehicle>& getRouter() const {
+            return *myRouter;
+        }
+
+    private:
+        /// @brief The router used by this thread only
+        SUMOAbstractRouter<MSEdge, SUMOVehicle>* const myRouter;
+
+    private:
+        /// @brief Invalidated copy constructor.
+        RoutingThread(const RoutingThread&);
+
+        /// @brief Invalidated assignment operator.
+        RoutingThread& operator=(const RoutingThread&);
+
+    };
+
+
+    /**
+     * @class RoutingTask
+     * @brief A task computing the new route of a device's holder
+     */
+    class RoutingTask : public FXWorkerThread::Task {
+    public:
+        /// @brief Constructor
+        RoutingTask(MSDevice_Routing& device, const MSEdge* const from, const MSEdge* const to, SUMOTime time)
+            : myDevice(device), myFrom(from), myTo(to), myTime(time) {}
+
+        /// @brief Computes the route into the device's pending route
+        void run(FXWorkerThread* context);
+
+    private:
+        /// @brief The device of the vehicle to route
+        MSDevice_Routing& myDevice;
+
+        /// @brief The begin and the end of the route
+        const MSEdge* const myFrom;
+        const MSEdge* const myTo;
+
+        /// @brief The departure time for the route
+        const SUMOTime myTime;
+
+    private:
+        /// @brief Invalidated assignment operator.
+        RoutingTask& operator=(const RoutingTask&);
+
+    };
+#endif
+
 private:
     /// @brief The period with which a vehicle shall be rerouted
     SUMOTime myPeriod;
@@ -217,6 +414,17 @@ private:
     /// @brief The (optional) command responsible for rerouting
     WrappingCommand< MSDevice_Routing >* myRerouteCommand;
 
+#ifdef HAVE_FOX
+    /// @brief Whether a background rerouting was requested and not yet applied
+    bool myReroutePending;
+
+    /// @brief The route computed in the background
+    MSEdgeVector myPendingRoute;
+
+    /// @brief The cache key of the route computed in the background
+    MSRouteCache::Key myPendingKey;
+#endif
+
     /// @brief The weights adaptation/overwriting command
     static Command* myEdgeWeightSettingCommand;
 
@@ -229,11 +437,26 @@ private:
     /// @brief Information which weight prior edge efforts have
     static SUMOTime myAdaptationInterval;
 
+    /// @brief The time of the last adaptation of the edge efforts
+    static SUMOTime myLastAdaptation;
+
     /// @brief whether taz shall be used at initial rerouting
     static bool myWithTaz;
 
-    /// @brief The container of pre-calculated routes
-    static std::map<std::pair<const MSEdge*, const MSEdge*>, const MSRoute*> myCachedRoutes;
+    /// @brief The cache of pre-calculated routes (0 if not used)
+    static MSRouteCache* myRouteCache;
+
+    /// @brief Whether all reroutings (not only the ones between zones) use the cache
+    static bool myCacheAll;
+
+    /// @brief The relative change of an edge effort invalidating the cached routes over the edge
+    static SUMOReal myCacheThreshold;
+
+    /// @brief The smallest and the largest effort of each edge the cached routes over the edge were computed with (negative if none)
+    static std::vector<std::pair<SUMOReal, SUMOReal> > myCacheEffortRanges;
+
+    /// @brief The epoch of the edge efforts, increased when all cached routes become invalid
+    static unsigned int myCacheEpoch;
 
     /// @brief The router to use
     static SUMOAbstractRouter<MSEdge, SUMOVehicle>* myRouter;
@@ -241,6 +464,28 @@ private:
     /// @brief the vehicles which explicitly carry a device
     static std::set<std::string> myExplicitIDs;
 
+#ifdef HAVE_FOX
+    /// @brief The threads computing reroutings in the background
+    static FXWorkerThread::Pool myThreadPool;
+
+    /// @brief The devices which requested a background rerouting, in the order of the requests
+    static std::vector<MSDevice_Routing*> myPendingReroutes;
+#endif
+
+    /// @brief The edge state used by the routing threads
+    struct EdgeSnapshot {
+        /// @brief The edge effort (negative if the edge has none)
+        SUMOReal effort;
+        /// @brief The speed limit of the edge
+        SUMOReal speedLimit;
+    };
+
+    /// @brief The edge states used by the routing threads, indexed by the edges' numerical ids
+    static std::vector<EdgeSnapshot> myEdgeSnapshot;
+
+    /// @brief The step in which the snapshot was taken
+    static SUMOTime mySnapshotTime;
+
 
 private:
     /// @brief Invalidated copy constructor.
@@ -33,7 +33,9 @@
 #include <microsim/MSLane.h>
 #include <microsim/MSVehicle.h>
 #include <utils/options/OptionsCont.h>
+#include <utils/common/FileHelpers.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include "MSDevice_Tripinfo.h"
 
 #ifdef CHECK_MEMORY_LEAKS
@@ -148,6 +150,20 @@ MSDevice_Tripinfo::generateOutput() const {
 }
 
 
+void
+MSDevice_Tripinfo::saveState(std::ostream& os) const {
+    FileHelpers::writeString(os, myDepartLane);
+    FileHelpers::writeFloat(os, myDepartPos);
+    FileHelpers::writeFloat(os, myDepartSpeed);
+    FileHelpers::writeUInt(os, myWaitingSteps);
+}
+
+
+void
+MSDevice_Tripinfo::loadState(BinaryInputDevice& bis) {
+    bis >> myDepartLane >> myDepartPos >> myDepartSpeed >> myWaitingSteps;
+}
+
 
 /****************************************************************************/
 
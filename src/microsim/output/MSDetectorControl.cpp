@@ -34,11 +34,14 @@
 #endif
 
 #include <iostream>
+#include <sstream>
 #include "MSDetectorControl.h"
 #include "MSMeanData_Net.h"
 #include <utils/options/OptionsCont.h>
 #include <utils/options/Option.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 
 #ifdef HAVE_INTERNAL
 #include <mesosim/MEInductLoop.h>
@@ -156,6 +159,85 @@ MSDetectorControl::writeOutput(SUMOTime step, bool closing) {
 }
 
 
+void
+MSDetectorControl::saveState(std::ostream& os) const {
+    FileHelpers::writeUInt(os, (unsigned int) myLastCalls.size());
+    for (std::map<IntervalsKey, SUMOTime>::const_iterator i = myLastCalls.begin(); i != myLastCalls.end(); ++i) {
+        FileHelpers::writeTime(os, (*i).first.first);
+        FileHelpers::writeTime(os, (*i).first.second);
+        FileHelpers::writeTime(os, (*i).second);
+    }
+    unsigned int numDetectors = 0;
+    for (std::map<SumoXMLTag, NamedObjectCont<MSDetectorFileOutput*> >::const_iterator i = myDetectors.begin(); i != myDetectors.end(); ++i) {
+        numDetectors += (unsigned int)(*i).second.size();
+    }
+    FileHelpers::writeUInt(os, numDetectors);
+    for (std::map<SumoXMLTag, NamedObjectCont<MSDetectorFileOutput*> >::const_iterator i = myDetectors.begin(); i != myDetectors.end(); ++i) {
+        const std::map<std::string, MSDetectorFileOutput*>& dets = (*i).second.getMyMap();
+        for (std::map<std::string, MSDetectorFileOutput*>::const_iterator j = dets.begin(); j != dets.end(); ++j) {
+            std::ostringstream state;
+            (*j).second->saveState(state);
+            FileHelpers::writeInt(os, (int)(*i).first);
+            FileHelpers::writeString(os, (*j).first);
+            FileHelpers::writeString(os, state.str());
+        }
+    }
+}
+
+
+std::string
+MSDetectorControl::getUnsavableDetectorID() const {
+    for (std::map<SumoXMLTag, NamedObjectCont<MSDetectorFileOutput*> >::const_iterator i = myDetectors.begin(); i != myDetectors.end(); ++i) {
+        const std::map<std::string, MSDetectorFileOutput*>& dets = (*i).second.getMyMap();
+        for (std::map<std::string, MSDetectorFileOutput*>::const_iterator j = dets.begin(); j != dets.end(); ++j) {
+            if (!(*j).second->canSaveState()) {
+                return (*j).first;
+            }
+        }
+    }
+    for (std::vector<MSMeanData*>::const_iterator i = myMeanData.begin(); i != myMeanData.end(); ++i) {
+        if (!(*i)->canSaveState()) {
+            return (*i)->getID();
+        }
+    }
+    return "";
+}
+
+
+void
+MSDetectorControl::loadState(BinaryInputDevice& bis, const SUMOTime offset) {
+    unsigned int numIntervals;
+    bis >> numIntervals;
+    for (; numIntervals > 0; numIntervals--) {
+        SUMOTime interval, begin, lastCall;
+        bis >> interval >> begin >> lastCall;
+        // the begin of the intervals may have been changed, so fall back to the interval length
+        std::map<IntervalsKey, SUMOTime>::iterator i = myLastCalls.find(std::make_pair(interval, begin));
+        for (std::map<IntervalsKey, SUMOTime>::iterator j = myLastCalls.begin(); j != myLastCalls.end() && i == myLastCalls.end(); ++j) {
+            if ((*j).first.first == interval) {
+                i = j;
+            }
+        }
+        if (i != myLastCalls.end()) {
+            (*i).second = lastCall + offset;
+        }
+    }
+    unsigned int numDetectors;
+    bis >> numDetectors;
+    for (; numDetectors > 0; numDetectors--) {
+        int type;
+        std::string id;
+        unsigned int size;
+        bis >> type >> id >> size;
+        MSDetectorFileOutput* det = getTypedDetectors((SumoXMLTag) type).get(id);
+        if (det != 0) {
+            det->loadState(bis, offset);
+        } else {
+            bis.getIStream().ignore(size);
+        }
+    }
+}
+
 void
 MSDetectorControl::addDetectorAndInterval(MSDetectorFileOutput* det,
         OutputDevice* device,
@@ -53,6 +53,7 @@
 // class declarations
 // ===========================================================================
 class MSMeanData;
+class BinaryInputDevice;
 
 
 // ===========================================================================
@@ -188,6 +189,32 @@ public:
     void writeOutput(SUMOTime step, bool closing);
 
 
+    /** @brief Saves the times of the last outputs and the states of all detectors
+     *
+     * The state of each detector is prefixed by its size so that detectors
+     *  which are not known when loading may be skipped.
+     * @param[in] os The stream to write the state into (binary)
+     * @see MSDetectorFileOutput::saveState
+     */
+    void saveState(std::ostream& os) const;
+
+
+    /** @brief Returns the id of a detector whose state can not be saved
+     * @return The id of the first such detector, "" if all states can be saved
+     * @see MSDetectorFileOutput::canSaveState
+     */
+    std::string getUnsavableDetectorID() const;
+
+
+    /** @brief Loads the times of the last outputs and the states of the detectors
+     *
+     * @param[in] bis The input to read the state from (binary)
+     * @param[in] offset The offset to add to the stored times
+     * @see MSDetectorFileOutput::loadState
+     */
+    void loadState(BinaryInputDevice& bis, const SUMOTime offset);
+
+
 protected:
     /// @name Structures needed for assigning detectors to intervals
     /// @{
@@ -44,6 +44,7 @@
 // class declarations
 // ===========================================================================
 class GUIDetectorWrapper;
+class BinaryInputDevice;
 
 
 // ===========================================================================
@@ -125,6 +126,44 @@ public:
     }
 
 
+    /// @name State I/O
+    /// @{
+
+    /** @brief Returns whether saveState stores everything the detector needs to continue
+     *
+     * Saving the simulation state is refused if a detector returns false,
+     *  which is the default.
+     * @return Whether the detector's state is saved completely
+     */
+    virtual bool canSaveState() const {
+        return false;
+    }
+
+
+    /** @brief Saves the detector's internal state
+     *
+     * Detectors which do not keep state between the intervals need not
+     *  overwrite this.
+     * @param[in] os The stream to write the state into (binary)
+     */
+    virtual void saveState(std::ostream& os) const {
+        UNUSED_PARAMETER(os);
+    }
+
+
+    /** @brief Loads the detector's internal state
+     *
+     * Must read exactly what saveState has written.
+     * @param[in] bis The input to read the state from (binary)
+     * @param[in] offset The offset to add to the stored times
+     */
+    virtual void loadState(BinaryInputDevice& bis, const SUMOTime offset) {
+        UNUSED_PARAMETER(bis);
+        UNUSED_PARAMETER(offset);
+    }
+    /// @}
+
+
 private:
     /// @brief Invalidated copy constructor.
     MSDetectorFileOutput(const MSDetectorFileOutput&);
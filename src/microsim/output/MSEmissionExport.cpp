@@ -55,11 +55,12 @@ MSEmissionExport::write(OutputDevice& of, SUMOTime timestep) {
     of.openTag("timestep") << " time=\"" << time2string(timestep) << "\">\n";
 
     MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
-    MSVehicleControl::constVehIt it = vc.loadedVehBegin();
-    MSVehicleControl::constVehIt end = vc.loadedVehEnd();
+    const std::vector<SUMOVehicle*>& vehicles = vc.getRunningVehicles();
+    std::vector<SUMOVehicle*>::const_iterator it = vehicles.begin();
+    std::vector<SUMOVehicle*>::const_iterator end = vehicles.end();
 
     for (; it != end; ++it) {
-        const MSVehicle* veh = static_cast<const MSVehicle*>((*it).second);
+        const MSVehicle* veh = static_cast<const MSVehicle*>(*it);
 
         if (veh->isOnRoad()) {
 
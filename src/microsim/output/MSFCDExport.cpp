@@ -27,6 +27,7 @@
 #endif
 
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/ColumnarFCDWriter.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/geom/GeoConvHelper.h>
 #include <microsim/MSEdgeControl.h>
@@ -47,6 +48,12 @@
 #endif // CHECK_MEMORY_LEAKS
 
 
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+ColumnarFCDWriter* MSFCDExport::myColumnarWriter = 0;
+
+
 // ===========================================================================
 // method definitions
 // ===========================================================================
@@ -54,12 +61,13 @@ void
 MSFCDExport::write(OutputDevice& of, SUMOTime timestep) {
     const bool useGeo = OptionsCont::getOptions().getBool("fcd-output.geo");
     MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
-    MSVehicleControl::constVehIt it = vc.loadedVehBegin();
-    MSVehicleControl::constVehIt end = vc.loadedVehEnd();
+    const std::vector<SUMOVehicle*>& vehicles = vc.getRunningVehicles();
+    std::vector<SUMOVehicle*>::const_iterator it = vehicles.begin();
+    std::vector<SUMOVehicle*>::const_iterator end = vehicles.end();
 
     of.openTag("timestep") << " time=\"" << time2string(timestep) << "\">\n";
     for (; it != end; ++it) {
-        const MSVehicle* veh = static_cast<const MSVehicle*>((*it).second);
+        const MSVehicle* veh = static_cast<const MSVehicle*>(*it);
         if (veh->isOnRoad()) {
             std::string fclass = veh->getVehicleType().getID();
             fclass = fclass.substr(0, fclass.find_first_of("@"));
@@ -82,4 +90,42 @@ MSFCDExport::write(OutputDevice& of, SUMOTime timestep) {
     of.closeTag();
 }
 
+
+void
+MSFCDExport::writeColumnar(OutputDevice& of, SUMOTime timestep) {
+    const bool useGeo = OptionsCont::getOptions().getBool("fcd-output.geo");
+    if (myColumnarWriter == 0) {
+        myColumnarWriter = new ColumnarFCDWriter(useGeo ? GEO_OUTPUT_ACCURACY : OUTPUT_ACCURACY, OUTPUT_ACCURACY);
+    }
+    MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
+    const std::vector<SUMOVehicle*>& vehicles = vc.getRunningVehicles();
+    const std::vector<unsigned int>& handles = vc.getRunningHandles();
+    for (size_t i = 0; i < vehicles.size(); ++i) {
+        const MSVehicle* veh = static_cast<const MSVehicle*>(vehicles[i]);
+        if (veh->isOnRoad()) {
+            const std::string& type = veh->getVehicleType().getID();
+            Position pos = veh->getLane()->getShape().positionAtLengthPosition(
+                               veh->getLane()->interpolateLanePosToGeometryPos(veh->getPositionOnLane()));
+            if (useGeo) {
+                GeoConvHelper::getFinal().cartesian2geo(pos);
+            }
+            // the vehicle handle lets the writer find the string handles without a lookup
+            const size_t typeEnd = type.find('@');
+            if (typeEnd == std::string::npos) {
+                myColumnarWriter->add(handles[i], veh->getID(), type, pos.x(), pos.y(), veh->getAngle(), veh->getSpeed());
+            } else {
+                myColumnarWriter->add(handles[i], veh->getID(), type.substr(0, typeEnd), pos.x(), pos.y(), veh->getAngle(), veh->getSpeed());
+            }
+        }
+    }
+    myColumnarWriter->writeStep(of, timestep);
+}
+
+
+void
+MSFCDExport::cleanup() {
+    delete myColumnarWriter;
+    myColumnarWriter = 0;
+}
+
 /****************************************************************************/
@@ -35,6 +35,7 @@
 // class declarations
 // ===========================================================================
 class OutputDevice;
+class ColumnarFCDWriter;
 class MSEdgeControl;
 class MSEdge;
 class MSLane;
@@ -65,6 +66,26 @@ public:
     static void write(OutputDevice& of, SUMOTime timestep);
 
 
+    /** @brief Writes the same values as write as a columnar binary block
+     *
+     * The dictionary of ids and types is kept between the calls.
+     *
+     * @param[in] of The output device to use (opened for binary output)
+     * @param[in] timestep The current time step
+     * @see ColumnarFCDWriter
+     */
+    static void writeColumnar(OutputDevice& of, SUMOTime timestep);
+
+
+    /// @brief Deletes the columnar writer
+    static void cleanup();
+
+
+private:
+    /// @brief The writer of the columnar output (built with the first step)
+    static ColumnarFCDWriter* myColumnarWriter;
+
+
 private:
     /// @brief Invalidated copy constructor.
     MSFCDExport(const MSFCDExport&);
@@ -76,12 +76,13 @@ MSFullExport::writeVehicles(OutputDevice& of) {
 
     const std::string indent("    ");
     MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
-    MSVehicleControl::constVehIt it = vc.loadedVehBegin();
-    MSVehicleControl::constVehIt end = vc.loadedVehEnd();
+    const std::vector<SUMOVehicle*>& vehicles = vc.getRunningVehicles();
+    std::vector<SUMOVehicle*>::const_iterator it = vehicles.begin();
+    std::vector<SUMOVehicle*>::const_iterator end = vehicles.end();
 
 
     for (; it != end; ++it) {
-        const MSVehicle* veh = static_cast<const MSVehicle*>((*it).second);
+        const MSVehicle* veh = static_cast<const MSVehicle*>(*it);
 
         if (veh->isOnRoad()) {
 
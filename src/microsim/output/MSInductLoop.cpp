@@ -43,10 +43,13 @@
 #include <microsim/MSLane.h>
 #include <microsim/MSVehicle.h>
 #include <microsim/MSNet.h>
+#include <microsim/MSVehicleControl.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/UtilExceptions.h>
 #include <utils/common/StringUtils.h>
+#include <utils/common/FileHelpers.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -273,6 +276,72 @@ MSInductLoop::writeTypedXMLOutput(OutputDevice& dev, SUMOTime startTime, SUMOTim
 }
 
 
+void
+MSInductLoop::saveState(std::ostream& os) const {
+    FileHelpers::writeFloat(os, myLastLeaveTime);
+    FileHelpers::writeFloat(os, myLastOccupancy);
+    FileHelpers::writeUInt(os, myDismissedVehicleNumber);
+    saveVehicleData(os, myVehicleDataCont);
+    saveVehicleData(os, myLastVehicleDataCont);
+    FileHelpers::writeUInt(os, (unsigned int) myVehiclesOnDet.size());
+    for (VehicleMap::const_iterator i = myVehiclesOnDet.begin(); i != myVehiclesOnDet.end(); ++i) {
+        FileHelpers::writeString(os, i->first->getID());
+        FileHelpers::writeFloat(os, i->second);
+    }
+}
+
+
+void
+MSInductLoop::loadState(BinaryInputDevice& bis, const SUMOTime offset) {
+    const SUMOReal timeOffset = STEPS2TIME(offset);
+    bis >> myLastLeaveTime >> myLastOccupancy >> myDismissedVehicleNumber;
+    myLastLeaveTime += timeOffset;
+    loadVehicleData(bis, timeOffset, myVehicleDataCont);
+    loadVehicleData(bis, timeOffset, myLastVehicleDataCont);
+    myVehiclesOnDet.clear();
+    unsigned int numVehicles;
+    bis >> numVehicles;
+    MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
+    for (; numVehicles > 0; numVehicles--) {
+        std::string id;
+        SUMOReal entryTime;
+        bis >> id >> entryTime;
+        SUMOVehicle* veh = vc.getVehicle(id);
+        if (veh == 0) {
+            throw ProcessError("Unknown vehicle '" + id + "' on induction loop '" + getID() + "' in the loaded state.");
+        }
+        myVehiclesOnDet[veh] = entryTime + timeOffset;
+    }
+}
+
+
+void
+MSInductLoop::saveVehicleData(std::ostream& os, const VehicleDataCont& data) {
+    FileHelpers::writeUInt(os, (unsigned int) data.size());
+    for (VehicleDataCont::const_iterator i = data.begin(); i != data.end(); ++i) {
+        FileHelpers::writeString(os, i->idM);
+        FileHelpers::writeFloat(os, i->lengthM);
+        FileHelpers::writeFloat(os, i->entryTimeM);
+        FileHelpers::writeFloat(os, i->leaveTimeM);
+        FileHelpers::writeString(os, i->typeIDM);
+    }
+}
+
+
+void
+MSInductLoop::loadVehicleData(BinaryInputDevice& bis, const SUMOReal timeOffset, VehicleDataCont& into) {
+    into.clear();
+    unsigned int size;
+    bis >> size;
+    for (; size > 0; size--) {
+        std::string id, typeID;
+        SUMOReal length, entryTime, leaveTime;
+        bis >> id >> length >> entryTime >> leaveTime >> typeID;
+        into.push_back(VehicleData(id, length, entryTime + timeOffset, leaveTime + timeOffset, typeID));
+    }
+}
+
+
 void
 MSInductLoop::enterDetectorByMove(SUMOVehicle& veh,
                                   SUMOReal entryTimestep) {
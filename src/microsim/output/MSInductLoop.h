@@ -243,6 +243,33 @@ public:
      * @exception IOError If an error on writing occurs (!!! not yet implemented)
      */
     void writeXMLDetectorProlog(OutputDevice& dev) const;
+
+
+    /** @brief Saves the collected vehicle data and the vehicles on the detector
+     *
+     * @param[in] os The stream to write the state into (binary)
+     * @see MSDetectorFileOutput::saveState
+     */
+    void saveState(std::ostream& os) const;
+
+
+    /** @brief Returns whether the state is saved (always)
+     * @return true
+     * @see MSDetectorFileOutput::canSaveState
+     */
+    bool canSaveState() const {
+        return true;
+    }
+
+
+    /** @brief Loads the collected vehicle data and the vehicles on the detector
+     *
+     * The vehicles must have been loaded before.
+     * @param[in] bis The input to read the state from (binary)
+     * @param[in] offset The offset to add to the stored times
+     * @see MSDetectorFileOutput::loadState
+     */
+    void loadState(BinaryInputDevice& bis, const SUMOTime offset);
     /// @}
 
 
@@ -371,6 +398,12 @@ protected:
     void writeTypedXMLOutput(OutputDevice& dev, SUMOTime startTime, SUMOTime stopTime,
                              const std::string& type, const VehicleDataCont& vdc, const VehicleMap& vm);
 
+    /// @brief Writes the given vehicle data into the state
+    static void saveVehicleData(std::ostream& os, const VehicleDataCont& data);
+
+    /// @brief Reads vehicle data from the state, shifting the times by the given offset [s]
+    static void loadVehicleData(BinaryInputDevice& bis, const SUMOReal timeOffset, VehicleDataCont& into);
+
 private:
     /// @brief Invalidated copy constructor.
     MSInductLoop(const MSInductLoop&);
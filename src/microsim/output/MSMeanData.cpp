@@ -36,6 +36,7 @@
 #include <microsim/MSLane.h>
 #include <microsim/MSVehicle.h>
 #include <microsim/MSNet.h>
+#include <microsim/MSGlobals.h>
 #include <utils/common/SUMOTime.h>
 #include <utils/common/ToString.h>
 #include <utils/iodevices/OutputDevice.h>
@@ -43,7 +44,6 @@
 #include <limits>
 
 #ifdef HAVE_INTERNAL
-#include <microsim/MSGlobals.h>
 #include <mesosim/MELoop.h>
 #include <mesosim/MESegment.h>
 #endif
@@ -457,15 +457,51 @@ MSMeanData::writeXMLOutput(OutputDevice& dev,
         }
         dev.openTag(SUMO_TAG_INTERVAL).writeAttr(SUMO_ATTR_BEGIN, STEPS2TIME(startTime)).writeAttr(SUMO_ATTR_END, STEPS2TIME(stopTime));
         dev.writeAttr(SUMO_ATTR_ID, myID).closeOpener();
-        std::vector<MSEdge*>::iterator edge = myEdges.begin();
-        for (std::vector<std::vector<MeanDataValues*> >::const_iterator i = myMeasures.begin(); i != myMeasures.end(); ++i, ++edge) {
-            writeEdge(dev, (*i), *edge, startTime, stopTime);
-        }
+        writeEdges(dev, startTime, stopTime);
         dev.closeTag();
     }
 }
 
 
+void
+MSMeanData::writeEdges(OutputDevice& dev, SUMOTime startTime, SUMOTime stopTime) {
+#ifdef HAVE_FOX
+    FXWorkerThread::Pool& pool = MSNet::getInstance()->getEdgeControl().getThreadPool();
+    bool parallel = MSGlobals::gParallelMeanData && pool.size() > 0 && !myTrackVehicles && !dev.isBinary();
+#ifdef HAVE_INTERNAL
+    parallel &= !MSGlobals::gUseMesoSim;
+#endif
+    if (parallel) {
+        // more ranges than threads to balance edges with many and few lanes
+        const size_t numTasks = MIN2(myEdges.size(), (size_t)(4 * pool.size()));
+        std::vector<WriteTask*> tasks;
+        for (size_t i = 0; i < numTasks; ++i) {
+            tasks.push_back(new WriteTask(*this, myEdges.size() * i / numTasks, myEdges.size() * (i + 1) / numTasks, startTime, stopTime));
+            pool.add(tasks.back());
+        }
+        try {
+            pool.waitAll(false);
+        } catch (ProcessError&) {
+            // all tasks are finished when the error is passed on
+            for (std::vector<WriteTask*>::iterator i = tasks.begin(); i != tasks.end(); ++i) {
+                delete *i;
+            }
+            throw;
+        }
+        for (std::vector<WriteTask*>::iterator i = tasks.begin(); i != tasks.end(); ++i) {
+            dev << (*i)->getOutput();
+            delete *i;
+        }
+        return;
+    }
+#endif
+    std::vector<MSEdge*>::iterator edge = myEdges.begin();
+    for (std::vector<std::vector<MeanDataValues*> >::const_iterator i = myMeasures.begin(); i != myMeasures.end(); ++i, ++edge) {
+        writeEdge(dev, (*i), *edge, startTime, stopTime);
+    }
+}
+
+
 void
 MSMeanData::writeXMLDetectorProlog(OutputDevice& dev) const {
     dev.writeXMLHeader("netstats");
@@ -480,5 +516,28 @@ MSMeanData::detectorUpdate(const SUMOTime step) {
 }
 
 
+#ifdef HAVE_FOX
+// ---------------------------------------------------------------------------
+// MSMeanData::WriteTask - methods
+// ---------------------------------------------------------------------------
+MSMeanData::WriteTask::WriteTask(MSMeanData& parent, const size_t begin, const size_t end,
+                                 const SUMOTime startTime, const SUMOTime stopTime)
+    : myParent(parent), myBegin(begin), myEnd(end), myStartTime(startTime), myStopTime(stopTime),
+      // the edges are nested in the root element and the interval
+      myOutput(false, 2) {
+    myOutput.setPrecision();
+    myOutput << std::setiosflags(std::ios::fixed);
+}
+
+
+void
+MSMeanData::WriteTask::run(FXWorkerThread* /* context */) {
+    for (size_t i = myBegin; i < myEnd; ++i) {
+        myParent.writeEdge(myOutput, myParent.myMeasures[i], myParent.myEdges[i], myStartTime, myStopTime);
+    }
+}
+#endif
+
+
 /****************************************************************************/
 
@@ -39,6 +39,11 @@
 #include <microsim/MSMoveReminder.h>
 #include <utils/common/SUMOTime.h>
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#include <utils/iodevices/OutputDevice_String.h>
+#endif
+
 
 // ===========================================================================
 // class declarations
@@ -397,6 +402,20 @@ protected:
     void writeEdge(OutputDevice& dev, const std::vector<MeanDataValues*>& edgeValues,
                    MSEdge* edge, SUMOTime startTime, SUMOTime stopTime);
 
+    /** @brief Writes the values of all edges into the given stream
+     *
+     * If parallel writing is enabled, consecutive ranges of edges are
+     *  written into separate buffers by the simulation's worker threads.
+     *  The buffers are appended to the device in the order of the edges,
+     *  so the output does not depend on the number of threads.
+     *
+     * @param[in] dev The output device to write the data into
+     * @param[in] startTime First time step the data were gathered
+     * @param[in] stopTime Last time step the data were gathered
+     * @exception IOError If an error on writing occurs (!!! not yet implemented)
+     */
+    void writeEdges(OutputDevice& dev, SUMOTime startTime, SUMOTime stopTime);
+
     /** @brief Checks for emptiness and writes prefix into the given stream
      *
      * @param[in] dev The output device to write the data into
@@ -409,6 +428,51 @@ protected:
     bool writePrefix(OutputDevice& dev, const MeanDataValues& values,
                      const SumoXMLTag tag, const std::string id) const;
 
+#ifdef HAVE_FOX
+    /**
+     * @class WriteTask
+     * @brief Aggregates and writes a range of edges into its own buffer in a worker thread
+     */
+    class WriteTask : public FXWorkerThread::Task {
+    public:
+        /** @brief Constructor
+         * @param[in] parent The mean data to write
+         * @param[in] begin The index of the first edge to write
+         * @param[in] end The index after the last edge to write
+         * @param[in] startTime First time step the data were gathered
+         * @param[in] stopTime Last time step the data were gathered
+         */
+        WriteTask(MSMeanData& parent, const size_t begin, const size_t end,
+                  const SUMOTime startTime, const SUMOTime stopTime);
+
+        /// @brief Writes the edges into the buffer
+        void run(FXWorkerThread* context);
+
+        /// @brief Returns the written output
+        std::string getOutput() {
+            return myOutput.getString();
+        }
+
+    private:
+        /// @brief The mean data to write
+        MSMeanData& myParent;
+
+        /// @brief The range of edges to write
+        const size_t myBegin, myEnd;
+
+        /// @brief The interval the data were gathered in
+        const SUMOTime myStartTime, myStopTime;
+
+        /// @brief The buffer to write into
+        OutputDevice_String myOutput;
+
+    private:
+        /// @brief Invalidated assignment operator.
+        WriteTask& operator=(const WriteTask&);
+
+    };
+#endif
+
 protected:
     /// @brief the minimum sample seconds
     const SUMOReal myMinSamples;
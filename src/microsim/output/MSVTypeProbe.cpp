@@ -67,10 +67,11 @@ MSVTypeProbe::execute(SUMOTime currentTime) {
     const std::string indent("    ");
     myOutputDevice << indent << "<timestep time=\"" << time2string(currentTime) << "\" id=\"" << getID() << "\" vType=\"" << myVType << "\">" << "\n";
     MSVehicleControl& vc = MSNet::getInstance()->getVehicleControl();
-    MSVehicleControl::constVehIt it = vc.loadedVehBegin();
-    MSVehicleControl::constVehIt end = vc.loadedVehEnd();
+    const std::vector<SUMOVehicle*>& vehicles = vc.getRunningVehicles();
+    std::vector<SUMOVehicle*>::const_iterator it = vehicles.begin();
+    std::vector<SUMOVehicle*>::const_iterator end = vehicles.end();
     for (; it != end; ++it) {
-        const MSVehicle* veh = static_cast<const MSVehicle*>((*it).second);
+        const MSVehicle* veh = static_cast<const MSVehicle*>(*it);
         if (myVType == "" || myVType == veh->getVehicleType().getID()) {
             if (!veh->isOnRoad()) {
                 continue;
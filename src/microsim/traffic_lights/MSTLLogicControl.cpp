@@ -45,6 +45,8 @@
 #include <utils/common/TplConvert.h>
 #include <utils/common/ToString.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -657,6 +659,43 @@ MSTLLogicControl::switchTo(const std::string& id, const std::string& programID)
 }
 
 
+void
+MSTLLogicControl::saveState(std::ostream& os, SUMOTime step) const {
+    FileHelpers::writeUInt(os, (unsigned int) myLogics.size());
+    for (std::map<std::string, TLSLogicVariants*>::const_iterator i = myLogics.begin(); i != myLogics.end(); ++i) {
+        const MSTrafficLightLogic* const active = (*i).second->getActive();
+        const SUMOTime nextSwitch = active->getNextSwitchTime();
+        FileHelpers::writeString(os, (*i).first);
+        FileHelpers::writeString(os, active->getProgramID());
+        FileHelpers::writeUInt(os, active->getCurrentPhaseIndex());
+        FileHelpers::writeTime(os, nextSwitch < 0 ? -1 : nextSwitch - step);
+    }
+}
+
+
+void
+MSTLLogicControl::loadState(BinaryInputDevice& bis, SUMOTime step) {
+    unsigned int numLogics;
+    bis >> numLogics;
+    for (; numLogics > 0; numLogics--) {
+        std::string id, programID;
+        unsigned int phaseIndex;
+        SUMOTime remaining;
+        bis >> id >> programID >> phaseIndex >> remaining;
+        MSTrafficLightLogic* const logic = get(id, programID);
+        if (logic == 0) {
+            WRITE_WARNING("Unknown program '" + programID + "' of tls '" + id + "' in the loaded state.");
+            continue;
+        }
+        if (getActive(id) != logic) {
+            switchTo(id, programID);
+        }
+        if (remaining >= 0 && phaseIndex < logic->getPhaseNumber()) {
+            logic->changeStepAndDuration(*this, step, phaseIndex, remaining);
+        }
+    }
+}
+
 void
 MSTLLogicControl::addWAUT(SUMOTime refTime, const std::string& id,
                           const std::string& startProg) {
@@ -42,6 +42,12 @@
 #include <utils/common/UtilExceptions.h>
 
 
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class BinaryInputDevice;
+
+
 // ===========================================================================
 // class definitions
 // ===========================================================================
@@ -284,6 +290,22 @@ public:
     void switchTo(const std::string& id, const std::string& programID);
 
 
+    /** @brief Saves the active programs, their current phases and the phases' remaining durations
+     * @param[in] os The stream to write the state into (binary)
+     * @param[in] step The current simulation step
+     */
+    void saveState(std::ostream& os, SUMOTime step) const;
+
+
+    /** @brief Restores the active programs and their phases
+     *
+     * Traffic lights or programs which are not known are skipped with a warning.
+     * @param[in] bis The input to read the state from (binary)
+     * @param[in] step The current (loaded) simulation step
+     */
+    void loadState(BinaryInputDevice& bis, SUMOTime step);
+
+
 
     /// @name WAUT definition methods
     /// @{
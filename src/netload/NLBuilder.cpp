@@ -125,8 +125,8 @@ NLBuilder::build() {
         return false;
     }
     buildNet();
-#ifdef HAVE_INTERNAL
-    // load the previous state if wished
+    // load the routes of the previous state if wished
+    std::streampos dynamicStatePos = 0;
     if (myOptions.isSet("load-state")) {
         long before = SysUtils::getCurrentMillis();
         BinaryInputDevice strm(myOptions.getString("load-state"));
@@ -135,6 +135,7 @@ NLBuilder::build() {
         } else {
             PROGRESS_BEGIN_MESSAGE("Loading state from '" + myOptions.getString("load-state") + "'");
             SUMOTime step = myNet.loadState(strm);
+            dynamicStatePos = strm.getIStream().tellg();
             if (myOptions.isDefault("begin")) {
                 myOptions.set("begin", time2string(step));
             }
@@ -147,7 +148,6 @@ NLBuilder::build() {
         }
         MsgHandler::getMessageInstance()->endProcessMsg("done (" + toString(SysUtils::getCurrentMillis() - before) + "ms).");
     }
-#endif
     // load weights if wished
     if (myOptions.isSet("weight-files")) {
         if (!myOptions.isUsableFileList("weight-files")) {
@@ -192,6 +192,24 @@ NLBuilder::build() {
             return false;
         }
     }
+    // refuse saving an incomplete state as early as possible
+    if (!myOptions.getIntVector("save-state.times").empty()) {
+        myNet.checkStateSaving();
+    }
+    // load the vehicles, signal and detector states of the previous state
+    //  (they may refer to types, routes and detectors from the files above)
+    if (myOptions.isSet("load-state")) {
+        long before = SysUtils::getCurrentMillis();
+        BinaryInputDevice strm(myOptions.getString("load-state"));
+        strm.getIStream().seekg(dynamicStatePos);
+        PROGRESS_BEGIN_MESSAGE("Loading vehicles from '" + myOptions.getString("load-state") + "'");
+        myNet.loadDynamicState(strm, string2time(myOptions.getString("begin")));
+        if (!strm.good()) {
+            WRITE_ERROR("Could not read state from '" + myOptions.getString("load-state") + "'!");
+            return false;
+        }
+        MsgHandler::getMessageInstance()->endProcessMsg("done (" + toString(SysUtils::getCurrentMillis() - before) + "ms).");
+    }
     WRITE_MESSAGE("Loading done.");
     return true;
 }
@@ -211,7 +229,6 @@ NLBuilder::buildNet() {
         MSFrame::buildStreams();
         std::vector<SUMOTime> stateDumpTimes;
         std::vector<std::string> stateDumpFiles;
-#ifdef HAVE_INTERNAL
         const std::vector<int> times = myOptions.getIntVector("save-state.times");
         for (std::vector<int>::const_iterator i = times.begin(); i != times.end(); ++i) {
             stateDumpTimes.push_back(TIME2STEPS(*i));
@@ -227,7 +244,6 @@ NLBuilder::buildNet() {
                 stateDumpFiles.push_back(prefix + "_" + time2string(*i) + ".bin");
             }
         }
-#endif
         myNet.closeBuilding(edges, junctions, routeLoaders, tlc, stateDumpTimes, stateDumpFiles);
     } catch (IOError& e) {
         delete edges;
@@ -58,6 +58,7 @@ ROCostCalculator::ROCostCalculator() {
     myMaxRouteNumber = oc.getInt("max-alternatives");
     myKeepRoutes = oc.getBool("keep-all-routes");
     mySkipRouteCalculation = oc.getBool("skip-new-routes");
+    myIncrementalTolerance = oc.getFloat("incremental.tolerance");
 }
 
 
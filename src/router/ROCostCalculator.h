@@ -72,6 +72,11 @@ public:
         return mySkipRouteCalculation;
     }
 
+    /// @brief Returns the relative change of costs up to which loaded routes are reused (negative if disabled)
+    SUMOReal getIncrementalTolerance() const {
+        return myIncrementalTolerance;
+    }
+
 protected:
     /// @brief Constructor
     ROCostCalculator();
@@ -91,6 +96,9 @@ private:
     /// @brief Information whether new routes should be calculated
     bool mySkipRouteCalculation;
 
+    /// @brief The relative change of costs up to which loaded routes are reused
+    SUMOReal myIncrementalTolerance;
+
 };
 
 
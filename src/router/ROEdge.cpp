@@ -36,12 +36,16 @@
 #include <algorithm>
 #include <cassert>
 #include <iostream>
+#include <limits>
 #include "ROLane.h"
 #include "ROEdge.h"
 #include "ROVehicle.h"
 #include <utils/common/SUMOVTypeParameter.h>
 #include <utils/common/HelpersHBEFA.h>
 #include <utils/common/HelpersHarmonoise.h>
+#ifdef HAVE_FOX
+#include <utils/foxtools/MFXMutex.h>
+#endif
 
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
@@ -57,6 +61,10 @@ bool ROEdge::myInterpolate = false;
 bool ROEdge::myHaveTTWarned = false;
 bool ROEdge::myHaveEWarned = false;
 std::vector<ROEdge*> ROEdge::myEdges;
+#ifdef HAVE_FOX
+// guards the warning flags, the edges are read by several routing threads
+static MFXMutex warningLock;
+#endif
 
 
 // ===========================================================================
@@ -66,6 +74,7 @@ ROEdge::ROEdge(const std::string& id, RONode* from, RONode* to, unsigned int ind
     : myID(id), mySpeed(-1),
       myIndex(index), myLength(-1),
       myUsingTTTimeLine(false),
+      myMinTravelTime(std::numeric_limits<SUMOReal>::max()),
       myUsingETimeLine(false),
       myFromNode(from), myToNode(to) {
     while (myEdges.size() <= index) {
@@ -118,6 +127,7 @@ void
 ROEdge::addTravelTime(SUMOReal value, SUMOReal timeBegin, SUMOReal timeEnd) {
     myTravelTimes.add(timeBegin, timeEnd, value);
     myUsingTTTimeLine = true;
+    myMinTravelTime = MIN2(myMinTravelTime, value);
 }
 
 
@@ -144,6 +154,9 @@ ROEdge::getDistanceTo(const ROEdge* other) const {
 
 SUMOReal
 ROEdge::getTravelTime(const ROVehicle* const veh, SUMOReal time) const {
+    if (veh == 0) {
+        return getTravelTime(time);
+    }
     return getTravelTime(veh->getType()->maxSpeed, time);
 }
 
@@ -157,9 +170,8 @@ ROEdge::getTravelTime(const SUMOReal maxSpeed, SUMOReal time) const {
 SUMOReal
 ROEdge::getTravelTime(SUMOReal time) const {
     if (myUsingTTTimeLine) {
-        if (!myHaveTTWarned && !myTravelTimes.describesTime(time)) {
-            WRITE_WARNING("No interval matches passed time " + toString(time)  + " in edge '" + myID + "'.\n Using edge's length / edge's speed.");
-            myHaveTTWarned = true;
+        if (!myTravelTimes.describesTime(time)) {
+            warnMissingWeight(myHaveTTWarned, time);
         }
         if (myInterpolate) {
             SUMOReal inTT = myTravelTimes.getValue(time);
@@ -176,7 +188,27 @@ ROEdge::getTravelTime(SUMOReal time) const {
 
 SUMOReal
 ROEdge::getMinimumTravelTime(const ROVehicle* const veh) const {
-    return (SUMOReal)(myLength / MIN2(veh->getType()->maxSpeed, mySpeed));
+    SUMOReal ret = myLength / mySpeed;
+    if (myUsingTTTimeLine) {
+        // interpolated values and filled gaps are never below the smallest loaded one
+        ret = MIN2(ret, myMinTravelTime);
+    }
+    if (veh == 0) {
+        return ret;
+    }
+    return MAX2(myLength / veh->getType()->maxSpeed, ret);
+}
+
+
+void
+ROEdge::warnMissingWeight(bool& warned, SUMOReal time) const {
+#ifdef HAVE_FOX
+    AbstractMutex::ScopedLocker locker(warningLock);
+#endif
+    if (!warned) {
+        WRITE_WARNING("No interval matches passed time " + toString(time)  + " in edge '" + myID + "'.\n Using edge's length / edge's speed.");
+        warned = true;
+    }
 }
 
 
@@ -267,10 +299,7 @@ bool
 ROEdge::getStoredEffort(SUMOReal time, SUMOReal& ret) const {
     if (myUsingETimeLine) {
         if (!myEfforts.describesTime(time)) {
-            if (!myHaveEWarned) {
-                WRITE_WARNING("No interval matches passed time " + toString(time)  + " in edge '" + myID + "'.\n Using edge's length / edge's speed.");
-                myHaveEWarned = true;
-            }
+            warnMissingWeight(myHaveEWarned, time);
             return false;
         }
         if (myInterpolate) {
@@ -337,10 +366,12 @@ ROEdge::buildTimeLines(const std::string& measure) {
             value = HelpersHBEFA::computeFuel(SVE_UNKNOWN, mySpeed, 0) * value;
         }
         myEfforts.fillGaps(value, myUseBoundariesOnOverrideE);
+        myEfforts.buildDenseTable();
     }
     if (myUsingTTTimeLine) {
         SUMOReal value = (SUMOReal)(myLength / mySpeed);
         myTravelTimes.fillGaps(value, myUseBoundariesOnOverrideTT);
+        myTravelTimes.buildDenseTable();
     }
 }
 
@@ -128,6 +128,8 @@ public:
     /** @brief Builds the internal representation of the travel time/effort
      *
      * Should be called after weights / travel times have been loaded.
+     *  Fills the gaps of the time lines and builds their tables for
+     *  looking up values without searching.
      *
      * In the case "weight-attribute" is one of "CO", "CO2", "HC", "NOx", "PMx", or "fuel"
      *  the proper value (departs/s) is computed and multiplied with the travel time.
@@ -312,7 +314,7 @@ public:
 
     /** @brief Returns the travel time for this edge
      *
-     * @param[in] veh The vehicle for which the effort on this edge shall be retrieved
+     * @param[in] veh The vehicle for which the effort on this edge shall be retrieved (0 for no speed limit by the vehicle)
      * @param[in] time The time for which the effort shall be returned [s]
      * @return The traveltime needed by the given vehicle to pass the edge at the given time
      */
@@ -328,10 +330,11 @@ public:
     SUMOReal getTravelTime(const SUMOReal maxSpeed, SUMOReal time) const;
 
 
-    /** @brief Returns the travel time for this edge without using any stored timeLine
+    /** @brief Returns a lower bound of the travel times of this edge
      *
-     * @param[in] veh The vehicle for which the effort on this edge shall be retrieved
-     * @param[in] time The time for which the effort shall be returned [s]
+     * This is the free-flow travel time unless smaller travel times were loaded.
+     *
+     * @param[in] veh The vehicle for which the effort on this edge shall be retrieved (0 for any vehicle)
      */
     SUMOReal getMinimumTravelTime(const ROVehicle* const veh) const;
 
@@ -378,6 +381,16 @@ protected:
     bool getStoredEffort(SUMOReal time, SUMOReal& ret) const;
 
 
+    /** @brief Reports a missing weight unless the given flag says it was reported before
+     *
+     * The flag is shared by all edges and checked and set under a lock as the
+     *  edges are used by several routing threads.
+     * @param[in, out] warned The flag telling whether the warning was written
+     * @param[in] time The time for which no weight is given
+     */
+    void warnMissingWeight(bool& warned, SUMOReal time) const;
+
+
 
 protected:
     /// @brief The id of the edge
@@ -397,6 +410,8 @@ protected:
     mutable ValueTimeLine<SUMOReal> myTravelTimes;
     /// @brief Information whether the time line shall be used instead of the length value
     bool myUsingTTTimeLine;
+    /// @brief The smallest travel time added to the time line
+    SUMOReal myMinTravelTime;
     /// @brief Whether overriding weight boundaries shall be reported
     static bool myUseBoundariesOnOverrideTT;
 
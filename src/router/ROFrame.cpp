@@ -131,16 +131,23 @@ ROFrame::fillOptions(OptionsCont& oc, bool forDuarouter) {
         oc.doRegister("routing-algorithm", new Option_String("dijkstra"));
         oc.addDescription("routing-algorithm", "Processing",
 #ifndef HAVE_INTERNAL // catchall for internal stuff
-                          "Select among routing algorithms ['dijkstra', 'astar']"
+                          "Select among routing algorithms ['dijkstra', 'astar', 'CH', 'CHWrapper']"
 #else
                           "Select among routing algorithms ['dijkstra', 'astar', 'bulkstar', 'CH', 'CHWrapper']"
 #endif
                          );
 
-#ifdef HAVE_INTERNAL // catchall for internal stuff
         oc.doRegister("weight-period", new Option_String("3600", "TIME"));
         oc.addDescription("weight-period", "Processing", "Aggregation period for the given weight files; triggers rebuilding of Contraction Hirarchy");
-#endif
+
+        oc.doRegister("astar.landmarks", new Option_Integer(0));
+        oc.addDescription("astar.landmarks", "Processing", "Use INT landmarks for the lower bounds of the 'astar' routing algorithm");
+
+        oc.doRegister("astar.landmark-distances", new Option_FileName());
+        oc.addDescription("astar.landmark-distances", "Processing", "Load the landmark distances for the 'astar' routing algorithm from FILE (computed with the same weights)");
+
+        oc.doRegister("astar.save-landmark-distances", new Option_FileName());
+        oc.addDescription("astar.save-landmark-distances", "Processing", "Save the computed landmark distances to FILE");
     }
 
     // register defaults options
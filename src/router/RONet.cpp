@@ -35,12 +35,15 @@
 #include <fstream>
 #include <deque>
 #include <queue>
+#include <set>
+#include <map>
 #include "ROEdge.h"
 #include "RONode.h"
 #include "RONet.h"
 #include "RORoute.h"
 #include "RORouteDef.h"
 #include "ROVehicle.h"
+#include "ROCostCalculator.h"
 #include <utils/common/SUMOVTypeParameter.h>
 #include <utils/common/SUMOAbstractRouter.h>
 #include <utils/options/OptionsCont.h>
@@ -63,7 +66,7 @@ RONet::RONet()
     : myVehicleTypes(), myDefaultVTypeMayBeDeleted(true),
       myRoutesOutput(0), myRouteAlternativesOutput(0), myTypesOutput(0),
       myReadRouteNo(0), myDiscardedRouteNo(0), myWrittenRouteNo(0),
-      myHaveRestrictions(false) {
+      myHaveRestrictions(false), myBatchInterval(-1) {
     SUMOVTypeParameter* type = new SUMOVTypeParameter();
     type->id = DEFAULT_VTYPE_ID;
     type->onlyReferenced = true;
@@ -72,6 +75,9 @@ RONet::RONet()
 
 
 RONet::~RONet() {
+#ifdef HAVE_FOX
+    myThreadPool.clear();
+#endif
     myNodes.clear();
     myEdges.clear();
     myVehicleTypes.clear();
@@ -278,6 +284,12 @@ SUMOTime
 RONet::saveAndRemoveRoutesUntil(OptionsCont& options, SUMOAbstractRouter<ROEdge, ROVehicle>& router,
                                 SUMOTime time) {
     SUMOTime lastTime = -1;
+    // the number of vehicles left from the batch whose routes were computed before
+    unsigned int numPrecomputed = 0;
+    bool precompute = myBatchInterval >= 0;
+#ifdef HAVE_FOX
+    precompute |= myThreadPool.size() > 0;
+#endif
     // write all vehicles (and additional structures)
     while (myVehicles.size() != 0) {
         // get the next vehicle
@@ -296,6 +308,12 @@ RONet::saveAndRemoveRoutesUntil(OptionsCont& options, SUMOAbstractRouter<ROEdge,
             }
         }
         lastTime = currentTime;
+        if (precompute) {
+            if (numPrecomputed == 0) {
+                numPrecomputed = precomputeRoutes(router, time);
+            }
+            numPrecomputed--;
+        }
 
         // ok, compute the route (try it)
         if (computeRoute(options, router, veh)) {
@@ -323,6 +341,102 @@ RONet::furtherStored() {
 }
 
 
+#ifdef HAVE_FOX
+void
+RONet::addRoutingThread(SUMOAbstractRouter<ROEdge, ROVehicle>* router) {
+    new RoutingThread(myThreadPool, router);
+}
+
+
+void
+RONet::RoutingTask::run(FXWorkerThread* context) {
+    computeGroup(static_cast<RoutingThread*>(context)->getRouter(), myVehicles, myInterval);
+}
+#endif
+
+
+unsigned int
+RONet::precomputeRoutes(SUMOAbstractRouter<ROEdge, ROVehicle>& router, SUMOTime time) {
+    // keep some tasks per thread in the queue, but not all routes of the run in memory
+    unsigned int batchSize = 4096;
+#ifdef HAVE_FOX
+    batchSize = MAX2(batchSize, 256 * (unsigned int) myThreadPool.size());
+#endif
+    std::vector<const ROVehicle*> vehicles;
+    myVehicles.getTopVehicles(time, batchSize, vehicles);
+    // the groups in the order of their first vehicle's departure
+    std::vector<std::vector<const ROVehicle*> > groups;
+    typedef std::pair<std::pair<const ROEdge*, const SUMOVTypeParameter*>, SUMOTime> GroupKey;
+    std::map<GroupKey, size_t> groupIndices;
+    std::set<const RORouteDef*> seen;
+    for (std::vector<const ROVehicle*>::const_iterator i = vehicles.begin(); i != vehicles.end(); ++i) {
+        const RORouteDef* const routeDef = (*i)->getRouteDefinition();
+        // the serial computation uses the route of the first vehicle as well
+        if (routeDef == 0 || routeDef->isSaved() || !seen.insert(routeDef).second) {
+            continue;
+        }
+        if (myBatchInterval >= 0 && routeDef->needsShortestPath()) {
+            SUMOTime depart = (*i)->getDepartureTime();
+            if (myBatchInterval > 0) {
+                depart -= depart % myBatchInterval;
+            }
+            const GroupKey key(std::make_pair(routeDef->getOrigin(), (*i)->getType()), depart);
+            std::map<GroupKey, size_t>::const_iterator group = groupIndices.find(key);
+            if (group != groupIndices.end()) {
+                groups[group->second].push_back(*i);
+                continue;
+            }
+            groupIndices[key] = groups.size();
+        }
+        groups.push_back(std::vector<const ROVehicle*>(1, *i));
+    }
+#ifdef HAVE_FOX
+    if (myThreadPool.size() > 0) {
+        for (std::vector<std::vector<const ROVehicle*> >::const_iterator i = groups.begin(); i != groups.end(); ++i) {
+            myThreadPool.add(new RoutingTask(*i, myBatchInterval));
+        }
+        myThreadPool.waitAll();
+        return (unsigned int) vehicles.size();
+    }
+#endif
+    for (std::vector<std::vector<const ROVehicle*> >::const_iterator i = groups.begin(); i != groups.end(); ++i) {
+        computeGroup(router, *i, myBatchInterval);
+    }
+    return (unsigned int) vehicles.size();
+}
+
+
+void
+RONet::computeGroup(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
+                    const std::vector<const ROVehicle*>& vehicles, SUMOTime interval) {
+    const ROVehicle* const first = vehicles.front();
+    if (vehicles.size() == 1) {
+        first->getRouteDefinition()->buildCurrentRoute(router, first->getDepartureTime(), *first);
+        return;
+    }
+    SUMOTime depart = first->getDepartureTime();
+    if (interval > 0) {
+        depart -= depart % interval;
+    }
+    std::vector<const ROVehicle*> searched;
+    std::vector<const ROEdge*> destinations;
+    for (std::vector<const ROVehicle*>::const_iterator i = vehicles.begin(); i != vehicles.end(); ++i) {
+        if (!(*i)->getRouteDefinition()->reuseUnchangedAlternative(router, depart, **i)) {
+            searched.push_back(*i);
+            destinations.push_back((*i)->getRouteDefinition()->getDestination());
+        }
+    }
+    if (searched.empty()) {
+        return;
+    }
+    std::vector<std::vector<const ROEdge*> > routes;
+    router.computeOneToMany(first->getRouteDefinition()->getOrigin(), destinations, first, depart, routes);
+    for (size_t i = 0; i < searched.size(); ++i) {
+        searched[i]->getRouteDefinition()->setComputedRoute(routes[i]);
+    }
+}
+
+
 ROEdge*
 RONet::getRandomSource() {
     // check whether an edge may be returned
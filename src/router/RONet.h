@@ -33,6 +33,7 @@
 
 #include <string>
 #include <set>
+#include <map>
 #include <fstream>
 #include <deque>
 #include <vector>
@@ -45,6 +46,10 @@
 #include <utils/common/SUMOAbstractRouter.h>
 #include <utils/common/RandomDistributor.h>
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/FXWorkerThread.h>
+#endif
+
 
 // ===========================================================================
 // class declarations
@@ -236,6 +241,11 @@ public:
      *  exists, its route is computed and it is written and removed from
      *  the internal container.
      *
+     * If routing threads were added or batch routing is enabled, the new
+     *  routes of the next vehicles are computed before (see precomputeRoutes),
+     *  the remaining processing and the output stay serial in the order of
+     *  departure.
+     *
      * @param[in] options The options used during this process
      * @param[in] router The router to use for routes computation
      * @param[in] options The time until which route definitions shall be processed
@@ -247,6 +257,32 @@ public:
 
     /// Returns the information whether further vehicles are stored
     virtual bool furtherStored();
+
+
+    /** @brief Enables routing vehicles which share their origin with one search
+     *
+     * Vehicles of the same type starting at the same edge within the same
+     *  departure interval are routed together using the begin of the
+     *  interval as departure time. An interval of 0 only groups vehicles
+     *  departing at the same time, which does not change the routes.
+     *
+     * @param[in] interval The length of the departure intervals, batch routing is disabled if negative
+     */
+    void setBatchInterval(SUMOTime interval) {
+        myBatchInterval = interval;
+    }
+
+
+#ifdef HAVE_FOX
+    /** @brief Adds a thread computing routes with the given router
+     *
+     * The router must be built like the one given to saveAndRemoveRoutesUntil,
+     *  it is deleted together with the thread.
+     *
+     * @param[in] router The router for the thread's exclusive use
+     */
+    void addRoutingThread(SUMOAbstractRouter<ROEdge, ROVehicle>* router);
+#endif
     //@}
 
 
@@ -322,6 +358,95 @@ protected:
     bool computeRoute(OptionsCont& options,
                       SUMOAbstractRouter<ROEdge, ROVehicle>& router, const ROVehicle* const veh);
 
+    /** @brief Computes the new routes of the next vehicles in batches and/or using the routing threads
+     *
+     * Each route definition which was not saved before is computed once for
+     *  the first vehicle using it, as the serial computation would do, so
+     *  that the results do not differ. If batch routing is enabled, these
+     *  vehicles are grouped by origin, type and departure interval.
+     *
+     * @param[in] router The router to use if no routing threads were added
+     * @param[in] time The time until which route definitions shall be processed
+     * @return The number of vehicles in the processed batch
+     */
+    unsigned int precomputeRoutes(SUMOAbstractRouter<ROEdge, ROVehicle>& router, SUMOTime time);
+
+
+    /** @brief Computes the routes of a group of vehicles built by precomputeRoutes
+     *
+     * @param[in] router The router to use
+     * @param[in] vehicles The vehicles sharing the origin, the type and the departure interval
+     * @param[in] interval The length of the departure intervals
+     */
+    static void computeGroup(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
+                             const std::vector<const ROVehicle*>& vehicles, SUMOTime interval);
+
+
+#ifdef HAVE_FOX
+
+
+    /**
+     * @class RoutingThread
+     * @brief A worker thread owning a router
+     */
+    class RoutingThread : public FXWorkerThread {
+    public:
+        /// @brief Constructor; adds the thread to the pool and starts it
+        RoutingThread(FXWorkerThread::Pool& pool, SUMOAbstractRouter<ROEdge, ROVehicle>* router)
+            : FXWorkerThread(pool), myRouter(router) {}
+
+        /// @brief Destructor; stops the thread before deleting the router
+        virtual ~RoutingThread() {
+            stop();
+            delete myRouter;
+        }
+
+        /// @brief Returns the thread's router
+        SUMOAbstractRouter<ROEdge, ROVehicle>& getRouter() const {
+            return *myRouter;
+        }
+
+    private:
+        /// @brief The router used by this thread only
+        SUMOAbstractRouter<ROEdge, ROVehicle>* const myRouter;
+
+    private:
+        /// @brief Invalidated copy constructor.
+        RoutingThread(const RoutingThread&);
+
+        /// @brief Invalidated assignment operator.
+        RoutingThread& operator=(const RoutingThread&);
+
+    };
+
+
+    /**
+     * @class RoutingTask
+     * @brief A task computing the new routes of a group of vehicles (see computeGroup)
+     */
+    class RoutingTask : public FXWorkerThread::Task {
+    public:
+        /// @brief Constructor
+        RoutingTask(const std::vector<const ROVehicle*>& vehicles, SUMOTime interval)
+            : myVehicles(vehicles), myInterval(interval) {}
+
+        /// @brief Computes the routes using the router of the running thread
+        void run(FXWorkerThread* context);
+
+    private:
+        /// @brief The vehicles to route
+        const std::vector<const ROVehicle*> myVehicles;
+
+        /// @brief The length of the departure intervals
+        const SUMOTime myInterval;
+
+    private:
+        /// @brief Invalidated assignment operator.
+        RoutingTask& operator=(const RoutingTask&);
+
+    };
+#endif
+
     /// Initialises the lists of source and destination edges
     void checkSourceAndDestinations() const;
 
@@ -386,6 +511,14 @@ protected:
     /// @brief Whether the network contains edges which not all vehicles may pass
     bool myHaveRestrictions;
 
+    /// @brief The length of the departure intervals for batch routing (-1 if disabled)
+    SUMOTime myBatchInterval;
+
+#ifdef HAVE_FOX
+    /// @brief The threads computing routes in parallel
+    FXWorkerThread::Pool myThreadPool;
+#endif
+
 
 private:
     /// @brief Invalidated copy constructor
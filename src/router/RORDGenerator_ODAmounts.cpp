@@ -65,10 +65,12 @@ RORDGenerator_ODAmounts::FlowDef::FlowDef(ROVehicle* vehicle,
         SUMOTime intBegin,
         SUMOTime intEnd,
         unsigned int vehicles2insert,
-        bool randomize)
+        bool randomize,
+        bool removeRoutes)
     : myVehicle(vehicle), myVehicleType(type), myRoute(route),
       myIntervalBegin(intBegin), myIntervalEnd(intEnd),
-      myVehicle2InsertNumber(vehicles2insert), myInserted(0), myRandom(randomize) {
+      myVehicle2InsertNumber(vehicles2insert), myInserted(0), myRandom(randomize),
+      myRemoveRoutes(removeRoutes) {
     assert(myIntervalBegin < myIntervalEnd);
     if (myRandom) {
         SUMOTime period = myIntervalEnd - myIntervalBegin;
@@ -119,7 +121,8 @@ RORDGenerator_ODAmounts::FlowDef::addRoutes(RONet& net, SUMOTime t) {
 void
 RORDGenerator_ODAmounts::FlowDef::addSingleRoute(RONet& net, SUMOTime t) {
     std::string id = myVehicle->getID() + "_" + toString<unsigned int>(myInserted);
-    RORouteDef* rd = myRoute->copyOrigDest(id);
+    // route definitions starting with '!' are deleted once the vehicle is written
+    RORouteDef* rd = myRoute->copyOrigDest(myRemoveRoutes ? "!" + id : id);
     net.addRouteDef(rd);
     ROVehicle* veh = myVehicle->copy(id, t, rd);
     net.addVehicle(id, veh);
@@ -275,7 +278,10 @@ RORDGenerator_ODAmounts::myEndFlowAmountDef() {
             myNextRouteRead = true;
             ROVehicle* vehicle = new ROVehicle(*myParameter, route, type);
             // add to the container
-            FlowDef* fd = new FlowDef(vehicle, type, route, myIntervalBegin, myIntervalEnd, myVehicle2InsertNumber, myRandom);
+            // only jtrrouter (which allows empty destinations) deletes the routes of flows
+            //  after writing, the ids and the output of duarouter stay as they were
+            FlowDef* fd = new FlowDef(vehicle, type, route, myIntervalBegin, myIntervalEnd, myVehicle2InsertNumber, myRandom,
+                                      myEmptyDestinationsAllowed);
             myFlows.push_back(fd);
         } else {
             WRITE_ERROR("The vehicle '" + myParameter->id + "' occurs at least twice.");
@@ -114,10 +114,13 @@ protected:
      */
     class FlowDef {
     public:
-        /// Constructor
+        /** @brief Constructor
+         *
+         * @param[in] removeRoutes Whether the generated route definitions shall be deleted once their vehicle is written
+         */
         FlowDef(ROVehicle* vehicle, SUMOVTypeParameter* type, RORouteDef* route,
                 SUMOTime intBegin, SUMOTime intEnd,
-                unsigned int vehicles2insert, bool randomize);
+                unsigned int vehicles2insert, bool randomize, bool removeRoutes);
 
         /// Destructor
         ~FlowDef();
@@ -162,6 +165,9 @@ protected:
         /// Information whether randomized departures are used
         bool myRandom;
 
+        /// Information whether the generated route definitions are deleted once their vehicle is written
+        bool myRemoveRoutes;
+
     private:
         /** @brief invalidated assignment operator */
         FlowDef& operator=(const FlowDef& s);
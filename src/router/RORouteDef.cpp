@@ -31,6 +31,7 @@
 
 #include <string>
 #include <iterator>
+#include <cmath>
 #include <utils/common/TplConvert.h>
 #include <utils/common/ToString.h>
 #include <utils/common/Named.h>
@@ -102,26 +103,72 @@ RORouteDef::preComputeCurrentRoute(SUMOAbstractRouter<ROEdge, ROVehicle>& router
     }
     if (ROCostCalculator::getCalculator().skipRouteCalculation()) {
         myPrecomputed = myAlternatives[myLastUsed];
-    } else {
+    } else if (!reuseUnchangedAlternative(router, begin, veh)) {
         // build a new route to test whether it is better
         std::vector<const ROEdge*> edges;
         router.compute(myAlternatives[0]->getFirst(), myAlternatives[0]->getLast(), &veh, begin, edges);
-        // check whether the same route was already used
-        int cheapest = -1;
-        for (unsigned int i = 0; i < myAlternatives.size(); i++) {
-            if (edges == myAlternatives[i]->getEdgeVector()) {
-                cheapest = i;
-                break;
-            }
+        setComputedRoute(edges);
+    }
+}
+
+
+bool
+RORouteDef::needsShortestPath() const {
+    return myPrecomputed == 0 && !myTryRepair && !ROCostCalculator::getCalculator().skipRouteCalculation();
+}
+
+
+bool
+RORouteDef::reuseUnchangedAlternative(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
+                                      SUMOTime begin, const ROVehicle& veh) const {
+    const SUMOReal tolerance = ROCostCalculator::getCalculator().getIncrementalTolerance();
+    if (tolerance < 0) {
+        return false;
+    }
+    // the costs of loaded routes are the ones of their last computation,
+    //  every alternative is checked as any of them may have become the cheapest
+    RORoute* best = 0;
+    SUMOReal bestCosts = 0;
+    for (std::vector<RORoute*>::const_iterator i = myAlternatives.begin(); i != myAlternatives.end(); ++i) {
+        if ((*i)->getCosts() < 0 || (*i)->size() == 0) {
+            continue;
         }
-        if (cheapest >= 0) {
-            myPrecomputed = myAlternatives[cheapest];
-        } else {
-            RGBColor* col = myAlternatives[0]->getColor() != 0 ? new RGBColor(*myAlternatives[0]->getColor()) : 0;
-            myPrecomputed = new RORoute(myID, 0, 1, edges, col);
-            myNewRoute = true;
+        const SUMOReal costs = router.recomputeCosts((*i)->getEdgeVector(), &veh, begin);
+        if (costs < 0 || fabs(costs - (*i)->getCosts()) > tolerance * (*i)->getCosts()) {
+            return false;
+        }
+        if (best == 0 || costs < bestCosts) {
+            best = *i;
+            bestCosts = costs;
         }
     }
+    if (best == 0) {
+        return false;
+    }
+    myNewRoute = false;
+    myPrecomputed = best;
+    return true;
+}
+
+
+void
+RORouteDef::setComputedRoute(const std::vector<const ROEdge*>& edges) const {
+    myNewRoute = false;
+    // check whether the same route was already used
+    int cheapest = -1;
+    for (unsigned int i = 0; i < myAlternatives.size(); i++) {
+        if (edges == myAlternatives[i]->getEdgeVector()) {
+            cheapest = i;
+            break;
+        }
+    }
+    if (cheapest >= 0) {
+        myPrecomputed = myAlternatives[cheapest];
+    } else {
+        RGBColor* col = myAlternatives[0]->getColor() != 0 ? new RGBColor(*myAlternatives[0]->getColor()) : 0;
+        myPrecomputed = new RORoute(myID, 0, 1, edges, col);
+        myNewRoute = true;
+    }
 }
 
 
@@ -247,6 +294,12 @@ RORouteDef::addAlternative(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
 }
 
 
+const ROEdge*
+RORouteDef::getOrigin() const {
+    return myAlternatives[0]->getFirst();
+}
+
+
 const ROEdge*
 RORouteDef::getDestination() const {
     return myAlternatives[0]->getLast();
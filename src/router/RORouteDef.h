@@ -92,6 +92,41 @@ public:
     void preComputeCurrentRoute(SUMOAbstractRouter<ROEdge, ROVehicle>& router, SUMOTime begin,
                                 const ROVehicle& veh) const;
 
+    /** @brief Returns whether building the current route means computing the shortest path
+     *
+     * This is not the case if the route was already built, shall be repaired
+     *  or is chosen from the loaded alternatives.
+     */
+    bool needsShortestPath() const;
+
+    /** @brief Chooses the cheapest loaded alternative if the costs did not change much
+     *
+     * Compares the costs of all alternatives with the given weights to the
+     *  loaded ones (the costs of the previous iteration). If each of them
+     *  differs by at most the incremental tolerance, the cheapest alternative
+     *  becomes the current route as if the search had found it again.
+     *  Checking only the cheapest one would miss alternatives which became
+     *  cheaper. Routes which are no alternatives are not checked, the
+     *  tolerance bounds the error made by not searching them.
+     *
+     * @param[in] router The router to compute the costs with
+     * @param[in] begin The departure time
+     * @param[in] veh The vehicle to compute the costs for
+     * @return Whether the alternative was chosen
+     */
+    bool reuseUnchangedAlternative(SUMOAbstractRouter<ROEdge, ROVehicle>& router, SUMOTime begin,
+                                   const ROVehicle& veh) const;
+
+    /** @brief Sets the shortest path computed for the current route
+     *
+     * The route is used as it would have been computed by
+     *  preComputeCurrentRoute, allowing to compute the routes
+     *  of several definitions at once.
+     *
+     * @param[in] edges The computed shortest path from the origin to the destination
+     */
+    void setComputedRoute(const std::vector<const ROEdge*>& edges) const;
+
     /** @brief Builds the complete route
      * (or chooses her from the list of alternatives, when existing) */
     void repairCurrentRoute(SUMOAbstractRouter<ROEdge, ROVehicle>& router, SUMOTime begin,
@@ -103,6 +138,8 @@ public:
     void addAlternative(SUMOAbstractRouter<ROEdge, ROVehicle>& router,
                         const ROVehicle* const, RORoute* current, SUMOTime begin);
 
+    const ROEdge* getOrigin() const;
+
     const ROEdge* getDestination() const;
 
     /** @brief Saves the built route / route alternatives
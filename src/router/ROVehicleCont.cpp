@@ -60,6 +60,20 @@ ROVehicleCont::getTopVehicle() const {
 }
 
 
+void
+ROVehicleCont::getTopVehicles(SUMOTime time, unsigned int maxNumber, std::vector<const ROVehicle*>& into) const {
+    std::vector<ROVehicle*> taken;
+    while (!mySorted.empty() && taken.size() < maxNumber && mySorted.top()->getDepartureTime() <= time) {
+        taken.push_back(mySorted.top());
+        mySorted.pop();
+    }
+    for (std::vector<ROVehicle*>::const_iterator i = taken.begin(); i != taken.end(); ++i) {
+        mySorted.push(*i);
+    }
+    into.insert(into.end(), taken.begin(), taken.end());
+}
+
+
 bool
 ROVehicleCont::add(const std::string& id, ROVehicle* item) {
     if (NamedObjectCont<ROVehicle*>::add(id, item)) {
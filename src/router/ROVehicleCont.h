@@ -71,6 +71,15 @@ public:
     const ROVehicle* getTopVehicle() const;
 
 
+    /** @brief Returns the vehicles departing first, sorted by their departure
+     *
+     * @param[in] time The latest departure time of the vehicles to return
+     * @param[in] maxNumber The maximum number of vehicles to return
+     * @param[out] into The container to append the vehicles to
+     */
+    void getTopVehicles(SUMOTime time, unsigned int maxNumber, std::vector<const ROVehicle*>& into) const;
+
+
     /** @brief Adds a vehicle to the container
      *
      * Tries to add the vehicle to the container using NamedObjectCont::add.
@@ -40,6 +40,7 @@
 #include <string>
 #include <iostream>
 #include <microsim/MSNet.h>
+#include <microsim/MSLane.h>
 #include <microsim/MSRoute.h>
 #include <microsim/MSVehicleControl.h>
 #include <netload/NLBuilder.h>
@@ -65,6 +66,10 @@
 #include <mesosim/MEVehicleControl.h>
 #endif
 
+#ifdef HAVE_FOX
+#include <utils/foxtools/MFXMutex.h>
+#endif
+
 #ifdef CHECK_MEMORY_LEAKS
 #include <foreign/nvwa/debug_new.h>
 #endif
@@ -113,6 +118,11 @@ load(OptionsCont& oc) {
  * ----------------------------------------------------------------------- */
 int
 main(int argc, char** argv) {
+#ifdef HAVE_FOX
+    // make the output aware of threading (background rerouting)
+    MFXMutex lock;
+    MsgHandler::assignLock(&lock);
+#endif
     OptionsCont& oc = OptionsCont::getOptions();
     // give some application descriptions
     oc.setApplicationDescription("A microscopic road traffic simulation.");
@@ -135,6 +145,7 @@ main(int argc, char** argv) {
         }
         RandHelper::initRandGlobal();
         RandHelper::initRandGlobal(&MSVehicleControl::myVehicleParamsRNG);
+        MSLane::initRNGs(oc);
         // load the net
         net = load(oc);
         if (net != 0) {
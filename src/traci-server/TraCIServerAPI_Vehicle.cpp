@@ -103,9 +103,10 @@ TraCIServerAPI_Vehicle::processGet(TraCIServer& server, tcpip::Storage& inputSto
     if (variable == ID_LIST || variable == ID_COUNT) {
         std::vector<std::string> ids;
         MSVehicleControl& c = MSNet::getInstance()->getVehicleControl();
-        for (MSVehicleControl::constVehIt i = c.loadedVehBegin(); i != c.loadedVehEnd(); ++i) {
-            if ((*i).second->isOnRoad()) {
-                ids.push_back((*i).first);
+        const std::vector<SUMOVehicle*>& vehicles = c.getRunningVehicles();
+        for (std::vector<SUMOVehicle*>::const_iterator i = vehicles.begin(); i != vehicles.end(); ++i) {
+            if ((*i)->isOnRoad()) {
+                ids.push_back((*i)->getID());
             }
         }
         if (variable == ID_LIST) {
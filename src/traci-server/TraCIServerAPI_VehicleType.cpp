@@ -302,6 +302,7 @@ TraCIServerAPI_VehicleType::setVariable(const int cmd, const int variable, const
                 return false;
             }
             v.getCarFollowModel().setMaxDecel(inputStorage.readDouble());
+            MSVehicleType::countChange();
         }
         break;
         case VAR_IMPERFECTION: {
@@ -0,0 +1,407 @@
+/****************************************************************************/
+/// @file    AStarLookupTable.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Precomputed lower bounds on the effort between edges for the A* router
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef AStarLookupTable_h
+#define AStarLookupTable_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <queue>
+#include <limits>
+#include <fstream>
+#include <functional>
+#include <utils/common/StdDefs.h>
+#include <utils/common/ToString.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/common/UtilExceptions.h>
+#include <utils/iodevices/BinaryInputDevice.h>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class AbstractLookupTable
+ * @brief Interface for lower bounds on the effort needed between two edges
+ *
+ * The bound for a pair (from, to) must not exceed the effort of any route
+ *  starting with from and ending before to, so that the A* router using it
+ *  as heuristic still finds the optimal routes.
+ */
+template<class E>
+class AbstractLookupTable {
+public:
+    /// @brief Destructor
+    virtual ~AbstractLookupTable() {}
+
+    /** @brief Returns a lower bound on the effort from the begin of from to the begin of to
+     * @param[in] from The edge to start at
+     * @param[in] to The edge to reach
+     * @return The lower bound
+     */
+    virtual SUMOReal lowerBound(const E* from, const E* to) const = 0;
+};
+
+
+/** @brief Returns the factor by which the vehicle may exceed the speed limits
+ *
+ * Lower bounds computed from the speed limits are divided by this factor.
+ *  Vehicle classes whose vehicles may drive faster overload this function.
+ * @param[in] veh The vehicle to route
+ * @return The factor (1 unless overloaded)
+ */
+template<class V>
+inline SUMOReal getSpeedLimitFactor(const V* const /* veh */) {
+    return 1.;
+}
+
+
+/**
+ * @class LandmarkLookupTable
+ * @brief Lower bounds using the triangle inequality on distances to and from landmarks (ALT)
+ *
+ * For each of a few landmark edges, the minimum efforts from the landmark to
+ *  all edges and from all edges to the landmark are computed once, using the
+ *  minimum travel times of the edges. The given operation must never exceed
+ *  any effort used for routing later on (the free-flow time edge length /
+ *  allowed speed is not sufficient if smaller loaded weights are used or
+ *  vehicles may drive faster than allowed). Then the
+ *  differences of these distances bound the remaining effort from below:
+ *  d(e, to) >= d(L, to) - d(L, e) and d(e, to) >= d(e, L) - d(to, L).
+ *  Prohibitions are not regarded, which only makes the bounds weaker.
+ *
+ * The landmarks are chosen one after another as the edge farthest away
+ *  from the ones chosen before. The tables may be saved to a binary file and
+ *  loaded again if the network did not change.
+ *
+ * The template parameters are:
+ * @param E The edge class to use (MSEdge/ROEdge)
+ * @param V The vehicle class to use (MSVehicle/ROVehicle)
+ */
+template<class E, class V>
+class LandmarkLookupTable : public AbstractLookupTable<E> {
+public:
+    /// Type of the function that is used to retrieve the minimum travel time (called with no vehicle).
+    typedef SUMOReal(E::* Operation)(const V* const) const;
+
+
+    /** @brief Constructor; computes the tables
+     * @param[in] noE The number of edges
+     * @param[in] numLandmarks The number of landmarks to choose
+     * @param[in] operation The minimum travel time of an edge
+     */
+    LandmarkLookupTable(size_t noE, unsigned int numLandmarks, Operation operation) :
+        myNumEdges(noE), myNumLandmarks(0) {
+        std::vector<SUMOReal> costs(noE);
+        for (size_t i = 0; i < noE; ++i) {
+            costs[i] = (E::dictionary(i)->*operation)(0);
+        }
+        std::vector<std::vector<size_t> > predecessors(noE);
+        for (size_t i = 0; i < noE; ++i) {
+            const E* const edge = E::dictionary(i);
+            const unsigned int numFollowers = edge->getNoFollowing();
+            for (unsigned int j = 0; j < numFollowers; ++j) {
+                predecessors[edge->getFollower(j)->getNumericalID()].push_back(i);
+            }
+        }
+        numLandmarks = (unsigned int) MIN2((size_t) numLandmarks, noE);
+        myFromLandmark.resize(noE * numLandmarks, UNREACHABLE);
+        myToLandmark.resize(noE * numLandmarks, UNREACHABLE);
+        // the smallest round trip distance of each edge to the chosen landmarks;
+        //  starting with an arbitrary edge which is not used itself
+        std::vector<SUMOReal> fromFirst, toFirst;
+        computeDistances(0, costs, predecessors, true, fromFirst);
+        computeDistances(0, costs, predecessors, false, toFirst);
+        std::vector<SUMOReal> closest(noE);
+        for (size_t i = 0; i < noE; ++i) {
+            closest[i] = roundTrip(fromFirst[i], toFirst[i]);
+        }
+        std::vector<SUMOReal> from, to;
+        for (unsigned int l = 0; l < numLandmarks; ++l) {
+            size_t landmark = 0;
+            for (size_t i = 1; i < noE; ++i) {
+                if (closest[i] > closest[landmark]) {
+                    landmark = i;
+                }
+            }
+            if (closest[landmark] == 0) {
+                // all edges are landmarks already
+                break;
+            }
+            computeDistances(landmark, costs, predecessors, true, from);
+            computeDistances(landmark, costs, predecessors, false, to);
+            for (size_t i = 0; i < noE; ++i) {
+                myFromLandmark[i * numLandmarks + l] = from[i];
+                myToLandmark[i * numLandmarks + l] = to[i];
+                closest[i] = MIN2(closest[i], roundTrip(from[i], to[i]));
+            }
+            // the unused edges are not regarded by the following selections
+            closest[landmark] = 0;
+            myLandmarks.push_back(landmark);
+            myNumLandmarks++;
+        }
+        if (myNumLandmarks < numLandmarks) {
+            compact(numLandmarks);
+        }
+    }
+
+
+    /** @brief Constructor; loads the tables from the given file
+     * @param[in] noE The number of edges
+     * @param[in] file The file written by save
+     * @exception ProcessError If the file cannot be read or does not match the network
+     */
+    LandmarkLookupTable(size_t noE, const std::string& file) :
+        myNumEdges(noE), myNumLandmarks(0) {
+        BinaryInputDevice in(file);
+        if (!in.good()) {
+            throw ProcessError("Could not open landmark distances '" + file + "'.");
+        }
+        unsigned int version, numEdges, numLandmarks;
+        in >> version;
+        in >> numEdges;
+        in >> numLandmarks;
+        if (!in.good() || version != FILE_VERSION || numLandmarks > numEdges) {
+            throw ProcessError("The file '" + file + "' does not contain landmark distances.");
+        }
+        if (numEdges != noE) {
+            throw ProcessError("The landmark distances in '" + file + "' were computed for another network.");
+        }
+        std::string id;
+        for (size_t i = 0; i < noE; ++i) {
+            in >> id;
+            if (id != E::dictionary(i)->getID()) {
+                throw ProcessError("The landmark distances in '" + file + "' were computed for another network.");
+            }
+        }
+        for (unsigned int l = 0; l < numLandmarks; ++l) {
+            unsigned int landmark;
+            in >> landmark;
+            if (!in.good() || landmark >= noE) {
+                throw ProcessError("The landmark distances in '" + file + "' are corrupt.");
+            }
+            myLandmarks.push_back(landmark);
+        }
+        myNumLandmarks = numLandmarks;
+        myFromLandmark.resize(noE * numLandmarks);
+        myToLandmark.resize(noE * numLandmarks);
+        for (typename std::vector<SUMOReal>::iterator i = myFromLandmark.begin(); i != myFromLandmark.end(); ++i) {
+            in >> *i;
+        }
+        for (typename std::vector<SUMOReal>::iterator i = myToLandmark.begin(); i != myToLandmark.end(); ++i) {
+            in >> *i;
+        }
+        if (!in.good()) {
+            throw ProcessError("The landmark distances in '" + file + "' are incomplete.");
+        }
+    }
+
+
+    /// @brief Destructor
+    ~LandmarkLookupTable() {}
+
+
+    /** @brief Writes the tables into the given binary file
+     * @param[in] file The file to write
+     * @exception IOError If the file cannot be written
+     */
+    void save(const std::string& file) const {
+        std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+        if (!out.good()) {
+            throw IOError("Could not write landmark distances to '" + file + "'.");
+        }
+        FileHelpers::writeUInt(out, FILE_VERSION);
+        FileHelpers::writeUInt(out, (unsigned int) myNumEdges);
+        FileHelpers::writeUInt(out, myNumLandmarks);
+        for (size_t i = 0; i < myNumEdges; ++i) {
+            FileHelpers::writeString(out, E::dictionary(i)->getID());
+        }
+        for (std::vector<size_t>::const_iterator i = myLandmarks.begin(); i != myLandmarks.end(); ++i) {
+            FileHelpers::writeUInt(out, (unsigned int) *i);
+        }
+        for (typename std::vector<SUMOReal>::const_iterator i = myFromLandmark.begin(); i != myFromLandmark.end(); ++i) {
+            FileHelpers::writeFloat(out, *i);
+        }
+        for (typename std::vector<SUMOReal>::const_iterator i = myToLandmark.begin(); i != myToLandmark.end(); ++i) {
+            FileHelpers::writeFloat(out, *i);
+        }
+        if (!out.good()) {
+            throw IOError("Could not write landmark distances to '" + file + "'.");
+        }
+    }
+
+
+    SUMOReal lowerBound(const E* from, const E* to) const {
+        if (myNumLandmarks == 0) {
+            return 0;
+        }
+        const SUMOReal* const fromL = &myFromLandmark[0] + from->getNumericalID() * myNumLandmarks;
+        const SUMOReal* const toL = &myFromLandmark[0] + to->getNumericalID() * myNumLandmarks;
+        const SUMOReal* const fromR = &myToLandmark[0] + from->getNumericalID() * myNumLandmarks;
+        const SUMOReal* const toR = &myToLandmark[0] + to->getNumericalID() * myNumLandmarks;
+        SUMOReal result = 0;
+        for (unsigned int l = 0; l < myNumLandmarks; ++l) {
+            if (fromL[l] != UNREACHABLE && toL[l] != UNREACHABLE && toL[l] - fromL[l] > result) {
+                result = toL[l] - fromL[l];
+            }
+            if (fromR[l] != UNREACHABLE && toR[l] != UNREACHABLE && fromR[l] - toR[l] > result) {
+                result = fromR[l] - toR[l];
+            }
+        }
+        return result;
+    }
+
+
+    /// @brief Returns the numerical ids of the landmark edges
+    const std::vector<size_t>& getLandmarks() const {
+        return myLandmarks;
+    }
+
+
+private:
+    /// @brief Returns the sum of both distances, UNREACHABLE if one of them is
+    static SUMOReal roundTrip(SUMOReal from, SUMOReal to) {
+        // edges in other components are the most interesting candidates
+        return from == UNREACHABLE || to == UNREACHABLE ? UNREACHABLE : from + to;
+    }
+
+
+    /** @brief Computes the minimum efforts from (or to) the given edge to (or from) all edges
+     *
+     * The effort between two edges contains the effort of the first but not the one of the second edge.
+     *
+     * @param[in] start The numerical id of the landmark
+     * @param[in] costs The effort of all edges
+     * @param[in] predecessors The numerical ids of the predecessors of all edges
+     * @param[in] forward Whether the efforts from the landmark shall be computed
+     * @param[out] into The efforts, UNREACHABLE for edges without a connection
+     */
+    void computeDistances(size_t start, const std::vector<SUMOReal>& costs,
+                          const std::vector<std::vector<size_t> >& predecessors,
+                          bool forward, std::vector<SUMOReal>& into) const {
+        typedef std::pair<SUMOReal, size_t> QueueItem;
+        std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem> > queue;
+        into.assign(myNumEdges, UNREACHABLE);
+        into[start] = 0;
+        queue.push(QueueItem(0, start));
+        while (!queue.empty()) {
+            const QueueItem item = queue.top();
+            queue.pop();
+            const size_t current = item.second;
+            if (item.first > into[current]) {
+                // outdated entry
+                continue;
+            }
+            if (forward) {
+                const E* const edge = E::dictionary(current);
+                const SUMOReal dist = item.first + costs[current];
+                const unsigned int numFollowers = edge->getNoFollowing();
+                for (unsigned int j = 0; j < numFollowers; ++j) {
+                    const size_t follower = edge->getFollower(j)->getNumericalID();
+                    if (dist < into[follower]) {
+                        into[follower] = dist;
+                        queue.push(QueueItem(dist, follower));
+                    }
+                }
+            } else {
+                const std::vector<size_t>& preds = predecessors[current];
+                for (std::vector<size_t>::const_iterator j = preds.begin(); j != preds.end(); ++j) {
+                    const SUMOReal dist = item.first + costs[*j];
+                    if (dist < into[*j]) {
+                        into[*j] = dist;
+                        queue.push(QueueItem(dist, *j));
+                    }
+                }
+            }
+        }
+    }
+
+
+    /** @brief Removes the unused columns of the tables if less landmarks were found than reserved
+     * @param[in] reserved The number of reserved columns
+     */
+    void compact(unsigned int reserved) {
+        for (size_t i = 0; i < myNumEdges; ++i) {
+            for (unsigned int l = 0; l < myNumLandmarks; ++l) {
+                myFromLandmark[i * myNumLandmarks + l] = myFromLandmark[i * reserved + l];
+                myToLandmark[i * myNumLandmarks + l] = myToLandmark[i * reserved + l];
+            }
+        }
+        myFromLandmark.resize(myNumEdges * myNumLandmarks);
+        myToLandmark.resize(myNumEdges * myNumLandmarks);
+    }
+
+
+private:
+    /// @brief The version of the file format
+    static const unsigned int FILE_VERSION = 1;
+
+    /// @brief The marker for edges which cannot be reached
+    static const SUMOReal UNREACHABLE;
+
+    /// @brief The number of edges
+    const size_t myNumEdges;
+
+    /// @brief The number of landmarks
+    unsigned int myNumLandmarks;
+
+    /// @brief The numerical ids of the landmark edges
+    std::vector<size_t> myLandmarks;
+
+    /// @brief The efforts from the landmarks, myNumLandmarks entries per edge
+    std::vector<SUMOReal> myFromLandmark;
+
+    /// @brief The efforts to the landmarks, myNumLandmarks entries per edge
+    std::vector<SUMOReal> myToLandmark;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    LandmarkLookupTable(const LandmarkLookupTable&);
+
+    /// @brief Invalidated assignment operator.
+    LandmarkLookupTable& operator=(const LandmarkLookupTable&);
+
+};
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+template<class E, class V>
+const SUMOReal LandmarkLookupTable<E, V>::UNREACHABLE = std::numeric_limits<SUMOReal>::max();
+
+template<class E, class V>
+const unsigned int LandmarkLookupTable<E, V>::FILE_VERSION;
+
+
+#endif
+
+/****************************************************************************/
+
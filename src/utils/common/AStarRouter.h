@@ -4,8 +4,8 @@
 /// @date    January 2012
 /// @version $Id: AStarRouter.h 13107 2012-12-02 13:57:34Z behrisch $
 ///
-// A* Algorithm using euclidean distance heuristic.
-// Based on DijkstraRouterTT. For routing by effort a novel heuristic would be needed.
+// A* Algorithm using euclidean distance or landmark heuristic.
+// Based on DijkstraRouterTT.
 /****************************************************************************/
 // SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
 // Copyright (C) 2001-2012 DLR (http://www.dlr.de/) and contributors
@@ -35,6 +35,7 @@
 #include <string>
 #include <functional>
 #include <vector>
+#include <deque>
 #include <set>
 #include <limits>
 #include <algorithm>
@@ -42,6 +43,8 @@
 #include <utils/common/MsgHandler.h>
 #include <utils/common/StdDefs.h>
 #include <utils/common/ToString.h>
+#include <utils/common/IndexedHeap.h>
+#include <utils/common/AStarLookupTable.h>
 #include "SUMOAbstractRouter.h"
 
 
@@ -50,7 +53,7 @@
 // ===========================================================================
 /**
  * @class AStarRouterTT
- * @brief Computes the shortest path through a network using the Dijkstra algorithm.
+ * @brief Computes the shortest path through a network using the A* algorithm.
  *
  * The template parameters are:
  * @param E The edge class to use (MSEdge/ROEdge)
@@ -62,6 +65,11 @@
  *  and whether a missing connection between two given edges (unbuild route) shall
  *  be reported as an error or as a warning.
  *
+ * The remaining effort is estimated using the given lookup table (see
+ *  LandmarkLookupTable). Without a table, the straight line distance at the
+ *  vehicle's maximum speed is used when routing by travel time, no estimate
+ *  at all when routing by another effort.
+ *
  */
 template<class E, class V, class PF>
 class AStarRouterTTBase : public SUMOAbstractRouter<E, V>, public PF {
@@ -69,10 +77,19 @@ class AStarRouterTTBase : public SUMOAbstractRouter<E, V>, public PF {
     using SUMOAbstractRouter<E, V>::endQuery;
 
 public:
-    /// Constructor
-    AStarRouterTTBase(size_t noE, bool unbuildIsWarning):
+    /// @brief The type of the lower bounds for the remaining effort
+    typedef AbstractLookupTable<E> LookupTable;
+
+    /** @brief Constructor
+     * @param[in] noE The number of edges
+     * @param[in] unbuildIsWarning Whether a missing connection is only a warning
+     * @param[in] effortIsTravelTime Whether the effort is the travel time (false if getTravelTime is overridden)
+     * @param[in] lookup The lower bounds for the remaining effort (may be 0, is not deleted)
+     */
+    AStarRouterTTBase(size_t noE, bool unbuildIsWarning, bool effortIsTravelTime = true, const LookupTable* lookup = 0):
         SUMOAbstractRouter<E, V>("AStarRouter"),
-        myErrorMsgHandler(unbuildIsWarning ? MsgHandler::getWarningInstance() : MsgHandler::getErrorInstance()) {
+        myErrorMsgHandler(unbuildIsWarning ? MsgHandler::getWarningInstance() : MsgHandler::getErrorInstance()),
+        myEffortIsTravelTime(effortIsTravelTime), myLookupTable(lookup) {
         for (size_t i = 0; i < noE; i++) {
             myEdgeInfos.push_back(EdgeInfo(i));
         }
@@ -91,20 +108,25 @@ public:
         /// Constructor
         EdgeInfo(size_t id) :
             edge(E::dictionary(id)),
-            traveltime(std::numeric_limits<SUMOReal>::max()),
-            heuristicTime(std::numeric_limits<SUMOReal>::max()),
+            effort(std::numeric_limits<SUMOReal>::max()),
+            heuristicEffort(std::numeric_limits<SUMOReal>::max()),
+            leaveTime(0),
             prev(0),
-            visited(false)
+            visited(false),
+            heapIndex(-1)
         {}
 
         /// The current edge
         const E* edge;
 
         /// Effort to reach the edge
-        SUMOReal traveltime;
+        SUMOReal effort;
 
-        /// Estimated time to reach the edge (traveltime + lower bound on remaining time)
-        SUMOReal heuristicTime;
+        /// Estimated effort to reach the destination (effort + lower bound on remaining effort)
+        SUMOReal heuristicEffort;
+
+        /// The time the vehicle leaves the edge
+        SUMOReal leaveTime;
 
         /// The previous edge
         EdgeInfo* prev;
@@ -112,9 +134,12 @@ public:
         /// The previous edge
         bool visited;
 
+        /// @brief The position within the frontier heap (-1 if not within the heap)
+        int heapIndex;
+
         inline void reset() {
-            // heuristicTime is set before adding to the frontier, thus no reset is needed
-            traveltime = std::numeric_limits<SUMOReal>::max();
+            // heuristicEffort is set before adding to the frontier, thus no reset is needed
+            effort = std::numeric_limits<SUMOReal>::max();
             visited = false;
         }
 
@@ -128,19 +153,24 @@ public:
     public:
         /// Comparing method
         bool operator()(const EdgeInfo* nod1, const EdgeInfo* nod2) const {
-            if (nod1->heuristicTime == nod2->heuristicTime) {
+            if (nod1->heuristicEffort == nod2->heuristicEffort) {
                 return nod1->edge->getNumericalID() > nod2->edge->getNumericalID();
             }
-            return nod1->heuristicTime > nod2->heuristicTime;
+            return nod1->heuristicEffort > nod2->heuristicEffort;
         }
     };
 
     virtual SUMOReal getEffort(const E* const e, const V* const v, SUMOReal t) const = 0;
 
+    /// @brief Returns the travel time of the edge; only used if the effort is not the travel time
+    virtual SUMOReal getTravelTime(const E* const e, const V* const v, SUMOReal t) const {
+        return getEffort(e, v, t);
+    }
+
 
     void init() {
         // all EdgeInfos touched in the previous query are either in myFrontierList or myFound: clean those up
-        for (typename std::vector<EdgeInfo*>::iterator i = myFrontierList.begin(); i != myFrontierList.end(); i++) {
+        for (typename FrontierHeap::const_iterator i = myFrontierList.begin(); i != myFrontierList.end(); i++) {
             (*i)->reset();
         }
         myFrontierList.clear();
@@ -151,27 +181,26 @@ public:
     }
 
 
-    /** @brief Builds the route between the given edges using the minimum travel time */
+    /** @brief Builds the route between the given edges using the minimum effort */
     virtual void compute(const E* from, const E* to, const V* const vehicle,
                          SUMOTime msTime, std::vector<const E*>& into) {
         assert(from != 0 && to != 0);
         startQuery();
-        const SUMOReal time = STEPS2TIME(msTime);
         init();
         // add begin node
         EdgeInfo* const fromInfo = &(myEdgeInfos[from->getNumericalID()]);
-        fromInfo->traveltime = 0;
+        fromInfo->effort = 0;
         fromInfo->prev = 0;
-        myFrontierList.push_back(fromInfo);
+        fromInfo->leaveTime = STEPS2TIME(msTime);
+        myFrontierList.push(fromInfo);
         // loop
         int num_visited = 0;
         while (!myFrontierList.empty()) {
             num_visited += 1;
             // use the node with the minimal length
-            EdgeInfo* const minimumInfo = myFrontierList.front();
+            EdgeInfo* const minimumInfo = myFrontierList.top();
             const E* const minEdge = minimumInfo->edge;
-            pop_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
-            myFrontierList.pop_back();
+            myFrontierList.pop();
             myFound.push_back(minimumInfo);
             // check whether the destination node was already reached
             if (minEdge == to) {
@@ -182,7 +211,10 @@ public:
                 return;
             }
             minimumInfo->visited = true;
-            const SUMOReal traveltime = minimumInfo->traveltime + getEffort(minEdge, vehicle, time + minimumInfo->traveltime);
+            const SUMOReal effort = minimumInfo->effort + getEffort(minEdge, vehicle, minimumInfo->leaveTime);
+            const SUMOReal leaveTime = myEffortIsTravelTime ?
+                                       fromInfo->leaveTime + effort :
+                                       minimumInfo->leaveTime + getTravelTime(minEdge, vehicle, minimumInfo->leaveTime);
             // check all ways from the node with the minimal length
             unsigned int i = 0;
             const unsigned int length_size = minEdge->getNoFollowing();
@@ -193,20 +225,23 @@ public:
                 if (PF::operator()(follower, vehicle)) {
                     continue;
                 }
-                const SUMOReal oldEffort = followerInfo->traveltime;
-                if (!followerInfo->visited && traveltime < oldEffort) {
-                    // admissible A* heuristic: straight line distance at maximum speed
-                    const SUMOReal heuristic_remaining = minEdge->getDistanceTo(to) / vehicle->getMaxSpeed();
-                    followerInfo->traveltime = traveltime;
-                    followerInfo->heuristicTime = traveltime + heuristic_remaining;
+                const SUMOReal oldEffort = followerInfo->effort;
+                if (!followerInfo->visited && effort < oldEffort) {
+                    SUMOReal heuristic_remaining = 0;
+                    if (myLookupTable != 0) {
+                        heuristic_remaining = myLookupTable->lowerBound(follower, to) / getSpeedLimitFactor(vehicle);
+                    } else if (myEffortIsTravelTime) {
+                        // admissible A* heuristic: straight line distance at maximum speed
+                        heuristic_remaining = minEdge->getDistanceTo(to) / vehicle->getMaxSpeed();
+                    }
+                    followerInfo->effort = effort;
+                    followerInfo->heuristicEffort = effort + heuristic_remaining;
+                    followerInfo->leaveTime = leaveTime;
                     followerInfo->prev = minimumInfo;
                     if (oldEffort == std::numeric_limits<SUMOReal>::max()) {
-                        myFrontierList.push_back(followerInfo);
-                        push_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
+                        myFrontierList.push(followerInfo);
                     } else {
-                        push_heap(myFrontierList.begin(),
-                                  find(myFrontierList.begin(), myFrontierList.end(), followerInfo) + 1,
-                                  myComparator);
+                        myFrontierList.update(followerInfo);
                     }
                 }
             }
@@ -217,13 +252,15 @@ public:
 
 
     SUMOReal recomputeCosts(const std::vector<const E*>& edges, const V* const v, SUMOTime msTime) const {
-        const SUMOReal time = STEPS2TIME(msTime);
         SUMOReal costs = 0;
+        SUMOReal t = STEPS2TIME(msTime);
         for (typename std::vector<const E*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
             if (PF::operator()(*i, v)) {
                 return -1;
             }
-            costs += getEffort(*i, v, time + costs);
+            const SUMOReal effort = getEffort(*i, v, t);
+            costs += effort;
+            t += myEffortIsTravelTime ? effort : getTravelTime(*i, v, t);
         }
         return costs;
     }
@@ -243,16 +280,23 @@ protected:
     /// The container of edge information
     std::vector<EdgeInfo> myEdgeInfos;
 
+    /// @brief The heap of edges to visit, ordered by estimated travel time
+    typedef IndexedHeap<EdgeInfo, EdgeInfoComparator> FrontierHeap;
+
     /// A container for reusage of the min edge heap
-    std::vector<EdgeInfo*> myFrontierList;
+    FrontierHeap myFrontierList;
     /// @brief list of visited Edges (for resetting)
     std::vector<EdgeInfo*> myFound;
 
-    EdgeInfoComparator myComparator;
-
     /// @brief the handler for routing errors
     MsgHandler* const myErrorMsgHandler;
 
+    /// @brief Whether the effort is the travel time
+    const bool myEffortIsTravelTime;
+
+    /// @brief The lower bounds for the remaining effort (may be 0)
+    const LookupTable* const myLookupTable;
+
 };
 
 
@@ -262,8 +306,9 @@ public:
     /// Type of the function that is used to retrieve the edge effort.
     typedef SUMOReal(* Operation)(const E* const, const V* const, SUMOReal);
 
-    AStarRouterTT_ByProxi(size_t noE, bool unbuildIsWarningOnly, Operation operation):
-        AStarRouterTTBase<E, V, PF>(noE, unbuildIsWarningOnly),
+    AStarRouterTT_ByProxi(size_t noE, bool unbuildIsWarningOnly, Operation operation,
+                          const AbstractLookupTable<E>* lookup = 0):
+        AStarRouterTTBase<E, V, PF>(noE, unbuildIsWarningOnly, true, lookup),
         myOperation(operation) {}
 
     inline SUMOReal getEffort(const E* const e, const V* const v, SUMOReal t) const {
@@ -282,8 +327,9 @@ public:
     /// Type of the function that is used to retrieve the edge effort.
     typedef SUMOReal(E::* Operation)(const V* const, SUMOReal) const;
 
-    AStarRouterTT_Direct(size_t noE, bool unbuildIsWarningOnly, Operation operation)
-        : AStarRouterTTBase<E, V, PF>(noE, unbuildIsWarningOnly), myOperation(operation) {}
+    AStarRouterTT_Direct(size_t noE, bool unbuildIsWarningOnly, Operation operation,
+                         const AbstractLookupTable<E>* lookup = 0)
+        : AStarRouterTTBase<E, V, PF>(noE, unbuildIsWarningOnly, true, lookup), myOperation(operation) {}
 
     inline SUMOReal getEffort(const E* const e, const V* const v, SUMOReal t) const {
         return (e->*myOperation)(v, t);
@@ -294,6 +340,35 @@ private:
 };
 
 
+template<class E, class V, class PF>
+class AStarRouterEffort_Direct : public AStarRouterTTBase<E, V, PF> {
+public:
+    /// Type of the function that is used to retrieve the edge effort.
+    typedef SUMOReal(E::* Operation)(const V* const, SUMOReal) const;
+
+    AStarRouterEffort_Direct(size_t noE, bool unbuildIsWarningOnly, Operation effortOperation, Operation ttOperation,
+                             const AbstractLookupTable<E>* lookup = 0)
+        : AStarRouterTTBase<E, V, PF>(noE, unbuildIsWarningOnly, false, lookup),
+          myEffortOperation(effortOperation), myTTOperation(ttOperation) {}
+
+    inline SUMOReal getEffort(const E* const e, const V* const v, SUMOReal t) const {
+        return (e->*myEffortOperation)(v, t);
+    }
+
+    inline SUMOReal getTravelTime(const E* const e, const V* const v, SUMOReal t) const {
+        return (e->*myTTOperation)(v, t);
+    }
+
+private:
+    /// @brief The object's operation to perform for obtaining the effort
+    Operation myEffortOperation;
+
+    /// @brief The object's operation to perform for obtaining the travel time
+    Operation myTTOperation;
+
+};
+
+
 #endif
 
 /****************************************************************************/
@@ -0,0 +1,201 @@
+/****************************************************************************/
+/// @file    ActiveSet.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A set of objects with dense numerical ids, stored in contiguous memory
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef ActiveSet_h
+#define ActiveSet_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <vector>
+#include <cassert>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class ActiveSet
+ * @brief A set of objects with dense numerical ids, stored in contiguous memory
+ *
+ * The stored class has to supply "getNumericalID()" returning a value smaller
+ *  than the size given in the constructor.
+ *
+ * Objects are added either at the front or at the back. The iteration order
+ *  (by index) is the same as a std::list would have using push_front and
+ *  push_back: the objects added at the front in reverse order of their
+ *  addition, followed by the objects added at the back in order of their
+ *  addition.
+ *
+ * Removing an object only clears its flag, so indices stay valid while
+ *  iterating. The memory is reorganised by "compact" which keeps the order
+ *  of the remaining objects. An object must not be added again before the
+ *  set was compacted after its removal.
+ */
+template<class T>
+class ActiveSet {
+public:
+    /** @brief Constructor
+     * @param[in] size The number of possible objects (maximum numerical id + 1)
+     */
+    ActiveSet(size_t size) : myFlags(size, false), myNeedsCompaction(false) { }
+
+
+    /// @brief Destructor
+    ~ActiveSet() { }
+
+
+    /** @brief Returns whether the given object is in the set
+     * @param[in] o The object to check
+     * @return Whether the object was added and not removed
+     */
+    bool contains(const T* const o) const {
+        return myFlags[o->getNumericalID()];
+    }
+
+
+    /** @brief Adds the object at the front unless it is contained
+     * @param[in] o The object to add
+     * @return Whether the object was added
+     */
+    bool pushFront(T* const o) {
+        if (contains(o)) {
+            return false;
+        }
+        myFront.push_back(o);
+        myFlags[o->getNumericalID()] = true;
+        return true;
+    }
+
+
+    /** @brief Adds the object at the back unless it is contained
+     * @param[in] o The object to add
+     * @return Whether the object was added
+     */
+    bool pushBack(T* const o) {
+        if (contains(o)) {
+            return false;
+        }
+        myBack.push_back(o);
+        myFlags[o->getNumericalID()] = true;
+        return true;
+    }
+
+
+    /** @brief Removes the object from the set
+     *
+     * The object stays in the storage (and thus is returned by the index
+     *  operator) until "compact" is called.
+     *
+     * @param[in] o The object to remove
+     */
+    void remove(const T* const o) {
+        assert(contains(o));
+        myFlags[o->getNumericalID()] = false;
+        myNeedsCompaction = true;
+    }
+
+
+    /** @brief Removes the storage of all removed objects keeping the order of the others
+     */
+    void compact() {
+        if (myNeedsCompaction) {
+            compact(myFront);
+            compact(myBack);
+            myNeedsCompaction = false;
+        }
+    }
+
+
+    /** @brief Returns the number of stored objects (including removed but not yet compacted ones)
+     * @return The number of objects to iterate over
+     */
+    size_t size() const {
+        return myFront.size() + myBack.size();
+    }
+
+
+    /** @brief Returns the number of objects added at the front (including removed but not yet compacted ones)
+     * @return The number of front objects
+     */
+    size_t frontSize() const {
+        return myFront.size();
+    }
+
+
+    /** @brief Returns the object at the given iteration position
+     * @param[in] i The position (smaller than size())
+     * @return The object at this position
+     */
+    T* operator[](const size_t i) const {
+        const size_t frontSize = myFront.size();
+        return i < frontSize ? myFront[frontSize - 1 - i] : myBack[i - frontSize];
+    }
+
+
+private:
+    /** @brief Removes the storage of all removed objects from the given container
+     * @param[in, changed] cont The container to compact
+     */
+    void compact(std::vector<T*>& cont) {
+        typename std::vector<T*>::iterator to = cont.begin();
+        for (typename std::vector<T*>::iterator from = cont.begin(); from != cont.end(); ++from) {
+            if (myFlags[(*from)->getNumericalID()]) {
+                *to = *from;
+                ++to;
+            }
+        }
+        cont.erase(to, cont.end());
+    }
+
+
+private:
+    /// @brief The objects added at the front (in order of addition, which is the reverse iteration order)
+    std::vector<T*> myFront;
+
+    /// @brief The objects added at the back (in order of addition)
+    std::vector<T*> myBack;
+
+    /// @brief Whether an object is contained, indexed by numerical id
+    std::vector<bool> myFlags;
+
+    /// @brief Whether an object was removed since the last compaction
+    bool myNeedsCompaction;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    ActiveSet(const ActiveSet&);
+
+    /// @brief Invalidated assignment operator.
+    ActiveSet& operator=(const ActiveSet&);
+
+};
+
+
+#endif
+
+/****************************************************************************/
@@ -0,0 +1,168 @@
+/****************************************************************************/
+/// @file    AliasDistributor.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A fixed random distribution drawing samples in constant time
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef AliasDistributor_h
+#define AliasDistributor_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cassert>
+#include <vector>
+#include <utils/common/RandHelper.h>
+#include <utils/common/RandomDistributor.h>
+#include <utils/common/UtilExceptions.h>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class AliasDistributor
+ * @brief A fixed random distribution drawing samples in constant time
+ *
+ * The distribution is built once from the members and their (non-negative)
+ *  probabilities using Vose's alias method. Each member gets a column of
+ *  the same width which is split between the member itself and an alias
+ *  filling the rest of the column, so drawing needs a single random number
+ *  choosing the column and the part within it.
+ *
+ * Unlike RandomDistributor, members can not be added after building.
+ *
+ * @see RandomDistributor
+ */
+template<class T>
+class AliasDistributor {
+public:
+    /// @brief Constructor for an empty distribution
+    AliasDistributor() : myProb(0) {}
+
+    /// @brief Constructor copying the members of the given distribution
+    AliasDistributor(const RandomDistributor<T>& dist) : myProb(0) {
+        build(dist.getProbs(), dist.getVals());
+    }
+
+    /// @brief Destructor
+    ~AliasDistributor() { }
+
+    /** @brief Builds the table for the given members, replacing the former ones
+     *
+     * @param[in] probs The probabilities of the members
+     * @param[in] vals The members
+     */
+    void build(const std::vector<SUMOReal>& probs, const std::vector<T>& vals) {
+        assert(probs.size() == vals.size());
+        const size_t size = vals.size();
+        myVals = vals;
+        myAliases.assign(size, 0);
+        myThresholds.assign(size, 1);
+        myProb = 0;
+        for (size_t i = 0; i < size; ++i) {
+            assert(probs[i] >= 0);
+            myProb += probs[i];
+        }
+        if (myProb == 0) {
+            return;
+        }
+        // the probabilities scaled to an average of one, split by being below or above
+        std::vector<SUMOReal> scaled(size);
+        std::vector<size_t> small;
+        std::vector<size_t> large;
+        for (size_t i = 0; i < size; ++i) {
+            scaled[i] = probs[i] * (SUMOReal) size / myProb;
+            if (scaled[i] < 1) {
+                small.push_back(i);
+            } else {
+                large.push_back(i);
+            }
+        }
+        while (!small.empty() && !large.empty()) {
+            const size_t less = small.back();
+            small.pop_back();
+            const size_t more = large.back();
+            myThresholds[less] = scaled[less];
+            myAliases[less] = more;
+            scaled[more] -= 1 - scaled[less];
+            if (scaled[more] < 1) {
+                large.pop_back();
+                small.push_back(more);
+            }
+        }
+        // the remaining ones are one up to rounding errors, thresholds stay one
+        for (std::vector<size_t>::const_iterator i = small.begin(); i != small.end(); ++i) {
+            myAliases[*i] = *i;
+        }
+        for (std::vector<size_t>::const_iterator i = large.begin(); i != large.end(); ++i) {
+            myAliases[*i] = *i;
+        }
+    }
+
+    /** @brief Draw a sample of the distribution.
+     *
+     * @param[in] which The random number generator to use; the static one will be used if 0 is passed
+     * @return the drawn member
+     */
+    T get(MTRand* which = 0) const {
+        if (myProb == 0) {
+            throw OutOfBoundsException();
+        }
+        const SUMOReal r = RandHelper::rand((SUMOReal) myVals.size(), which);
+        size_t column = (size_t) r;
+        if (column >= myVals.size()) {
+            column = myVals.size() - 1;
+        }
+        if (r - (SUMOReal) column < myThresholds[column]) {
+            return myVals[column];
+        }
+        return myVals[myAliases[column]];
+    }
+
+    /** @brief Return the sum of the probabilites assigned to the members.
+     *
+     * This should be zero if and only if the distribution is empty.
+     *
+     * @return the total probability
+     */
+    SUMOReal getOverallProb() const {
+        return myProb;
+    }
+
+private:
+    /// @brief the total probability
+    SUMOReal myProb;
+    /// @brief the members
+    std::vector<T> myVals;
+    /// @brief the share of each column drawing its own member
+    std::vector<SUMOReal> myThresholds;
+    /// @brief the member drawn for the rest of each column
+    std::vector<size_t> myAliases;
+
+};
+
+
+#endif
+
+/****************************************************************************/
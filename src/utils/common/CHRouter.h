@@ -0,0 +1,786 @@
+/****************************************************************************/
+/// @file    CHRouter.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Shortest path search using a Contraction Hierarchy
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef CHRouter_h
+#define CHRouter_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cassert>
+#include <string>
+#include <functional>
+#include <vector>
+#include <map>
+#include <limits>
+#include <algorithm>
+#include <utils/common/MsgHandler.h>
+#include <utils/common/StdDefs.h>
+#include <utils/common/SysUtils.h>
+#include <utils/common/ToString.h>
+#include <utils/common/UtilExceptions.h>
+#include <utils/common/SUMOVehicleClass.h>
+#include "SUMOAbstractRouter.h"
+
+
+// ===========================================================================
+// function definitions
+// ===========================================================================
+/// @brief Returns whether the prohibition function depends on the vehicle (class)
+template<class E, class V>
+inline bool regardsVehicleClass(const prohibited_noRestrictions<E, V>&) {
+    return false;
+}
+
+
+template<class PF>
+inline bool regardsVehicleClass(const PF&) {
+    return true;
+}
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class CHRouterBase
+ * @brief Computes the shortest path through a contracted network
+ *
+ * The template parameters are:
+ * @param E The edge class to use (MSEdge/ROEdge)
+ * @param V The vehicle class to use (MSVehicle/ROVehicle)
+ * @param PF The prohibition function to use (prohibited_withRestrictions/prohibited_noRestrictions)
+ *
+ * The router is edge-based like the other routers: the nodes of the hierarchy
+ *  are the edges of the network and reaching a follower costs the travel time
+ *  of the edge left. The nodes are contracted one by one in the order of their
+ *  importance (edge difference plus the number of contracted neighbors), adding
+ *  shortcuts wherever a local witness search does not find a path avoiding the
+ *  contracted node. A query is a bidirectional Dijkstra search which only goes
+ *  upwards in the hierarchy; the shortcuts of the found path are unpacked
+ *  recursively.
+ *
+ * The hierarchy is built on the first query of each weight interval (intervals
+ *  of the given period starting at the given begin time) using the efforts at
+ *  the interval's begin. The efforts are retrieved without a vehicle, i.e.
+ *  they are not limited by a vehicle's maximum speed, so that the routes are
+ *  the fastest ones for vehicles which can drive the allowed speeds. The
+ *  hierarchy is rebuilt if the set of prohibited edges changes.
+ *
+ * With a prohibition function regarding the vehicle class, the edges
+ *  prohibited for the class of the first querying vehicle cannot be entered
+ *  and vehicles of other classes are refused with a ProcessError; use
+ *  CHRouterWrapper to keep one hierarchy per vehicle class.
+ */
+template<class E, class V, class PF>
+class CHRouterBase : public SUMOAbstractRouter<E, V>, public PF {
+    using SUMOAbstractRouter<E, V>::startQuery;
+    using SUMOAbstractRouter<E, V>::endQuery;
+
+public:
+    /** @brief Constructor
+     * @param[in] noE The number of edges
+     * @param[in] unbuildIsWarning Whether a missing connection shall be reported as a warning only
+     * @param[in] begin The begin of the first weight interval
+     * @param[in] weightPeriod The length of the weight intervals (SUMOTime_MAX if the weights do not change)
+     */
+    CHRouterBase(size_t noE, bool unbuildIsWarning, SUMOTime begin, SUMOTime weightPeriod) :
+        SUMOAbstractRouter<E, V>("CHRouter"),
+        myErrorMsgHandler(unbuildIsWarning ?  MsgHandler::getWarningInstance() : MsgHandler::getErrorInstance()),
+        myNumNodes(noE), myBegin(begin), myWeightPeriod(weightPeriod),
+        myValidFrom(0), myValidUntil(0), myHaveHierarchy(false), myBuildClass(SVC_UNKNOWN),
+        myNumBuilds(0), myBuildTimeSum(0), myNumShortcuts(0) {
+        myForward.init(noE);
+        myBackward.init(noE);
+    }
+
+    /// Destructor
+    virtual ~CHRouterBase() {
+        if (myNumBuilds > 0) {
+            WRITE_MESSAGE("CHRouter built " + toString(myNumBuilds) + " hierarchies (" + toString(myNumShortcuts) + " shortcuts in the last one) in "
+                          + toString(myBuildTimeSum) + " ms (" + toString(double(myBuildTimeSum) / myNumBuilds) + " ms on average).");
+        }
+    }
+
+    virtual SUMOReal getEffort(const E* const e, const V* const v, SUMOReal t) const = 0;
+
+
+    /** @brief Sets the edges which must not be entered, invalidates the hierarchy if they changed
+     * @note Only available with prohibited_withRestrictions
+     */
+    void prohibit(const std::vector<E*>& toProhibit) {
+        if (toProhibit != PF::myProhibited) {
+            PF::prohibit(toProhibit);
+            myHaveHierarchy = false;
+        }
+    }
+
+
+    /** @brief Builds the route between the given edges using the minimum travel time
+     * @exception ProcessError If the vehicle's class differs from the one the hierarchy is restricted to
+     */
+    virtual void compute(const E* from, const E* to, const V* const vehicle,
+                         SUMOTime msTime, std::vector<const E*>& into) {
+        assert(from != 0 && to != 0);
+        if (regardsVehicleClass(static_cast<const PF&>(*this))) {
+            const SUMOVehicleClass vClass = vehicle == 0 ? SVC_UNKNOWN : vehicle->getVClass();
+            if (myNumBuilds == 0) {
+                myBuildClass = vClass;
+            } else if (vClass != myBuildClass) {
+                throw ProcessError("CHRouter is restricted to vehicle class '" + getVehicleClassCompoundName(myBuildClass)
+                                   + "' and cannot route vehicle class '" + getVehicleClassCompoundName(vClass) + "'; use CHWrapper.");
+            }
+        }
+        if (!myHaveHierarchy || msTime < myValidFrom || msTime >= myValidUntil) {
+            buildHierarchy(msTime, vehicle);
+        }
+        startQuery();
+        const unsigned int source = from->getNumericalID();
+        const unsigned int target = to->getNumericalID();
+        myForward.reset();
+        myBackward.reset();
+        myForward.add(source, 0, source, NO_VIA);
+        myBackward.add(target, 0, target, NO_VIA);
+        SUMOReal best = std::numeric_limits<SUMOReal>::max();
+        unsigned int meet = 0;
+        int num_visited = 0;
+        while (true) {
+            const bool forward = myForward.hasNext(best);
+            const bool backward = myBackward.hasNext(best);
+            if (!forward && !backward) {
+                break;
+            }
+            if (forward) {
+                num_visited++;
+                settle(myForward, myBackward, myUpward, myDownward, best, meet);
+            }
+            if (backward) {
+                num_visited++;
+                settle(myBackward, myForward, myDownward, myUpward, best, meet);
+            }
+        }
+        if (best == std::numeric_limits<SUMOReal>::max()) {
+            endQuery(num_visited);
+            myErrorMsgHandler->inform("No connection between '" + from->getID() + "' and '" + to->getID() + "' found.");
+            return;
+        }
+        // collect the hierarchy links of the path and unpack them
+        std::vector<std::pair<unsigned int, std::pair<unsigned int, int> > > links;
+        for (unsigned int node = meet; node != source; node = myForward.prev[node]) {
+            links.push_back(std::make_pair(myForward.prev[node], std::make_pair(node, myForward.via[node])));
+        }
+        std::reverse(links.begin(), links.end());
+        for (unsigned int node = meet; node != target; node = myBackward.prev[node]) {
+            links.push_back(std::make_pair(node, std::make_pair(myBackward.prev[node], myBackward.via[node])));
+        }
+        into.push_back(from);
+        for (std::vector<std::pair<unsigned int, std::pair<unsigned int, int> > >::const_iterator i = links.begin(); i != links.end(); ++i) {
+            unpack((*i).first, (*i).second.first, (*i).second.second, into);
+        }
+        endQuery(num_visited);
+    }
+
+
+    SUMOReal recomputeCosts(const std::vector<const E*>& edges, const V* const v, SUMOTime msTime) const {
+        const SUMOReal time = STEPS2TIME(msTime);
+        SUMOReal costs = 0;
+        for (typename std::vector<const E*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+            if (PF::operator()(*i, v)) {
+                return -1;
+            }
+            costs += getEffort(*i, v, time + costs);
+        }
+        return costs;
+    }
+
+
+    /// @brief Returns the number of shortcuts of the current hierarchy
+    size_t getShortcutNo() const {
+        return myNumShortcuts;
+    }
+
+
+protected:
+    /// @brief Marker for links which are no shortcuts
+    static const int NO_VIA = -1;
+
+    /// @brief The maximum number of nodes settled by a witness search
+    static const int WITNESS_SETTLE_LIMIT = 500;
+
+    /// @brief The maximum number of nodes settled by a witness search when estimating the priority
+    static const int PRIORITY_SETTLE_LIMIT = 20;
+
+    /// @brief The weights of the edge difference and the level in the priority
+    static const int EDGE_DIFF_WEIGHT = 2;
+    static const int LEVEL_WEIGHT = 1;
+
+
+    /// @brief A link of the hierarchy (or of the graph while it is contracted)
+    struct CHLink {
+        CHLink(unsigned int n, SUMOReal c, int v) : node(n), cost(c), via(v) {}
+        /// @brief The node at the other end
+        unsigned int node;
+        /// @brief The costs for going along the link
+        SUMOReal cost;
+        /// @brief The node skipped by the shortcut, NO_VIA for an original link
+        int via;
+    };
+
+    typedef std::vector<CHLink> CHLinks;
+
+    /// @brief A queue entry (costs and node), the std heap is ordered by greater costs
+    typedef std::pair<SUMOReal, unsigned int> QueueEntry;
+
+
+    /// @brief The state of one direction of the bidirectional query
+    struct Search {
+        void init(size_t noE) {
+            dist.assign(noE, std::numeric_limits<SUMOReal>::max());
+            prev.assign(noE, 0);
+            via.assign(noE, NO_VIA);
+        }
+
+        void reset() {
+            for (std::vector<unsigned int>::iterator i = touched.begin(); i != touched.end(); ++i) {
+                dist[*i] = std::numeric_limits<SUMOReal>::max();
+            }
+            touched.clear();
+            queue.clear();
+        }
+
+        void add(unsigned int node, SUMOReal cost, unsigned int prevNode, int viaNode) {
+            if (dist[node] == std::numeric_limits<SUMOReal>::max()) {
+                touched.push_back(node);
+            }
+            dist[node] = cost;
+            prev[node] = prevNode;
+            via[node] = viaNode;
+            queue.push_back(QueueEntry(cost, node));
+            std::push_heap(queue.begin(), queue.end(), std::greater<QueueEntry>());
+        }
+
+        /// @brief Removes outdated queue entries, returns whether a node closer than the given bound is left
+        bool hasNext(SUMOReal bound) {
+            while (!queue.empty() && queue.front().first > dist[queue.front().second]) {
+                std::pop_heap(queue.begin(), queue.end(), std::greater<QueueEntry>());
+                queue.pop_back();
+            }
+            return !queue.empty() && queue.front().first < bound;
+        }
+
+        std::vector<SUMOReal> dist;
+        std::vector<unsigned int> prev;
+        std::vector<int> via;
+        std::vector<unsigned int> touched;
+        std::vector<QueueEntry> queue;
+    };
+
+
+    /** @brief Settles the next node of the given search
+     *
+     * The node's links are not followed if the node can be reached cheaper over a
+     *  higher node which was already reached (stall-on-demand); such nodes are not
+     *  on a shortest path.
+     * @param[in] search The search direction to advance
+     * @param[in] other The opposite direction
+     * @param[in] links The links to follow (upwards in the direction of the search)
+     * @param[in] stallLinks The links coming from higher nodes (in the direction of the search)
+     * @param[in, out] best The costs of the shortest path found so far
+     * @param[in, out] meet The node where the shortest path found so far was found
+     */
+    void settle(Search& search, const Search& other, const std::vector<CHLinks>& links, const std::vector<CHLinks>& stallLinks,
+                SUMOReal& best, unsigned int& meet) {
+        const unsigned int node = search.queue.front().second;
+        const SUMOReal dist = search.queue.front().first;
+        std::pop_heap(search.queue.begin(), search.queue.end(), std::greater<QueueEntry>());
+        search.queue.pop_back();
+        if (other.dist[node] != std::numeric_limits<SUMOReal>::max() && dist + other.dist[node] < best) {
+            best = dist + other.dist[node];
+            meet = node;
+        }
+        const CHLinks& higher = stallLinks[node];
+        for (typename CHLinks::const_iterator i = higher.begin(); i != higher.end(); ++i) {
+            if (search.dist[(*i).node] + (*i).cost < dist) {
+                return;
+            }
+        }
+        const CHLinks& nodeLinks = links[node];
+        for (typename CHLinks::const_iterator i = nodeLinks.begin(); i != nodeLinks.end(); ++i) {
+            const SUMOReal cost = dist + (*i).cost;
+            if (cost < search.dist[(*i).node]) {
+                search.add((*i).node, cost, node, (*i).via);
+            }
+        }
+    }
+
+
+    /// @brief Appends the edges of the hierarchy link from -> to (without from) to the route
+    void unpack(unsigned int from, unsigned int to, int via, std::vector<const E*>& into) const {
+        if (via == NO_VIA) {
+            into.push_back(E::dictionary(to));
+            return;
+        }
+        // both halves were stored when "via" was contracted
+        unpack(from, via, findLink(myDownward[via], from).via, into);
+        unpack(via, to, findLink(myUpward[via], to).via, into);
+    }
+
+
+    static const CHLink& findLink(const CHLinks& links, unsigned int node) {
+        typename CHLinks::const_iterator i = links.begin();
+        while ((*i).node != node) {
+            ++i;
+            assert(i != links.end());
+        }
+        return *i;
+    }
+
+
+    /** @brief Builds the hierarchy for the weight interval containing the given time
+     * @param[in] msTime The time to build the hierarchy for
+     * @param[in] vehicle The vehicle whose class determines the prohibited edges
+     */
+    void buildHierarchy(SUMOTime msTime, const V* const vehicle) {
+        const long buildStart = SysUtils::getCurrentMillis();
+        if (myWeightPeriod == SUMOTime_MAX) {
+            myValidFrom = msTime;
+            myValidUntil = SUMOTime_MAX;
+        } else {
+            SUMOTime interval = (msTime - myBegin) / myWeightPeriod;
+            if (msTime < myBegin && (msTime - myBegin) % myWeightPeriod != 0) {
+                interval--;
+            }
+            myValidFrom = myBegin + interval * myWeightPeriod;
+            myValidUntil = myValidFrom + myWeightPeriod;
+        }
+        const SUMOReal time = STEPS2TIME(myWeightPeriod == SUMOTime_MAX ? msTime : myValidFrom);
+        // the graph to contract; following an edge costs the edge's effort
+        myOut.assign(myNumNodes, CHLinks());
+        myIn.assign(myNumNodes, CHLinks());
+        myUpward.assign(myNumNodes, CHLinks());
+        myDownward.assign(myNumNodes, CHLinks());
+        std::vector<bool> allowed(myNumNodes, false);
+        for (unsigned int i = 0; i < myNumNodes; ++i) {
+            const E* const edge = E::dictionary(i);
+            allowed[i] = edge != 0 && !PF::operator()(edge, vehicle);
+        }
+        for (unsigned int i = 0; i < myNumNodes; ++i) {
+            const E* const edge = E::dictionary(i);
+            if (edge == 0) {
+                continue;
+            }
+            // the effort is independent of the vehicle's maximum speed
+            const SUMOReal effort = getEffort(edge, 0, time);
+            const unsigned int numFollowers = edge->getNoFollowing();
+            for (unsigned int j = 0; j < numFollowers; ++j) {
+                const unsigned int follower = edge->getFollower(j)->getNumericalID();
+                // like the other routers, only the entered edges have to be allowed
+                if (allowed[follower] && follower != i) {
+                    addLink(i, follower, effort, NO_VIA);
+                }
+            }
+        }
+        myContractedNeighbors.assign(myNumNodes, 0);
+        myWitnessDist.assign(myNumNodes, std::numeric_limits<SUMOReal>::max());
+        myNumShortcuts = 0;
+        myLevel.assign(myNumNodes, 0);
+        myPriority.resize(myNumNodes);
+        myContracted.assign(myNumNodes, false);
+        // contract the nodes; the priorities of the neighbors are updated after each
+        //  contraction, all others lazily when they come up
+        myQueue.clear();
+        for (unsigned int i = 0; i < myNumNodes; ++i) {
+            myPriority[i] = getPriority(i);
+            myQueue.push_back(std::make_pair(myPriority[i], i));
+        }
+        std::make_heap(myQueue.begin(), myQueue.end(), std::greater<std::pair<int, unsigned int> >());
+        while (!myQueue.empty()) {
+            const std::pair<int, unsigned int> next = myQueue.front();
+            std::pop_heap(myQueue.begin(), myQueue.end(), std::greater<std::pair<int, unsigned int> >());
+            myQueue.pop_back();
+            const unsigned int node = next.second;
+            if (myContracted[node] || next.first != myPriority[node]) {
+                // outdated entry
+                continue;
+            }
+            const int priority = getPriority(node);
+            if (priority != myPriority[node]) {
+                updatePriority(node, priority);
+                if (priority > myQueue.front().first) {
+                    continue;
+                }
+            }
+            contract(node);
+        }
+        myQueue.clear();
+        myOut.clear();
+        myIn.clear();
+        myHaveHierarchy = true;
+        myNumBuilds++;
+        myBuildTimeSum += SysUtils::getCurrentMillis() - buildStart;
+    }
+
+
+    /// @brief Adds a link to the graph being contracted, keeping only the cheapest link between two nodes
+    void addLink(unsigned int from, unsigned int to, SUMOReal cost, int via) {
+        for (typename CHLinks::iterator i = myOut[from].begin(); i != myOut[from].end(); ++i) {
+            if ((*i).node == to) {
+                if (cost < (*i).cost) {
+                    (*i).cost = cost;
+                    (*i).via = via;
+                    CHLink& back = findLink(myIn[to], from);
+                    back.cost = cost;
+                    back.via = via;
+                }
+                return;
+            }
+        }
+        myOut[from].push_back(CHLink(to, cost, via));
+        myIn[to].push_back(CHLink(from, cost, via));
+    }
+
+
+    static CHLink& findLink(CHLinks& links, unsigned int node) {
+        typename CHLinks::iterator i = links.begin();
+        while ((*i).node != node) {
+            ++i;
+            assert(i != links.end());
+        }
+        return *i;
+    }
+
+
+    /// @brief Returns the priority for contracting the node (lower first)
+    int getPriority(unsigned int node) {
+        const int shortcuts = (int) contractNode(node, true, PRIORITY_SETTLE_LIMIT);
+        return EDGE_DIFF_WEIGHT * (shortcuts - (int)(myIn[node].size() + myOut[node].size()))
+               + (int) myContractedNeighbors[node] + LEVEL_WEIGHT * myLevel[node];
+    }
+
+
+    void updatePriority(unsigned int node, int priority) {
+        myPriority[node] = priority;
+        myQueue.push_back(std::make_pair(priority, node));
+        std::push_heap(myQueue.begin(), myQueue.end(), std::greater<std::pair<int, unsigned int> >());
+    }
+
+
+    /// @brief Contracts the node, moving its remaining links into the hierarchy
+    void contract(unsigned int node) {
+        myNumShortcuts += contractNode(node, false, WITNESS_SETTLE_LIMIT);
+        myUpward[node] = myOut[node];
+        myDownward[node] = myIn[node];
+        for (typename CHLinks::const_iterator i = myIn[node].begin(); i != myIn[node].end(); ++i) {
+            removeLink(myOut[(*i).node], node);
+            myContractedNeighbors[(*i).node]++;
+        }
+        for (typename CHLinks::const_iterator i = myOut[node].begin(); i != myOut[node].end(); ++i) {
+            removeLink(myIn[(*i).node], node);
+            myContractedNeighbors[(*i).node]++;
+        }
+        myContracted[node] = true;
+        std::vector<unsigned int> neighbors;
+        for (typename CHLinks::const_iterator i = myIn[node].begin(); i != myIn[node].end(); ++i) {
+            neighbors.push_back((*i).node);
+        }
+        for (typename CHLinks::const_iterator i = myOut[node].begin(); i != myOut[node].end(); ++i) {
+            neighbors.push_back((*i).node);
+        }
+        CHLinks().swap(myIn[node]);
+        CHLinks().swap(myOut[node]);
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+        for (std::vector<unsigned int>::const_iterator i = neighbors.begin(); i != neighbors.end(); ++i) {
+            myLevel[*i] = MAX2(myLevel[*i], myLevel[node] + 1);
+            const int priority = getPriority(*i);
+            if (priority != myPriority[*i]) {
+                updatePriority(*i, priority);
+            }
+        }
+    }
+
+
+    static void removeLink(CHLinks& links, unsigned int node) {
+        for (typename CHLinks::iterator i = links.begin(); i != links.end(); ++i) {
+            if ((*i).node == node) {
+                links.erase(i);
+                return;
+            }
+        }
+    }
+
+
+    /** @brief Finds the shortcuts needed when contracting the node
+     * @param[in] node The node to contract
+     * @param[in] simulate Whether the shortcuts shall only be counted
+     * @param[in] settleLimit The maximum number of nodes settled by each witness search
+     * @return The number of shortcuts needed
+     */
+    size_t contractNode(unsigned int node, bool simulate, int settleLimit) {
+        size_t shortcuts = 0;
+        const CHLinks& in = myIn[node];
+        const CHLinks& out = myOut[node];
+        if (out.empty()) {
+            return 0;
+        }
+        SUMOReal maxOut = 0;
+        for (typename CHLinks::const_iterator j = out.begin(); j != out.end(); ++j) {
+            maxOut = MAX2(maxOut, (*j).cost);
+        }
+        // adding shortcuts does not change the links of the node itself
+        for (size_t i = 0; i < in.size(); ++i) {
+            const unsigned int from = in[i].node;
+            const SUMOReal inCost = in[i].cost;
+            findWitnesses(from, node, inCost + maxOut, settleLimit);
+            for (size_t j = 0; j < out.size(); ++j) {
+                const unsigned int to = out[j].node;
+                const SUMOReal cost = inCost + out[j].cost;
+                if (to != from && myWitnessDist[to] > cost) {
+                    shortcuts++;
+                    if (!simulate) {
+                        addLink(from, to, cost, (int) node);
+                    }
+                }
+            }
+            resetWitnesses();
+        }
+        return shortcuts;
+    }
+
+
+    /// @brief Runs a Dijkstra search from the given node which avoids the node being contracted
+    void findWitnesses(unsigned int start, unsigned int avoid, SUMOReal maxCost, int settleLimit) {
+        std::vector<QueueEntry>& queue = myWitnessQueue;
+        queue.clear();
+        myWitnessDist[start] = 0;
+        myWitnessTouched.push_back(start);
+        queue.push_back(QueueEntry(0, start));
+        int settled = 0;
+        while (!queue.empty() && settled < settleLimit) {
+            const QueueEntry entry = queue.front();
+            std::pop_heap(queue.begin(), queue.end(), std::greater<QueueEntry>());
+            queue.pop_back();
+            if (entry.first > myWitnessDist[entry.second]) {
+                continue;
+            }
+            if (entry.first > maxCost) {
+                break;
+            }
+            settled++;
+            const CHLinks& links = myOut[entry.second];
+            for (typename CHLinks::const_iterator i = links.begin(); i != links.end(); ++i) {
+                if ((*i).node == avoid) {
+                    continue;
+                }
+                const SUMOReal cost = entry.first + (*i).cost;
+                if (cost < myWitnessDist[(*i).node]) {
+                    if (myWitnessDist[(*i).node] == std::numeric_limits<SUMOReal>::max()) {
+                        myWitnessTouched.push_back((*i).node);
+                    }
+                    myWitnessDist[(*i).node] = cost;
+                    queue.push_back(QueueEntry(cost, (*i).node));
+                    std::push_heap(queue.begin(), queue.end(), std::greater<QueueEntry>());
+                }
+            }
+        }
+    }
+
+
+    void resetWitnesses() {
+        for (std::vector<unsigned int>::const_iterator i = myWitnessTouched.begin(); i != myWitnessTouched.end(); ++i) {
+            myWitnessDist[*i] = std::numeric_limits<SUMOReal>::max();
+        }
+        myWitnessTouched.clear();
+    }
+
+
+protected:
+    /// @brief the handler for routing errors
+    MsgHandler* const myErrorMsgHandler;
+
+    /// @brief The number of nodes (edges of the network)
+    const unsigned int myNumNodes;
+
+    /// @brief The begin of the first weight interval
+    const SUMOTime myBegin;
+
+    /// @brief The length of the weight intervals
+    const SUMOTime myWeightPeriod;
+
+    /// @brief The interval the current hierarchy was built for
+    SUMOTime myValidFrom, myValidUntil;
+
+    /// @brief Whether the hierarchy is valid
+    bool myHaveHierarchy;
+
+    /// @brief The vehicle class the hierarchy is restricted to
+    SUMOVehicleClass myBuildClass;
+
+    /// @brief Statistics about the builds
+    int myNumBuilds;
+    long myBuildTimeSum;
+    size_t myNumShortcuts;
+
+    /// @brief The links to nodes contracted later (forward search), indexed by node
+    std::vector<CHLinks> myUpward;
+
+    /// @brief The links from nodes contracted later (backward search, reversed), indexed by node
+    std::vector<CHLinks> myDownward;
+
+    /// @brief The graph being contracted
+    std::vector<CHLinks> myOut, myIn;
+    std::vector<unsigned int> myContractedNeighbors;
+    std::vector<int> myLevel;
+    std::vector<int> myPriority;
+    std::vector<bool> myContracted;
+    std::vector<std::pair<int, unsigned int> > myQueue;
+
+    /// @brief The distances of the witness search and the nodes touched by it
+    std::vector<SUMOReal> myWitnessDist;
+    std::vector<unsigned int> myWitnessTouched;
+    std::vector<QueueEntry> myWitnessQueue;
+
+    /// @brief The two directions of the query
+    Search myForward, myBackward;
+
+};
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+template<class E, class V, class PF>
+const int CHRouterBase<E, V, PF>::NO_VIA;
+
+
+template<class E, class V, class PF>
+class CHRouter_ByProxi : public CHRouterBase<E, V, PF> {
+public:
+    /// Type of the function that is used to retrieve the edge effort.
+    typedef SUMOReal(* Operation)(const E* const, const V* const, SUMOReal);
+
+    CHRouter_ByProxi(size_t noE, bool unbuildIsWarningOnly, Operation operation, SUMOTime begin, SUMOTime weightPeriod):
+        CHRouterBase<E, V, PF>(noE, unbuildIsWarningOnly, begin, weightPeriod),
+        myOperation(operation) {}
+
+    inline SUMOReal getEffort(const E* const e, const V* const v, SUMOReal t) const {
+        return (*myOperation)(e, v, t);
+    }
+
+private:
+    /// @brief The object's operation to perform.
+    Operation myOperation;
+
+};
+
+
+template<class E, class V, class PF>
+class CHRouter_Direct : public CHRouterBase<E, V, PF> {
+public:
+    /// Type of the function that is used to retrieve the edge effort.
+    typedef SUMOReal(E::* Operation)(const V* const, SUMOReal) const;
+
+    CHRouter_Direct(size_t noE, bool unbuildIsWarningOnly, Operation operation, SUMOTime begin, SUMOTime weightPeriod)
+        : CHRouterBase<E, V, PF>(noE, unbuildIsWarningOnly, begin, weightPeriod), myOperation(operation) {}
+
+    inline SUMOReal getEffort(const E* const e, const V* const v, SUMOReal t) const {
+        return (e->*myOperation)(v, t);
+    }
+
+private:
+    Operation myOperation;
+
+};
+
+
+/**
+ * @class CHRouterWrapper
+ * @brief Keeps one contraction hierarchy per vehicle class
+ *
+ * @param CH The contraction hierarchy router to use per class (with prohibited_withRestrictions)
+ */
+template<class E, class V, class CH>
+class CHRouterWrapper : public SUMOAbstractRouter<E, V> {
+public:
+    CHRouterWrapper(size_t noE, bool unbuildIsWarningOnly, typename CH::Operation operation, SUMOTime begin, SUMOTime weightPeriod) :
+        SUMOAbstractRouter<E, V>("CHRouterWrapper"),
+        myNumEdges(noE), myUnbuildIsWarningOnly(unbuildIsWarningOnly), myOperation(operation),
+        myBegin(begin), myWeightPeriod(weightPeriod) {}
+
+    ~CHRouterWrapper() {
+        for (typename RouterMap::iterator i = myRouters.begin(); i != myRouters.end(); ++i) {
+            delete(*i).second;
+        }
+    }
+
+    void compute(const E* from, const E* to, const V* const vehicle,
+                 SUMOTime msTime, std::vector<const E*>& into) {
+        getRouter(vehicle).compute(from, to, vehicle, msTime, into);
+    }
+
+    SUMOReal recomputeCosts(const std::vector<const E*>& edges, const V* const v, SUMOTime msTime) const {
+        return getRouter(v).recomputeCosts(edges, v, msTime);
+    }
+
+    /// @brief Sets the edges which must not be entered by any vehicle class
+    void prohibit(const std::vector<E*>& toProhibit) {
+        myProhibited = toProhibit;
+        for (typename RouterMap::iterator i = myRouters.begin(); i != myRouters.end(); ++i) {
+            (*i).second->prohibit(toProhibit);
+        }
+    }
+
+private:
+    typedef std::map<SUMOVehicleClass, CH*> RouterMap;
+
+    CH& getRouter(const V* const vehicle) const {
+        const SUMOVehicleClass vClass = vehicle == 0 ? SVC_UNKNOWN : vehicle->getVClass();
+        typename RouterMap::const_iterator i = myRouters.find(vClass);
+        if (i != myRouters.end()) {
+            return *(*i).second;
+        }
+        CH* router = new CH(myNumEdges, myUnbuildIsWarningOnly, myOperation, myBegin, myWeightPeriod);
+        router->prohibit(myProhibited);
+        myRouters[vClass] = router;
+        return *router;
+    }
+
+private:
+    const size_t myNumEdges;
+    const bool myUnbuildIsWarningOnly;
+    const typename CH::Operation myOperation;
+    const SUMOTime myBegin;
+    const SUMOTime myWeightPeriod;
+    std::vector<E*> myProhibited;
+    mutable RouterMap myRouters;
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
@@ -36,12 +36,14 @@
 #include <string>
 #include <functional>
 #include <vector>
+#include <deque>
 #include <set>
 #include <limits>
 #include <algorithm>
 #include <utils/common/InstancePool.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/StdDefs.h>
+#include <utils/common/IndexedHeap.h>
 #include "SUMOAbstractRouter.h"
 
 
@@ -90,7 +92,7 @@ public:
     public:
         /// Constructor
         EdgeInfo(size_t id)
-            : edge(E::dictionary(id)), effort(std::numeric_limits<SUMOReal>::max()), leaveTime(0), prev(0), visited(false) {}
+            : edge(E::dictionary(id)), effort(std::numeric_limits<SUMOReal>::max()), leaveTime(0), prev(0), visited(false), heapIndex(-1) {}
 
         /// The current edge
         const E* edge;
@@ -107,6 +109,9 @@ public:
         /// The previous edge
         bool visited;
 
+        /// @brief The position within the frontier heap (-1 if not within the heap)
+        int heapIndex;
+
         inline void reset() {
             effort = std::numeric_limits<SUMOReal>::max();
             visited = false;
@@ -134,7 +139,7 @@ public:
 
     void init() {
         // all EdgeInfos touched in the previous query are either in myFrontierList or myFound: clean those up
-        for (typename std::vector<EdgeInfo*>::iterator i = myFrontierList.begin(); i != myFrontierList.end(); i++) {
+        for (typename FrontierHeap::const_iterator i = myFrontierList.begin(); i != myFrontierList.end(); i++) {
             (*i)->reset();
         }
         myFrontierList.clear();
@@ -157,16 +162,15 @@ public:
         fromInfo->effort = 0;
         fromInfo->prev = 0;
         fromInfo->leaveTime = STEPS2TIME(msTime);
-        myFrontierList.push_back(fromInfo);
+        myFrontierList.push(fromInfo);
         // loop
         int num_visited = 0;
         while (!myFrontierList.empty()) {
             num_visited += 1;
             // use the node with the minimal length
-            EdgeInfo* const minimumInfo = myFrontierList.front();
+            EdgeInfo* const minimumInfo = myFrontierList.top();
             const E* const minEdge = minimumInfo->edge;
-            pop_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
-            myFrontierList.pop_back();
+            myFrontierList.pop();
             myFound.push_back(minimumInfo);
             // check whether the destination node was already reached
             if (minEdge == to) {
@@ -193,12 +197,9 @@ public:
                     followerInfo->leaveTime = leaveTime;
                     followerInfo->prev = minimumInfo;
                     if (oldEffort == std::numeric_limits<SUMOReal>::max()) {
-                        myFrontierList.push_back(followerInfo);
-                        push_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
+                        myFrontierList.push(followerInfo);
                     } else {
-                        push_heap(myFrontierList.begin(),
-                                  find(myFrontierList.begin(), myFrontierList.end(), followerInfo) + 1,
-                                  myComparator);
+                        myFrontierList.update(followerInfo);
                     }
                 }
             }
@@ -236,13 +237,14 @@ protected:
     /// The container of edge information
     std::vector<EdgeInfo> myEdgeInfos;
 
+    /// @brief The heap of edges to visit, ordered by effort
+    typedef IndexedHeap<EdgeInfo, EdgeInfoByEffortComparator> FrontierHeap;
+
     /// A container for reusage of the min edge heap
-    std::vector<EdgeInfo*> myFrontierList;
+    FrontierHeap myFrontierList;
     /// @brief list of visited Edges (for resetting)
     std::vector<EdgeInfo*> myFound;
 
-    EdgeInfoByEffortComparator myComparator;
-
     /// @brief the handler for routing errors
     MsgHandler* const myErrorMsgHandler;
 
@@ -36,7 +36,9 @@
 #include <string>
 #include <functional>
 #include <vector>
+#include <deque>
 #include <set>
+#include <map>
 #include <limits>
 #include <algorithm>
 #include <iterator>
@@ -44,6 +46,7 @@
 #include <utils/common/InstancePool.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/common/StdDefs.h>
+#include <utils/common/IndexedHeap.h>
 #include "SUMOAbstractRouter.h"
 
 //#define DijkstraRouterTT_DEBUG_QUERY
@@ -94,7 +97,7 @@ public:
     public:
         /// Constructor
         EdgeInfo(size_t id)
-            : edge(E::dictionary(id)), traveltime(std::numeric_limits<SUMOReal>::max()), prev(0), visited(false) {}
+            : edge(E::dictionary(id)), traveltime(std::numeric_limits<SUMOReal>::max()), prev(0), visited(false), heapIndex(-1) {}
 
         /// The current edge
         const E* edge;
@@ -108,6 +111,9 @@ public:
         /// The previous edge
         bool visited;
 
+        /// @brief The position within the frontier heap (-1 if not within the heap)
+        int heapIndex;
+
         inline void reset() {
             traveltime = std::numeric_limits<SUMOReal>::max();
             visited = false;
@@ -134,7 +140,7 @@ public:
 
     void init() {
         // all EdgeInfos touched in the previous query are either in myFrontierList or myFound: clean those up
-        for (typename std::vector<EdgeInfo*>::iterator i = myFrontierList.begin(); i != myFrontierList.end(); i++) {
+        for (typename FrontierHeap::const_iterator i = myFrontierList.begin(); i != myFrontierList.end(); i++) {
             (*i)->reset();
         }
         myFrontierList.clear();
@@ -157,20 +163,19 @@ public:
         EdgeInfo* const fromInfo = &(myEdgeInfos[from->getNumericalID()]);
         fromInfo->traveltime = 0;
         fromInfo->prev = 0;
-        myFrontierList.push_back(fromInfo);
+        myFrontierList.push(fromInfo);
         // loop
         int num_visited = 0;
         while (!myFrontierList.empty()) {
             num_visited += 1;
             // use the node with the minimal length
-            EdgeInfo* const minimumInfo = myFrontierList.front();
+            EdgeInfo* const minimumInfo = myFrontierList.top();
             const E* const minEdge = minimumInfo->edge;
-            pop_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
-            myFrontierList.pop_back();
+            myFrontierList.pop();
             myFound.push_back(minimumInfo);
 #ifdef DijkstraRouterTT_DEBUG_QUERY
             std::cout << "DEBUG: hit '" << minEdge->getID() << "' Q: ";
-            for (typename std::vector<EdgeInfo*>::iterator it = myFrontierList.begin(); it != myFrontierList.end(); it++) {
+            for (typename FrontierHeap::const_iterator it = myFrontierList.begin(); it != myFrontierList.end(); it++) {
                 std::cout << (*it)->traveltime << "," << (*it)->edge->getID() << " ";
             }
             std::cout << "\n";
@@ -184,32 +189,7 @@ public:
 #endif
                 return;
             }
-            minimumInfo->visited = true;
-            const SUMOReal traveltime = minimumInfo->traveltime + getEffort(minEdge, vehicle, time + minimumInfo->traveltime);
-            // check all ways from the node with the minimal length
-            unsigned int i = 0;
-            const unsigned int length_size = minEdge->getNoFollowing();
-            for (i = 0; i < length_size; i++) {
-                const E* const follower = minEdge->getFollower(i);
-                EdgeInfo* const followerInfo = &(myEdgeInfos[follower->getNumericalID()]);
-                // check whether it can be used
-                if (PF::operator()(follower, vehicle)) {
-                    continue;
-                }
-                const SUMOReal oldEffort = followerInfo->traveltime;
-                if (!followerInfo->visited && traveltime < oldEffort) {
-                    followerInfo->traveltime = traveltime;
-                    followerInfo->prev = minimumInfo;
-                    if (oldEffort == std::numeric_limits<SUMOReal>::max()) {
-                        myFrontierList.push_back(followerInfo);
-                        push_heap(myFrontierList.begin(), myFrontierList.end(), myComparator);
-                    } else {
-                        push_heap(myFrontierList.begin(),
-                                  find(myFrontierList.begin(), myFrontierList.end(), followerInfo) + 1,
-                                  myComparator);
-                    }
-                }
-            }
+            expand(minimumInfo, vehicle, time);
         }
         endQuery(num_visited);
 #ifdef DijkstraRouterTT_DEBUG_QUERY_PERF
@@ -219,6 +199,57 @@ public:
     }
 
 
+    /** @brief Builds the routes from the given edge to each of the given destinations
+     *
+     * Grows a single search tree until all destinations are reached, the
+     *  routes are the same as the ones of separate queries.
+     */
+    virtual void computeOneToMany(const E* from, const std::vector<const E*>& to, const V* const vehicle,
+                                  SUMOTime msTime, std::vector<std::vector<const E*> >& into) {
+        assert(from != 0);
+        startQuery();
+        const SUMOReal time = STEPS2TIME(msTime);
+        init();
+        into.clear();
+        into.resize(to.size());
+        // the indices of the destinations not reached yet by edge
+        std::map<const E*, std::vector<size_t> > open;
+        for (size_t i = 0; i < to.size(); ++i) {
+            assert(to[i] != 0);
+            open[to[i]].push_back(i);
+        }
+        // add begin node
+        EdgeInfo* const fromInfo = &(myEdgeInfos[from->getNumericalID()]);
+        fromInfo->traveltime = 0;
+        fromInfo->prev = 0;
+        myFrontierList.push(fromInfo);
+        // loop
+        int num_visited = 0;
+        while (!myFrontierList.empty() && !open.empty()) {
+            num_visited += 1;
+            // use the node with the minimal length
+            EdgeInfo* const minimumInfo = myFrontierList.top();
+            myFrontierList.pop();
+            myFound.push_back(minimumInfo);
+            // check whether destinations were reached
+            typename std::map<const E*, std::vector<size_t> >::iterator reached = open.find(minimumInfo->edge);
+            if (reached != open.end()) {
+                for (std::vector<size_t>::const_iterator i = reached->second.begin(); i != reached->second.end(); ++i) {
+                    buildPathFrom(minimumInfo, into[*i]);
+                }
+                open.erase(reached);
+            }
+            expand(minimumInfo, vehicle, time);
+        }
+        endQuery(num_visited);
+        for (size_t i = 0; i < to.size(); ++i) {
+            if (into[i].empty()) {
+                myErrorMsgHandler->inform("No connection between '" + from->getID() + "' and '" + to[i]->getID() + "' found.");
+            }
+        }
+    }
+
+
     SUMOReal recomputeCosts(const std::vector<const E*>& edges, const V* const v, SUMOTime msTime) const {
         const SUMOReal time = STEPS2TIME(msTime);
         SUMOReal costs = 0;
@@ -231,6 +262,35 @@ public:
         return costs;
     }
 
+private:
+    /// @brief Marks the edge as visited and updates the travel times of its followers
+    inline void expand(EdgeInfo* const minimumInfo, const V* const vehicle, const SUMOReal time) {
+        const E* const minEdge = minimumInfo->edge;
+        minimumInfo->visited = true;
+        const SUMOReal traveltime = minimumInfo->traveltime + getEffort(minEdge, vehicle, time + minimumInfo->traveltime);
+        // check all ways from the node with the minimal length
+        unsigned int i = 0;
+        const unsigned int length_size = minEdge->getNoFollowing();
+        for (i = 0; i < length_size; i++) {
+            const E* const follower = minEdge->getFollower(i);
+            EdgeInfo* const followerInfo = &(myEdgeInfos[follower->getNumericalID()]);
+            // check whether it can be used
+            if (PF::operator()(follower, vehicle)) {
+                continue;
+            }
+            const SUMOReal oldEffort = followerInfo->traveltime;
+            if (!followerInfo->visited && traveltime < oldEffort) {
+                followerInfo->traveltime = traveltime;
+                followerInfo->prev = minimumInfo;
+                if (oldEffort == std::numeric_limits<SUMOReal>::max()) {
+                    myFrontierList.push(followerInfo);
+                } else {
+                    myFrontierList.update(followerInfo);
+                }
+            }
+        }
+    }
+
 public:
     /// Builds the path from marked edges
     void buildPathFrom(EdgeInfo* rbegin, std::vector<const E*>& edges) {
@@ -246,13 +306,14 @@ protected:
     /// The container of edge information
     std::vector<EdgeInfo> myEdgeInfos;
 
+    /// @brief The heap of edges to visit, ordered by travel time
+    typedef IndexedHeap<EdgeInfo, EdgeInfoByTTComparator> FrontierHeap;
+
     /// A container for reusage of the min edge heap
-    std::vector<EdgeInfo*> myFrontierList;
+    FrontierHeap myFrontierList;
     /// @brief list of visited Edges (for resetting)
     std::vector<EdgeInfo*> myFound;
 
-    EdgeInfoByTTComparator myComparator;
-
     /// @brief the handler for routing errors
     MsgHandler* const myErrorMsgHandler;
 };
@@ -93,6 +93,12 @@ FileHelpers::isSocket(const std::string& name) {
 }
 
 
+bool
+FileHelpers::isGzip(const std::string& name) {
+    return name.length() > 3 && name.substr(name.length() - 3) == ".gz";
+}
+
+
 bool
 FileHelpers::isAbsolute(const std::string& path) {
     if (isSocket(path)) {
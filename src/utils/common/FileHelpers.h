@@ -98,6 +98,16 @@ public:
     static bool isSocket(const std::string& name);
 
 
+    /** @brief Returns the information whether the given name represents a gzip compressed file
+     *
+     * A file is meant to be compressed if its name ends with ".gz".
+     *
+     * @param[in] name The name of a file
+     * @return Whether the name names a compressed file
+     */
+    static bool isGzip(const std::string& name);
+
+
     /** @brief Returns the information whether the given path is absolute
      *
      * A path is meant to be absolute, if
@@ -0,0 +1,378 @@
+/****************************************************************************/
+/// @file    IDHandleMap.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A dictionary from string ids to dense numerical handles using open addressing
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef IDHandleMap_h
+#define IDHandleMap_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <cassert>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class IDHandleMap
+ * @brief A dictionary from string ids to dense numerical handles using open addressing
+ *
+ * Each stored object gets a handle which is an index into a contiguous
+ *  storage of (id, value) pairs. Handles of removed objects are reused, so
+ *  the handles stay dense even if objects are added and removed all the
+ *  time (as vehicles are).
+ *
+ * The ids are found using a hash table with linear probing which stores
+ *  the handles only. Removed entries are marked as deleted and cleaned up
+ *  when the table is rebuilt.
+ *
+ * Iteration goes over the stored pairs in the order of their handles; the
+ *  iterator skips unused handles. Like a std::map iterator, the id is
+ *  available as "first" and the value as "second".
+ */
+template<class T>
+class IDHandleMap {
+public:
+    /// @brief The type of the handles
+    typedef unsigned int Handle;
+
+    /// @brief The type of the stored entries
+    typedef std::pair<std::string, T> value_type;
+
+    /// @brief The value returned for unknown ids
+    static const Handle INVALID_HANDLE = 0xffffffff;
+
+
+    class const_iterator;
+    friend class const_iterator;
+
+    /**
+     * @class const_iterator
+     * @brief Iterator over the stored entries in the order of their handles
+     */
+    class const_iterator {
+    public:
+        /// @brief Default constructor
+        const_iterator() : myMap(0), myHandle(0) {}
+
+        /// @brief Constructor; moves to the first used handle at or after the given one
+        const_iterator(const IDHandleMap* map, Handle handle) : myMap(map), myHandle(handle) {
+            skipUnused();
+        }
+
+        const value_type& operator*() const {
+            return myMap->myEntries[myHandle];
+        }
+
+        const value_type* operator->() const {
+            return &myMap->myEntries[myHandle];
+        }
+
+        const_iterator& operator++() {
+            ++myHandle;
+            skipUnused();
+            return *this;
+        }
+
+        const_iterator operator++(int) {
+            const_iterator ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        bool operator==(const const_iterator& other) const {
+            return myHandle == other.myHandle;
+        }
+
+        bool operator!=(const const_iterator& other) const {
+            return myHandle != other.myHandle;
+        }
+
+        /// @brief Returns the handle of the current entry
+        Handle getHandle() const {
+            return myHandle;
+        }
+
+    private:
+        /// @brief Advances to the next used handle (or the end)
+        void skipUnused() {
+            while (myHandle < myMap->myUsed.size() && !myMap->myUsed[myHandle]) {
+                ++myHandle;
+            }
+        }
+
+    private:
+        /// @brief The map iterated over
+        const IDHandleMap* myMap;
+
+        /// @brief The current handle
+        Handle myHandle;
+    };
+
+
+public:
+    /// @brief Constructor
+    IDHandleMap() : mySize(0), myNumDeleted(0) {
+        mySlots.resize(16, EMPTY);
+    }
+
+
+    /// @brief Destructor
+    ~IDHandleMap() { }
+
+
+    /** @brief Adds the value under the given id unless the id is known
+     * @param[in] id The id of the value
+     * @param[in] value The value to store
+     * @return The handle of the new entry, INVALID_HANDLE if the id was already known
+     */
+    Handle insert(const std::string& id, const T& value) {
+        if ((mySize + myNumDeleted + 1) * 4 > mySlots.size() * 3) {
+            rehash(mySize * 4 > mySlots.size() ? 2 * mySlots.size() : mySlots.size());
+        }
+        const unsigned int hash = computeHash(id);
+        const size_t mask = mySlots.size() - 1;
+        size_t firstDeleted = mySlots.size();
+        size_t slot = hash & mask;
+        for (; mySlots[slot] != EMPTY; slot = (slot + 1) & mask) {
+            if (mySlots[slot] == DELETED) {
+                if (firstDeleted == mySlots.size()) {
+                    firstDeleted = slot;
+                }
+            } else if (myHashes[mySlots[slot]] == hash && myEntries[mySlots[slot]].first == id) {
+                return INVALID_HANDLE;
+            }
+        }
+        if (firstDeleted != mySlots.size()) {
+            slot = firstDeleted;
+            myNumDeleted--;
+        }
+        Handle handle;
+        if (myFreeHandles.empty()) {
+            handle = (Handle) myEntries.size();
+            myEntries.push_back(value_type(id, value));
+            myHashes.push_back(hash);
+            myUsed.push_back(true);
+        } else {
+            handle = myFreeHandles.back();
+            myFreeHandles.pop_back();
+            myEntries[handle] = value_type(id, value);
+            myHashes[handle] = hash;
+            myUsed[handle] = true;
+        }
+        mySlots[slot] = handle;
+        mySize++;
+        return handle;
+    }
+
+
+    /** @brief Returns the handle of the given id
+     * @param[in] id The id to look up
+     * @return The handle of the entry, INVALID_HANDLE if the id is not known
+     */
+    Handle find(const std::string& id) const {
+        const size_t slot = findSlot(id, computeHash(id));
+        return slot == mySlots.size() ? INVALID_HANDLE : mySlots[slot];
+    }
+
+
+    /** @brief Returns the value stored under the given handle
+     * @param[in] handle A valid handle
+     * @return The stored value
+     */
+    const T& get(Handle handle) const {
+        assert(handle < myEntries.size() && myUsed[handle]);
+        return myEntries[handle].second;
+    }
+
+
+    /** @brief Returns the id stored under the given handle
+     * @param[in] handle A valid handle
+     * @return The id of the entry
+     */
+    const std::string& getID(Handle handle) const {
+        assert(handle < myEntries.size() && myUsed[handle]);
+        return myEntries[handle].first;
+    }
+
+
+    /** @brief Removes the entry with the given id; its handle may be reused by the next insertion
+     * @param[in] id The id of the entry to remove
+     * @return Whether the id was known
+     */
+    bool erase(const std::string& id) {
+        const size_t slot = findSlot(id, computeHash(id));
+        if (slot == mySlots.size()) {
+            return false;
+        }
+        const Handle handle = mySlots[slot];
+        mySlots[slot] = DELETED;
+        myNumDeleted++;
+        myEntries[handle] = value_type();
+        myUsed[handle] = false;
+        myFreeHandles.push_back(handle);
+        mySize--;
+        return true;
+    }
+
+
+    /// @brief Removes all entries
+    void clear() {
+        myEntries.clear();
+        myHashes.clear();
+        myUsed.clear();
+        myFreeHandles.clear();
+        mySlots.assign(16, EMPTY);
+        mySize = 0;
+        myNumDeleted = 0;
+    }
+
+
+    /// @brief Returns the number of stored entries
+    size_t size() const {
+        return mySize;
+    }
+
+
+    /// @brief Returns the number of handles in use or free for reuse (an upper bound for all handles)
+    size_t handleCount() const {
+        return myEntries.size();
+    }
+
+
+    /// @brief Returns an iterator to the entry with the smallest handle
+    const_iterator begin() const {
+        return const_iterator(this, 0);
+    }
+
+
+    /// @brief Returns the iterator behind the last entry
+    const_iterator end() const {
+        return const_iterator(this, (Handle) myEntries.size());
+    }
+
+
+    /** @brief Computes the hash of the given id (FNV-1a)
+     * @param[in] id The id to hash
+     * @return The hash value
+     */
+    static unsigned int computeHash(const std::string& id) {
+        unsigned int hash = 2166136261u;
+        for (std::string::const_iterator i = id.begin(); i != id.end(); ++i) {
+            hash ^= (unsigned char)(*i);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+
+private:
+    /** @brief Returns the slot holding the given id
+     * @param[in] id The id to look up
+     * @param[in] hash The id's hash
+     * @return The slot index, the number of slots if the id is not known
+     */
+    size_t findSlot(const std::string& id, const unsigned int hash) const {
+        const size_t mask = mySlots.size() - 1;
+        for (size_t slot = hash & mask; mySlots[slot] != EMPTY; slot = (slot + 1) & mask) {
+            const Handle handle = mySlots[slot];
+            if (handle != DELETED && myHashes[handle] == hash && myEntries[handle].first == id) {
+                return slot;
+            }
+        }
+        return mySlots.size();
+    }
+
+
+    /** @brief Rebuilds the hash table with the given number of slots, dropping deleted markers
+     * @param[in] numSlots The new number of slots (a power of two)
+     */
+    void rehash(const size_t numSlots) {
+        mySlots.assign(numSlots, EMPTY);
+        const size_t mask = numSlots - 1;
+        for (Handle handle = 0; handle < myEntries.size(); ++handle) {
+            if (myUsed[handle]) {
+                size_t slot = myHashes[handle] & mask;
+                while (mySlots[slot] != EMPTY) {
+                    slot = (slot + 1) & mask;
+                }
+                mySlots[slot] = handle;
+            }
+        }
+        myNumDeleted = 0;
+    }
+
+
+private:
+    /// @brief Markers for empty and deleted slots
+    enum { EMPTY = 0xffffffff, DELETED = 0xfffffffe };
+
+    /// @brief The hash table (handles or markers); its size is a power of two
+    std::vector<Handle> mySlots;
+
+    /// @brief The stored entries, indexed by handle
+    std::vector<value_type> myEntries;
+
+    /// @brief The hashes of the stored ids, indexed by handle
+    std::vector<unsigned int> myHashes;
+
+    /// @brief Whether a handle is in use
+    std::vector<bool> myUsed;
+
+    /// @brief Handles of removed entries to be reused
+    std::vector<Handle> myFreeHandles;
+
+    /// @brief The number of stored entries
+    size_t mySize;
+
+    /// @brief The number of slots marked as deleted
+    size_t myNumDeleted;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    IDHandleMap(const IDHandleMap&);
+
+    /// @brief Invalidated assignment operator.
+    IDHandleMap& operator=(const IDHandleMap&);
+
+};
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+template<class T>
+const typename IDHandleMap<T>::Handle IDHandleMap<T>::INVALID_HANDLE;
+
+
+#endif
+
+/****************************************************************************/
+
@@ -0,0 +1,208 @@
+/****************************************************************************/
+/// @file    IndexedHeap.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A 4-ary heap which knows the position of its elements
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef IndexedHeap_h
+#define IndexedHeap_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstddef>
+#include <vector>
+#include <cassert>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class IndexedHeap
+ * @brief A 4-ary heap which knows the position of its elements
+ *
+ * The heap stores pointers to elements of type T which have to provide an
+ *  integer member "heapIndex". The heap keeps this member up to date with the
+ *  element's position (-1 if the element is not within the heap), so that
+ *  the key of an element may be decreased in O(log n) without searching it.
+ *
+ * The comparator follows the convention of std::push_heap: C(a, b) is true
+ *  if a has to be removed after b. With the comparators of the routers
+ *  (greater effort first) the heap returns the element with the minimum
+ *  effort. As long as the comparator is a strict total order (the routers
+ *  break ties by the edges' numerical ids) the elements are removed in the
+ *  same order as from a binary std heap.
+ */
+template<class T, class C>
+class IndexedHeap {
+public:
+    /// @brief The iterator over the elements (in heap order)
+    typedef typename std::vector<T*>::const_iterator const_iterator;
+
+
+    /// @brief Constructor
+    IndexedHeap() { }
+
+
+    /// @brief Returns whether the heap is empty
+    bool empty() const {
+        return myElements.empty();
+    }
+
+
+    /// @brief Returns the number of elements within the heap
+    size_t size() const {
+        return myElements.size();
+    }
+
+
+    /// @brief Returns the element to be removed next
+    T* top() const {
+        assert(!myElements.empty());
+        return myElements.front();
+    }
+
+
+    /** @brief Adds an element which is not within the heap yet
+     * @param[in] elem The element to add
+     */
+    void push(T* elem) {
+        assert(elem->heapIndex < 0);
+        myElements.push_back(elem);
+        siftUp(myElements.size() - 1);
+    }
+
+
+    /// @brief Removes the top element
+    void pop() {
+        assert(!myElements.empty());
+        myElements.front()->heapIndex = -1;
+        T* const last = myElements.back();
+        myElements.pop_back();
+        if (!myElements.empty()) {
+            // the last element usually belongs to the bottom, so the hole is
+            //  moved down to a leaf first and the element moved up from there
+            const size_t hole = moveHoleDown(0);
+            myElements[hole] = last;
+            siftUp(hole);
+        }
+    }
+
+
+    /** @brief Restores the heap order after the key of the element was decreased
+     * @param[in] elem The element within the heap whose key was decreased
+     */
+    void update(T* elem) {
+        assert(elem->heapIndex >= 0 && myElements[elem->heapIndex] == elem);
+        siftUp(elem->heapIndex);
+    }
+
+
+    /// @brief Removes all elements
+    void clear() {
+        for (typename std::vector<T*>::iterator i = myElements.begin(); i != myElements.end(); ++i) {
+            (*i)->heapIndex = -1;
+        }
+        myElements.clear();
+    }
+
+
+    /// @brief Returns an iterator to the first element
+    const_iterator begin() const {
+        return myElements.begin();
+    }
+
+
+    /// @brief Returns the iterator behind the last element
+    const_iterator end() const {
+        return myElements.end();
+    }
+
+
+private:
+    /// @brief Moves the element at the given position up until its parent is not removed after it
+    void siftUp(size_t pos) {
+        T* const elem = myElements[pos];
+        while (pos > 0) {
+            const size_t parent = (pos - 1) / ARITY;
+            if (!myComparator(myElements[parent], elem)) {
+                break;
+            }
+            myElements[pos] = myElements[parent];
+            myElements[pos]->heapIndex = (int) pos;
+            pos = parent;
+        }
+        myElements[pos] = elem;
+        elem->heapIndex = (int) pos;
+    }
+
+
+    /** @brief Fills the hole at the given position by moving up the best children down to a leaf
+     * @param[in] pos The position of the hole
+     * @return The position of the hole afterwards
+     */
+    size_t moveHoleDown(size_t pos) {
+        const size_t size = myElements.size();
+        while (true) {
+            const size_t first = pos * ARITY + 1;
+            size_t best = first;
+            if (first + ARITY <= size) {
+                // all children exist: pairwise tournament
+                T* const* const children = &myElements[first];
+                const size_t b1 = myComparator(children[0], children[1]) ? 1 : 0;
+                const size_t b2 = myComparator(children[2], children[3]) ? 3 : 2;
+                best += myComparator(children[b1], children[b2]) ? b2 : b1;
+            } else if (first >= size) {
+                return pos;
+            } else {
+                for (size_t child = first + 1; child < size; ++child) {
+                    if (myComparator(myElements[best], myElements[child])) {
+                        best = child;
+                    }
+                }
+            }
+            myElements[pos] = myElements[best];
+            myElements[pos]->heapIndex = (int) pos;
+            pos = best;
+        }
+    }
+
+
+private:
+    /// @brief The number of children of each node
+    enum { ARITY = 4 };
+
+    /// @brief The elements in heap order
+    std::vector<T*> myElements;
+
+    /// @brief The comparator
+    C myComparator;
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
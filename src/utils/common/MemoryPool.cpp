@@ -0,0 +1,155 @@
+/****************************************************************************/
+/// @file    MemoryPool.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A pool of memory blocks for frequently created and deleted objects
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <new>
+#include <cstdlib>
+#include <algorithm>
+#include <cassert>
+#include "MemoryPool.h"
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+MemoryPool::MemoryPool(const std::string& name, size_t blocksPerChunk)
+    : myName(name), myBlocksPerChunk(blocksPerChunk), myAllocationNo(0), myReuseNo(0),
+      myInUseNo(0), myMaxInUseNo(0), myReservedBytes(0), myReleased(false) {
+    getPoolRegistry().push_back(this);
+}
+
+
+MemoryPool::~MemoryPool() {
+    std::vector<MemoryPool*>& pools = getPoolRegistry();
+    pools.erase(std::find(pools.begin(), pools.end(), this));
+    // blocks still in use (e.g. of objects deleted during the program's exit) stay valid
+    if (myInUseNo == 0) {
+        for (std::vector<void*>::iterator i = myChunks.begin(); i != myChunks.end(); ++i) {
+            std::free(*i);
+        }
+    }
+}
+
+
+void*
+MemoryPool::allocate(size_t size) {
+    SizeClass& sc = getSizeClass(roundSize(size));
+    void* block;
+    if (sc.freeList != 0) {
+        block = sc.freeList;
+        sc.freeList = *static_cast<void**>(block);
+        myReuseNo++;
+    } else {
+        if (sc.chunkPos == sc.chunkEnd) {
+            const size_t chunkSize = sc.size * myBlocksPerChunk;
+            sc.chunkPos = static_cast<char*>(std::malloc(chunkSize));
+            if (sc.chunkPos == 0) {
+                throw std::bad_alloc();
+            }
+            sc.chunkEnd = sc.chunkPos + chunkSize;
+            myChunks.push_back(sc.chunkPos);
+            myReservedBytes += chunkSize;
+        }
+        block = sc.chunkPos;
+        sc.chunkPos += sc.size;
+    }
+    myAllocationNo++;
+    myInUseNo++;
+    myMaxInUseNo = std::max(myMaxInUseNo, myInUseNo);
+    return block;
+}
+
+
+void
+MemoryPool::deallocate(void* p, size_t size) {
+    if (p == 0) {
+        return;
+    }
+    assert(myInUseNo > 0);
+    SizeClass& sc = getSizeClass(roundSize(size));
+    *static_cast<void**>(p) = sc.freeList;
+    sc.freeList = p;
+    myInUseNo--;
+    if (myReleased && myInUseNo == 0) {
+        delete this;
+    }
+}
+
+
+void
+MemoryPool::release() {
+    if (myInUseNo == 0) {
+        delete this;
+    } else {
+        myReleased = true;
+    }
+}
+
+
+void
+MemoryPool::releasePools() {
+    // deleting a pool removes it from the registry
+    std::vector<MemoryPool*> pools = getPoolRegistry();
+    for (std::vector<MemoryPool*>::iterator i = pools.begin(); i != pools.end(); ++i) {
+        (*i)->release();
+    }
+}
+
+
+MemoryPool::SizeClass&
+MemoryPool::getSizeClass(size_t size) {
+    // there are only a few sizes (one per class using the pool)
+    for (std::vector<SizeClass>::iterator i = mySizeClasses.begin(); i != mySizeClasses.end(); ++i) {
+        if ((*i).size == size) {
+            return *i;
+        }
+    }
+    SizeClass sc;
+    sc.size = size;
+    sc.freeList = 0;
+    sc.chunkPos = 0;
+    sc.chunkEnd = 0;
+    mySizeClasses.push_back(sc);
+    return mySizeClasses.back();
+}
+
+
+std::vector<MemoryPool*>&
+MemoryPool::getPoolRegistry() {
+    static std::vector<MemoryPool*> pools;
+    return pools;
+}
+
+
+/****************************************************************************/
+
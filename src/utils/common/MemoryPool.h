@@ -0,0 +1,234 @@
+/****************************************************************************/
+/// @file    MemoryPool.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A pool of memory blocks for frequently created and deleted objects
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef MemoryPool_h
+#define MemoryPool_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <cstddef>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class MemoryPool
+ * @brief A pool of memory blocks for frequently created and deleted objects
+ *
+ * The pool hands out memory blocks which are carved from larger chunks. Blocks
+ *  given back are kept in a free list (one per block size) and reused by the
+ *  next allocation of the same size, so that objects which are created and
+ *  deleted all the time (vehicles, routes, devices) do not fragment the heap.
+ *  Chunks are only given back to the system when the pool is deleted and no
+ *  block is in use anymore. Pools which are used by static methods of the
+ *  pooled classes are deleted by releasePools at the end of the program.
+ *
+ * A class uses the pool by defining its own operator new and the sized
+ *  operator delete; derived classes of different sizes are served by the
+ *  same pool, each size having its own free list. Arrays are not pooled.
+ *
+ * All pools register themselves so that their counters can be reported
+ *  at the end of a run (see getPools).
+ *
+ * @note The pool is not thread safe; objects must be created and deleted by one thread at a time
+ */
+class MemoryPool {
+public:
+    /** @brief Constructor
+     *
+     * @param[in] name The name of the pool (used for reporting)
+     * @param[in] blocksPerChunk The number of blocks to reserve at once
+     */
+    MemoryPool(const std::string& name, size_t blocksPerChunk = 256);
+
+
+    /// @brief Destructor
+    ~MemoryPool();
+
+
+    /** @brief Returns a memory block of the given size
+     *
+     * @param[in] size The size of the block
+     * @return The block
+     * @exception std::bad_alloc If no memory could be reserved
+     */
+    void* allocate(size_t size);
+
+
+    /** @brief Gives the block back to the pool
+     *
+     * @param[in] p The block (may be 0)
+     * @param[in] size The size the block was allocated with
+     */
+    void deallocate(void* p, size_t size);
+
+
+    /** @brief Deletes the pool as soon as no block is in use
+     *
+     * The pool must have been built using new. It is deleted at once if no
+     *  block is in use, otherwise when the last block is given back.
+     */
+    void release();
+
+
+    /// @name Counters
+    /// @{
+
+    /// @brief Returns the name of the pool
+    const std::string& getName() const {
+        return myName;
+    }
+
+
+    /// @brief Returns the number of allocated blocks
+    unsigned long getAllocationNo() const {
+        return myAllocationNo;
+    }
+
+
+    /// @brief Returns the number of allocations which reused a block given back before
+    unsigned long getReuseNo() const {
+        return myReuseNo;
+    }
+
+
+    /// @brief Returns the number of blocks currently in use
+    size_t getInUseNo() const {
+        return myInUseNo;
+    }
+
+
+    /// @brief Returns the maximum number of blocks which were in use at the same time
+    size_t getMaxInUseNo() const {
+        return myMaxInUseNo;
+    }
+
+
+    /// @brief Returns the number of bytes reserved from the system
+    size_t getReservedBytes() const {
+        return myReservedBytes;
+    }
+    /// @}
+
+
+    /** @brief Returns all existing pools
+     * @return The pools in the order of their creation
+     */
+    static const std::vector<MemoryPool*>& getPools() {
+        return getPoolRegistry();
+    }
+
+
+    /** @brief Releases all pools (see release)
+     *
+     * Called at the end of the program; no object of a pooled class may be
+     *  built afterwards.
+     */
+    static void releasePools();
+
+
+private:
+    /// @brief The free list and the current chunk of one block size
+    struct SizeClass {
+        /// @brief The (rounded) size of the blocks
+        size_t size;
+        /// @brief The first free block, the following ones are linked through the blocks
+        void* freeList;
+        /// @brief The next unused position within the current chunk
+        char* chunkPos;
+        /// @brief The end of the current chunk
+        char* chunkEnd;
+    };
+
+
+    /** @brief Returns the size class of the given (rounded) block size, builds it if needed
+     * @param[in] size The rounded block size
+     * @return The size class
+     */
+    SizeClass& getSizeClass(size_t size);
+
+
+    /// @brief Returns the size rounded to the alignment of the blocks
+    static size_t roundSize(size_t size) {
+        const size_t alignment = 2 * sizeof(void*);
+        return size == 0 ? alignment : (size + alignment - 1) / alignment * alignment;
+    }
+
+
+    /// @brief Returns the list of all existing pools
+    static std::vector<MemoryPool*>& getPoolRegistry();
+
+
+private:
+    /// @brief The name of the pool
+    const std::string myName;
+
+    /// @brief The number of blocks to reserve at once
+    const size_t myBlocksPerChunk;
+
+    /// @brief The known block sizes
+    std::vector<SizeClass> mySizeClasses;
+
+    /// @brief The chunks reserved from the system
+    std::vector<void*> myChunks;
+
+    /// @brief The number of allocated blocks
+    unsigned long myAllocationNo;
+
+    /// @brief The number of allocations which reused a block
+    unsigned long myReuseNo;
+
+    /// @brief The number of blocks in use
+    size_t myInUseNo;
+
+    /// @brief The maximum number of blocks in use
+    size_t myMaxInUseNo;
+
+    /// @brief The number of bytes reserved from the system
+    size_t myReservedBytes;
+
+    /// @brief Whether the pool shall be deleted as soon as no block is in use
+    bool myReleased;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    MemoryPool(const MemoryPool&);
+
+    /// @brief Invalidated assignment operator.
+    MemoryPool& operator=(const MemoryPool&);
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
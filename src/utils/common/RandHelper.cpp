@@ -31,6 +31,8 @@
 
 #include <utils/options/OptionsCont.h>
 #include <utils/common/SysUtils.h>
+#include <utils/common/FileHelpers.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include "RandHelper.h"
 #include <ctime>
 #include <cmath>
@@ -87,5 +89,33 @@ RandHelper::initRandGlobal(MTRand* which) {
 }
 
 
+void
+RandHelper::saveState(std::ostream& os, const MTRand* which) {
+    if (which == 0) {
+        which = &myRandomNumberGenerator;
+    }
+    MTRand::uint32 state[MTRand::SAVE];
+    which->save(state);
+    for (int i = 0; i < MTRand::SAVE; ++i) {
+        FileHelpers::writeUInt(os, (unsigned int) state[i]);
+    }
+}
+
+
+void
+RandHelper::loadState(BinaryInputDevice& bis, MTRand* which) {
+    if (which == 0) {
+        which = &myRandomNumberGenerator;
+    }
+    MTRand::uint32 state[MTRand::SAVE];
+    for (int i = 0; i < MTRand::SAVE; ++i) {
+        unsigned int value;
+        bis >> value;
+        state[i] = value;
+    }
+    which->load(state);
+}
+
+
 /****************************************************************************/
 
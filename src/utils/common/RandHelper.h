@@ -32,6 +32,7 @@
 #endif
 
 #include <cassert>
+#include <iostream>
 #include <vector>
 #include <foreign/mersenne/MersenneTwister.h>
 
@@ -40,6 +41,7 @@
 // class declarations
 // ===========================================================================
 class OptionsCont;
+class BinaryInputDevice;
 
 
 // ===========================================================================
@@ -57,19 +59,28 @@ public:
     /// @brief Reads the given random number options and initialises the random number generator in accordance
     static void initRandGlobal(MTRand* which = 0);
 
-    /// @brief Returns a random real number in [0, 1)
-    static inline SUMOReal rand() {
-        return (SUMOReal) RandHelper::myRandomNumberGenerator.randExc();
+    /// @brief Saves the state of the given generator (the global one if 0) into the given stream (binary)
+    static void saveState(std::ostream& os, const MTRand* which = 0);
+
+    /// @brief Loads the state of the given generator (the global one if 0) as written by saveState
+    static void loadState(BinaryInputDevice& bis, MTRand* which = 0);
+
+    /// @brief Returns a random real number in [0, 1) using the given generator (the global one if 0)
+    static inline SUMOReal rand(MTRand* rng = 0) {
+        if (rng == 0) {
+            rng = &myRandomNumberGenerator;
+        }
+        return (SUMOReal) rng->randExc();
     }
 
     /// @brief Returns a random real number in [0, maxV)
-    static inline SUMOReal rand(SUMOReal maxV) {
-        return maxV * rand();
+    static inline SUMOReal rand(SUMOReal maxV, MTRand* rng = 0) {
+        return maxV * rand(rng);
     }
 
     /// @brief Returns a random real number in [minV, maxV)
-    static inline SUMOReal rand(SUMOReal minV, SUMOReal maxV) {
-        return minV + (maxV - minV) * rand();
+    static inline SUMOReal rand(SUMOReal minV, SUMOReal maxV, MTRand* rng = 0) {
+        return minV + (maxV - minV) * rand(rng);
     }
 
     /// @brief Returns a random integer in [0, maxV-1]
@@ -92,6 +103,11 @@ public:
         return (SUMOReal) rng.randNorm(mean, variance);
     }
 
+    /// @brief Access to a random number from a normal distribution using the given generator (the global one if 0)
+    static inline SUMOReal randNorm(SUMOReal mean, SUMOReal variance, MTRand* rng) {
+        return randNorm(mean, variance, rng == 0 ? myRandomNumberGenerator : *rng);
+    }
+
     /// @brief Returns a random element from the given vector
     template<class T>
     static inline T
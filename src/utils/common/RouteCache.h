@@ -0,0 +1,471 @@
+/****************************************************************************/
+/// @file    RouteCache.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A bounded cache of routes with least recently used eviction
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef RouteCache_h
+#define RouteCache_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <vector>
+#include <cstddef>
+#include <cassert>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class RouteCache
+ * @brief A bounded cache of routes with least recently used eviction
+ *
+ * The routes are stored under their origin, destination and vehicle class
+ *  and the version (epoch) of the edge weights they were computed with. Routes
+ *  of older epochs are not found anymore and are evicted as the least recently
+ *  used ones, so that all routes become invalid without clearing the cache.
+ *
+ * The memory used by the entries (including the edges of the routes) is
+ *  estimated; if adding a route exceeds the budget, the least recently used
+ *  routes are removed. The routes containing an edge can be removed
+ *  explicitly (see invalidate), e.g. when the edge's weight changed.
+ *
+ * The entries are found using a hash table with linear probing storing
+ *  indices into the entry storage. The routes of each edge are kept in a
+ *  list of entry indices which is cleaned lazily; an entry carries a
+ *  generation counter so that references to removed entries are detected.
+ *
+ * The edge type needs "getNumericalID". The stored values are handed to
+ *  the given release function when they are removed from the cache.
+ */
+template<class E, class V>
+class RouteCache {
+public:
+    /// @brief The key of a cached route
+    struct Key {
+        /// @brief The first edge of the route
+        const E* from;
+        /// @brief The last edge of the route
+        const E* to;
+        /// @brief The vehicle class the route was computed for
+        int vClass;
+        /// @brief The version of the edge weights the route was computed with
+        unsigned int epoch;
+
+        bool operator==(const Key& other) const {
+            return from == other.from && to == other.to && vClass == other.vClass && epoch == other.epoch;
+        }
+    };
+
+    /// @brief The function called for removed values
+    typedef void(* ReleaseFunction)(V);
+
+
+    /** @brief Constructor
+     *
+     * @param[in] memoryBudget The maximum memory (in bytes) to use for the entries
+     * @param[in] release The function to call for removed values (may be 0)
+     */
+    RouteCache(size_t memoryBudget, ReleaseFunction release = 0)
+        : myMemoryBudget(memoryBudget), myRelease(release), mySize(0), myNumDeleted(0), myMemory(0),
+          myFirst(NONE), myLast(NONE), myHitNo(0), myMissNo(0), myInvalidatedNo(0), myEvictedNo(0) {
+        mySlots.resize(16, EMPTY);
+    }
+
+
+    /// @brief Destructor; releases all values
+    ~RouteCache() {
+        clear();
+    }
+
+
+    /** @brief Looks up the route stored under the given key
+     *
+     * A found route becomes the most recently used one.
+     *
+     * @param[in] key The key to look up
+     * @param[out] into The found value
+     * @return Whether a route was found
+     */
+    bool get(const Key& key, V& into) {
+        const size_t slot = findSlot(key, computeHash(key));
+        if (slot == mySlots.size()) {
+            myMissNo++;
+            return false;
+        }
+        const unsigned int index = mySlots[slot];
+        unlink(index);
+        pushFront(index);
+        into = myEntries[index].value;
+        myHitNo++;
+        return true;
+    }
+
+
+    /** @brief Stores the value under the given key, replacing a route stored before
+     *
+     * Least recently used routes are removed until the new entry fits into the
+     *  memory budget. The value is released at once if it does not fit at all.
+     *
+     * @param[in] key The key of the route
+     * @param[in] value The value to store
+     * @param[in] edges The edges of the route
+     */
+    void insert(const Key& key, V value, const std::vector<const E*>& edges) {
+        const unsigned int hash = computeHash(key);
+        size_t slot = findSlot(key, hash);
+        if (slot != mySlots.size()) {
+            remove(slot);
+        }
+        const size_t memory = computeMemory(edges.size());
+        if (memory > myMemoryBudget) {
+            if (myRelease != 0) {
+                myRelease(value);
+            }
+            return;
+        }
+        while (myMemory + memory > myMemoryBudget) {
+            remove(findSlot(myEntries[myLast].key, myEntries[myLast].hash));
+            myEvictedNo++;
+        }
+        if ((mySize + myNumDeleted + 1) * 4 > mySlots.size() * 3) {
+            rehash(mySize * 4 > mySlots.size() ? 2 * mySlots.size() : mySlots.size());
+        }
+        // find a free slot, reusing deleted ones
+        const size_t mask = mySlots.size() - 1;
+        for (slot = hash & mask; mySlots[slot] != EMPTY && mySlots[slot] != DELETED; slot = (slot + 1) & mask) {}
+        if (mySlots[slot] == DELETED) {
+            myNumDeleted--;
+        }
+        unsigned int index;
+        if (myFreeEntries.empty()) {
+            index = (unsigned int) myEntries.size();
+            myEntries.push_back(Entry());
+            myEntries.back().generation = 0;
+        } else {
+            index = myFreeEntries.back();
+            myFreeEntries.pop_back();
+        }
+        Entry& entry = myEntries[index];
+        entry.key = key;
+        entry.hash = hash;
+        entry.value = value;
+        entry.memory = memory;
+        entry.used = true;
+        mySlots[slot] = index;
+        pushFront(index);
+        mySize++;
+        myMemory += memory;
+        // register the route at its edges
+        for (typename std::vector<const E*>::const_iterator i = edges.begin(); i != edges.end(); ++i) {
+            const size_t id = (size_t)(*i)->getNumericalID();
+            if (id >= myEdgeRoutes.size()) {
+                myEdgeRoutes.resize(id + 1);
+            }
+            std::vector<EntryRef>& refs = myEdgeRoutes[id];
+            if (refs.size() == refs.capacity()) {
+                // drop the references to removed entries before the list grows
+                purge(refs);
+            }
+            refs.push_back(EntryRef(index, entry.generation));
+        }
+    }
+
+
+    /** @brief Removes all routes which contain the given edge
+     * @param[in] edge The edge
+     * @return The number of removed routes
+     */
+    unsigned int invalidate(const E* const edge) {
+        const size_t id = (size_t) edge->getNumericalID();
+        if (id >= myEdgeRoutes.size()) {
+            return 0;
+        }
+        std::vector<EntryRef> refs;
+        refs.swap(myEdgeRoutes[id]);
+        unsigned int removed = 0;
+        for (typename std::vector<EntryRef>::const_iterator i = refs.begin(); i != refs.end(); ++i) {
+            const Entry& entry = myEntries[i->index];
+            if (entry.used && entry.generation == i->generation) {
+                remove(findSlot(entry.key, entry.hash));
+                removed++;
+            }
+        }
+        myInvalidatedNo += removed;
+        return removed;
+    }
+
+
+    /// @brief Removes all routes (the counters are kept)
+    void clear() {
+        for (typename std::vector<Entry>::const_iterator i = myEntries.begin(); i != myEntries.end(); ++i) {
+            if (i->used && myRelease != 0) {
+                myRelease(i->value);
+            }
+        }
+        myEntries.clear();
+        myFreeEntries.clear();
+        myEdgeRoutes.clear();
+        mySlots.assign(16, EMPTY);
+        mySize = 0;
+        myNumDeleted = 0;
+        myMemory = 0;
+        myFirst = NONE;
+        myLast = NONE;
+    }
+
+
+    /// @brief Returns the number of stored routes
+    size_t size() const {
+        return mySize;
+    }
+
+
+    /// @brief Returns the estimated memory used by the stored routes
+    size_t getMemory() const {
+        return myMemory;
+    }
+
+
+    /// @name Counters
+    /// @{
+
+    /// @brief Returns the number of successful lookups
+    unsigned long getHitNo() const {
+        return myHitNo;
+    }
+
+    /// @brief Returns the number of failed lookups
+    unsigned long getMissNo() const {
+        return myMissNo;
+    }
+
+    /// @brief Returns the number of routes removed because of their edges
+    unsigned long getInvalidatedNo() const {
+        return myInvalidatedNo;
+    }
+
+    /// @brief Returns the number of routes removed to keep the memory budget
+    unsigned long getEvictedNo() const {
+        return myEvictedNo;
+    }
+    /// @}
+
+
+    /** @brief Returns the estimated memory of an entry
+     * @param[in] numEdges The number of edges of the route
+     * @return The memory used by the entry, the route's edges and the edge references
+     */
+    static size_t computeMemory(size_t numEdges) {
+        return sizeof(Entry) + 2 * sizeof(unsigned int) + numEdges * (sizeof(const E*) + sizeof(EntryRef));
+    }
+
+
+private:
+    /// @brief A cached route
+    struct Entry {
+        /// @brief The key of the route
+        Key key;
+        /// @brief The hash of the key
+        unsigned int hash;
+        /// @brief The stored value
+        V value;
+        /// @brief The estimated memory of the entry
+        size_t memory;
+        /// @brief The neighbours in the list of recent use
+        unsigned int prev, next;
+        /// @brief Counter of the reuses of the entry, invalidating older references
+        unsigned int generation;
+        /// @brief Whether the entry holds a route
+        bool used;
+    };
+
+    /// @brief A reference from an edge to an entry
+    struct EntryRef {
+        EntryRef(unsigned int i, unsigned int g) : index(i), generation(g) {}
+        /// @brief The index of the entry
+        unsigned int index;
+        /// @brief The generation of the entry when the reference was made
+        unsigned int generation;
+    };
+
+    /// @brief Markers for empty and deleted hash slots and for missing list neighbours
+    enum { EMPTY = 0xffffffff, DELETED = 0xfffffffe, NONE = 0xffffffff };
+
+
+    /// @brief Computes the hash of a key
+    static unsigned int computeHash(const Key& key) {
+        size_t hash = (size_t) key.from;
+        hash = hash * 31 + (size_t) key.to;
+        hash = hash * 31 + (size_t) key.vClass;
+        hash = hash * 31 + (size_t) key.epoch;
+        // mix the high bits into the low ones which select the slot
+        hash ^= hash >> 16;
+        hash *= 0x45d9f3b;
+        hash ^= hash >> 16;
+        return (unsigned int) hash;
+    }
+
+
+    /** @brief Returns the slot holding the given key
+     * @return The slot index, the number of slots if the key is not known
+     */
+    size_t findSlot(const Key& key, const unsigned int hash) const {
+        const size_t mask = mySlots.size() - 1;
+        for (size_t slot = hash & mask; mySlots[slot] != EMPTY; slot = (slot + 1) & mask) {
+            const unsigned int index = mySlots[slot];
+            if (index != DELETED && myEntries[index].hash == hash && myEntries[index].key == key) {
+                return slot;
+            }
+        }
+        return mySlots.size();
+    }
+
+
+    /// @brief Removes the entry stored in the given slot
+    void remove(const size_t slot) {
+        assert(slot < mySlots.size());
+        const unsigned int index = mySlots[slot];
+        mySlots[slot] = DELETED;
+        myNumDeleted++;
+        unlink(index);
+        Entry& entry = myEntries[index];
+        if (myRelease != 0) {
+            myRelease(entry.value);
+        }
+        entry.used = false;
+        entry.generation++;
+        myMemory -= entry.memory;
+        myFreeEntries.push_back(index);
+        mySize--;
+    }
+
+
+    /// @brief Removes the entry from the list of recent use
+    void unlink(const unsigned int index) {
+        Entry& entry = myEntries[index];
+        if (entry.prev != NONE) {
+            myEntries[entry.prev].next = entry.next;
+        } else {
+            myFirst = entry.next;
+        }
+        if (entry.next != NONE) {
+            myEntries[entry.next].prev = entry.prev;
+        } else {
+            myLast = entry.prev;
+        }
+    }
+
+
+    /// @brief Makes the entry the most recently used one
+    void pushFront(const unsigned int index) {
+        Entry& entry = myEntries[index];
+        entry.prev = NONE;
+        entry.next = myFirst;
+        if (myFirst != NONE) {
+            myEntries[myFirst].prev = index;
+        } else {
+            myLast = index;
+        }
+        myFirst = index;
+    }
+
+
+    /// @brief Removes the references to removed entries from the list
+    void purge(std::vector<EntryRef>& refs) const {
+        typename std::vector<EntryRef>::iterator valid = refs.begin();
+        for (typename std::vector<EntryRef>::const_iterator i = refs.begin(); i != refs.end(); ++i) {
+            const Entry& entry = myEntries[i->index];
+            if (entry.used && entry.generation == i->generation) {
+                *valid++ = *i;
+            }
+        }
+        refs.erase(valid, refs.end());
+    }
+
+
+    /// @brief Rebuilds the hash table with the given number of slots, dropping deleted markers
+    void rehash(const size_t numSlots) {
+        mySlots.assign(numSlots, EMPTY);
+        const size_t mask = numSlots - 1;
+        for (unsigned int index = 0; index < myEntries.size(); ++index) {
+            if (myEntries[index].used) {
+                size_t slot = myEntries[index].hash & mask;
+                while (mySlots[slot] != EMPTY) {
+                    slot = (slot + 1) & mask;
+                }
+                mySlots[slot] = index;
+            }
+        }
+        myNumDeleted = 0;
+    }
+
+
+private:
+    /// @brief The maximum memory to use
+    const size_t myMemoryBudget;
+
+    /// @brief The function to call for removed values
+    const ReleaseFunction myRelease;
+
+    /// @brief The entries (used ones and free ones)
+    std::vector<Entry> myEntries;
+
+    /// @brief The indices of the free entries
+    std::vector<unsigned int> myFreeEntries;
+
+    /// @brief The hash table of entry indices
+    std::vector<unsigned int> mySlots;
+
+    /// @brief The references to the routes of each edge, indexed by the edges' numerical ids
+    std::vector<std::vector<EntryRef> > myEdgeRoutes;
+
+    /// @brief The number of stored routes and of deleted hash slots
+    size_t mySize, myNumDeleted;
+
+    /// @brief The estimated memory of the stored routes
+    size_t myMemory;
+
+    /// @brief The most and the least recently used entry
+    unsigned int myFirst, myLast;
+
+    /// @brief The counters
+    unsigned long myHitNo, myMissNo, myInvalidatedNo, myEvictedNo;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    RouteCache(const RouteCache&);
+
+    /// @brief Invalidated assignment operator.
+    RouteCache& operator=(const RouteCache&);
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
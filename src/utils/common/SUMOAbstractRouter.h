@@ -76,6 +76,48 @@ public:
     virtual SUMOReal recomputeCosts(const std::vector<const E*>& edges,
                                     const V* const v, SUMOTime msTime) const = 0;
 
+    /** @brief Builds the routes from the given edge to each of the given destinations
+     *
+     * The default implementation answers one query per destination, routers
+     *  which build a search tree answer all of them with a single one. A
+     *  destination which cannot be reached gets an empty route.
+     *
+     * @param[in] from The edge all routes start at
+     * @param[in] to The destinations
+     * @param[in] vehicle The vehicle to route
+     * @param[in] msTime The departure time
+     * @param[out] into The routes in the order of the destinations
+     */
+    virtual void computeOneToMany(const E* from, const std::vector<const E*>& to, const V* const vehicle,
+                                  SUMOTime msTime, std::vector<std::vector<const E*> >& into) {
+        into.clear();
+        into.resize(to.size());
+        for (size_t i = 0; i < to.size(); ++i) {
+            compute(from, to[i], vehicle, msTime, into[i]);
+        }
+    }
+
+    /** @brief Computes the costs of the routes between all origins and destinations
+     *
+     * @param[in] from The origins
+     * @param[in] to The destinations
+     * @param[in] vehicle The vehicle to route
+     * @param[in] msTime The departure time
+     * @param[out] into The costs by origin and destination, -1 if there is no route
+     */
+    void computeMatrix(const std::vector<const E*>& from, const std::vector<const E*>& to, const V* const vehicle,
+                       SUMOTime msTime, std::vector<std::vector<SUMOReal> >& into) {
+        into.clear();
+        into.resize(from.size());
+        std::vector<std::vector<const E*> > routes;
+        for (size_t i = 0; i < from.size(); ++i) {
+            computeOneToMany(from[i], to, vehicle, msTime, routes);
+            for (size_t j = 0; j < to.size(); ++j) {
+                into[i].push_back(routes[j].empty() ? -1 : recomputeCosts(routes[j], vehicle, msTime));
+            }
+        }
+    }
+
     // interface extension for BulkStarRouter
     virtual void prepare(const E*, const V*, bool) {
         assert(false);
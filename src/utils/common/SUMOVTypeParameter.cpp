@@ -35,7 +35,9 @@
 #include <utils/common/ToString.h>
 #include <utils/common/TplConvert.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/FileHelpers.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/xml/SUMOXMLDefinitions.h>
 
@@ -139,5 +141,60 @@ SUMOVTypeParameter::get(const SumoXMLAttr attr, const SUMOReal defaultValue) con
 }
 
 
+void
+SUMOVTypeParameter::saveState(std::ostream& os) const {
+    FileHelpers::writeString(os, id);
+    FileHelpers::writeFloat(os, length);
+    FileHelpers::writeFloat(os, minGap);
+    FileHelpers::writeFloat(os, maxSpeed);
+    FileHelpers::writeFloat(os, defaultProbability);
+    FileHelpers::writeFloat(os, speedFactor);
+    FileHelpers::writeFloat(os, speedDev);
+    FileHelpers::writeInt(os, emissionClass);
+    FileHelpers::writeFloat(os, color.red());
+    FileHelpers::writeFloat(os, color.green());
+    FileHelpers::writeFloat(os, color.blue());
+    FileHelpers::writeInt(os, vehicleClass);
+    FileHelpers::writeFloat(os, width);
+    FileHelpers::writeFloat(os, height);
+    FileHelpers::writeInt(os, shape);
+    FileHelpers::writeString(os, osgFile);
+    FileHelpers::writeString(os, imgFile);
+    FileHelpers::writeInt(os, cfModel);
+    FileHelpers::writeUInt(os, (unsigned int) cfParameter.size());
+    for (CFParams::const_iterator i = cfParameter.begin(); i != cfParameter.end(); ++i) {
+        FileHelpers::writeInt(os, i->first);
+        FileHelpers::writeFloat(os, i->second);
+    }
+    FileHelpers::writeString(os, lcModel);
+    FileHelpers::writeInt(os, setParameter);
+}
+
+
+void
+SUMOVTypeParameter::loadState(BinaryInputDevice& bis) {
+    int enumValue;
+    SUMOReal r, g, b;
+    bis >> id >> length >> minGap >> maxSpeed >> defaultProbability >> speedFactor >> speedDev >> enumValue;
+    emissionClass = (SUMOEmissionClass) enumValue;
+    bis >> r >> g >> b >> enumValue;
+    color.set(r, g, b);
+    vehicleClass = (SUMOVehicleClass) enumValue;
+    bis >> width >> height >> enumValue;
+    shape = (SUMOVehicleShape) enumValue;
+    bis >> osgFile >> imgFile >> enumValue;
+    cfModel = (SumoXMLTag) enumValue;
+    unsigned int numParameter;
+    bis >> numParameter;
+    cfParameter.clear();
+    for (; numParameter > 0; numParameter--) {
+        SUMOReal value;
+        bis >> enumValue >> value;
+        cfParameter[(SumoXMLAttr) enumValue] = value;
+    }
+    bis >> lcModel >> setParameter;
+}
+
+
 /****************************************************************************/
 
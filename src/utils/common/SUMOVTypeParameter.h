@@ -44,6 +44,7 @@
 // ===========================================================================
 class OutputDevice;
 class OptionsCont;
+class BinaryInputDevice;
 
 
 // ===========================================================================
@@ -110,6 +111,18 @@ public:
     SUMOReal get(const SumoXMLAttr attr, const SUMOReal defaultValue) const;
 
 
+    /** @brief Saves the parameters (including the car-following parameter) into the given stream
+     * @param[in] os The stream to write the parameters into (binary)
+     */
+    void saveState(std::ostream& os) const;
+
+
+    /** @brief Loads the parameters as written by saveState
+     * @param[in] bis The input to read the parameters from (binary)
+     */
+    void loadState(BinaryInputDevice& bis);
+
+
     /// @brief The vehicle type's id
     std::string id;
 
@@ -34,6 +34,7 @@
 
 #include <vector>
 #include <utils/common/SUMOTime.h>
+#include <utils/common/StdDefs.h>
 #include <utils/common/SUMOAbstractRouter.h>
 #include <utils/common/SUMOVehicleParameter.h>
 
@@ -47,6 +48,7 @@ class MSEdge;
 class MSLane;
 class MSDevice;
 class MSPerson;
+class BinaryInputDevice;
 
 typedef std::vector<const MSEdge*> MSEdgeVector;
 
@@ -88,6 +90,11 @@ public:
      */
     virtual const MSVehicleType& getVehicleType() const = 0;
 
+    /** @brief Returns the vehicle's class
+     * @return The class of the vehicle's type
+     */
+    virtual SUMOVehicleClass getVClass() const = 0;
+
     /// Returns the current route
     virtual const MSRoute& getRoute() const = 0;
 
@@ -192,9 +199,43 @@ public:
 
 
     virtual SUMOReal getChosenSpeedFactor() const = 0;
+
+
+    /// @name State I/O
+    /// @{
+
+    /** @brief Saves the vehicle's dynamic state
+     *
+     * The vehicle's parameter, route and type are not saved.
+     * @param[in] os The stream to write the state into (binary)
+     */
+    virtual void saveState(std::ostream& os) const = 0;
+
+
+    /** @brief Loads the vehicle's dynamic state as written by saveState
+     *
+     * @param[in] bis The input to read the state from (binary)
+     * @param[in] offset The offset to add to the loaded times
+     */
+    virtual void loadState(BinaryInputDevice& bis, const SUMOTime offset) = 0;
+    /// @}
 };
 
 
+// ===========================================================================
+// function definitions
+// ===========================================================================
+/** @brief Returns the factor by which the vehicle may exceed the speed limits
+ *
+ * Overloads the default for the A* lower bounds (see AStarLookupTable.h).
+ * @param[in] veh The vehicle to route
+ * @return The vehicle's speed factor if above 1, 1 otherwise
+ */
+inline SUMOReal getSpeedLimitFactor(const SUMOVehicle* const veh) {
+    return MAX2((SUMOReal) 1., veh->getChosenSpeedFactor());
+}
+
+
 #endif
 
 /****************************************************************************/
@@ -34,7 +34,9 @@
 #include <utils/common/ToString.h>
 #include <utils/common/TplConvert.h>
 #include <utils/common/MsgHandler.h>
+#include <utils/common/FileHelpers.h>
 #include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/BinaryInputDevice.h>
 #include <utils/options/OptionsCont.h>
 
 #ifdef CHECK_MEMORY_LEAKS
@@ -249,6 +251,93 @@ SUMOVehicleParameter::writeAs(const std::string& xmlElem, OutputDevice& dev,
 }
 
 
+void
+SUMOVehicleParameter::saveState(std::ostream& os) const {
+    FileHelpers::writeString(os, id);
+    FileHelpers::writeString(os, routeid);
+    FileHelpers::writeString(os, vtypeid);
+    FileHelpers::writeFloat(os, color.red());
+    FileHelpers::writeFloat(os, color.green());
+    FileHelpers::writeFloat(os, color.blue());
+    FileHelpers::writeTime(os, depart);
+    FileHelpers::writeInt(os, departProcedure);
+    FileHelpers::writeInt(os, departLane);
+    FileHelpers::writeInt(os, departLaneProcedure);
+    FileHelpers::writeFloat(os, departPos);
+    FileHelpers::writeInt(os, departPosProcedure);
+    FileHelpers::writeFloat(os, departSpeed);
+    FileHelpers::writeInt(os, departSpeedProcedure);
+    FileHelpers::writeInt(os, arrivalLane);
+    FileHelpers::writeInt(os, arrivalLaneProcedure);
+    FileHelpers::writeFloat(os, arrivalPos);
+    FileHelpers::writeInt(os, arrivalPosProcedure);
+    FileHelpers::writeFloat(os, arrivalSpeed);
+    FileHelpers::writeInt(os, arrivalSpeedProcedure);
+    FileHelpers::writeInt(os, repetitionNumber);
+    FileHelpers::writeInt(os, repetitionsDone);
+    FileHelpers::writeFloat(os, (SUMOReal) repetitionOffset);
+    FileHelpers::writeString(os, line);
+    FileHelpers::writeString(os, fromTaz);
+    FileHelpers::writeString(os, toTaz);
+    FileHelpers::writeUInt(os, (unsigned int) stops.size());
+    for (std::vector<Stop>::const_iterator i = stops.begin(); i != stops.end(); ++i) {
+        FileHelpers::writeString(os, i->lane);
+        FileHelpers::writeString(os, i->busstop);
+        FileHelpers::writeFloat(os, i->startPos);
+        FileHelpers::writeFloat(os, i->endPos);
+        FileHelpers::writeTime(os, i->duration);
+        FileHelpers::writeTime(os, i->until);
+        FileHelpers::writeByte(os, i->triggered);
+        FileHelpers::writeByte(os, i->parking);
+        FileHelpers::writeInt(os, i->index);
+    }
+    FileHelpers::writeUInt(os, personCapacity);
+    FileHelpers::writeUInt(os, personNumber);
+    FileHelpers::writeInt(os, setParameter);
+}
+
+
+void
+SUMOVehicleParameter::loadState(BinaryInputDevice& bis) {
+    int enumValue;
+    SUMOReal r, g, b;
+    bis >> id >> routeid >> vtypeid >> r >> g >> b;
+    color.set(r, g, b);
+    bis >> depart >> enumValue;
+    departProcedure = (DepartDefinition) enumValue;
+    bis >> departLane >> enumValue;
+    departLaneProcedure = (DepartLaneDefinition) enumValue;
+    bis >> departPos >> enumValue;
+    departPosProcedure = (DepartPosDefinition) enumValue;
+    bis >> departSpeed >> enumValue;
+    departSpeedProcedure = (DepartSpeedDefinition) enumValue;
+    bis >> arrivalLane >> enumValue;
+    arrivalLaneProcedure = (ArrivalLaneDefinition) enumValue;
+    bis >> arrivalPos >> enumValue;
+    arrivalPosProcedure = (ArrivalPosDefinition) enumValue;
+    bis >> arrivalSpeed >> enumValue;
+    arrivalSpeedProcedure = (ArrivalSpeedDefinition) enumValue;
+    SUMOReal offset;
+    bis >> repetitionNumber >> repetitionsDone >> offset;
+#ifdef HAVE_SUBSECOND_TIMESTEPS
+    repetitionOffset = (SUMOTime) offset;
+#else
+    repetitionOffset = offset;
+#endif
+    bis >> line >> fromTaz >> toTaz;
+    unsigned int numStops;
+    bis >> numStops;
+    stops.clear();
+    for (; numStops > 0; numStops--) {
+        Stop stop;
+        bis >> stop.lane >> stop.busstop >> stop.startPos >> stop.endPos
+            >> stop.duration >> stop.until >> stop.triggered >> stop.parking >> stop.index;
+        stops.push_back(stop);
+    }
+    bis >> personCapacity >> personNumber >> setParameter;
+}
+
+
 bool
 SUMOVehicleParameter::parseDepartLane(const std::string& val, const std::string& element, const std::string& id,
                                       int& lane, DepartLaneDefinition& dld, std::string& error) {
@@ -418,5 +507,12 @@ SUMOVehicleParameter::interpretEdgePos(SUMOReal pos, SUMOReal maximumValue, Sumo
     return pos;
 }
 
+
+MemoryPool&
+SUMOVehicleParameter::getPool() {
+    static MemoryPool* const pool = new MemoryPool("vehicle parameter");
+    return *pool;
+}
+
 /****************************************************************************/
 
@@ -37,6 +37,7 @@
 #include "SUMOVehicleClass.h"
 #include "RGBColor.h"
 #include "SUMOTime.h"
+#include "MemoryPool.h"
 
 
 // ===========================================================================
@@ -44,6 +45,7 @@
 // ===========================================================================
 class OutputDevice;
 class OptionsCont;
+class BinaryInputDevice;
 
 // ===========================================================================
 // value definitions
@@ -228,6 +230,24 @@ public:
     SUMOVehicleParameter();
 
 
+#ifndef CHECK_MEMORY_LEAKS
+    /// @name Pooled allocation (see MemoryPool)
+    /// @{
+
+    /// @brief Returns the memory for new vehicle parameter from the pool
+    static void* operator new(size_t size) {
+        return getPool().allocate(size);
+    }
+
+
+    /// @brief Gives the memory of deleted vehicle parameter back to the pool
+    static void operator delete(void* p, size_t size) {
+        getPool().deallocate(p, size);
+    }
+    /// @}
+#endif
+
+
     /** @brief Returns whether the given parameter was set
      * @param[in] what The parameter which one asks for
      * @return Whether the given parameter was set
@@ -256,6 +276,22 @@ public:
     bool defaultOptionOverrides(const OptionsCont& oc, const std::string& optionName) const;
 
 
+    /// @name State I/O
+    /// @{
+
+    /** @brief Saves the parameters (including the stops) into the given stream
+     * @param[in] os The stream to write the parameters into (binary)
+     */
+    void saveState(std::ostream& os) const;
+
+
+    /** @brief Loads the parameters as written by saveState
+     * @param[in] bis The input to read the parameters from (binary)
+     */
+    void loadState(BinaryInputDevice& bis);
+    /// @}
+
+
 
     /// @name Depart/arrival-attributes verification
     /// @{
@@ -461,6 +497,17 @@ public:
     mutable int setParameter;
 
 
+private:
+    /** @brief Returns the pool the memory of vehicle parameter is taken from
+     *
+     * The pool is built on first use and deleted by MemoryPool::releasePools
+     *  after the last vehicle parameter was deleted. Vehicle parameter are
+     *  built and deleted by the loading thread only (the routing threads of
+     *  the routers and the simulation work on existing ones).
+     */
+    static MemoryPool& getPool();
+
+
 };
 
 #endif
@@ -33,6 +33,7 @@
 #include "SystemFrame.h"
 #include <string>
 #include <utils/xml/XMLSubSys.h>
+#include <utils/common/MemoryPool.h>
 #include <utils/common/MsgHandler.h>
 #include <utils/options/OptionsCont.h>
 #include <utils/iodevices/OutputDevice.h>
@@ -115,6 +116,8 @@ SystemFrame::close() {
     OptionsCont::getOptions().clear();
     // delete messages
     MsgHandler::cleanupOnEnd();
+    // delete the pools of the pooled objects
+    MemoryPool::releasePools();
 }
 
 
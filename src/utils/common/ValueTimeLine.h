@@ -27,9 +27,11 @@
 // included modules
 // ===========================================================================
 #include <map>
+#include <vector>
 #include <cassert>
 #include <utility>
 #include <utils/common/SUMOTime.h>
+#include <utils/common/StdDefs.h>
 
 #ifdef _MSC_VER
 #include <windows_config.h>
@@ -48,12 +50,17 @@
  * with assigned values. The container is sorted by the first value of the
  * time-range while being filled. Every new inserted time range
  * may overwrite or split one or multiple earlier intervals.
+ *
+ * Once filling is done, buildDenseTable may be called to copy the intervals
+ * into a flat array together with a table of equally sized cells pointing
+ * into it, so that the queries do not need to search the map anymore.
+ * Adding values or filling gaps discards the table again.
  */
 template<typename T>
 class ValueTimeLine {
 public:
     /// @brief Constructor
-    ValueTimeLine() { }
+    ValueTimeLine() : myCellBegin(0), myCellWidth(0) { }
 
     /// @brief Destructor
     ~ValueTimeLine() { }
@@ -69,6 +76,7 @@ public:
     void add(SUMOReal begin, SUMOReal end, T value) {
         assert(begin >= 0);
         assert(begin < end);
+        clearDenseTable();
         // inserting strictly before the first or after the last interval (includes empty case)
         if (myValues.upper_bound(begin) == myValues.end() ||
                 myValues.upper_bound(end) == myValues.begin()) {
@@ -102,6 +110,11 @@ public:
      */
     T getValue(SUMOReal time) const {
         assert(myValues.size() != 0);
+        if (!myIntervals.empty()) {
+            const int index = getIntervalIndex(time);
+            assert(index >= 0);
+            return myIntervals[index].second.second;
+        }
         typename TimedValueMap::const_iterator it = myValues.upper_bound(time);
         assert(it != myValues.begin());
         --it;
@@ -119,6 +132,10 @@ public:
      * @return whether a valid value was set
      */
     bool describesTime(SUMOReal time) const {
+        if (!myIntervals.empty()) {
+            const int index = getIntervalIndex(time);
+            return index >= 0 && myIntervals[index].second.first;
+        }
         typename TimedValueMap::const_iterator afterIt = myValues.upper_bound(time);
         if (afterIt == myValues.begin()) {
             return false;
@@ -138,6 +155,13 @@ public:
      * @return the split point
      */
     SUMOReal getSplitTime(SUMOReal low, SUMOReal high) const {
+        if (!myIntervals.empty()) {
+            const int afterLow = getIntervalIndex(low) + 1;
+            if (afterLow == getIntervalIndex(high)) {
+                return myIntervals[afterLow].first;
+            }
+            return -1;
+        }
         typename TimedValueMap::const_iterator afterLow = myValues.upper_bound(low);
         typename TimedValueMap::const_iterator afterHigh = myValues.upper_bound(high);
         --afterHigh;
@@ -153,6 +177,7 @@ public:
      * @param[in] extendOverBoundaries whether the first/last value should be valid for later / earlier times as well
      */
     void fillGaps(T value, bool extendOverBoundaries = false) {
+        clearDenseTable();
         for (typename TimedValueMap::iterator it = myValues.begin(); it != myValues.end(); ++it) {
             if (!it->second.first) {
                 it->second.second = value;
@@ -168,6 +193,87 @@ public:
         myValues[-1] = std::make_pair(false, value);
     }
 
+    /** @brief Builds the table for the lookup of values without searching the map.
+     *
+     * The cells of the table have the width of the shortest interval
+     *  (not counting the one before the first begin) and each refers to the
+     *  interval containing its begin. The table is only built if it does
+     *  not exceed the given number of cells per interval, which holds
+     *  if all intervals are multiples of a common aggregation period.
+     *
+     * @param[in] maxCellsPerInterval the maximum ratio of cells to intervals
+     * @return whether the table was built
+     */
+    bool buildDenseTable(unsigned int maxCellsPerInterval = 16) {
+        clearDenseTable();
+        if (myValues.size() < 2) {
+            return false;
+        }
+        typename TimedValueMap::const_iterator it = myValues.begin();
+        ++it;
+        const SUMOReal begin = it->first;
+        const SUMOReal end = (--myValues.end())->first;
+        SUMOReal width = end - begin;
+        for (typename TimedValueMap::const_iterator next = it; ++next != myValues.end(); ++it) {
+            width = MIN2(width, next->first - it->first);
+        }
+        const size_t numCells = width > 0 ? (size_t)((end - begin) / width) + 1 : 0;
+        if (numCells > maxCellsPerInterval * myValues.size()) {
+            return false;
+        }
+        myIntervals.assign(myValues.begin(), myValues.end());
+        myCellBegin = begin;
+        myCellWidth = width;
+        myCells.reserve(numCells);
+        size_t index = 1;
+        for (size_t i = 0; i < numCells; ++i) {
+            const SUMOReal cellBegin = begin + (SUMOReal) i * width;
+            while (index + 1 < myIntervals.size() && myIntervals[index + 1].first <= cellBegin) {
+                ++index;
+            }
+            myCells.push_back((unsigned int) index);
+        }
+        return true;
+    }
+
+private:
+    /// @brief Discards the table built by buildDenseTable
+    void clearDenseTable() {
+        myIntervals.clear();
+        myCells.clear();
+    }
+
+    /** @brief Returns the index of the interval containing the given time within the table
+     *
+     * The cell only gives the first guess since a cell may contain the
+     *  begin of the next interval if the intervals are not aligned to
+     *  the cells.
+     *
+     * @param[in] time the time to look up
+     * @return the index in myIntervals or -1 if the time is before the first interval
+     */
+    int getIntervalIndex(SUMOReal time) const {
+        if (time < myCellBegin) {
+            return time < myIntervals[0].first ? -1 : 0;
+        }
+        const int last = (int) myIntervals.size() - 1;
+        if (time >= myIntervals[last].first) {
+            return last;
+        }
+        size_t cell = (size_t)((time - myCellBegin) / myCellWidth);
+        if (cell >= myCells.size()) {
+            cell = myCells.size() - 1;
+        }
+        int index = (int) myCells[cell];
+        while (index < last && myIntervals[index + 1].first <= time) {
+            ++index;
+        }
+        while (index > 0 && myIntervals[index].first > time) {
+            --index;
+        }
+        return index;
+    }
+
 private:
     /// @brief Value of time line, indicating validity.
     typedef std::pair<bool, T> ValidValue;
@@ -178,6 +284,18 @@ private:
     /// @brief The list of time periods (with values)
     TimedValueMap myValues;
 
+    /// @brief The intervals (begin and value) of the dense table in the order of the map
+    std::vector<std::pair<SUMOReal, ValidValue> > myIntervals;
+
+    /// @brief The index of the interval containing the begin of each cell
+    std::vector<unsigned int> myCells;
+
+    /// @brief The begin of the first cell (the begin of the second interval)
+    SUMOReal myCellBegin;
+
+    /// @brief The width of the cells
+    SUMOReal myCellWidth;
+
 };
 
 
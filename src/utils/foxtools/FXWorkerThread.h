@@ -0,0 +1,371 @@
+/****************************************************************************/
+/// @file    FXWorkerThread.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// A thread class together with a pool and a task for parallelized computation
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef FXWorkerThread_h
+#define FXWorkerThread_h
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <list>
+#include <vector>
+#include <stdexcept>
+#include <fx.h>
+#include <FXThread.h>
+#include <utils/common/UtilExceptions.h>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class FXWorkerThread
+ * @brief A thread repeatingly calculating incoming tasks
+ *
+ * Each worker owns a queue of tasks which are processed in the order of
+ *  their insertion. Tasks are either assigned round robin by the pool or
+ *  explicitly to a given worker. The latter allows to keep the order of
+ *  tasks which share some state (e.g. a random number generator) and
+ *  therefore makes the results independent from the thread scheduling.
+ */
+class FXWorkerThread : public FXThread {
+
+public:
+    /**
+     * @class FXWorkerThread::Task
+     * @brief Abstract superclass of a task to be run with an index to keep track of pending tasks
+     */
+    class Task {
+    public:
+        /// @brief Desctructor
+        virtual ~Task() {};
+
+        /** @brief Abstract method which in subclasses should contain the computations to be performed.
+         *
+         * If there is data to be shared among several tasks (but not among several threads) it can be put
+         *  into the thread class subclassing the FXWorkerThread. the instance of the thread is then
+         *  made available via the context parameter.
+         *
+         * @param[in] context The thread which runs the task
+         */
+        virtual void run(FXWorkerThread* context) = 0;
+
+        /** @brief Sets the running index of this task.
+         *
+         * Every task receive an index which is unique among all pending tasks of the same thread pool.
+         *
+         * @param[in] newIndex the index to assign
+         */
+        void setIndex(const int newIndex) {
+            myIndex = newIndex;
+        }
+    private:
+        /// @brief the index of the task, valid only after the task has been added to the pool
+        int myIndex;
+    };
+
+    /**
+     * @class FXWorkerThread::Pool
+     * @brief A pool of worker threads which distributes the tasks and collects the results
+     */
+    class Pool {
+    public:
+        /** @brief Constructor
+         *
+         * May initialize the pool with a given number of workers.
+         *
+         * @param[in] numThreads the number of threads to create
+         */
+        Pool(int numThreads = 0) : myRunningIndex(0), myException(0) {
+            while (numThreads > 0) {
+                new FXWorkerThread(*this);
+                numThreads--;
+            }
+        }
+
+        /** @brief Destructor
+         *
+         * Stopping and deleting all workers by calling clear.
+         */
+        virtual ~Pool() {
+            clear();
+            delete myException;
+        }
+
+        /** @brief Stops and deletes all worker threads.
+         */
+        void clear() {
+            for (std::vector<FXWorkerThread*>::iterator it = myWorkers.begin(); it != myWorkers.end(); ++it) {
+                delete *it;
+            }
+            myWorkers.clear();
+        }
+
+        /** @brief Adds the given thread to the pool.
+         *
+         * @param[in] w the thread to add
+         */
+        void addWorker(FXWorkerThread* const w) {
+            myWorkers.push_back(w);
+        }
+
+        /** @brief Gives a number to the given task and assigns it to the worker with the given index.
+         * If the index is negative, assign to the next (round robin) one.
+         *
+         * @param[in] t the task to add
+         * @param[in] index index of the worker thread to use or -1 for an arbitrary one
+         */
+        void add(Task* const t, int index = -1) {
+            if (index < 0) {
+                index = myRunningIndex % myWorkers.size();
+            }
+            t->setIndex(myRunningIndex++);
+            myWorkers[index]->add(t);
+        }
+
+        /** @brief Adds the given tasks to the list of finished tasks.
+         *
+         * Locks the internal mutex and appends the finished tasks. This is probably only useful for internal use.
+         *
+         * @param[in] tasks the tasks to add
+         */
+        void addFinished(std::list<Task*>& tasks) {
+            myMutex.lock();
+            myFinishedTasks.splice(myFinishedTasks.end(), tasks);
+            myCondition.signal();
+            myMutex.unlock();
+        }
+
+        /** @brief Stores the error of a failed task to be rethrown by waitAll.
+         *
+         * Only the first error is kept, the ones of later tasks are discarded.
+         *
+         * @param[in] e the error which occured
+         */
+        void setException(const std::runtime_error& e) {
+            myMutex.lock();
+            if (myException == 0) {
+                myException = new ProcessError(e.what());
+            }
+            myMutex.unlock();
+        }
+
+        /** @brief waits for all tasks to be finished
+         *
+         * If a task failed, its error is rethrown after all tasks have finished.
+         *
+         * @param[in] deleteFinished whether the finished tasks shall be deleted
+         * @exception ProcessError If one of the tasks threw an error
+         */
+        void waitAll(const bool deleteFinished = true) {
+            myMutex.lock();
+            while ((int)myFinishedTasks.size() < myRunningIndex) {
+                myCondition.wait(myMutex);
+            }
+            if (deleteFinished) {
+                for (std::list<Task*>::iterator it = myFinishedTasks.begin(); it != myFinishedTasks.end(); ++it) {
+                    delete *it;
+                }
+            }
+            myFinishedTasks.clear();
+            myRunningIndex = 0;
+            ProcessError* const error = myException;
+            myException = 0;
+            myMutex.unlock();
+            if (error != 0) {
+                const ProcessError copy(*error);
+                delete error;
+                throw copy;
+            }
+        }
+
+        /** @brief Checks whether there are currently more pending tasks than threads.
+         *
+         * This is only a rough estimate because the tasks are already assigned and there could be an idle thread even though the
+         *  number of tasks is large.
+         *
+         * @return whether there are enough tasks to let all threads work
+         */
+        bool isFull() const {
+            myMutex.lock();
+            const bool full = myRunningIndex - (int)myFinishedTasks.size() >= size();
+            myMutex.unlock();
+            return full;
+        }
+
+        /** @brief Returns the number of threads in the pool.
+         *
+         * @return the number of threads
+         */
+        int size() const {
+            return (int)myWorkers.size();
+        }
+
+        /// @brief locks the pool mutex
+        void lock() {
+            myPoolMutex.lock();
+        }
+
+        /// @brief unlocks the pool mutex
+        void unlock() {
+            myPoolMutex.unlock();
+        }
+
+        /// @brief Returns the worker threads
+        const std::vector<FXWorkerThread*>& getWorkers() {
+            return myWorkers;
+        }
+
+    private:
+        /// @brief the current worker threads
+        std::vector<FXWorkerThread*> myWorkers;
+        /// @brief the internal mutex for the task list
+        mutable FXMutex myMutex;
+        /// @brief a mutex which can be used by the user of the pool to protect shared data
+        FXMutex myPoolMutex;
+        /// @brief the semaphore to wait on for finishing all tasks
+        FXCondition myCondition;
+        /// @brief list of finished tasks
+        std::list<Task*> myFinishedTasks;
+        /// @brief the running index for the next task
+        int myRunningIndex;
+        /// @brief the first error thrown by a task since the last waitAll
+        ProcessError* myException;
+
+    private:
+        /// @brief Invalidated copy constructor.
+        Pool(const Pool&);
+
+        /// @brief Invalidated assignment operator.
+        Pool& operator=(const Pool&);
+
+    };
+
+public:
+    /** @brief Constructor
+     *
+     * Adds the thread to the given pool and starts it.
+     *
+     * @param[in] pool the pool for this thread
+     */
+    FXWorkerThread(Pool& pool): FXThread(), myPool(pool), myStopped(false) {
+        pool.addWorker(this);
+        start();
+    }
+
+    /** @brief Destructor
+     *
+     * Stops the thread by calling stop.
+     */
+    virtual ~FXWorkerThread() {
+        stop();
+    }
+
+    /** @brief Adds the given task to this thread to be calculated
+     *
+     * @param[in] t the task to add
+     */
+    void add(Task* t) {
+        myMutex.lock();
+        myTasks.push_back(t);
+        myCondition.signal();
+        myMutex.unlock();
+    }
+
+    /** @brief Main execution method of this thread.
+     *
+     * Checks for new tasks, calculates them and puts them in the finished list of the pool checking for stop signals after every task.
+     * Errors of the tasks, whatever their type, are handed to the pool which rethrows them as ProcessError in waitAll.
+     *
+     * @return always 0
+     */
+    FXint run() {
+        while (!myStopped) {
+            myMutex.lock();
+            while (!myStopped && myTasks.empty()) {
+                myCondition.wait(myMutex);
+            }
+            if (myStopped) {
+                myMutex.unlock();
+                break;
+            }
+            myCurrentTasks.splice(myCurrentTasks.end(), myTasks);
+            myMutex.unlock();
+            for (std::list<Task*>::iterator it = myCurrentTasks.begin(); it != myCurrentTasks.end(); ++it) {
+                try {
+                    (*it)->run(this);
+                } catch (std::runtime_error& e) {
+                    // keep the thread alive, the error is rethrown by the pool
+                    myPool.setException(e);
+                } catch (std::exception& e) {
+                    myPool.setException(ProcessError(e.what()));
+                } catch (...) {
+                    myPool.setException(ProcessError("Unknown error in a worker thread."));
+                }
+            }
+            myPool.addFinished(myCurrentTasks);
+        }
+        return 0;
+    }
+
+    /** @brief Stops the thread
+     *
+     * Sets the stop flag and wakes up the thread, waiting for it to terminate.
+     */
+    void stop() {
+        myMutex.lock();
+        myStopped = true;
+        myCondition.signal();
+        myMutex.unlock();
+        join();
+    }
+
+private:
+    /// @brief the pool for this thread
+    Pool& myPool;
+    /// @brief the mutex for the task list
+    FXMutex myMutex;
+    /// @brief the semaphore when waiting for new tasks
+    FXCondition myCondition;
+    /// @brief the list of pending tasks
+    std::list<Task*> myTasks;
+    /// @brief the list of tasks which are currently calculated
+    std::list<Task*> myCurrentTasks;
+    /// @brief whether we are still running
+    bool myStopped;
+
+private:
+    /// @brief Invalidated copy constructor.
+    FXWorkerThread(const FXWorkerThread&);
+
+    /// @brief Invalidated assignment operator.
+    FXWorkerThread& operator=(const FXWorkerThread&);
+
+};
+
+
+#endif
+
+/****************************************************************************/
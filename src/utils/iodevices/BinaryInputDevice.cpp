@@ -162,6 +162,10 @@ operator>>(BinaryInputDevice& os, std::string& s) {
         os.myStream.read((char*) &os.myBuffer, sizeof(char)*size);
         os.myBuffer[size] = 0;
         s = std::string(os.myBuffer);
+    } else {
+        // longer strings do not fit into the buffer
+        s.resize(size);
+        os.myStream.read(&s[0], sizeof(char)*size);
     }
     return os;
 }
@@ -0,0 +1,108 @@
+/****************************************************************************/
+/// @file    ColumnarFCDReader.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Reads floating car data written by ColumnarFCDWriter
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cmath>
+#include <utils/common/ToString.h>
+#include "ColumnarFCDWriter.h"
+#include "ColumnarFCDReader.h"
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+ColumnarFCDReader::ColumnarFCDReader(const std::string& file)
+    : myFile(file), myStream(file.c_str(), std::ios::binary), myTime(0) {
+    if (!myStream.good()) {
+        throw IOError("Could not open columnar fcd file '" + file + "'.");
+    }
+    std::string magic(ColumnarFCDWriter::MAGIC.length(), ' ');
+    unsigned int version = 0;
+    if (!myStream.read(&magic[0], (std::streamsize) magic.length()) || magic != ColumnarFCDWriter::MAGIC) {
+        throw IOError("File '" + file + "' is no columnar fcd file.");
+    }
+    readValue(version);
+    if (version != ColumnarFCDWriter::FORMAT_VERSION) {
+        throw IOError("Unsupported version " + toString(version) + " of columnar fcd file '" + file + "'.");
+    }
+    unsigned int posPrecision, precision;
+    readValue(posPrecision);
+    readValue(precision);
+    myPosScale = pow(10., (SUMOReal) posPrecision);
+    myScale = pow(10., (SUMOReal) precision);
+}
+
+
+ColumnarFCDReader::~ColumnarFCDReader() {}
+
+
+bool
+ColumnarFCDReader::readStep() {
+    if (myStream.peek() == std::char_traits<char>::eof()) {
+        return false;
+    }
+    readValue(myTime);
+    unsigned int reset;
+    readValue(reset);
+    if (reset != 0) {
+        myDictionary.clear();
+    }
+    unsigned int number;
+    readValue(number);
+    for (unsigned int i = 0; i < number; ++i) {
+        unsigned int length;
+        readValue(length);
+        std::string s(length, ' ');
+        if (length > 0 && !myStream.read(&s[0], (std::streamsize) length)) {
+            throw IOError("Unexpected end of columnar fcd file '" + myFile + "'.");
+        }
+        myDictionary.push_back(s);
+    }
+    readValue(number);
+    readColumn(myIDs, number);
+    readColumn(myTypes, number);
+    readColumn(myX, number);
+    readColumn(myY, number);
+    readColumn(myAngles, number);
+    readColumn(mySpeeds, number);
+    for (unsigned int i = 0; i < number; ++i) {
+        if (myIDs[i] >= myDictionary.size() || myTypes[i] >= myDictionary.size()) {
+            throw IOError("Invalid string handle in columnar fcd file '" + myFile + "'.");
+        }
+    }
+    return true;
+}
+
+
+/****************************************************************************/
+
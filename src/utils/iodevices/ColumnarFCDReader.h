@@ -0,0 +1,223 @@
+/****************************************************************************/
+/// @file    ColumnarFCDReader.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Reads floating car data written by ColumnarFCDWriter
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef ColumnarFCDReader_h
+#define ColumnarFCDReader_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <fstream>
+#include <string>
+#include <vector>
+#include <utils/common/SUMOTime.h>
+#include <utils/common/UtilExceptions.h>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class ColumnarFCDReader
+ * @brief Reads floating car data written by ColumnarFCDWriter
+ *
+ * The file is read step by step using readStep. The columns of the
+ *  current step may be accessed as a whole or per vehicle.
+ */
+class ColumnarFCDReader {
+public:
+    /** @brief Constructor, opens the file and reads its header
+     * @param[in] file The name of the file to read
+     * @exception IOError If the file could not be opened or is no columnar fcd file
+     */
+    ColumnarFCDReader(const std::string& file);
+
+
+    /// @brief Destructor
+    ~ColumnarFCDReader();
+
+
+    /** @brief Reads the next step
+     * @return Whether a step was read (false at the end of the file)
+     * @exception IOError If the file is truncated
+     */
+    bool readStep();
+
+
+    /// @brief Returns the time of the current step
+    SUMOTime getTime() const {
+        return myTime;
+    }
+
+
+    /// @brief Returns the number of vehicles in the current step
+    unsigned int size() const {
+        return (unsigned int) myIDs.size();
+    }
+
+
+    /// @brief Returns the string with the given handle
+    const std::string& getString(unsigned int handle) const {
+        return myDictionary[handle];
+    }
+
+
+    /// @name Access to the vehicles of the current step
+    /// @{
+
+    /// @brief Returns the id of the i-th vehicle
+    const std::string& getID(unsigned int i) const {
+        return myDictionary[myIDs[i]];
+    }
+
+    /// @brief Returns the type of the i-th vehicle
+    const std::string& getType(unsigned int i) const {
+        return myDictionary[myTypes[i]];
+    }
+
+    /// @brief Returns the x coordinate (or longitude) of the i-th vehicle
+    SUMOReal getX(unsigned int i) const {
+        return (SUMOReal) myX[i] / myPosScale;
+    }
+
+    /// @brief Returns the y coordinate (or latitude) of the i-th vehicle
+    SUMOReal getY(unsigned int i) const {
+        return (SUMOReal) myY[i] / myPosScale;
+    }
+
+    /// @brief Returns the angle of the i-th vehicle
+    SUMOReal getAngle(unsigned int i) const {
+        return (SUMOReal) myAngles[i] / myScale;
+    }
+
+    /// @brief Returns the speed of the i-th vehicle
+    SUMOReal getSpeed(unsigned int i) const {
+        return (SUMOReal) mySpeeds[i] / myScale;
+    }
+    /// @}
+
+
+    /// @name Access to the raw columns of the current step
+    /// @{
+
+    /// @brief Returns the id handles
+    const std::vector<unsigned int>& getIDHandles() const {
+        return myIDs;
+    }
+
+    /// @brief Returns the type handles
+    const std::vector<unsigned int>& getTypeHandles() const {
+        return myTypes;
+    }
+
+    /// @brief Returns the fixed point x values (divide by getPositionScale)
+    const std::vector<int>& getXColumn() const {
+        return myX;
+    }
+
+    /// @brief Returns the fixed point y values (divide by getPositionScale)
+    const std::vector<int>& getYColumn() const {
+        return myY;
+    }
+
+    /// @brief Returns the fixed point angles (divide by getScale)
+    const std::vector<int>& getAngleColumn() const {
+        return myAngles;
+    }
+
+    /// @brief Returns the fixed point speeds (divide by getScale)
+    const std::vector<int>& getSpeedColumn() const {
+        return mySpeeds;
+    }
+
+    /// @brief Returns the scale of the fixed point positions
+    SUMOReal getPositionScale() const {
+        return myPosScale;
+    }
+
+    /// @brief Returns the scale of the fixed point angles and speeds
+    SUMOReal getScale() const {
+        return myScale;
+    }
+    /// @}
+
+
+private:
+    /// @brief Reads the value, throws an IOError if the file is truncated
+    template <class T>
+    void readValue(T& value) {
+        if (!myStream.read((char*) &value, sizeof(T))) {
+            throw IOError("Unexpected end of columnar fcd file '" + myFile + "'.");
+        }
+    }
+
+    /// @brief Reads a column of the given size
+    template <class T>
+    void readColumn(std::vector<T>& column, unsigned int size) {
+        column.resize(size);
+        if (size > 0 && !myStream.read((char*) &column[0], (std::streamsize)(sizeof(T) * size))) {
+            throw IOError("Unexpected end of columnar fcd file '" + myFile + "'.");
+        }
+    }
+
+
+private:
+    /// @brief The name of the file
+    const std::string myFile;
+
+    /// @brief The file read
+    std::ifstream myStream;
+
+    /// @brief The scales of the fixed point values
+    SUMOReal myPosScale, myScale;
+
+    /// @brief The strings read so far (index is the handle)
+    std::vector<std::string> myDictionary;
+
+    /// @brief The time of the current step
+    SUMOTime myTime;
+
+    /// @brief The handle columns of the current step
+    std::vector<unsigned int> myIDs, myTypes;
+
+    /// @brief The value columns of the current step
+    std::vector<int> myX, myY, myAngles, mySpeeds;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    ColumnarFCDReader(const ColumnarFCDReader&);
+
+    /// @brief Invalidated assignment operator.
+    ColumnarFCDReader& operator=(const ColumnarFCDReader&);
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
@@ -0,0 +1,157 @@
+/****************************************************************************/
+/// @file    ColumnarFCDWriter.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Writes floating car data as columnar binary blocks
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cmath>
+#include "OutputDevice.h"
+#include "ColumnarFCDWriter.h"
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+const std::string ColumnarFCDWriter::MAGIC = "SUMOFCDC";
+const unsigned int ColumnarFCDWriter::FORMAT_VERSION = 2;
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+ColumnarFCDWriter::ColumnarFCDWriter(const unsigned int posPrecision, const unsigned int precision,
+                                     const unsigned int maxDictionarySize)
+    : myPosScale(pow(10., (SUMOReal) posPrecision)), myScale(pow(10., (SUMOReal) precision)),
+      myPosPrecision(posPrecision), myPrecision(precision), myHeaderWritten(false),
+      myMaxDictionarySize(maxDictionarySize), myDictionaryReset(false) {}
+
+
+ColumnarFCDWriter::~ColumnarFCDWriter() {}
+
+
+void
+ColumnarFCDWriter::add(const std::string& id, const std::string& type,
+                       SUMOReal x, SUMOReal y, SUMOReal angle, SUMOReal speed) {
+    const unsigned int idHandle = getHandle(id);
+    addValues(idHandle, getHandle(type), x, y, angle, speed);
+}
+
+
+void
+ColumnarFCDWriter::add(const unsigned int key, const std::string& id, const std::string& type,
+                       SUMOReal x, SUMOReal y, SUMOReal angle, SUMOReal speed) {
+    if (key >= myKeyHandles.size()) {
+        myKeyHandles.resize(key + 1, std::make_pair(StringDictionary::INVALID_HANDLE, StringDictionary::INVALID_HANDLE));
+    }
+    std::pair<unsigned int, unsigned int>& handles = myKeyHandles[key];
+    // the key may have been reused by another vehicle or the vehicle may have changed its type
+    if (handles.first == StringDictionary::INVALID_HANDLE || myDictionary.getID(handles.first) != id) {
+        handles.first = getHandle(id);
+    }
+    if (handles.second == StringDictionary::INVALID_HANDLE || myDictionary.getID(handles.second) != type) {
+        handles.second = getHandle(type);
+    }
+    addValues(handles.first, handles.second, x, y, angle, speed);
+}
+
+
+void
+ColumnarFCDWriter::addValues(unsigned int idHandle, unsigned int typeHandle,
+                             SUMOReal x, SUMOReal y, SUMOReal angle, SUMOReal speed) {
+    myIDs.push_back(idHandle);
+    myTypes.push_back(typeHandle);
+    myX.push_back(toFixed(x, myPosScale));
+    myY.push_back(toFixed(y, myPosScale));
+    myAngles.push_back(toFixed(angle, myScale));
+    mySpeeds.push_back(toFixed(speed, myScale));
+}
+
+
+void
+ColumnarFCDWriter::writeStep(OutputDevice& into, SUMOTime time) {
+    myBlock.clear();
+    if (!myHeaderWritten) {
+        myBlock.append(MAGIC);
+        appendValue(FORMAT_VERSION);
+        appendValue(myPosPrecision);
+        appendValue(myPrecision);
+        myHeaderWritten = true;
+    }
+    appendValue(time);
+    appendValue((unsigned int)(myDictionaryReset ? 1 : 0));
+    appendValue((unsigned int) myNewStrings.size());
+    for (std::vector<std::string>::const_iterator i = myNewStrings.begin(); i != myNewStrings.end(); ++i) {
+        appendValue((unsigned int) i->length());
+        myBlock.append(*i);
+    }
+    appendValue((unsigned int) myIDs.size());
+    appendColumn(myIDs);
+    appendColumn(myTypes);
+    appendColumn(myX);
+    appendColumn(myY);
+    appendColumn(myAngles);
+    appendColumn(mySpeeds);
+    into << myBlock;
+    myNewStrings.clear();
+    myIDs.clear();
+    myTypes.clear();
+    myX.clear();
+    myY.clear();
+    myAngles.clear();
+    mySpeeds.clear();
+    myDictionaryReset = myDictionary.size() > myMaxDictionarySize;
+    if (myDictionaryReset) {
+        myDictionary.clear();
+        myKeyHandles.assign(myKeyHandles.size(), std::make_pair(StringDictionary::INVALID_HANDLE, StringDictionary::INVALID_HANDLE));
+    }
+}
+
+
+unsigned int
+ColumnarFCDWriter::getHandle(const std::string& s) {
+    const StringDictionary::Handle handle = myDictionary.find(s);
+    if (handle != StringDictionary::INVALID_HANDLE) {
+        return handle;
+    }
+    myNewStrings.push_back(s);
+    // no string is removed, so the handles are assigned in the order of insertion
+    return myDictionary.insert(s, true);
+}
+
+
+int
+ColumnarFCDWriter::toFixed(SUMOReal value, SUMOReal scale) {
+    return (int) floor(value * scale + 0.5);
+}
+
+
+/****************************************************************************/
+
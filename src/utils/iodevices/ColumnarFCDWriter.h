@@ -0,0 +1,211 @@
+/****************************************************************************/
+/// @file    ColumnarFCDWriter.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Writes floating car data as columnar binary blocks
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef ColumnarFCDWriter_h
+#define ColumnarFCDWriter_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <utility>
+#include <utils/common/SUMOTime.h>
+#include <utils/common/IDHandleMap.h>
+
+
+// ===========================================================================
+// class declarations
+// ===========================================================================
+class OutputDevice;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class ColumnarFCDWriter
+ * @brief Writes floating car data as columnar binary blocks
+ *
+ * The file starts with the magic string "SUMOFCDC", the format version and
+ *  the number of decimal digits stored for positions and for the other
+ *  values (all as unsigned int). It is followed by one block per time step:
+ *  - the time (SUMOTime)
+ *  - whether the dictionary starts anew with this block (unsigned int, 0 or 1)
+ *  - the number of strings added to the dictionary followed by the strings
+ *    (length as unsigned int, then the characters); the n-th string written
+ *    since the dictionary started has the handle n
+ *  - the number of vehicles n
+ *  - n id handles, n type handles (unsigned int)
+ *  - n x, n y, n angle and n speed values (int, fixed point)
+ *
+ * The dictionary starts anew after a block when it holds more than the
+ *  given maximum number of strings, so its size stays bounded even if many
+ *  vehicles pass during the simulation.
+ *
+ * As for BinaryFormatter, the byte order and the type sizes are the ones of
+ *  the writing platform. ColumnarFCDReader reads the files back.
+ */
+class ColumnarFCDWriter {
+public:
+    /** @brief Constructor
+     * @param[in] posPrecision The number of decimal digits stored for positions
+     * @param[in] precision The number of decimal digits stored for angles and speeds
+     * @param[in] maxDictionarySize The number of strings after which the dictionary starts anew
+     */
+    ColumnarFCDWriter(const unsigned int posPrecision, const unsigned int precision,
+                      const unsigned int maxDictionarySize = 1 << 16);
+
+
+    /// @brief Destructor
+    ~ColumnarFCDWriter();
+
+
+    /** @brief Adds a vehicle to the current step
+     * @param[in] id The id of the vehicle
+     * @param[in] type The type of the vehicle
+     * @param[in] x The x coordinate (or longitude)
+     * @param[in] y The y coordinate (or latitude)
+     * @param[in] angle The angle of the vehicle
+     * @param[in] speed The speed of the vehicle
+     */
+    void add(const std::string& id, const std::string& type,
+             SUMOReal x, SUMOReal y, SUMOReal angle, SUMOReal speed);
+
+
+    /** @brief Adds a vehicle with a numerical key to the current step
+     *
+     * The key (e.g. the vehicle's handle) is used to find the handles of the
+     *  vehicle's id and type without looking them up in the dictionary. Keys
+     *  should be small as they are used as indices; a key may be reused for
+     *  another vehicle.
+     *
+     * @param[in] key The numerical key of the vehicle
+     * @param[in] id The id of the vehicle
+     * @param[in] type The type of the vehicle
+     * @param[in] x The x coordinate (or longitude)
+     * @param[in] y The y coordinate (or latitude)
+     * @param[in] angle The angle of the vehicle
+     * @param[in] speed The speed of the vehicle
+     */
+    void add(const unsigned int key, const std::string& id, const std::string& type,
+             SUMOReal x, SUMOReal y, SUMOReal angle, SUMOReal speed);
+
+
+    /** @brief Writes the block of the current step and starts a new one
+     *
+     * The file header is written before the first block.
+     * @param[in] into The device to write into (opened for binary output)
+     * @param[in] time The time of the step
+     */
+    void writeStep(OutputDevice& into, SUMOTime time);
+
+
+    /// @brief The magic string starting the file
+    static const std::string MAGIC;
+
+    /// @brief The version of the format
+    static const unsigned int FORMAT_VERSION;
+
+
+private:
+    /// @brief The dictionary of the strings, the handles of its entries are the ones written
+    typedef IDHandleMap<bool> StringDictionary;
+
+    /// @brief Returns the handle of the string, adds it to the dictionary if it is new
+    unsigned int getHandle(const std::string& s);
+
+    /// @brief Adds the vehicle's values to the columns
+    void addValues(unsigned int idHandle, unsigned int typeHandle,
+                   SUMOReal x, SUMOReal y, SUMOReal angle, SUMOReal speed);
+
+    /// @brief Converts the value into fixed point
+    static int toFixed(SUMOReal value, SUMOReal scale);
+
+    /// @brief Appends the column to the block
+    template <class T>
+    void appendColumn(const std::vector<T>& column) {
+        if (!column.empty()) {
+            myBlock.append((const char*) &column[0], sizeof(T) * column.size());
+        }
+    }
+
+    /// @brief Appends the value to the block
+    template <class T>
+    void appendValue(const T& value) {
+        myBlock.append((const char*) &value, sizeof(T));
+    }
+
+
+private:
+    /// @brief The scales of the fixed point values
+    const SUMOReal myPosScale, myScale;
+
+    /// @brief The number of decimal digits (written to the header)
+    const unsigned int myPosPrecision, myPrecision;
+
+    /// @brief Whether the file header was written
+    bool myHeaderWritten;
+
+    /// @brief The number of strings after which the dictionary starts anew
+    const unsigned int myMaxDictionarySize;
+
+    /// @brief Whether the dictionary starts anew with the next block
+    bool myDictionaryReset;
+
+    /// @brief The strings written since the dictionary started
+    StringDictionary myDictionary;
+
+    /// @brief The handles of the id and the type last added with each key
+    std::vector<std::pair<unsigned int, unsigned int> > myKeyHandles;
+
+    /// @brief The strings added to the dictionary in the current step
+    std::vector<std::string> myNewStrings;
+
+    /// @brief The handle columns of the current step
+    std::vector<unsigned int> myIDs, myTypes;
+
+    /// @brief The value columns of the current step
+    std::vector<int> myX, myY, myAngles, mySpeeds;
+
+    /// @brief The serialized block (kept to reuse its memory)
+    std::string myBlock;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    ColumnarFCDWriter(const ColumnarFCDWriter&);
+
+    /// @brief Invalidated assignment operator.
+    ColumnarFCDWriter& operator=(const ColumnarFCDWriter&);
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
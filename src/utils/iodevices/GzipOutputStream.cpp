@@ -0,0 +1,111 @@
+/****************************************************************************/
+/// @file    GzipOutputStream.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// An output stream writing a gzip compressed file
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_ZLIB
+
+#include "GzipOutputStream.h"
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+// ---------------------------------------------------------------------------
+// GzipOutputStream - methods
+// ---------------------------------------------------------------------------
+GzipOutputStream::GzipOutputStream(const std::string& fullName)
+    : std::ostream(0), myBuffer(fullName) {
+    rdbuf(&myBuffer);
+    if (!myBuffer.isOpen()) {
+        setstate(std::ios_base::badbit);
+    }
+}
+
+
+GzipOutputStream::~GzipOutputStream() {}
+
+
+// ---------------------------------------------------------------------------
+// GzipOutputStream::Buffer - methods
+// ---------------------------------------------------------------------------
+GzipOutputStream::Buffer::Buffer(const std::string& fullName)
+    : myFile(gzopen(fullName.c_str(), "wb")) {
+    setp(myData, myData + sizeof(myData));
+}
+
+
+GzipOutputStream::Buffer::~Buffer() {
+    if (myFile != 0) {
+        compress();
+        gzclose(myFile);
+    }
+}
+
+
+GzipOutputStream::Buffer::int_type
+GzipOutputStream::Buffer::overflow(int_type c) {
+    if (!compress()) {
+        return traits_type::eof();
+    }
+    if (!traits_type::eq_int_type(c, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(c);
+        pbump(1);
+    }
+    return traits_type::not_eof(c);
+}
+
+
+int
+GzipOutputStream::Buffer::sync() {
+    return compress() ? 0 : -1;
+}
+
+
+bool
+GzipOutputStream::Buffer::compress() {
+    const int size = (int)(pptr() - pbase());
+    if (myFile == 0) {
+        return false;
+    }
+    if (size > 0 && gzwrite(myFile, pbase(), (unsigned int) size) != size) {
+        return false;
+    }
+    setp(myData, myData + sizeof(myData));
+    return true;
+}
+
+
+#endif
+
+/****************************************************************************/
+
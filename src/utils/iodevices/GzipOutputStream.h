@@ -0,0 +1,130 @@
+/****************************************************************************/
+/// @file    GzipOutputStream.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// An output stream writing a gzip compressed file
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef GzipOutputStream_h
+#define GzipOutputStream_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_ZLIB
+
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <zlib.h>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class GzipOutputStream
+ * @brief An output stream writing a gzip compressed file
+ *
+ * The data is collected in a buffer and compressed whenever the buffer is
+ *  full, the stream is flushed or destroyed. The stream is bad if the file
+ *  could not be opened.
+ */
+class GzipOutputStream : public std::ostream {
+public:
+    /** @brief Constructor
+     * @param[in] fullName The name of the file to write
+     */
+    GzipOutputStream(const std::string& fullName);
+
+
+    /// @brief Destructor, compresses the remaining data and closes the file
+    ~GzipOutputStream();
+
+
+private:
+    /**
+     * @class Buffer
+     * @brief The stream buffer passing its content to zlib
+     */
+    class Buffer : public std::streambuf {
+    public:
+        /// @brief Constructor
+        Buffer(const std::string& fullName);
+
+        /// @brief Destructor
+        ~Buffer();
+
+        /// @brief Returns whether the file could be opened
+        bool isOpen() const {
+            return myFile != 0;
+        }
+
+    protected:
+        /// @brief Compresses the full buffer and stores the given character
+        int_type overflow(int_type c);
+
+        /// @brief Compresses the buffer
+        int sync();
+
+    private:
+        /// @brief Compresses the buffer, returns whether this succeeded
+        bool compress();
+
+    private:
+        /// @brief The compressed file
+        gzFile myFile;
+
+        /// @brief The uncompressed data
+        char myData[1 << 16];
+
+    private:
+        /// @brief Invalidated copy constructor.
+        Buffer(const Buffer&);
+
+        /// @brief Invalidated assignment operator.
+        Buffer& operator=(const Buffer&);
+
+    };
+
+
+private:
+    /// @brief The buffer of this stream
+    Buffer myBuffer;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    GzipOutputStream(const GzipOutputStream&);
+
+    /// @brief Invalidated assignment operator.
+    GzipOutputStream& operator=(const GzipOutputStream&);
+
+};
+
+
+#endif
+
+#endif
+
+/****************************************************************************/
+
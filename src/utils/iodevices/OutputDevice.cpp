@@ -56,6 +56,7 @@
 // static member definitions
 // ===========================================================================
 std::map<std::string, OutputDevice*> OutputDevice::myOutputDevices;
+OutputDevice::FileDeviceBuilder OutputDevice::myFileDeviceBuilder = 0;
 
 
 // ===========================================================================
@@ -63,7 +64,8 @@ std::map<std::string, OutputDevice*> OutputDevice::myOutputDevices;
 // ===========================================================================
 OutputDevice&
 OutputDevice::getDevice(const std::string& name,
-                        const std::string& base) {
+                        const std::string& base,
+                        const bool binary) {
     std::string internalName = name;
     if (name == "-") {
         internalName = "stdout";
@@ -90,8 +92,13 @@ OutputDevice::getDevice(const std::string& name,
         }
     } else {
         const size_t len = internalName.length();
-        dev = new OutputDevice_File(FileHelpers::checkForRelativity(internalName, base),
-                                    len > 4 && internalName.substr(len - 4) == ".sbx");
+        const std::string fullName = FileHelpers::checkForRelativity(internalName, base);
+        const bool isBinary = binary || (len > 4 && internalName.substr(len - 4) == ".sbx");
+        if (myFileDeviceBuilder != 0) {
+            dev = myFileDeviceBuilder(fullName, isBinary);
+        } else {
+            dev = new OutputDevice_File(fullName, isBinary);
+        }
     }
     dev->setPrecision();
     dev->getOStream() << std::setiosflags(std::ios::fixed);
@@ -133,6 +140,12 @@ OutputDevice::closeAll() {
 }
 
 
+void
+OutputDevice::setFileDeviceBuilder(FileDeviceBuilder builder) {
+    myFileDeviceBuilder = builder;
+}
+
+
 std::string
 OutputDevice::realString(const SUMOReal v, const int precision) {
     std::ostringstream oss;
@@ -69,6 +69,10 @@
  */
 class OutputDevice {
 public:
+    /// @brief Definition of a function building the device for the named file
+    typedef OutputDevice* (*FileDeviceBuilder)(const std::string& fullName, const bool binary);
+
+
     /// @name static access methods to OutputDevices
     /// @{
 
@@ -81,11 +85,13 @@ public:
      *
      * @param[in] name The description of the output name/port/whatever
      * @param[in] base The base path the application is run within
+     * @param[in] binary Whether a file shall be written in binary mode (always for files ending with ".sbx")
      * @return The corresponding (built or existing) device
      * @exception IOError If the output could not be built for any reason (error message is supplied)
      */
     static OutputDevice& getDevice(const std::string& name,
-                                   const std::string& base = "");
+                                   const std::string& base = "",
+                                   const bool binary = false);
 
 
     /** @brief Creates the device using the output definition stored in the named option
@@ -126,6 +132,16 @@ public:
     /**  Closes all registered devices
      */
     static void closeAll();
+
+
+    /** @brief Sets the function building the devices for files opened later on
+     *
+     * Allows to replace the plain file devices, e.g. by devices
+     *  which are written by a background thread.
+     *
+     * @param[in] builder The function to use, 0 for building OutputDevice_File
+     */
+    static void setFileDeviceBuilder(FileDeviceBuilder builder);
     /// @}
 
 
@@ -316,6 +332,9 @@ private:
     /// @brief map from names to output devices
     static std::map<std::string, OutputDevice*> myOutputDevices;
 
+    /// @brief The function building the devices for files (0 for OutputDevice_File)
+    static FileDeviceBuilder myFileDeviceBuilder;
+
 
 private:
     /// @brief The formatter for XML
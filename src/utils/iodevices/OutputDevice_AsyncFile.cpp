@@ -0,0 +1,197 @@
+/****************************************************************************/
+/// @file    OutputDevice_AsyncFile.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// An output device for files written by a background thread
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_FOX
+
+#include <utils/common/MsgHandler.h>
+#include <utils/common/UtilExceptions.h>
+#include "OutputDevice_File.h"
+#include "OutputDevice_AsyncFile.h"
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+FXWorkerThread::Pool* OutputDevice_AsyncFile::myWriter = 0;
+unsigned int OutputDevice_AsyncFile::myDeviceNo = 0;
+size_t OutputDevice_AsyncFile::myPendingBytes = 0;
+FXMutex OutputDevice_AsyncFile::myMutex;
+FXCondition OutputDevice_AsyncFile::myCondition;
+size_t OutputDevice_AsyncFile::myBufferSize = 1 << 20;
+size_t OutputDevice_AsyncFile::myMemoryLimit = 64 << 20;
+
+
+// ===========================================================================
+// static method definitions
+// ===========================================================================
+void
+OutputDevice_AsyncFile::enable(size_t bufferSize, size_t memoryLimit) {
+    myBufferSize = bufferSize;
+    myMemoryLimit = memoryLimit;
+    OutputDevice::setFileDeviceBuilder(&build);
+}
+
+
+OutputDevice*
+OutputDevice_AsyncFile::build(const std::string& fullName, const bool binary) {
+    return new OutputDevice_AsyncFile(fullName, binary);
+}
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+OutputDevice_AsyncFile::OutputDevice_AsyncFile(const std::string& fullName, const bool binary)
+    : OutputDevice(binary), myFileName(fullName), myFileStream(OutputDevice_File::openStream(fullName, binary)),
+      myBuffer(myBufferSize), myStream(&myBuffer), myFailed(false), myFailureReported(false) {
+    if (myWriter == 0) {
+        myWriter = new FXWorkerThread::Pool(1);
+    }
+    myDeviceNo++;
+}
+
+
+OutputDevice_AsyncFile::~OutputDevice_AsyncFile() {
+    flushBuffer();
+    // the tasks of all devices are finished, including the ones of this device
+    myWriter->waitAll();
+    if (myFailed && !myFailureReported) {
+        WRITE_ERROR("Could not write to '" + myFileName + "'.");
+    }
+    delete myFileStream;
+    myDeviceNo--;
+    if (myDeviceNo == 0) {
+        delete myWriter;
+        myWriter = 0;
+    }
+}
+
+
+bool
+OutputDevice_AsyncFile::ok() {
+    myMutex.lock();
+    const bool failed = myFailed;
+    myMutex.unlock();
+    return !failed && myStream.good();
+}
+
+
+std::ostream&
+OutputDevice_AsyncFile::getOStream() {
+    if (myBuffer.size() >= myBufferSize && !flushBuffer() && !myFailureReported) {
+        myFailureReported = true;
+        throw IOError("Could not write to '" + myFileName + "'.");
+    }
+    return myStream;
+}
+
+
+bool
+OutputDevice_AsyncFile::flushBuffer() {
+    const size_t size = myBuffer.size();
+    std::vector<char> block;
+    myMutex.lock();
+    if (myFailed || size == 0) {
+        const bool failed = myFailed;
+        myMutex.unlock();
+        // the output of a failed device is dropped
+        myBuffer.discard();
+        return !failed;
+    }
+    // back-pressure: let the writer catch up before exceeding the memory limit
+    while (myPendingBytes > 0 && myPendingBytes + size > myMemoryLimit) {
+        myCondition.wait(myMutex);
+    }
+    myPendingBytes += size;
+    // continue with the block written before (if any) while the filled one is written
+    block.swap(mySpareBlock);
+    myMutex.unlock();
+    myBuffer.swap(block);
+    myWriter->add(new WriteTask(*this, block, size));
+    return true;
+}
+
+
+void
+OutputDevice_AsyncFile::WriteTask::run(FXWorkerThread* /* context */) {
+    std::ostream& strm = *myDevice.myFileStream;
+    strm.write(&myBlock[0], (std::streamsize) mySize);
+    const bool failed = !strm.good();
+    myMutex.lock();
+    myPendingBytes -= mySize;
+    if (failed) {
+        myDevice.myFailed = true;
+    }
+    if (myDevice.mySpareBlock.empty()) {
+        myDevice.mySpareBlock.swap(myBlock);
+    }
+    myCondition.broadcast();
+    myMutex.unlock();
+}
+
+
+OutputDevice_AsyncFile::Buffer::Buffer(size_t size)
+    : mySize(size > 0 ? size : 1) {
+    myBlock.resize(mySize);
+    setp(&myBlock[0], &myBlock[0] + myBlock.size());
+}
+
+
+void
+OutputDevice_AsyncFile::Buffer::swap(std::vector<char>& block) {
+    myBlock.swap(block);
+    if (myBlock.size() < mySize) {
+        myBlock.resize(mySize);
+    }
+    setp(&myBlock[0], &myBlock[0] + myBlock.size());
+}
+
+
+OutputDevice_AsyncFile::Buffer::int_type
+OutputDevice_AsyncFile::Buffer::overflow(int_type c) {
+    if (traits_type::eq_int_type(c, traits_type::eof())) {
+        return traits_type::not_eof(c);
+    }
+    const size_t used = size();
+    myBlock.resize(2 * myBlock.size());
+    setp(&myBlock[0], &myBlock[0] + myBlock.size());
+    pbump((int) used);
+    return sputc(traits_type::to_char_type(c));
+}
+
+
+#endif
+
+/****************************************************************************/
+
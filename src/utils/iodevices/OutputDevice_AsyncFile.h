@@ -0,0 +1,257 @@
+/****************************************************************************/
+/// @file    OutputDevice_AsyncFile.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// An output device for files written by a background thread
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef OutputDevice_AsyncFile_h
+#define OutputDevice_AsyncFile_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_FOX
+
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include <utils/foxtools/FXWorkerThread.h>
+#include "OutputDevice.h"
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class OutputDevice_AsyncFile
+ * @brief An output device for files written by a background thread
+ *
+ * The device collects the output in a memory block and hands the block over
+ *  to a writing thread (shared by all devices of this type) whenever the
+ *  buffer size is reached. The block is not copied; the device continues with
+ *  a block which was written before. If the data waiting to be written exceeds
+ *  the memory limit, the caller waits until enough of it has been written.
+ *  Closing the device waits until all of its data has been written.
+ *  Compressing the output (see OutputDevice_File::openStream) happens in the
+ *  writing thread, too.
+ *
+ * A failure of the writing thread is thrown as an IOError when the device
+ *  hands over the next block and reported as an error when it is closed.
+ *
+ * The devices are built by OutputDevice::getDevice for all files opened
+ *  after calling enable.
+ */
+class OutputDevice_AsyncFile : public OutputDevice {
+public:
+    /** @brief Lets all files opened later on be written asynchronously
+     * @param[in] bufferSize The size of the buffers handed over to the writing thread
+     * @param[in] memoryLimit The maximum size of the data waiting to be written
+     */
+    static void enable(size_t bufferSize, size_t memoryLimit);
+
+
+    /** @brief Builds the device for the named file
+     * @param[in] fullName The name of the file to write
+     * @param[in] binary Whether binary output shall be written
+     * @return The built device
+     * @exception IOError If the file could not be opened
+     */
+    static OutputDevice* build(const std::string& fullName, const bool binary);
+
+
+    /** @brief Constructor
+     * @param[in] fullName The name of the file to write
+     * @param[in] binary Whether binary output shall be written
+     * @exception IOError If the file could not be opened
+     */
+    OutputDevice_AsyncFile(const std::string& fullName, const bool binary);
+
+
+    /// @brief Destructor, writes the remaining output and closes the file
+    ~OutputDevice_AsyncFile();
+
+
+    /** @brief returns the information whether the device and the data written so far are ok
+     * @return Whether writing into the file has not failed
+     */
+    bool ok();
+
+
+protected:
+    /// @name Methods that override/implement OutputDevice-methods
+    /// @{
+
+    /** @brief Returns the stream to write into
+     *
+     * Hands the buffer over to the writing thread before if it is full.
+     * @return The used stream
+     * @exception IOError If writing a buffer handed over before failed
+     */
+    std::ostream& getOStream();
+    /// @}
+
+
+private:
+    /** @brief Hands the current buffer over to the writing thread
+     *
+     * Waits until enough data is written before if the memory limit would be exceeded.
+     * @return Whether writing the buffers handed over before has not failed
+     */
+    bool flushBuffer();
+
+
+    /**
+     * @class Buffer
+     * @brief A stream buffer collecting the output in a growing memory block
+     */
+    class Buffer : public std::streambuf {
+    public:
+        /// @brief Constructor
+        Buffer(size_t size);
+
+        /// @brief Returns the size of the collected output
+        size_t size() const {
+            return pptr() - pbase();
+        }
+
+        /** @brief Exchanges the filled block with the given one which is filled from its begin on
+         * @param[in, out] block The block to fill next, receives the filled block
+         */
+        void swap(std::vector<char>& block);
+
+        /// @brief Drops the collected output
+        void discard() {
+            setp(pbase(), epptr());
+        }
+
+    protected:
+        /// @brief Enlarges the block when it is full
+        int_type overflow(int_type c);
+
+    private:
+        /// @brief The block collecting the output
+        std::vector<char> myBlock;
+
+        /// @brief The initial size of the blocks
+        const size_t mySize;
+
+    };
+
+
+    /**
+     * @class WriteTask
+     * @brief A block to be written into a file by the writing thread
+     */
+    class WriteTask : public FXWorkerThread::Task {
+    public:
+        /** @brief Constructor
+         * @param[in] device The device to write for
+         * @param[in, out] block The block to write, swapped into the task
+         * @param[in] size The size of the data in the block
+         */
+        WriteTask(OutputDevice_AsyncFile& device, std::vector<char>& block, size_t size)
+            : myDevice(device), mySize(size) {
+            myBlock.swap(block);
+        }
+
+        /// @brief Writes the data and returns the block to the device for reuse
+        void run(FXWorkerThread* context);
+
+    private:
+        /// @brief The device to write for
+        OutputDevice_AsyncFile& myDevice;
+
+        /// @brief The block to write
+        std::vector<char> myBlock;
+
+        /// @brief The size of the data in the block
+        const size_t mySize;
+
+    private:
+        /// @brief Invalidated assignment operator.
+        WriteTask& operator=(const WriteTask&);
+
+    };
+
+
+private:
+    /// @brief The name of the file
+    const std::string myFileName;
+
+    /// @brief The file written by the thread
+    std::ostream* myFileStream;
+
+    /// @brief The buffer collecting the output
+    Buffer myBuffer;
+
+    /// @brief The stream writing into the buffer
+    std::ostream myStream;
+
+    /// @brief A block which was written, to be filled again (guarded by myMutex)
+    std::vector<char> mySpareBlock;
+
+    /// @brief Whether writing into the file failed (guarded by myMutex)
+    bool myFailed;
+
+    /// @brief Whether the failure was thrown already
+    bool myFailureReported;
+
+    /// @brief The writing thread shared by all devices (built with the first one)
+    static FXWorkerThread::Pool* myWriter;
+
+    /// @brief The number of existing devices
+    static unsigned int myDeviceNo;
+
+    /// @brief The size of the data handed over and not yet written (guarded by myMutex)
+    static size_t myPendingBytes;
+
+    /// @brief The mutex guarding the data shared with the writing thread
+    static FXMutex myMutex;
+
+    /// @brief The condition signalled when a block was written
+    static FXCondition myCondition;
+
+    /// @brief The size of the buffers handed over
+    static size_t myBufferSize;
+
+    /// @brief The maximum size of the data waiting to be written
+    static size_t myMemoryLimit;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    OutputDevice_AsyncFile(const OutputDevice_AsyncFile&);
+
+    /// @brief Invalidated assignment operator.
+    OutputDevice_AsyncFile& operator=(const OutputDevice_AsyncFile&);
+
+};
+
+
+#endif
+
+#endif
+
+/****************************************************************************/
+
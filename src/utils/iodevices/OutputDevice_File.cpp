@@ -30,6 +30,9 @@
 #endif
 
 #include <iostream>
+#include <fstream>
+#include <utils/common/FileHelpers.h>
+#include "GzipOutputStream.h"
 #include "OutputDevice_File.h"
 
 #ifdef CHECK_MEMORY_LEAKS
@@ -41,27 +44,39 @@
 // method definitions
 // ===========================================================================
 OutputDevice_File::OutputDevice_File(const std::string& fullName, const bool binary)
-    : OutputDevice(binary), myFileStream(0) {
+    : OutputDevice(binary), myFileStream(openStream(fullName, binary)) {
+}
+
+
+OutputDevice_File::~OutputDevice_File() {
+    delete myFileStream;
+}
+
+
+std::ostream*
+OutputDevice_File::openStream(const std::string& fullName, const bool binary) {
+    std::ostream* strm = 0;
 #ifdef WIN32
     if (fullName == "/dev/null") {
-        myFileStream = new std::ofstream("NUL");
+        strm = new std::ofstream("NUL");
 #else
     if (fullName == "nul" || fullName == "NUL") {
-        myFileStream = new std::ofstream("/dev/null");
+        strm = new std::ofstream("/dev/null");
+#endif
+    } else if (FileHelpers::isGzip(fullName)) {
+#ifdef HAVE_ZLIB
+        strm = new GzipOutputStream(fullName);
+#else
+        throw IOError("Could not build output file '" + fullName + "' (compressed output needs zlib).");
 #endif
     } else {
-        myFileStream = new std::ofstream(fullName.c_str(), binary ? std::ios::binary : std::ios_base::out);
+        strm = new std::ofstream(fullName.c_str(), binary ? std::ios::binary : std::ios_base::out);
     }
-    if (!myFileStream->good()) {
-        delete myFileStream;
+    if (!strm->good()) {
+        delete strm;
         throw IOError("Could not build output file '" + fullName + "'.");
     }
-}
-
-
-OutputDevice_File::~OutputDevice_File() {
-    myFileStream->close();
-    delete myFileStream;
+    return strm;
 }
 
 
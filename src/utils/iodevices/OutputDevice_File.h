@@ -31,7 +31,7 @@
 #include <config.h>
 #endif
 
-#include <fstream>
+#include <ostream>
 #include "OutputDevice.h"
 
 
@@ -44,6 +44,9 @@
  *
  * Please note that the device gots responsible for the stream and deletes
  *  it (it should not be deleted elsewhere).
+ *
+ * Files whose names end with ".gz" are written gzip compressed
+ *  (if SUMO was built with zlib).
  */
 class OutputDevice_File : public OutputDevice {
 public:
@@ -58,6 +61,18 @@ public:
     ~OutputDevice_File();
 
 
+    /** @brief Opens the stream for writing the named file
+     *
+     * Builds a compressing stream if the file name ends with ".gz".
+     *
+     * @param[in] fullName The name of the file to write
+     * @param[in] binary Whether binary output shall be written
+     * @return The opened stream
+     * @exception IOError If the file could not be opened
+     */
+    static std::ostream* openStream(const std::string& fullName, const bool binary);
+
+
 protected:
     /// @name Methods that override/implement OutputDevice-methods
     /// @{
@@ -70,8 +85,8 @@ protected:
 
 
 private:
-    /// The wrapped ofstream
-    std::ofstream* myFileStream;
+    /// The wrapped ofstream (or compressing stream)
+    std::ostream* myFileStream;
 
 };
 
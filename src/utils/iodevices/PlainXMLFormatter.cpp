@@ -28,6 +28,7 @@
 #include <config.h>
 #endif
 
+#include <cmath>
 #include <utils/common/ToString.h>
 #include <utils/options/OptionsCont.h>
 #include "PlainXMLFormatter.h"
@@ -37,11 +38,27 @@
 #endif // CHECK_MEMORY_LEAKS
 
 
+// ===========================================================================
+// static member definitions
+// ===========================================================================
+std::vector<std::string> PlainXMLFormatter::myAttrNames;
+
+
 // ===========================================================================
 // member method definitions
 // ===========================================================================
 PlainXMLFormatter::PlainXMLFormatter(const unsigned int defaultIndentation)
     : myDefaultIndentation(defaultIndentation) {
+    if (myAttrNames.empty()) {
+        const std::vector<std::string> names = SUMOXMLDefinitions::Attrs.getStrings();
+        for (std::vector<std::string>::const_iterator i = names.begin(); i != names.end(); ++i) {
+            const size_t index = (size_t) SUMOXMLDefinitions::Attrs.get(*i);
+            if (index >= myAttrNames.size()) {
+                myAttrNames.resize(index + 1);
+            }
+            myAttrNames[index] = " " + *i + "=\"";
+        }
+    }
 }
 
 
@@ -104,5 +121,111 @@ PlainXMLFormatter::writeAttr(std::ostream& into, const std::string& attr, const
     into << " " << attr << "=\"" << val << "\"";
 }
 
+
+void
+PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const SUMOReal& val) {
+    writeAttrName(into, attr);
+    char buffer[32];
+    const int length = formatReal(buffer, val, (int) into.precision());
+    if (length > 0) {
+        into.write(buffer, length);
+    } else {
+        const std::ios::fmtflags flags = into.flags();
+        into.setf(std::ios::fixed, std::ios::floatfield);
+        into << val;
+        into.flags(flags);
+    }
+    into.put('"');
+}
+
+
+void
+PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const int& val) {
+    writeAttrName(into, attr);
+    char buffer[32];
+    int length = 0;
+    if (val < 0) {
+        buffer[0] = '-';
+        length = 1 + formatUnsigned(buffer + 1, 0UL - (unsigned long) val);
+    } else {
+        length = formatUnsigned(buffer, (unsigned long) val);
+    }
+    into.write(buffer, length);
+    into.put('"');
+}
+
+
+void
+PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const unsigned int& val) {
+    writeAttrName(into, attr);
+    char buffer[32];
+    into.write(buffer, formatUnsigned(buffer, val));
+    into.put('"');
+}
+
+
+void
+PlainXMLFormatter::writeAttr(std::ostream& into, const SumoXMLAttr attr, const std::string& val) {
+    writeAttrName(into, attr);
+    into.write(val.data(), (std::streamsize) val.size());
+    into.put('"');
+}
+
+
+int
+PlainXMLFormatter::formatReal(char* buffer, SUMOReal value, int precision) {
+    static const SUMOReal powers[] = { 1., 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8 };
+    if (precision < 0 || precision > 8) {
+        return 0;
+    }
+    int length = 0;
+    if (value < 0 || (value == 0 && 1. / value < 0)) {
+        buffer[length++] = '-';
+        value = -value;
+    }
+    // fails for nan and inf, too
+    if (!(value < 4294967295.)) {
+        return 0;
+    }
+    unsigned long intPart = (unsigned long) value;
+    // the subtraction is exact, the scaling errs by less than 1e-7
+    const SUMOReal scaled = (value - (SUMOReal) intPart) * powers[precision];
+    const SUMOReal fracPart = floor(scaled);
+    const SUMOReal rest = scaled - fracPart;
+    if (fabs(rest - 0.5) < 1e-6) {
+        return 0;
+    }
+    unsigned long frac = (unsigned long) fracPart + (rest > 0.5 ? 1 : 0);
+    if (frac >= (unsigned long) powers[precision]) {
+        frac = 0;
+        ++intPart;
+    }
+    length += formatUnsigned(buffer + length, intPart);
+    if (precision > 0) {
+        buffer[length++] = '.';
+        for (int i = precision - 1; i >= 0; --i) {
+            buffer[length + i] = (char)('0' + frac % 10);
+            frac /= 10;
+        }
+        length += precision;
+    }
+    return length;
+}
+
+
+int
+PlainXMLFormatter::formatUnsigned(char* buffer, unsigned long value) {
+    char digits[24];
+    int number = 0;
+    do {
+        digits[number++] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    for (int i = 0; i < number; ++i) {
+        buffer[i] = digits[number - 1 - i];
+    }
+    return number;
+}
+
 /****************************************************************************/
 
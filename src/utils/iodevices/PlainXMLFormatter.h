@@ -30,6 +30,8 @@
 #include <config.h>
 #endif
 
+#include <ostream>
+#include <utils/common/ToString.h>
 #include "OutputFormatter.h"
 
 
@@ -130,7 +132,83 @@ public:
      */
     template <class T>
     static void writeAttr(std::ostream& into, const SumoXMLAttr attr, const T& val) {
-        into << " " << toString(attr) << "=\"" << toString(val, into.precision()) << "\"";
+        writeAttrName(into, attr);
+        into << toString(val, into.precision()) << "\"";
+    }
+
+
+    /// @name Overloads of writeAttr for the frequent value types
+    /// @brief These format the value without building temporary strings
+    /// @{
+
+    /** @brief writes a named real valued attribute using the precision of the stream
+     *
+     * @param[in] into The output stream to use
+     * @param[in] attr The attribute (name)
+     * @param[in] val The attribute value
+     */
+    static void writeAttr(std::ostream& into, const SumoXMLAttr attr, const SUMOReal& val);
+
+
+    /** @brief writes a named integer attribute
+     *
+     * @param[in] into The output stream to use
+     * @param[in] attr The attribute (name)
+     * @param[in] val The attribute value
+     */
+    static void writeAttr(std::ostream& into, const SumoXMLAttr attr, const int& val);
+
+
+    /** @brief writes a named unsigned integer attribute
+     *
+     * @param[in] into The output stream to use
+     * @param[in] attr The attribute (name)
+     * @param[in] val The attribute value
+     */
+    static void writeAttr(std::ostream& into, const SumoXMLAttr attr, const unsigned int& val);
+
+
+    /** @brief writes a named string attribute
+     *
+     * @param[in] into The output stream to use
+     * @param[in] attr The attribute (name)
+     * @param[in] val The attribute value
+     */
+    static void writeAttr(std::ostream& into, const SumoXMLAttr attr, const std::string& val);
+    /// @}
+
+
+    /** @brief Formats the value like a stream in fixed notation does
+     *
+     * Ties (and values too close to a tie to be decided exactly) are not
+     *  formatted, as well as values of 2^32 and above, infinite values and
+     *  precisions above 8. These have to be formatted by the stream.
+     *
+     * @param[out] buffer The buffer to write into (at least 32 characters)
+     * @param[in] value The value to format
+     * @param[in] precision The number of decimal places
+     * @return The number of characters written, 0 if the value was not formatted
+     */
+    static int formatReal(char* buffer, SUMOReal value, int precision);
+
+
+    /** @brief Formats the unsigned value
+     *
+     * @param[out] buffer The buffer to write into (at least 32 characters)
+     * @param[in] value The value to format
+     * @return The number of characters written
+     */
+    static int formatUnsigned(char* buffer, unsigned long value);
+
+
+private:
+    /// @brief Writes the attribute name together with the preceding space and the following '="'
+    static void writeAttrName(std::ostream& into, const SumoXMLAttr attr) {
+        if ((size_t) attr < myAttrNames.size() && !myAttrNames[attr].empty()) {
+            into.write(myAttrNames[attr].data(), (std::streamsize) myAttrNames[attr].size());
+        } else {
+            into << " " << toString(attr) << "=\"";
+        }
     }
 
 
@@ -138,6 +216,9 @@ private:
     /// @brief The stack of begun xml elements
     std::vector<std::string> myXMLStack;
 
+    /// @brief The written attribute names (with space and '="') by attribute, filled by the first constructor call
+    static std::vector<std::string> myAttrNames;
+
     /// @brief The initial indentation level
     unsigned int myDefaultIndentation;
 
@@ -0,0 +1,82 @@
+/****************************************************************************/
+/// @file    GzipInputSource.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// An input source for the XML parser reading a gzip compressed file
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_ZLIB
+
+#include <utils/common/UtilExceptions.h>
+#include "GzipInputSource.h"
+
+#ifdef CHECK_MEMORY_LEAKS
+#include <foreign/nvwa/debug_new.h>
+#endif // CHECK_MEMORY_LEAKS
+
+
+// ===========================================================================
+// method definitions
+// ===========================================================================
+// ---------------------------------------------------------------------------
+// GzipInputSource - methods
+// ---------------------------------------------------------------------------
+GzipInputSource::GzipInputSource(const std::string& file)
+    : XERCES_CPP_NAMESPACE::InputSource(file.c_str()), myFile(file) {}
+
+
+GzipInputSource::~GzipInputSource() {}
+
+
+XERCES_CPP_NAMESPACE::BinInputStream*
+GzipInputSource::makeStream() const {
+    gzFile file = gzopen(myFile.c_str(), "rb");
+    if (file == 0) {
+        return 0;
+    }
+    return new Stream(file);
+}
+
+
+// ---------------------------------------------------------------------------
+// GzipInputSource::Stream - methods
+// ---------------------------------------------------------------------------
+XERCES3_SIZE_t
+GzipInputSource::Stream::readBytes(XMLByte* const toFill, const XERCES3_SIZE_t maxToRead) {
+    const int read = gzread(myFile, toFill, (unsigned int) maxToRead);
+    if (read < 0) {
+        int error;
+        throw ProcessError("Could not decompress input (" + std::string(gzerror(myFile, &error)) + ").");
+    }
+    myPos += read;
+    return (XERCES3_SIZE_t) read;
+}
+
+
+#endif
+
+/****************************************************************************/
+
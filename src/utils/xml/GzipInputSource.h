@@ -0,0 +1,146 @@
+/****************************************************************************/
+/// @file    GzipInputSource.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// An input source for the XML parser reading a gzip compressed file
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef GzipInputSource_h
+#define GzipInputSource_h
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_ZLIB
+
+#include <string>
+#include <zlib.h>
+#include <xercesc/sax/InputSource.hpp>
+#include <xercesc/util/BinInputStream.hpp>
+#include <xercesc/util/XercesVersion.hpp>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class GzipInputSource
+ * @brief An input source for the XML parser reading a gzip compressed file
+ *
+ * The file is decompressed while being parsed. Uncompressed files are
+ *  read unchanged.
+ */
+class GzipInputSource : public XERCES_CPP_NAMESPACE::InputSource {
+public:
+    /** @brief Constructor
+     * @param[in] file The name of the file to read
+     */
+    GzipInputSource(const std::string& file);
+
+
+    /// @brief Destructor
+    ~GzipInputSource();
+
+
+    /** @brief Opens the file for the parser
+     * @return The stream to read from (owned by the parser), 0 if the file could not be opened
+     */
+    XERCES_CPP_NAMESPACE::BinInputStream* makeStream() const;
+
+
+private:
+    /**
+     * @class Stream
+     * @brief The stream decompressing the file
+     */
+    class Stream : public XERCES_CPP_NAMESPACE::BinInputStream {
+    public:
+        /// @brief Constructor
+        Stream(gzFile file) : myFile(file), myPos(0) {}
+
+        /// @brief Destructor, closes the file
+        ~Stream() {
+            gzclose(myFile);
+        }
+
+#if _XERCES_VERSION < 30000
+        /// @brief Returns the number of decompressed bytes read so far
+        unsigned int curPos() const {
+            return (unsigned int) myPos;
+        }
+#else
+        /// @brief Returns the number of decompressed bytes read so far
+        XMLFilePos curPos() const {
+            return myPos;
+        }
+
+        /// @brief Returns the content type (unknown)
+        const XMLCh* getContentType() const {
+            return 0;
+        }
+#endif
+
+        /** @brief Decompresses the next bytes
+         * @param[out] toFill The buffer to fill
+         * @param[in] maxToRead The size of the buffer
+         * @return The number of bytes read, 0 at the end of the file
+         */
+        XERCES3_SIZE_t readBytes(XMLByte* const toFill, const XERCES3_SIZE_t maxToRead);
+
+    private:
+        /// @brief The compressed file
+        gzFile myFile;
+
+        /// @brief The number of decompressed bytes read so far
+        XERCES3_SIZE_t myPos;
+
+    private:
+        /// @brief Invalidated copy constructor.
+        Stream(const Stream&);
+
+        /// @brief Invalidated assignment operator.
+        Stream& operator=(const Stream&);
+
+    };
+
+
+private:
+    /// @brief The name of the file to read
+    const std::string myFile;
+
+
+private:
+    /// @brief Invalidated copy constructor.
+    GzipInputSource(const GzipInputSource&);
+
+    /// @brief Invalidated assignment operator.
+    GzipInputSource& operator=(const GzipInputSource&);
+
+};
+
+
+#endif
+
+#endif
+
+/****************************************************************************/
+
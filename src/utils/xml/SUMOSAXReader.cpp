@@ -33,10 +33,12 @@
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #include <xercesc/framework/MemBufInputSource.hpp>
 #include <utils/common/ToString.h>
+#include <utils/common/FileHelpers.h>
 #include <utils/iodevices/BinaryFormatter.h>
 #include <utils/iodevices/BinaryInputDevice.h>
 #include "SUMOSAXAttributesImpl_Binary.h"
 #include "GenericSAXHandler.h"
+#include "GzipInputSource.h"
 #include "SUMOSAXReader.h"
 
 #ifdef CHECK_MEMORY_LEAKS
@@ -49,12 +51,13 @@
 // ===========================================================================
 SUMOSAXReader::SUMOSAXReader(GenericSAXHandler& handler, const bool enableValidation)
     : myHandler(&handler), myEnableValidation(enableValidation),
-      myXMLReader(0), myBinaryInput(0)  {}
+      myXMLReader(0), myBinaryInput(0), myInputSource(0)  {}
 
 
 SUMOSAXReader::~SUMOSAXReader() {
     delete myXMLReader;
     delete myBinaryInput;
+    delete myInputSource;
 }
 
 
@@ -78,7 +81,16 @@ SUMOSAXReader::parse(std::string systemID) {
         if (myXMLReader == 0) {
             myXMLReader = getSAXReader();
         }
-        myXMLReader->parse(systemID.c_str());
+        if (FileHelpers::isGzip(systemID)) {
+#ifdef HAVE_ZLIB
+            GzipInputSource source(systemID);
+            myXMLReader->parse(source);
+#else
+            throw ProcessError("Could not read '" + systemID + "' (compressed input needs zlib).");
+#endif
+        } else {
+            myXMLReader->parse(systemID.c_str());
+        }
     }
 }
 
@@ -128,6 +140,17 @@ SUMOSAXReader::parseFirst(std::string systemID) {
             myXMLReader = getSAXReader();
         }
         myToken = XERCES_CPP_NAMESPACE::XMLPScanToken();
+        delete myInputSource;
+        myInputSource = 0;
+        if (FileHelpers::isGzip(systemID)) {
+#ifdef HAVE_ZLIB
+            // the source has to be kept until the progressive parse ends
+            myInputSource = new GzipInputSource(systemID);
+            return myXMLReader->parseFirst(*myInputSource, myToken);
+#else
+            throw ProcessError("Could not read '" + systemID + "' (compressed input needs zlib).");
+#endif
+        }
         return myXMLReader->parseFirst(systemID.c_str(), myToken);
     }
 }
@@ -38,6 +38,9 @@
 // ===========================================================================
 class GenericSAXHandler;
 class BinaryInputDevice;
+XERCES_CPP_NAMESPACE_BEGIN
+class InputSource;
+XERCES_CPP_NAMESPACE_END
 
 
 // ===========================================================================
@@ -49,7 +52,8 @@ class BinaryInputDevice;
  *
  * This class generates on demand either a SAX2XMLReader or parses the SUMO
  * binary xml. The interface is inspired by but not identical to
- * SAX2XMLReader.
+ * SAX2XMLReader. XML files whose names end with ".gz" are decompressed
+ * while being parsed (if SUMO was built with zlib).
  */
 class SUMOSAXReader {
 public:
@@ -104,6 +108,9 @@ private:
 
     BinaryInputDevice* myBinaryInput;
 
+    /// @brief The source of the compressed file parsed progressively
+    XERCES_CPP_NAMESPACE::InputSource* myInputSource;
+
 private:
     /// @brief invalidated copy constructor
     SUMOSAXReader(const SUMOSAXReader& s);
@@ -123,6 +123,8 @@ def initOptions():
                          help="parameter to adapt the cost unit")
     optParser.add_option("-J", "--addweights", dest="addweights",
                          help="Additional weightes for duarouter")
+    optParser.add_option("--incremental-tolerance", type="float", dest="incrementalTolerance",
+                         help="let duarouter reuse routes whose costs changed by at most this fraction instead of searching")
     optParser.add_option("--router-verbose", action="store_true",
                          default=False, help="let duarouter print some statistics")
     optParser.add_option("-M", "--external-gawron", action="store_true", dest="externalgawron",
@@ -196,6 +198,8 @@ def writeRouteConf(step, options, file, output, routesInfo, initial_type):
                 options.logitgamma)
     if options.logittheta:
         print >> fd, '        <logit.theta value="%s"/>' % options.logittheta
+    if options.incrementalTolerance is not None and step > 0:
+        print >> fd, '        <incremental.tolerance value="%s"/>' % options.incrementalTolerance
     print >> fd, '    </processing>'
                 
     print >> fd, '    <random_number><random value="%s"/></random_number>' % options.absrand
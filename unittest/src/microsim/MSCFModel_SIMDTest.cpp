@@ -0,0 +1,406 @@
+/****************************************************************************/
+/// @file    MSCFModel_SIMDTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests MSCFModel_SIMD class from <SUMO>/src/microsim/cfmodels
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <utils/common/StdDefs.h>
+#include <microsim/cfmodels/MSCFModel_SIMD.h>
+#include <microsim/MSNet.h>
+#include <microsim/MSEdge.h>
+#include <microsim/MSLane.h>
+#include <microsim/MSRoute.h>
+#include <microsim/MSVehicle.h>
+#include <microsim/MSVehicleType.h>
+#include <microsim/MSVehicleControl.h>
+#include <microsim/MSEventControl.h>
+#include <microsim/MSEdgeControl.h>
+#include <microsim/MSJunctionControl.h>
+#include <microsim/MSFrame.h>
+#include <microsim/MSInsertionControl.h>
+#include <microsim/traffic_lights/MSTLLogicControl.h>
+#include <utils/common/SUMOVehicleParameter.h>
+#include <utils/common/SUMOVTypeParameter.h>
+#include <utils/common/SysUtils.h>
+#include <utils/geom/PositionVector.h>
+#include <utils/options/OptionsCont.h>
+
+
+// ===========================================================================
+// helper definitions
+// ===========================================================================
+/* Input data for a number of vehicles. The values include the special cases
+ * of the models (standing leaders, leaders without deceleration, tiny gaps). */
+struct SIMDTestInput {
+    SIMDTestInput(size_t n) : speeds(n), gaps(n), predSpeeds(n), predMaxDecels(n), desiredSpeeds(n), headwayTimes(n) {
+        srand(42);
+        for (size_t i = 0; i < n; ++i) {
+            speeds[i] = (SUMOReal)(rand() % 4000) / 100;
+            gaps[i] = (SUMOReal)(rand() % 20000) / 100;
+            predSpeeds[i] = (SUMOReal)(rand() % 4000) / 100;
+            predMaxDecels[i] = (SUMOReal)(rand() % 90) / 10;
+            desiredSpeeds[i] = (SUMOReal)(1 + rand() % 4000) / 100;
+            headwayTimes[i] = (SUMOReal)(rand() % 30) / 10;
+            switch (i % 7) {
+                case 1:
+                    predSpeeds[i] = 0;
+                    break;
+                case 2:
+                    predMaxDecels[i] = 0;
+                    break;
+                case 3:
+                    gaps[i] = (SUMOReal) 0.005;
+                    predSpeeds[i] = 0;
+                    break;
+                case 4:
+                    predSpeeds[i] = predMaxDecels[i] / 2;
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+
+    std::vector<SUMOReal> speeds;
+    std::vector<SUMOReal> gaps;
+    std::vector<SUMOReal> predSpeeds;
+    std::vector<SUMOReal> predMaxDecels;
+    std::vector<SUMOReal> desiredSpeeds;
+    std::vector<SUMOReal> headwayTimes;
+};
+
+
+MSCFModel_SIMD::KraussParameter
+getKraussParameter() {
+    MSCFModel_SIMD::KraussParameter p;
+    p.decel = (SUMOReal) 4.5;
+    p.headwayTime = 1;
+    p.tauDecel = p.decel * p.headwayTime;
+    p.accelStep = (SUMOReal) 2.6;
+    p.maxSpeed = 70;
+    return p;
+}
+
+
+MSCFModel_SIMD::IDMParameter
+getIDMParameter() {
+    MSCFModel_SIMD::IDMParameter p;
+    p.accel = (SUMOReal) 2.6;
+    p.minGap = (SUMOReal) 2.5;
+    p.delta = 4;
+    p.twoSqrtAccelDecel = (SUMOReal)(2 * sqrt(2.6 * 4.5));
+    p.iterations = 4;
+    p.stepLength = 1;
+    return p;
+}
+
+
+/* Returns the implementations available on this processor. */
+std::vector<MSCFModel_SIMD::Implementation>
+getSupportedImplementations() {
+    std::vector<MSCFModel_SIMD::Implementation> result;
+    result.push_back(MSCFModel_SIMD::IMPL_SCALAR);
+    if (MSCFModel_SIMD::isSupported(MSCFModel_SIMD::IMPL_SSE2)) {
+        result.push_back(MSCFModel_SIMD::IMPL_SSE2);
+    }
+    if (MSCFModel_SIMD::isSupported(MSCFModel_SIMD::IMPL_AVX2)) {
+        result.push_back(MSCFModel_SIMD::IMPL_AVX2);
+    }
+    return result;
+}
+
+
+/* Compares the results bitwise, treating two NaNs as equal. */
+void
+expectIdentical(const std::vector<SUMOReal>& expected, const std::vector<SUMOReal>& actual, const std::string& impl) {
+    for (size_t i = 0; i < expected.size(); ++i) {
+        if (expected[i] != expected[i]) {
+            EXPECT_TRUE(actual[i] != actual[i]) << impl << " at " << i;
+        } else {
+            EXPECT_EQ(expected[i], actual[i]) << impl << " at " << i;
+        }
+    }
+}
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests that the scalar implementation is always available. */
+TEST(MSCFModel_SIMD, test_dispatch) {
+    const MSCFModel_SIMD::Implementation before = MSCFModel_SIMD::getImplementation();
+    EXPECT_TRUE(MSCFModel_SIMD::isSupported(MSCFModel_SIMD::IMPL_SCALAR));
+    EXPECT_TRUE(MSCFModel_SIMD::isSupported(MSCFModel_SIMD::getBestImplementation()));
+    EXPECT_TRUE(MSCFModel_SIMD::setImplementation(MSCFModel_SIMD::IMPL_SCALAR));
+    EXPECT_EQ(MSCFModel_SIMD::IMPL_SCALAR, MSCFModel_SIMD::getImplementation());
+    EXPECT_EQ("scalar", MSCFModel_SIMD::getName(MSCFModel_SIMD::IMPL_SCALAR));
+    MSCFModel_SIMD::setImplementation(before);
+}
+
+
+/* Tests that all implementations of the Krauss kernels give identical results (including the remainder loop). */
+TEST(MSCFModel_SIMD, test_krauss_identical) {
+    const MSCFModel_SIMD::Implementation before = MSCFModel_SIMD::getImplementation();
+    const MSCFModel_SIMD::KraussParameter p = getKraussParameter();
+    const size_t n = 1003;
+    SIMDTestInput in(n);
+    std::vector<SUMOReal> expectedFollow(n);
+    std::vector<SUMOReal> expectedStop(n);
+    MSCFModel_SIMD::setImplementation(MSCFModel_SIMD::IMPL_SCALAR);
+    MSCFModel_SIMD::kraussFollowSpeeds(p, &in.speeds[0], &in.gaps[0], &in.predSpeeds[0], &in.predMaxDecels[0], &expectedFollow[0], n);
+    MSCFModel_SIMD::kraussStopSpeeds(p, &in.speeds[0], &in.gaps[0], &expectedStop[0], n);
+    EXPECT_EQ(0, expectedStop[3]);
+    EXPECT_EQ(0, expectedFollow[3]);
+    const std::vector<MSCFModel_SIMD::Implementation> impls = getSupportedImplementations();
+    for (size_t i = 1; i < impls.size(); ++i) {
+        MSCFModel_SIMD::setImplementation(impls[i]);
+        std::vector<SUMOReal> follow(n);
+        std::vector<SUMOReal> stop(n);
+        MSCFModel_SIMD::kraussFollowSpeeds(p, &in.speeds[0], &in.gaps[0], &in.predSpeeds[0], &in.predMaxDecels[0], &follow[0], n);
+        MSCFModel_SIMD::kraussStopSpeeds(p, &in.speeds[0], &in.gaps[0], &stop[0], n);
+        expectIdentical(expectedFollow, follow, MSCFModel_SIMD::getName(impls[i]));
+        expectIdentical(expectedStop, stop, MSCFModel_SIMD::getName(impls[i]));
+    }
+    MSCFModel_SIMD::setImplementation(before);
+}
+
+
+/* Tests that all implementations of the IDM kernel give identical results (including the remainder loop). */
+TEST(MSCFModel_SIMD, test_idm_identical) {
+    const MSCFModel_SIMD::Implementation before = MSCFModel_SIMD::getImplementation();
+    const MSCFModel_SIMD::IDMParameter p = getIDMParameter();
+    const size_t n = 1003;
+    SIMDTestInput in(n);
+    std::vector<SUMOReal> expected(n);
+    MSCFModel_SIMD::setImplementation(MSCFModel_SIMD::IMPL_SCALAR);
+    MSCFModel_SIMD::idmFollowSpeeds(p, &in.speeds[0], &in.gaps[0], &in.predSpeeds[0], &in.desiredSpeeds[0], &in.headwayTimes[0], &expected[0], n);
+    const std::vector<MSCFModel_SIMD::Implementation> impls = getSupportedImplementations();
+    for (size_t i = 1; i < impls.size(); ++i) {
+        MSCFModel_SIMD::setImplementation(impls[i]);
+        std::vector<SUMOReal> result(n);
+        MSCFModel_SIMD::idmFollowSpeeds(p, &in.speeds[0], &in.gaps[0], &in.predSpeeds[0], &in.desiredSpeeds[0], &in.headwayTimes[0], &result[0], n);
+        expectIdentical(expected, result, MSCFModel_SIMD::getName(impls[i]));
+    }
+    MSCFModel_SIMD::setImplementation(before);
+}
+
+
+/* A net with a single lane to put vehicles of the car-following models on. */
+class MSCFModel_SIMDModelTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        OptionsCont::getOptions().clear();
+        MSFrame::fillOptions();
+        MSFrame::setMSGlobals(OptionsCont::getOptions());
+        myVehicleControl = new MSVehicleControl();
+        myNet = new MSNet(myVehicleControl, new MSEventControl(), new MSEventControl(), new MSEventControl());
+        MSEdge* edge = new MSEdge("e", 0, MSEdge::EDGEFUNCTION_NORMAL);
+        PositionVector shape;
+        shape.push_back(Position(0, 0));
+        shape.push_back(Position(1000, 0));
+        MSLane* lane = new MSLane("e_0", 13.9, 1000, edge, 0, shape, SUMO_const_laneWidth, SVCFreeForAll);
+        MSLane::dictionary("e_0", lane);
+        edge->initialize(new std::vector<MSLane*>(1, lane));
+        MSEdge::dictionary("e", edge);
+        myNet->closeBuilding(new MSEdgeControl(std::vector<MSEdge*>(1, edge)), new MSJunctionControl(), 0, new MSTLLogicControl(),
+                             std::vector<SUMOTime>(), std::vector<std::string>());
+        myRoute = new MSRoute("r", MSEdgeVector(1, edge), 1, 0, std::vector<SUMOVehicleParameter::Stop>());
+        MSRoute::dictionary("r", myRoute);
+        myImplementation = MSCFModel_SIMD::getImplementation();
+    }
+
+    virtual void TearDown() {
+        MSCFModel_SIMD::setImplementation(myImplementation);
+        delete myNet;
+        OptionsCont::getOptions().clear();
+    }
+
+    /// @brief Builds a vehicle of a type using the given model, inserts it and lets it accelerate for some steps
+    const MSVehicle* insertVehicle(SumoXMLTag cfModel) {
+        SUMOVTypeParameter type;
+        type.id = "t";
+        type.cfModel = cfModel;
+        MSVehicleType* vtype = MSVehicleType::build(type);
+        myVehicleControl->addVType(vtype);
+        SUMOVehicleParameter* pars = new SUMOVehicleParameter();
+        pars->id = "v";
+        SUMOVehicle* veh = myVehicleControl->buildVehicle(pars, myRoute, vtype);
+        myVehicleControl->addVehicle(pars->id, veh);
+        myNet->getInsertionControl().add(veh);
+        myNet->getInsertionControl().emitVehicles(0);
+        if (!veh->isOnRoad()) {
+            return 0;
+        }
+        MSLane* const lane = MSLane::dictionary("e_0");
+        std::vector<MSLane*> into;
+        for (SUMOTime t = DELTA_T; t <= 4 * DELTA_T; t += DELTA_T) {
+            lane->planMovements(t);
+            lane->moveCritical(t);
+            lane->setCritical(t, into);
+        }
+        return static_cast<const MSVehicle*>(veh);
+    }
+
+    /** @brief Checks that the batch speeds of the vehicle's model match its speeds computed one by one
+     *
+     * The vehicle is used for all positions of the batch, the speeds and
+     *  gaps vary. This compares the kernels of every implementation
+     *  against the model's own scalar code.
+     */
+    void checkBatchSpeeds(const MSVehicle* const veh) {
+        const MSCFModel& cf = veh->getCarFollowModel();
+        const size_t n = 1003;
+        SIMDTestInput in(n);
+        const std::vector<const MSVehicle*> vehs(n, veh);
+        // stopSpeed uses the vehicle's own speed
+        const std::vector<SUMOReal> ownSpeeds(n, veh->getSpeed());
+        std::vector<SUMOReal> expectedFollow(n);
+        std::vector<SUMOReal> expectedStop(n);
+        for (size_t i = 0; i < n; ++i) {
+            expectedFollow[i] = cf.followSpeed(veh, in.speeds[i], in.gaps[i], in.predSpeeds[i], in.predMaxDecels[i]);
+            expectedStop[i] = cf.stopSpeed(veh, in.gaps[i]);
+        }
+        const std::vector<MSCFModel_SIMD::Implementation> impls = getSupportedImplementations();
+        for (size_t i = 0; i < impls.size(); ++i) {
+            MSCFModel_SIMD::setImplementation(impls[i]);
+            std::vector<SUMOReal> follow(n);
+            std::vector<SUMOReal> stop(n);
+            ASSERT_TRUE(cf.followSpeeds(&vehs[0], &in.speeds[0], &in.gaps[0], &in.predSpeeds[0], &in.predMaxDecels[0], &follow[0], n));
+            ASSERT_TRUE(cf.stopSpeeds(&vehs[0], &ownSpeeds[0], &in.gaps[0], &stop[0], n));
+            for (size_t j = 0; j < n; ++j) {
+                EXPECT_NEAR(expectedFollow[j], follow[j], 1e-9 * MAX2((SUMOReal) 1, expectedFollow[j])) << MSCFModel_SIMD::getName(impls[i]) << " at " << j;
+                EXPECT_NEAR(expectedStop[j], stop[j], 1e-9 * MAX2((SUMOReal) 1, expectedStop[j])) << MSCFModel_SIMD::getName(impls[i]) << " at " << j;
+                EXPECT_LE(0, follow[j]);
+            }
+        }
+    }
+
+    MSVehicleControl* myVehicleControl;
+    MSNet* myNet;
+    MSRoute* myRoute;
+    MSCFModel_SIMD::Implementation myImplementation;
+};
+
+
+/* Tests that the Krauss batch speeds match the speeds of the model computed one by one. */
+TEST_F(MSCFModel_SIMDModelTest, test_krauss_model) {
+    const MSVehicle* const veh = insertVehicle(SUMO_TAG_CF_KRAUSS);
+    ASSERT_TRUE(veh != 0);
+    ASSERT_LT(0, veh->getSpeed());
+    checkBatchSpeeds(veh);
+}
+
+
+/* Tests that the IDM batch speeds match the speeds of the model computed one by one. */
+TEST_F(MSCFModel_SIMDModelTest, test_idm_model) {
+    const MSVehicle* const veh = insertVehicle(SUMO_TAG_CF_IDM);
+    ASSERT_TRUE(veh != 0);
+    checkBatchSpeeds(veh);
+}
+
+
+/* Tests that the batch speeds of the IDM with adaptation use the vehicle's headway time. */
+TEST_F(MSCFModel_SIMDModelTest, test_idmm_model) {
+    const MSVehicle* const veh = insertVehicle(SUMO_TAG_CF_IDMM);
+    ASSERT_TRUE(veh != 0);
+    checkBatchSpeeds(veh);
+}
+
+
+/* Tests properties of the Krauss speeds which do not depend on the implementation:
+ * a vehicle stopping with the safe speed behind a standing leader needs no
+ * more than the gap when braking with its maximum deceleration after the
+ * headway time, and a faster leader allows a higher speed. */
+TEST(MSCFModel_SIMD, test_krauss_safe_speeds) {
+    const MSCFModel_SIMD::Implementation before = MSCFModel_SIMD::getImplementation();
+    const MSCFModel_SIMD::KraussParameter p = getKraussParameter();
+    const size_t n = 7;
+    const SUMOReal speeds[n] = {0, 5, 10, 20, 30, 40, 50};
+    const SUMOReal gaps[n] = {0, 1, 10, 50, 100, 200, 1000};
+    const SUMOReal predMaxDecels[n] = {4.5, 4.5, 4.5, 4.5, 4.5, 4.5, 4.5};
+    const std::vector<MSCFModel_SIMD::Implementation> impls = getSupportedImplementations();
+    for (size_t i = 0; i < impls.size(); ++i) {
+        MSCFModel_SIMD::setImplementation(impls[i]);
+        SUMOReal stop[n];
+        SUMOReal follow[n];
+        MSCFModel_SIMD::kraussStopSpeeds(p, speeds, gaps, stop, n);
+        MSCFModel_SIMD::kraussFollowSpeeds(p, speeds, gaps, speeds, predMaxDecels, follow, n);
+        EXPECT_EQ(0, stop[0]) << MSCFModel_SIMD::getName(impls[i]);
+        for (size_t j = 0; j < n; ++j) {
+            // never faster than accelerating from the current speed
+            EXPECT_GE(MIN2(speeds[j] + p.accelStep, p.maxSpeed) + 1e-9, stop[j]);
+            EXPECT_LE(0, stop[j]);
+            // the braking distance of the safe speed fits into the gap
+            EXPECT_GE(gaps[j] + 1e-9, stop[j] * p.headwayTime + stop[j] * stop[j] / (2 * p.decel)) << MSCFModel_SIMD::getName(impls[i]) << " at " << j;
+            // a moving leader leaves more room than a standing one
+            EXPECT_LE(stop[j], follow[j] + 1e-9);
+        }
+        // with a long gap the speed is limited by the acceleration only
+        EXPECT_DOUBLE_EQ(speeds[n - 1] + p.accelStep, stop[n - 1]);
+    }
+    MSCFModel_SIMD::setImplementation(before);
+}
+
+
+/* Measures the vehicles per second for each model and implementation.
+ * Run with --gtest_also_run_disabled_tests. */
+TEST(MSCFModel_SIMD, DISABLED_benchmark_vehicles_per_second) {
+    const MSCFModel_SIMD::Implementation before = MSCFModel_SIMD::getImplementation();
+    const size_t n = 100000;
+    const int steps = 100;
+    SIMDTestInput in(n);
+    std::vector<SUMOReal> result(n);
+    const MSCFModel_SIMD::KraussParameter krauss = getKraussParameter();
+    const MSCFModel_SIMD::IDMParameter idm = getIDMParameter();
+    const std::vector<MSCFModel_SIMD::Implementation> impls = getSupportedImplementations();
+    for (size_t i = 0; i < impls.size(); ++i) {
+        MSCFModel_SIMD::setImplementation(impls[i]);
+        long begin = SysUtils::getCurrentMillis();
+        for (int step = 0; step < steps; ++step) {
+            MSCFModel_SIMD::kraussFollowSpeeds(krauss, &in.speeds[0], &in.gaps[0], &in.predSpeeds[0], &in.predMaxDecels[0], &result[0], n);
+        }
+        const long durationKrauss = MAX2(SysUtils::getCurrentMillis() - begin, 1L);
+        begin = SysUtils::getCurrentMillis();
+        for (int step = 0; step < steps; ++step) {
+            MSCFModel_SIMD::idmFollowSpeeds(idm, &in.speeds[0], &in.gaps[0], &in.predSpeeds[0], &in.desiredSpeeds[0], &in.headwayTimes[0], &result[0], n);
+        }
+        const long durationIDM = MAX2(SysUtils::getCurrentMillis() - begin, 1L);
+        std::cout << MSCFModel_SIMD::getName(impls[i])
+                  << ": Krauss " << (double)n * steps / durationKrauss * 1000. << " veh/s"
+                  << ", IDM " << (double)n * steps / durationIDM * 1000. << " veh/s" << std::endl;
+    }
+    MSCFModel_SIMD::setImplementation(before);
+}
+
+
+/****************************************************************************/
+
@@ -1,5 +1,12 @@
+#include <algorithm>
+#include <queue>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
 #include <gtest/gtest.h>
 #include <microsim/MSEventControl.h>
+#include <utils/common/SysUtils.h>
+#include <utils/common/UtilExceptions.h>
 #include "../utils/common/CommandMock.h"
 
 using namespace std;
@@ -23,4 +30,276 @@ TEST(MSEventControl, test_method_execute) {
 }
 
 
+/* A command which records the times it is executed at. */
+class RecordingCommand : public Command {
+public:
+    RecordingCommand(int id, std::vector<std::pair<int, SUMOTime> >& log, SUMOTime repeat = 0, bool fail = false)
+        : myID(id), myLog(log), myRepeat(repeat), myFail(fail) {}
 
+    SUMOTime execute(SUMOTime currentTime) {
+        myLog.push_back(std::make_pair(myID, currentTime));
+        if (myFail) {
+            throw ProcessError("failed");
+        }
+        return myRepeat;
+    }
+
+private:
+    int myID;
+    std::vector<std::pair<int, SUMOTime> >& myLog;
+    SUMOTime myRepeat;
+    bool myFail;
+};
+
+
+/* A command which only counts its executions (for the benchmark). */
+class CountingCommand : public Command {
+public:
+    CountingCommand(SUMOTime repeat, long& count) : myRepeat(repeat), myCount(count) {}
+
+    SUMOTime execute(SUMOTime) {
+        myCount++;
+        return myRepeat;
+    }
+
+private:
+    SUMOTime myRepeat;
+    long& myCount;
+};
+
+
+/* The former heap based event control, used as the benchmark's reference. */
+class HeapEventControl {
+public:
+    typedef std::pair<Command*, SUMOTime> Event;
+
+    ~HeapEventControl() {
+        while (!myEvents.empty()) {
+            delete myEvents.top().first;
+            myEvents.pop();
+        }
+    }
+
+    void addEvent(Command* operation, SUMOTime execTimeStep) {
+        myEvents.push(Event(operation, execTimeStep));
+    }
+
+    void execute(SUMOTime execTime) {
+        while (!myEvents.empty() && myEvents.top().second < execTime + DELTA_T) {
+            Event currEvent = myEvents.top();
+            myEvents.pop();
+            const SUMOTime time = currEvent.first->execute(execTime);
+            if (time <= 0) {
+                delete currEvent.first;
+            } else {
+                currEvent.second = execTime + time;
+                myEvents.push(currEvent);
+            }
+        }
+    }
+
+private:
+    class EventSortCrit {
+    public:
+        bool operator()(const Event& e1, const Event& e2) const {
+            return e1.second > e2.second;
+        }
+    };
+
+    std::priority_queue<Event, std::vector<Event>, EventSortCrit> myEvents;
+};
+
+
+/* Test that events are executed at their step in the order of time and insertion,
+   including the ones beyond the horizon of the time wheel. */
+TEST(MSEventControl, test_execution_order) {
+    std::vector<std::pair<int, SUMOTime> > log;
+    MSEventControl control;
+    control.setCurrentTimeStep(0);
+    control.addEvent(new RecordingCommand(0, log), 3000, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(1, log), 2000, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(2, log), 3000, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(3, log), 5000000, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(4, log), 2000000, MSEventControl::NO_CHANGE);
+    for (SUMOTime t = 0; t < 4000; t += DELTA_T) {
+        control.execute(t);
+    }
+    ASSERT_EQ(3, (int)log.size());
+    EXPECT_EQ(std::make_pair(1, 2000), log[0]);
+    EXPECT_EQ(std::make_pair(0, 3000), log[1]);
+    EXPECT_EQ(std::make_pair(2, 3000), log[2]);
+    control.execute(1999000);
+    EXPECT_EQ(3, (int)log.size());
+    control.execute(2000000);
+    ASSERT_EQ(4, (int)log.size());
+    EXPECT_EQ(std::make_pair(4, 2000000), log[3]);
+    EXPECT_FALSE(control.isEmpty());
+    control.execute(6000000);
+    ASSERT_EQ(5, (int)log.size());
+    EXPECT_EQ(std::make_pair(3, 6000000), log[4]);
+    EXPECT_TRUE(control.isEmpty());
+}
+
+
+/* Test recurring events and events which are not aligned to the step length. */
+TEST(MSEventControl, test_recurring_and_unaligned) {
+    std::vector<std::pair<int, SUMOTime> > log;
+    MSEventControl control;
+    control.setCurrentTimeStep(0);
+    control.addEvent(new RecordingCommand(0, log, 2000), 1000, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(1, log), 1700, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(2, log), 1200, MSEventControl::NO_CHANGE);
+    control.execute(500);
+    ASSERT_EQ(2, (int)log.size());
+    EXPECT_EQ(std::make_pair(0, 500), log[0]);
+    EXPECT_EQ(std::make_pair(2, 500), log[1]);
+    control.execute(1100);
+    ASSERT_EQ(3, (int)log.size());
+    EXPECT_EQ(std::make_pair(1, 1100), log[2]);
+    control.execute(1500);
+    EXPECT_EQ(3, (int)log.size());
+    control.execute(1600);
+    ASSERT_EQ(4, (int)log.size());
+    EXPECT_EQ(std::make_pair(0, 1600), log[3]);
+    control.execute(2600);
+    EXPECT_EQ(4, (int)log.size());
+    control.execute(2700);
+    ASSERT_EQ(5, (int)log.size());
+    EXPECT_EQ(std::make_pair(0, 2700), log[4]);
+}
+
+
+/* Test that events added for the current time while executing are executed, too,
+   and that events scheduled in the past are executed at the next call. */
+TEST(MSEventControl, test_due_events) {
+    std::vector<std::pair<int, SUMOTime> > log;
+    MSEventControl control;
+    control.setCurrentTimeStep(10000);
+    EXPECT_EQ(10000, control.addEvent(new RecordingCommand(0, log), 2000, MSEventControl::ADAPT_AFTER_EXECUTION));
+    EXPECT_EQ(3000, control.addEvent(new RecordingCommand(1, log), 3000, MSEventControl::NO_CHANGE));
+    control.execute(10000);
+    ASSERT_EQ(2, (int)log.size());
+    EXPECT_EQ(std::make_pair(1, 10000), log[0]);
+    EXPECT_EQ(std::make_pair(0, 10000), log[1]);
+    EXPECT_TRUE(control.isEmpty());
+}
+
+
+/* Test that events of steps which were not executed (e.g. the switches of the traffic
+   lights after loading a state with a later begin) run late at the next call,
+   in the order of their times, and recur from there. */
+TEST(MSEventControl, test_late_events) {
+    std::vector<std::pair<int, SUMOTime> > log;
+    MSEventControl control;
+    control.setCurrentTimeStep(0);
+    control.addEvent(new RecordingCommand(0, log, 30000), 0, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(1, log), 5000000, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(2, log), 1000, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(3, log), 7000000, MSEventControl::NO_CHANGE);
+    control.execute(6000000);
+    ASSERT_EQ(3, (int)log.size());
+    EXPECT_EQ(std::make_pair(0, 6000000), log[0]);
+    EXPECT_EQ(std::make_pair(2, 6000000), log[1]);
+    EXPECT_EQ(std::make_pair(1, 6000000), log[2]);
+    for (SUMOTime t = 6001000; t < 6030000; t += DELTA_T) {
+        control.execute(t);
+    }
+    EXPECT_EQ(3, (int)log.size());
+    control.execute(6030000);
+    ASSERT_EQ(4, (int)log.size());
+    EXPECT_EQ(std::make_pair(0, 6030000), log[3]);
+    control.execute(7000000);
+    ASSERT_EQ(6, (int)log.size());
+    EXPECT_EQ(std::make_pair(0, 7000000), log[4]);
+    EXPECT_EQ(std::make_pair(3, 7000000), log[5]);
+}
+
+
+/* Test that the time wheel executes the same events at the same times as the former heap
+   if steps are skipped. */
+TEST(MSEventControl, test_skipped_steps) {
+    std::vector<std::pair<int, SUMOTime> > heapLog;
+    std::vector<std::pair<int, SUMOTime> > wheelLog;
+    srand(42);
+    {
+        HeapEventControl heap;
+        MSEventControl wheel;
+        wheel.setCurrentTimeStep(0);
+        for (int i = 0; i < 1000; ++i) {
+            const SUMOTime begin = (rand() % 10000) * DELTA_T;
+            const SUMOTime repeat = i % 3 == 0 ? 0 : (1 + rand() % 500) * DELTA_T;
+            heap.addEvent(new RecordingCommand(i, heapLog, repeat), begin);
+            wheel.addEvent(new RecordingCommand(i, wheelLog, repeat), begin, MSEventControl::NO_CHANGE);
+        }
+        for (SUMOTime t = 0; t < 12000 * DELTA_T; t += (1 + rand() % 700) * DELTA_T) {
+            heap.execute(t);
+            wheel.execute(t);
+        }
+    }
+    ASSERT_EQ(heapLog.size(), wheelLog.size());
+    for (size_t i = 0; i < heapLog.size(); ++i) {
+        ASSERT_EQ(heapLog[i].second, wheelLog[i].second);
+    }
+    std::sort(heapLog.begin(), heapLog.end());
+    std::sort(wheelLog.begin(), wheelLog.end());
+    EXPECT_EQ(heapLog, wheelLog);
+}
+
+
+/* Test that a failing command is removed and the remaining events are kept. */
+TEST(MSEventControl, test_exception) {
+    std::vector<std::pair<int, SUMOTime> > log;
+    MSEventControl control;
+    control.setCurrentTimeStep(0);
+    control.addEvent(new RecordingCommand(0, log), 1000, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(1, log, 0, true), 1000, MSEventControl::NO_CHANGE);
+    control.addEvent(new RecordingCommand(2, log), 1000, MSEventControl::NO_CHANGE);
+    EXPECT_THROW(control.execute(1000), ProcessError);
+    EXPECT_FALSE(control.isEmpty());
+    control.execute(1000);
+    ASSERT_EQ(3, (int)log.size());
+    EXPECT_EQ(2, log[2].first);
+    EXPECT_TRUE(control.isEmpty());
+}
+
+
+/* Compares the time wheel with the former heap at 1M scheduled events.
+   Run with --gtest_also_run_disabled_tests. */
+TEST(MSEventControl, DISABLED_benchmark_events) {
+    const int numEvents = 1000000;
+    const SUMOTime end = 3600 * DELTA_T;
+    std::vector<SUMOTime> begins(numEvents);
+    std::vector<SUMOTime> repeats(numEvents);
+    srand(42);
+    for (int i = 0; i < numEvents; ++i) {
+        begins[i] = (rand() % 3600) * DELTA_T;
+        repeats[i] = i % 2 == 0 ? 0 : (1 + rand() % 900) * DELTA_T;
+    }
+    long heapCount = 0;
+    long begin = SysUtils::getCurrentMillis();
+    {
+        HeapEventControl control;
+        for (int i = 0; i < numEvents; ++i) {
+            control.addEvent(new CountingCommand(repeats[i], heapCount), begins[i]);
+        }
+        for (SUMOTime t = 0; t < end; t += DELTA_T) {
+            control.execute(t);
+        }
+    }
+    const long durationHeap = SysUtils::getCurrentMillis() - begin;
+    long wheelCount = 0;
+    begin = SysUtils::getCurrentMillis();
+    {
+        MSEventControl control;
+        control.setCurrentTimeStep(0);
+        for (int i = 0; i < numEvents; ++i) {
+            control.addEvent(new CountingCommand(repeats[i], wheelCount), begins[i], MSEventControl::NO_CHANGE);
+        }
+        for (SUMOTime t = 0; t < end; t += DELTA_T) {
+            control.execute(t);
+        }
+    }
+    const long durationWheel = SysUtils::getCurrentMillis() - begin;
+    EXPECT_EQ(heapCount, wheelCount);
+    std::cout << wheelCount << " executions; heap: " << durationHeap << "ms, time wheel: " << durationWheel << "ms" << std::endl;
+}
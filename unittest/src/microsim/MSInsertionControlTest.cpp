@@ -0,0 +1,179 @@
+/****************************************************************************/
+/// @file    MSInsertionControlTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests MSInsertionControl class from <SUMO>/src/microsim
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <microsim/MSNet.h>
+#include <microsim/MSEdge.h>
+#include <microsim/MSLane.h>
+#include <microsim/MSRoute.h>
+#include <microsim/MSVehicle.h>
+#include <microsim/MSVehicleControl.h>
+#include <microsim/MSEventControl.h>
+#include <microsim/MSEdgeControl.h>
+#include <microsim/MSJunctionControl.h>
+#include <microsim/MSFrame.h>
+#include <microsim/MSInsertionControl.h>
+#include <microsim/traffic_lights/MSTLLogicControl.h>
+#include <utils/common/SUMOVehicleParameter.h>
+#include <utils/common/ToString.h>
+#include <utils/geom/PositionVector.h>
+#include <utils/options/OptionsCont.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* A net with a single edge of one lane and the insertion control to test. */
+class MSInsertionControlTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        OptionsCont::getOptions().clear();
+        MSFrame::fillOptions();
+        MSFrame::setMSGlobals(OptionsCont::getOptions());
+        myVehicleControl = new MSVehicleControl();
+        myNet = new MSNet(myVehicleControl, new MSEventControl(), new MSEventControl(), new MSEventControl());
+        myEdge = new MSEdge("e", 0, MSEdge::EDGEFUNCTION_NORMAL);
+        PositionVector shape;
+        shape.push_back(Position(0, 0));
+        shape.push_back(Position(1000, 0));
+        myLane = new MSLane("e_0", 13.9, 1000, myEdge, 0, shape, SUMO_const_laneWidth, SVCFreeForAll);
+        MSLane::dictionary("e_0", myLane);
+        myEdge->initialize(new std::vector<MSLane*>(1, myLane));
+        MSEdge::dictionary("e", myEdge);
+        MSEdgeVector edges(1, myEdge);
+        myNet->closeBuilding(new MSEdgeControl(std::vector<MSEdge*>(1, myEdge)), new MSJunctionControl(), 0, new MSTLLogicControl(),
+                             std::vector<SUMOTime>(), std::vector<std::string>());
+        myRoute = new MSRoute("r", edges, 1, 0, std::vector<SUMOVehicleParameter::Stop>());
+        MSRoute::dictionary("r", myRoute);
+    }
+
+    virtual void TearDown() {
+        delete myNet;
+        OptionsCont::getOptions().clear();
+    }
+
+    /// @brief Builds a vehicle departing at the given time with the default departure procedures
+    SUMOVehicle* buildVehicle(const std::string& id, SUMOTime depart) {
+        SUMOVehicleParameter* pars = new SUMOVehicleParameter();
+        pars->id = id;
+        pars->depart = depart;
+        SUMOVehicle* veh = myVehicleControl->buildVehicle(pars, myRoute, myVehicleControl->getVType());
+        myVehicleControl->addVehicle(id, veh);
+        return veh;
+    }
+
+    /// @brief Moves the vehicles on the lane by one step
+    void moveVehicles(SUMOTime t) {
+        std::vector<MSLane*> into;
+        myLane->planMovements(t);
+        myLane->moveCritical(t);
+        myLane->setCritical(t, into);
+    }
+
+    MSVehicleControl* myVehicleControl;
+    MSNet* myNet;
+    MSEdge* myEdge;
+    MSLane* myLane;
+    MSRoute* myRoute;
+};
+
+
+/* Test that the vehicles waiting behind a refused one are removed once they waited too long. */
+TEST_F(MSInsertionControlTest, test_expired_behind_blocked) {
+    MSInsertionControl control(*myVehicleControl, 5000, false);
+    control.add(buildVehicle("leader", 0));
+    for (int i = 0; i < 3; ++i) {
+        control.add(buildVehicle("waiting" + toString(i), 1000 * i));
+    }
+    EXPECT_EQ(1u, control.emitVehicles(0));
+    EXPECT_EQ(1u, myLane->getVehicleNumber());
+    EXPECT_EQ(0u, control.emitVehicles(1000));
+    EXPECT_EQ(0u, control.emitVehicles(2000));
+    EXPECT_EQ(3u, control.getWaitingVehicleNo());
+    EXPECT_EQ(0u, control.emitVehicles(5000));
+    EXPECT_EQ(3u, control.getWaitingVehicleNo());
+    // the first one waits too long, the others stay behind the still blocked insertion position
+    EXPECT_EQ(0u, control.emitVehicles(6000));
+    EXPECT_EQ(2u, control.getWaitingVehicleNo());
+    // both remaining ones wait too long now
+    EXPECT_EQ(0u, control.emitVehicles(8000));
+    EXPECT_EQ(0u, control.getWaitingVehicleNo());
+    EXPECT_EQ(3u, myVehicleControl->getEndedVehicleNo());
+    EXPECT_EQ(1u, myLane->getVehicleNumber());
+}
+
+
+/* Test that descheduled vehicles are removed from behind a refused one. */
+TEST_F(MSInsertionControlTest, test_descheduled_behind_blocked) {
+    MSInsertionControl control(*myVehicleControl, -1, false);
+    control.add(buildVehicle("leader", 0));
+    control.add(buildVehicle("first", 0));
+    SUMOVehicle* second = buildVehicle("second", 0);
+    control.add(second);
+    control.add(buildVehicle("third", 0));
+    EXPECT_EQ(1u, control.emitVehicles(0));
+    EXPECT_EQ(3u, control.getWaitingVehicleNo());
+    control.descheduleDeparture(second);
+    EXPECT_EQ(0u, control.emitVehicles(1000));
+    EXPECT_EQ(2u, control.getWaitingVehicleNo());
+    EXPECT_EQ(1u, myVehicleControl->getEndedVehicleNo());
+}
+
+
+/* Test that a blocked lane is tried again once its last vehicle has moved far enough. */
+TEST_F(MSInsertionControlTest, test_blocked_lane_wakes_up) {
+    MSInsertionControl control(*myVehicleControl, -1, false);
+    control.add(buildVehicle("leader", 0));
+    control.add(buildVehicle("follower", 0));
+    EXPECT_EQ(1u, control.emitVehicles(0));
+    EXPECT_EQ(1u, control.getWaitingVehicleNo());
+    const MSVehicle* const leader = myLane->getLastVehicle();
+    ASSERT_TRUE(leader != 0);
+    const SUMOReal needed = leader->getPositionOnLane() + leader->getVehicleType().getMinGap()
+                            + leader->getVehicleType().getLength();
+    SUMOTime t = 0;
+    while (leader->getPositionOnLane() < needed) {
+        EXPECT_EQ(0u, control.emitVehicles(t));
+        EXPECT_EQ(1u, control.getWaitingVehicleNo());
+        t += DELTA_T;
+        moveVehicles(t);
+        ASSERT_LT(t, 60000);
+    }
+    EXPECT_LT(DELTA_T, t);
+    EXPECT_EQ(1u, control.emitVehicles(t));
+    EXPECT_EQ(0u, control.getWaitingVehicleNo());
+    EXPECT_EQ(2u, myLane->getVehicleNumber());
+}
+
+
+/****************************************************************************/
+
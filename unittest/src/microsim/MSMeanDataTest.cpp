@@ -0,0 +1,187 @@
+/****************************************************************************/
+/// @file    MSMeanDataTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the parallel writing of the MSMeanData class from <SUMO>/src/microsim/output
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_FOX
+
+#include <iomanip>
+#include <set>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <microsim/MSNet.h>
+#include <microsim/MSEdge.h>
+#include <microsim/MSLane.h>
+#include <microsim/MSRoute.h>
+#include <microsim/MSGlobals.h>
+#include <microsim/MSVehicleControl.h>
+#include <microsim/MSEventControl.h>
+#include <microsim/MSEdgeControl.h>
+#include <microsim/MSJunctionControl.h>
+#include <microsim/MSFrame.h>
+#include <microsim/MSInsertionControl.h>
+#include <microsim/output/MSMeanData_Net.h>
+#include <microsim/traffic_lights/MSTLLogicControl.h>
+#include <utils/common/SUMOVehicleParameter.h>
+#include <utils/common/ToString.h>
+#include <utils/geom/PositionVector.h>
+#include <utils/iodevices/OutputDevice_String.h>
+#include <utils/options/OptionsCont.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* A net of unconnected edges with two lanes each and vehicles driving on them. */
+class MSMeanDataTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        OptionsCont::getOptions().clear();
+        MSFrame::fillOptions();
+        MSFrame::setMSGlobals(OptionsCont::getOptions());
+        MSGlobals::gNumSimThreads = 4;
+        myVehicleControl = new MSVehicleControl();
+        myNet = new MSNet(myVehicleControl, new MSEventControl(), new MSEventControl(), new MSEventControl());
+        std::vector<MSEdge*> edges;
+        for (int i = 0; i < 50; ++i) {
+            MSEdge* edge = new MSEdge("e" + toString(i), i, MSEdge::EDGEFUNCTION_NORMAL);
+            std::vector<MSLane*>* lanes = new std::vector<MSLane*>();
+            for (int j = 0; j < 2; ++j) {
+                PositionVector shape;
+                shape.push_back(Position(0, 10 * i + 3 * j));
+                shape.push_back(Position(1000, 10 * i + 3 * j));
+                MSLane* lane = new MSLane(edge->getID() + "_" + toString(j), 13.9, 1000, edge, 2 * i + j, shape, SUMO_const_laneWidth, SVCFreeForAll);
+                MSLane::dictionary(lane->getID(), lane);
+                lanes->push_back(lane);
+                myLanes.push_back(lane);
+            }
+            edge->initialize(lanes);
+            MSEdge::dictionary(edge->getID(), edge);
+            edges.push_back(edge);
+        }
+        myNet->closeBuilding(new MSEdgeControl(edges), new MSJunctionControl(), 0, new MSTLLogicControl(),
+                             std::vector<SUMOTime>(), std::vector<std::string>());
+    }
+
+    virtual void TearDown() {
+        delete myNet;
+        myLanes.clear();
+        MSGlobals::gParallelMeanData = false;
+        OptionsCont::getOptions().clear();
+    }
+
+    /// @brief Inserts vehicles on every third edge and lets all vehicles drive for some steps
+    void simulate() {
+        const std::vector<MSEdge*>& edges = myNet->getEdgeControl().getEdges();
+        for (size_t i = 0; i < edges.size(); i += 3) {
+            MSRoute* route = new MSRoute("r" + toString(i), MSEdgeVector(1, edges[i]), 1, 0, std::vector<SUMOVehicleParameter::Stop>());
+            MSRoute::dictionary(route->getID(), route);
+            for (size_t j = 0; j <= i % 4; ++j) {
+                SUMOVehicleParameter* pars = new SUMOVehicleParameter();
+                pars->id = "v" + toString(i) + "_" + toString(j);
+                pars->depart = (SUMOTime)(1000 * (i % 5 + 2 * j));
+                pars->departLaneProcedure = DEPART_LANE_GIVEN;
+                pars->departLane = (int)(j % 2);
+                SUMOVehicle* veh = myVehicleControl->buildVehicle(pars, route, myVehicleControl->getVType());
+                myVehicleControl->addVehicle(pars->id, veh);
+                myNet->getInsertionControl().add(veh);
+            }
+        }
+        std::vector<MSLane*> into;
+        for (SUMOTime t = 0; t < 20000; t += DELTA_T) {
+            myNet->getInsertionControl().emitVehicles(t);
+            std::vector<MSLane*> active;
+            for (std::vector<MSLane*>::iterator i = myLanes.begin(); i != myLanes.end(); ++i) {
+                if ((*i)->getVehicleNumber() > 0) {
+                    active.push_back(*i);
+                }
+            }
+            for (std::vector<MSLane*>::iterator i = active.begin(); i != active.end(); ++i) {
+                (*i)->planMovements(t);
+            }
+            for (std::vector<MSLane*>::iterator i = active.begin(); i != active.end(); ++i) {
+                (*i)->moveCritical(t);
+            }
+            for (std::vector<MSLane*>::iterator i = active.begin(); i != active.end(); ++i) {
+                (*i)->setCritical(t, into);
+            }
+        }
+    }
+
+    /// @brief Writes the interval of the given mean data serially or in parallel
+    std::string write(MSMeanData& meanData, const bool parallel) {
+        MSGlobals::gParallelMeanData = parallel;
+        OutputDevice_String dev;
+        dev.setPrecision();
+        dev << std::setiosflags(std::ios::fixed);
+        dev.openTag("meandata");
+        meanData.writeXMLOutput(dev, 0, 20000);
+        dev.closeTag();
+        return dev.getString();
+    }
+
+    /// @brief Checks that serial and parallel writing of identical mean data give the same output
+    void checkParallelOutput(const bool useLanes) {
+        MSMeanData_Net serial("dump", 0, 100000, useLanes, false, false, false, false, -1, 0, 0.1, std::set<std::string>());
+        MSMeanData_Net parallel("dump", 0, 100000, useLanes, false, false, false, false, -1, 0, 0.1, std::set<std::string>());
+        ASSERT_LT(0, myNet->getEdgeControl().getThreadPool().size());
+        serial.init();
+        parallel.init();
+        simulate();
+        const std::string serialOutput = write(serial, false);
+        const std::string parallelOutput = write(parallel, true);
+        // some edges were driven on while others are omitted as empty
+        EXPECT_NE(std::string::npos, serialOutput.find("sampledSeconds"));
+        EXPECT_NE(std::string::npos, serialOutput.find("id=\"e48"));
+        EXPECT_EQ(std::string::npos, serialOutput.find("id=\"e49"));
+        EXPECT_EQ(serialOutput, parallelOutput);
+    }
+
+    MSVehicleControl* myVehicleControl;
+    MSNet* myNet;
+    std::vector<MSLane*> myLanes;
+};
+
+
+/* Test that edges written in parallel give the same output as written serially. */
+TEST_F(MSMeanDataTest, test_parallel_edges) {
+    checkParallelOutput(false);
+}
+
+
+/* Test that lanes written in parallel give the same output as written serially. */
+TEST_F(MSMeanDataTest, test_parallel_lanes) {
+    checkParallelOutput(true);
+}
+
+#endif
+
+
+/****************************************************************************/
+
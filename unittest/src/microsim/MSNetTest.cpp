@@ -0,0 +1,222 @@
+/****************************************************************************/
+/// @file    MSNetTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the state saving and loading of the MSNet class from <SUMO>/src/microsim
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstdio>
+#include <algorithm>
+#include <string>
+#include <deque>
+#include <vector>
+#include <gtest/gtest.h>
+#include <microsim/MSNet.h>
+#include <microsim/MSEdge.h>
+#include <microsim/MSLane.h>
+#include <microsim/MSRoute.h>
+#include <microsim/MSVehicle.h>
+#include <microsim/MSVehicleControl.h>
+#include <microsim/MSEventControl.h>
+#include <microsim/MSEdgeControl.h>
+#include <microsim/MSJunctionControl.h>
+#include <microsim/MSFrame.h>
+#include <microsim/MSInsertionControl.h>
+#include <microsim/traffic_lights/MSTLLogicControl.h>
+#include <utils/common/SUMOVehicleParameter.h>
+#include <utils/common/ToString.h>
+#include <utils/geom/PositionVector.h>
+#include <utils/iodevices/BinaryInputDevice.h>
+#include <utils/options/OptionsCont.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* A net which gives access to its time and the writing of its state. */
+class StateNet : public MSNet {
+public:
+    StateNet(MSVehicleControl* vc)
+        : MSNet(vc, new MSEventControl(), new MSEventControl(), new MSEventControl()) {}
+
+    /// @brief Sets the current time step
+    void setStep(SUMOTime t) {
+        myStep = t;
+    }
+
+    /// @brief Writes the state into the given file and waits until it is written
+    void write(const std::string& file) {
+        writeState(file);
+#ifdef HAVE_FOX
+        myStateWriter.waitAll();
+#endif
+    }
+};
+
+
+/* A net with a single edge of one lane whose state is saved and loaded again. */
+class MSNetTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        OptionsCont::getOptions().clear();
+        MSFrame::fillOptions();
+        MSFrame::setMSGlobals(OptionsCont::getOptions());
+        myVehicleControl = new MSVehicleControl();
+        myNet = new StateNet(myVehicleControl);
+        MSEdge* edge = new MSEdge("e", 0, MSEdge::EDGEFUNCTION_NORMAL);
+        PositionVector shape;
+        shape.push_back(Position(0, 0));
+        shape.push_back(Position(1000, 0));
+        myLane = new MSLane("e_0", 13.9, 1000, edge, 0, shape, SUMO_const_laneWidth, SVCFreeForAll);
+        MSLane::dictionary("e_0", myLane);
+        edge->initialize(new std::vector<MSLane*>(1, myLane));
+        MSEdge::dictionary("e", edge);
+        myNet->closeBuilding(new MSEdgeControl(std::vector<MSEdge*>(1, edge)), new MSJunctionControl(), 0, new MSTLLogicControl(),
+                             std::vector<SUMOTime>(), std::vector<std::string>());
+        myRoute = new MSRoute("r", MSEdgeVector(1, edge), 1, 0, std::vector<SUMOVehicleParameter::Stop>());
+        MSRoute::dictionary("r", myRoute);
+    }
+
+    virtual void TearDown() {
+        delete myNet;
+        OptionsCont::getOptions().clear();
+    }
+
+    /// @brief Builds a vehicle departing at the given time and adds it to the insertion control
+    void addVehicle(const std::string& id, SUMOTime depart) {
+        SUMOVehicleParameter* pars = new SUMOVehicleParameter();
+        pars->id = id;
+        pars->depart = depart;
+        SUMOVehicle* veh = myVehicleControl->buildVehicle(pars, myRoute, myVehicleControl->getVType());
+        myVehicleControl->addVehicle(id, veh);
+        myNet->getInsertionControl().add(veh);
+    }
+
+    /// @brief Inserts and moves the vehicles on the lane by one step
+    void step(SUMOTime t) {
+        std::vector<MSLane*> into;
+        myNet->setStep(t);
+        myNet->getInsertionControl().emitVehicles(t);
+        myLane->planMovements(t);
+        myLane->moveCritical(t);
+        myLane->setCritical(t, into);
+    }
+
+    /// @brief Builds a new net and loads the state from the given file into it
+    void reload(const std::string& file) {
+        TearDown();
+        SetUp();
+        BinaryInputDevice bis(file);
+        const SUMOTime step = myNet->loadState(bis);
+        myNet->loadDynamicState(bis, step);
+    }
+
+    MSVehicleControl* myVehicleControl;
+    StateNet* myNet;
+    MSLane* myLane;
+    MSRoute* myRoute;
+};
+
+
+/* Test that the vehicles on the lane and the waiting ones are restored from a saved state. */
+TEST_F(MSNetTest, test_state_round_trip) {
+    const std::string file = "msnet_state_test.bin";
+    for (int i = 0; i < 5; ++i) {
+        addVehicle("v" + toString(i), 0);
+    }
+    SUMOTime t = 0;
+    for (; t < 10000; t += DELTA_T) {
+        step(t);
+    }
+    const std::deque<MSVehicle*> vehicles = myLane->getVehiclesSecure();
+    myLane->releaseVehicles();
+    ASSERT_LT(1u, vehicles.size());
+    ASSERT_GT(5u, vehicles.size());
+    std::vector<std::string> ids;
+    std::vector<SUMOReal> positions;
+    std::vector<SUMOReal> speeds;
+    for (std::deque<MSVehicle*>::const_iterator i = vehicles.begin(); i != vehicles.end(); ++i) {
+        ids.push_back((*i)->getID());
+        positions.push_back((*i)->getPositionOnLane());
+        speeds.push_back((*i)->getSpeed());
+    }
+    EXPECT_EQ(5u, myNet->getInsertionControl().getWaitingVehicleNo() + vehicles.size());
+    myNet->write(file);
+
+    reload(file);
+    std::remove(file.c_str());
+    EXPECT_EQ(5u, myVehicleControl->getLoadedVehicleNo());
+    // the vehicles not inserted yet are waiting again
+    for (int i = 0; i < 5; ++i) {
+        const SUMOVehicle* const veh = myVehicleControl->getVehicle("v" + toString(i));
+        ASSERT_TRUE(veh != 0);
+        EXPECT_EQ(std::find(ids.begin(), ids.end(), veh->getID()) != ids.end(), veh->hasDeparted());
+    }
+    const std::deque<MSVehicle*>& loaded = myLane->getVehiclesSecure();
+    ASSERT_EQ(ids.size(), loaded.size());
+    for (size_t i = 0; i < loaded.size(); ++i) {
+        EXPECT_EQ(ids[i], loaded[i]->getID());
+        EXPECT_DOUBLE_EQ(positions[i], loaded[i]->getPositionOnLane());
+        EXPECT_DOUBLE_EQ(speeds[i], loaded[i]->getSpeed());
+    }
+    myLane->releaseVehicles();
+}
+
+
+/* Test that a state larger than the buffers used for writing it is restored completely. */
+TEST_F(MSNetTest, test_large_state) {
+    const std::string file = "msnet_large_state_test.bin";
+    for (int i = 0; i < 20000; ++i) {
+        addVehicle("veh_with_a_rather_long_id_" + toString(i), 0);
+    }
+    step(0);
+    myNet->setStep(DELTA_T);
+    ASSERT_EQ(1u, myLane->getVehicleNumber());
+    myNet->write(file);
+    std::FILE* f = std::fopen(file.c_str(), "rb");
+    ASSERT_TRUE(f != 0);
+    std::fseek(f, 0, SEEK_END);
+    EXPECT_LT(1 << 20, std::ftell(f));
+    std::fclose(f);
+
+    reload(file);
+    std::remove(file.c_str());
+    EXPECT_EQ(20000u, myVehicleControl->getLoadedVehicleNo());
+    EXPECT_EQ(1u, myLane->getVehicleNumber());
+    const SUMOVehicle* const last = myVehicleControl->getVehicle("veh_with_a_rather_long_id_19999");
+    ASSERT_TRUE(last != 0);
+    EXPECT_FALSE(last->hasDeparted());
+}
+
+
+/* Test that a state which can not be written is reported. */
+TEST_F(MSNetTest, test_unwritable_state) {
+    EXPECT_THROW(myNet->write("nonexisting_dir/state.bin"), ProcessError);
+}
+
+
+/****************************************************************************/
+
@@ -0,0 +1,118 @@
+/****************************************************************************/
+/// @file    ROEdgeTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the travel time lines of the ROEdge class from <SUMO>/src/router
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <gtest/gtest.h>
+#include <router/ROEdge.h>
+#include <router/ROLane.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* An edge of 1000m with 10m/s (100s) having travel times of 50s in [0, 100) and 150s in [100, 200). */
+class ROEdgeTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        myEdge = new ROEdge("e", 0, 0, 0);
+        myEdge->addLane(new ROLane("e_0", 1000, 10, SVCFreeForAll));
+        myEdge->addTravelTime(50, 0, 100);
+        myEdge->addTravelTime(150, 100, 200);
+    }
+
+    virtual void TearDown() {
+        ROEdge::setTimeLineOptions(false, false, false);
+        delete myEdge;
+    }
+
+    /// @brief Returns the travel time on the edge without a vehicle limiting the speed
+    SUMOReal travelTime(SUMOReal time) const {
+        return myEdge->getTravelTime(static_cast<const ROVehicle*>(0), time);
+    }
+
+    ROEdge* myEdge;
+};
+
+
+/* Test the travel times within, between and outside the loaded intervals without interpolation. */
+TEST_F(ROEdgeTest, test_travel_times) {
+    ROEdge::setTimeLineOptions(false, false, false);
+    myEdge->buildTimeLines("traveltime");
+    EXPECT_DOUBLE_EQ(50., travelTime(0));
+    EXPECT_DOUBLE_EQ(50., travelTime(99.5));
+    EXPECT_DOUBLE_EQ(150., travelTime(100));
+    EXPECT_DOUBLE_EQ(150., travelTime(199.5));
+    // behind the loaded intervals the edge's length and speed are used
+    EXPECT_DOUBLE_EQ(100., travelTime(200));
+    EXPECT_DOUBLE_EQ(100., travelTime(1e6));
+    EXPECT_DOUBLE_EQ(50., myEdge->getMinimumTravelTime(0));
+}
+
+
+/* Test that the last loaded travel time is used behind the intervals if the boundaries are extended. */
+TEST_F(ROEdgeTest, test_travel_times_extended) {
+    ROEdge::setTimeLineOptions(true, false, false);
+    myEdge->buildTimeLines("traveltime");
+    EXPECT_DOUBLE_EQ(150., travelTime(200));
+    EXPECT_DOUBLE_EQ(150., travelTime(1e6));
+    EXPECT_DOUBLE_EQ(50., travelTime(0));
+}
+
+
+/* Test the interpolated travel times for departures near the ends of the intervals. */
+TEST_F(ROEdgeTest, test_interpolated_travel_times) {
+    ROEdge::setTimeLineOptions(false, false, true);
+    myEdge->buildTimeLines("traveltime");
+    // arriving within the interval of the departure
+    EXPECT_DOUBLE_EQ(50., travelTime(0));
+    EXPECT_DOUBLE_EQ(50., travelTime(50));
+    // 40s with the first and the remaining fifth of the way with the second travel time
+    EXPECT_DOUBLE_EQ(70., travelTime(60));
+    // leaving the loaded intervals, the remaining way uses the edge's length and speed
+    EXPECT_DOUBLE_EQ(100. + 100. / 3., travelTime(100));
+    EXPECT_DOUBLE_EQ(1. + 100. * 149. / 150., travelTime(199));
+    // no more intervals to interpolate with behind the loaded ones
+    EXPECT_DOUBLE_EQ(100., travelTime(200));
+    EXPECT_DOUBLE_EQ(100., travelTime(1e6));
+}
+
+
+/* Test the interpolated travel times if the boundaries are extended. */
+TEST_F(ROEdgeTest, test_interpolated_travel_times_extended) {
+    ROEdge::setTimeLineOptions(true, false, true);
+    myEdge->buildTimeLines("traveltime");
+    EXPECT_DOUBLE_EQ(70., travelTime(60));
+    EXPECT_DOUBLE_EQ(150., travelTime(100));
+    EXPECT_DOUBLE_EQ(150., travelTime(199));
+    EXPECT_DOUBLE_EQ(150., travelTime(1e6));
+}
+
+
+/****************************************************************************/
+
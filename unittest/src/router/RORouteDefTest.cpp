@@ -0,0 +1,170 @@
+/****************************************************************************/
+/// @file    RORouteDefTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the reuse of route alternatives by the RORouteDef class from <SUMO>/src/router
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <router/ROCostCalculator.h>
+#include <router/ROEdge.h>
+#include <router/ROLane.h>
+#include <router/RORoute.h>
+#include <router/RORouteDef.h>
+#include <router/ROVehicle.h>
+#include <utils/common/DijkstraRouterTT.h>
+#include <utils/common/SUMOVehicleParameter.h>
+#include <utils/common/SUMOVTypeParameter.h>
+#include <utils/options/OptionsCont.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* A router which counts the searches it answers. */
+class CountingRouter : public SUMOAbstractRouter<ROEdge, ROVehicle> {
+public:
+    CountingRouter(size_t numEdges)
+        : SUMOAbstractRouter<ROEdge, ROVehicle>("CountingRouter"),
+          myRouter(numEdges, true, &ROEdge::getTravelTime), myQueries(0) {}
+
+    void compute(const ROEdge* from, const ROEdge* to, const ROVehicle* const vehicle,
+                 SUMOTime msTime, std::vector<const ROEdge*>& into) {
+        ++myQueries;
+        myRouter.compute(from, to, vehicle, msTime, into);
+    }
+
+    SUMOReal recomputeCosts(const std::vector<const ROEdge*>& edges, const ROVehicle* const v, SUMOTime msTime) const {
+        return myRouter.recomputeCosts(edges, v, msTime);
+    }
+
+    DijkstraRouterTT_Direct<ROEdge, ROVehicle, prohibited_noRestrictions<ROEdge, ROVehicle> > myRouter;
+    int myQueries;
+};
+
+
+/* Two routes from a to c, a-b-c (30s) and a-d-c (40s), loaded as the alternatives of a vehicle. */
+class RORouteDefTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        OptionsCont& oc = OptionsCont::getOptions();
+        oc.clear();
+        oc.doRegister("max-alternatives", new Option_Integer(5));
+        oc.doRegister("keep-all-routes", new Option_Bool(false));
+        oc.doRegister("skip-new-routes", new Option_Bool(false));
+        oc.doRegister("incremental.tolerance", new Option_Float(0.05f));
+        oc.doRegister("logit", new Option_Bool(false));
+        oc.doRegister("gawron.beta", new Option_Float(0.3f));
+        oc.doRegister("gawron.a", new Option_Float(0.05f));
+        myA = buildEdge("a", 0, 100);
+        myB = buildEdge("b", 1, 100);
+        myC = buildEdge("c", 2, 100);
+        myD = buildEdge("d", 3, 200);
+        myA->addFollower(myB);
+        myA->addFollower(myD);
+        myB->addFollower(myC);
+        myD->addFollower(myC);
+        myRouter = new CountingRouter(4);
+        myRouteDef = new RORouteDef("r", 0, false);
+        SUMOVehicleParameter pars;
+        pars.id = "v";
+        myVehicle = new ROVehicle(pars, myRouteDef, &myType);
+        myDirect = addAlternative(myB);
+        myDetour = addAlternative(myD);
+    }
+
+    virtual void TearDown() {
+        delete myVehicle;
+        delete myRouteDef;
+        delete myRouter;
+        delete myA;
+        delete myB;
+        delete myC;
+        delete myD;
+        ROCostCalculator::cleanup();
+        OptionsCont::getOptions().clear();
+    }
+
+    /// @brief Builds an edge with a single lane where vehicles drive with 10m/s
+    ROEdge* buildEdge(const std::string& id, unsigned int index, SUMOReal length) {
+        ROEdge* edge = new ROEdge(id, 0, 0, index);
+        edge->addLane(new ROLane(id + "_0", length, 10, SVCFreeForAll));
+        return edge;
+    }
+
+    /// @brief Adds the route from a over the given edge to c with its costs under the current weights
+    RORoute* addAlternative(ROEdge* via) {
+        std::vector<const ROEdge*> edges;
+        edges.push_back(myA);
+        edges.push_back(via);
+        edges.push_back(myC);
+        RORoute* route = new RORoute("r", myRouter->recomputeCosts(edges, myVehicle, 0), 0.5, edges, 0);
+        myRouteDef->addLoadedAlternative(route);
+        return route;
+    }
+
+    ROEdge* myA;
+    ROEdge* myB;
+    ROEdge* myC;
+    ROEdge* myD;
+    CountingRouter* myRouter;
+    RORouteDef* myRouteDef;
+    SUMOVTypeParameter myType;
+    ROVehicle* myVehicle;
+    RORoute* myDirect;
+    RORoute* myDetour;
+};
+
+
+/* Test that the cheapest alternative is reused without a search if the weights did not change. */
+TEST_F(RORouteDefTest, test_reuse_unchanged) {
+    EXPECT_DOUBLE_EQ(30., myDirect->getCosts());
+    EXPECT_DOUBLE_EQ(40., myDetour->getCosts());
+    EXPECT_EQ(myDirect, myRouteDef->buildCurrentRoute(*myRouter, 0, *myVehicle));
+    EXPECT_EQ(0, myRouter->myQueries);
+}
+
+
+/* Test that small changes of the weights within the tolerance still reuse the alternative. */
+TEST_F(RORouteDefTest, test_reuse_within_tolerance) {
+    myB->addTravelTime(11, 0, 3600);
+    EXPECT_EQ(myDirect, myRouteDef->buildCurrentRoute(*myRouter, 0, *myVehicle));
+    EXPECT_EQ(0, myRouter->myQueries);
+}
+
+
+/* Test that a route is searched if an alternative other than the cheapest one became cheaper. */
+TEST_F(RORouteDefTest, test_search_if_other_alternative_changed) {
+    myD->addTravelTime(5, 0, 3600);
+    EXPECT_EQ(myDetour, myRouteDef->buildCurrentRoute(*myRouter, 0, *myVehicle));
+    EXPECT_EQ(1, myRouter->myQueries);
+}
+
+
+/****************************************************************************/
+
@@ -0,0 +1,301 @@
+/****************************************************************************/
+/// @file    ActiveSetTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests ActiveSet class from <SUMO>/src/utils/common
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <list>
+#include <vector>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <utils/common/ActiveSet.h>
+#include <utils/common/SysUtils.h>
+
+
+// ===========================================================================
+// helper classes
+// ===========================================================================
+/* A minimal lane substitute having a numerical id and a vehicle number. */
+class ActiveSetTestLane {
+public:
+    ActiveSetTestLane(size_t id, bool haveNeighbors)
+        : myID(id), myHaveNeighbors(haveNeighbors), myVehicleNumber(0) {}
+
+    size_t getNumericalID() const {
+        return myID;
+    }
+
+    size_t myID;
+    bool myHaveNeighbors;
+    unsigned int myVehicleNumber;
+};
+
+
+/* Builds the lanes of a grid network with the given number of lanes.
+ * Every second edge has two lanes (which therefore have neighbors). */
+void
+buildGridLanes(size_t numLanes, std::vector<ActiveSetTestLane*>& into) {
+    size_t edge = 0;
+    while (into.size() < numLanes) {
+        if (edge % 2 == 0 && into.size() + 1 < numLanes) {
+            into.push_back(new ActiveSetTestLane(into.size(), true));
+            into.push_back(new ActiveSetTestLane(into.size(), true));
+        } else {
+            into.push_back(new ActiveSetTestLane(into.size(), false));
+        }
+        edge++;
+    }
+}
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests the iteration order which has to match a list using push_front / push_back. */
+TEST(ActiveSet, test_order) {
+    std::vector<ActiveSetTestLane*> lanes;
+    buildGridLanes(10, lanes);
+    ActiveSet<ActiveSetTestLane> set(lanes.size());
+    std::list<ActiveSetTestLane*> list;
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        if (lanes[i]->myHaveNeighbors) {
+            EXPECT_TRUE(set.pushFront(lanes[i]));
+            list.push_front(lanes[i]);
+        } else {
+            EXPECT_TRUE(set.pushBack(lanes[i]));
+            list.push_back(lanes[i]);
+        }
+    }
+    EXPECT_EQ(list.size(), set.size());
+    size_t i = 0;
+    for (std::list<ActiveSetTestLane*>::iterator it = list.begin(); it != list.end(); ++it, ++i) {
+        EXPECT_EQ(*it, set[i]);
+        EXPECT_TRUE(set.contains(*it));
+    }
+    for (i = 0; i < lanes.size(); ++i) {
+        delete lanes[i];
+    }
+}
+
+
+/* Tests that adding a contained object is refused. */
+TEST(ActiveSet, test_double_add) {
+    ActiveSetTestLane a(0, true);
+    ActiveSetTestLane b(1, false);
+    ActiveSet<ActiveSetTestLane> set(2);
+    EXPECT_FALSE(set.contains(&a));
+    EXPECT_TRUE(set.pushFront(&a));
+    EXPECT_FALSE(set.pushFront(&a));
+    EXPECT_FALSE(set.pushBack(&a));
+    EXPECT_TRUE(set.pushBack(&b));
+    EXPECT_FALSE(set.pushFront(&b));
+    EXPECT_EQ(2, (int)set.size());
+    EXPECT_EQ(1, (int)set.frontSize());
+}
+
+
+/* Tests removing while iterating and the order after compaction. */
+TEST(ActiveSet, test_remove_compact) {
+    std::vector<ActiveSetTestLane*> lanes;
+    buildGridLanes(10, lanes);
+    ActiveSet<ActiveSetTestLane> set(lanes.size());
+    std::list<ActiveSetTestLane*> list;
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        if (lanes[i]->myHaveNeighbors) {
+            set.pushFront(lanes[i]);
+            list.push_front(lanes[i]);
+        } else {
+            set.pushBack(lanes[i]);
+            list.push_back(lanes[i]);
+        }
+    }
+    // remove every third object
+    ActiveSetTestLane* const first = list.front();
+    size_t i = 0;
+    for (std::list<ActiveSetTestLane*>::iterator it = list.begin(); it != list.end(); ++i) {
+        EXPECT_EQ(*it, set[i]);
+        if (i % 3 == 0) {
+            set.remove(*it);
+            EXPECT_FALSE(set.contains(*it));
+            it = list.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    EXPECT_EQ(lanes.size(), set.size());
+    set.compact();
+    EXPECT_EQ(list.size(), set.size());
+    i = 0;
+    for (std::list<ActiveSetTestLane*>::iterator it = list.begin(); it != list.end(); ++it, ++i) {
+        EXPECT_EQ(*it, set[i]);
+    }
+    // re-adding after compaction
+    EXPECT_TRUE(set.pushFront(first));
+    list.push_front(first);
+    EXPECT_EQ(first, set[0]);
+    EXPECT_EQ(list.size(), set.size());
+    for (i = 0; i < lanes.size(); ++i) {
+        delete lanes[i];
+    }
+}
+
+
+/* Tests removing every object while iterating, as done when all lanes become empty. */
+TEST(ActiveSet, test_remove_all_during_iteration) {
+    std::vector<ActiveSetTestLane*> lanes;
+    buildGridLanes(7, lanes);
+    ActiveSet<ActiveSetTestLane> set(lanes.size());
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        lanes[i]->myHaveNeighbors ? set.pushFront(lanes[i]) : set.pushBack(lanes[i]);
+    }
+    size_t visited = 0;
+    for (size_t i = 0; i < set.size(); ++i) {
+        set.remove(set[i]);
+        ++visited;
+    }
+    EXPECT_EQ(lanes.size(), visited);
+    set.compact();
+    EXPECT_EQ(0, (int)set.size());
+    EXPECT_EQ(0, (int)set.frontSize());
+    // a second compaction does not change anything
+    set.compact();
+    EXPECT_EQ(0, (int)set.size());
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        EXPECT_FALSE(set.contains(lanes[i]));
+    }
+    // all objects may be added again
+    EXPECT_TRUE(set.pushBack(lanes[1]));
+    EXPECT_TRUE(set.pushFront(lanes[0]));
+    EXPECT_EQ(lanes[0], set[0]);
+    EXPECT_EQ(lanes[1], set[1]);
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        delete lanes[i];
+    }
+}
+
+
+/* Tests removing objects which were not visited yet by the current iteration. */
+TEST(ActiveSet, test_remove_ahead_during_iteration) {
+    std::vector<ActiveSetTestLane*> lanes;
+    buildGridLanes(9, lanes);
+    ActiveSet<ActiveSetTestLane> set(lanes.size());
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        set.pushBack(lanes[i]);
+    }
+    // each visited object removes its successor, the last one removes the first
+    std::vector<ActiveSetTestLane*> visited;
+    for (size_t i = 0; i < set.size(); ++i) {
+        ActiveSetTestLane* const l = set[i];
+        // removed objects are still returned until compaction
+        EXPECT_EQ(lanes[i], l);
+        if (!set.contains(l)) {
+            continue;
+        }
+        visited.push_back(l);
+        set.remove(set[(i + 1) % set.size()]);
+    }
+    EXPECT_EQ(lanes.size(), set.size());
+    set.compact();
+    ASSERT_EQ(visited.size() - 1, set.size());
+    // the first object was removed by the last visited one
+    EXPECT_FALSE(set.contains(lanes[0]));
+    for (size_t i = 0; i < set.size(); ++i) {
+        EXPECT_EQ(visited[i + 1], set[i]);
+        EXPECT_TRUE(set.contains(set[i]));
+    }
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        delete lanes[i];
+    }
+}
+
+
+/* Compares the active set against a list on a grid network with 100k lanes.
+ * Half of the lanes get occupied, in each step a fraction is deactivated and
+ * reactivated. Run with --gtest_also_run_disabled_tests. */
+TEST(ActiveSet, DISABLED_benchmark_grid_100k) {
+    const size_t numLanes = 100000;
+    const int steps = 1000;
+    std::vector<ActiveSetTestLane*> lanes;
+    buildGridLanes(numLanes, lanes);
+    for (size_t i = 0; i < lanes.size(); i += 2) {
+        lanes[i]->myVehicleNumber = 1;
+    }
+    // the list implementation as used by MSEdgeControl before
+    std::vector<bool> active(numLanes, false);
+    std::list<ActiveSetTestLane*> list;
+    long sumList = 0;
+    long begin = SysUtils::getCurrentMillis();
+    for (int step = 0; step < steps; ++step) {
+        for (size_t i = 0; i < lanes.size(); ++i) {
+            ActiveSetTestLane* const l = lanes[i];
+            if (l->myVehicleNumber > 0 && !active[i]) {
+                l->myHaveNeighbors ? list.push_front(l) : list.push_back(l);
+                active[i] = true;
+            }
+        }
+        for (std::list<ActiveSetTestLane*>::iterator it = list.begin(); it != list.end();) {
+            sumList += (long)(*it)->myID;
+            if (((*it)->myID + step) % 16 == 0) {
+                active[(*it)->myID] = false;
+                it = list.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    const long durationList = SysUtils::getCurrentMillis() - begin;
+    // the active set
+    ActiveSet<ActiveSetTestLane> set(numLanes);
+    long sumSet = 0;
+    begin = SysUtils::getCurrentMillis();
+    for (int step = 0; step < steps; ++step) {
+        for (size_t i = 0; i < lanes.size(); ++i) {
+            ActiveSetTestLane* const l = lanes[i];
+            if (l->myVehicleNumber > 0) {
+                l->myHaveNeighbors ? set.pushFront(l) : set.pushBack(l);
+            }
+        }
+        for (size_t i = 0; i < set.size(); ++i) {
+            ActiveSetTestLane* const l = set[i];
+            sumSet += (long)l->myID;
+            if ((l->myID + step) % 16 == 0) {
+                set.remove(l);
+            }
+        }
+        set.compact();
+    }
+    const long durationSet = SysUtils::getCurrentMillis() - begin;
+    EXPECT_EQ(sumList, sumSet);
+    std::cout << "list: " << durationList << "ms, active set: " << durationSet << "ms (" << numLanes << " lanes, " << steps << " steps)" << std::endl;
+    for (size_t i = 0; i < lanes.size(); ++i) {
+        delete lanes[i];
+    }
+}
+
+
+/****************************************************************************/
+
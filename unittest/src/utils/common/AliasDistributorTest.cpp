@@ -0,0 +1,93 @@
+/****************************************************************************/
+/// @file    AliasDistributorTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests AliasDistributor class from <SUMO>/src/utils/common
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <map>
+#include <gtest/gtest.h>
+#include <utils/common/AliasDistributor.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests that the members are drawn according to their probabilities. */
+TEST(AliasDistributor, test_frequencies) {
+    RandomDistributor<char> dist;
+    dist.add(1, 'a');
+    dist.add(2, 'b');
+    dist.add(0, 'c');
+    dist.add(5, 'd');
+    AliasDistributor<char> table(dist);
+    EXPECT_DOUBLE_EQ(8., table.getOverallProb());
+    MTRand rng(42);
+    std::map<char, int> counts;
+    for (int i = 0; i < 80000; i++) {
+        counts[table.get(&rng)]++;
+    }
+    EXPECT_EQ(0, counts['c']);
+    EXPECT_NEAR(10000, counts['a'], 500);
+    EXPECT_NEAR(20000, counts['b'], 500);
+    EXPECT_NEAR(50000, counts['d'], 500);
+}
+
+
+/* Tests that the same seed draws the same members. */
+TEST(AliasDistributor, test_seeded) {
+    std::vector<SUMOReal> probs;
+    std::vector<int> vals;
+    for (int i = 0; i < 10; i++) {
+        probs.push_back((SUMOReal) i);
+        vals.push_back(i);
+    }
+    AliasDistributor<int> table;
+    table.build(probs, vals);
+    MTRand rng1(7);
+    MTRand rng2(7);
+    for (int i = 0; i < 100; i++) {
+        const int val = table.get(&rng1);
+        EXPECT_EQ(val, table.get(&rng2));
+        EXPECT_NE(0, val);
+    }
+}
+
+
+/* Tests the distributions without members or probabilities. */
+TEST(AliasDistributor, test_empty) {
+    AliasDistributor<int> table;
+    EXPECT_EQ(0, table.getOverallProb());
+    EXPECT_THROW(table.get(), OutOfBoundsException);
+    RandomDistributor<int> dist;
+    dist.add(0, 1);
+    AliasDistributor<int> zero(dist);
+    EXPECT_EQ(0, zero.getOverallProb());
+    EXPECT_THROW(zero.get(), OutOfBoundsException);
+    RandomDistributor<int> single;
+    single.add(3, 5);
+    EXPECT_EQ(5, AliasDistributor<int>(single).get());
+}
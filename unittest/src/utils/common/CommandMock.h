@@ -24,7 +24,7 @@ public:
 	/** @brief Executes the command.*/
     SUMOTime execute(SUMOTime currentTime) throw(ProcessError) {
 		hasRun = true;
-		return currentTime;
+		return 0;
 	} 
 
 	/** return true, when execute was called, otherwise false */
@@ -0,0 +1,206 @@
+/****************************************************************************/
+/// @file    IDHandleMapTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests IDHandleMap class from <SUMO>/src/utils/common
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <gtest/gtest.h>
+#include <utils/common/IDHandleMap.h>
+#include <utils/common/ToString.h>
+#include <utils/common/SysUtils.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests insertion, lookup and the rejection of duplicate ids. */
+TEST(IDHandleMap, test_insert_find) {
+    IDHandleMap<int> map;
+    const IDHandleMap<int>::Handle h0 = map.insert("veh0", 10);
+    const IDHandleMap<int>::Handle h1 = map.insert("veh1", 11);
+    EXPECT_EQ(0u, h0);
+    EXPECT_EQ(1u, h1);
+    EXPECT_EQ(IDHandleMap<int>::INVALID_HANDLE, map.insert("veh0", 12));
+    EXPECT_EQ(h1, map.find("veh1"));
+    EXPECT_EQ(IDHandleMap<int>::INVALID_HANDLE, map.find("veh2"));
+    EXPECT_EQ(10, map.get(h0));
+    EXPECT_EQ("veh1", map.getID(h1));
+    EXPECT_EQ(2u, map.size());
+}
+
+
+/* Tests that the handles of removed entries are reused and skipped while iterating. */
+TEST(IDHandleMap, test_erase_reuse) {
+    IDHandleMap<int> map;
+    map.insert("a", 1);
+    map.insert("b", 2);
+    map.insert("c", 3);
+    EXPECT_TRUE(map.erase("b"));
+    EXPECT_FALSE(map.erase("b"));
+    EXPECT_EQ(IDHandleMap<int>::INVALID_HANDLE, map.find("b"));
+    std::string ids;
+    for (IDHandleMap<int>::const_iterator i = map.begin(); i != map.end(); ++i) {
+        ids += i->first;
+    }
+    EXPECT_EQ("ac", ids);
+    EXPECT_EQ(1u, map.insert("d", 4));
+    EXPECT_EQ(3u, map.handleCount());
+    EXPECT_EQ(4, map.get(map.find("d")));
+}
+
+
+/* Tests ids probing past a deleted slot, the reuse of that slot and the rejection of ids stored behind it. */
+TEST(IDHandleMap, test_collisions_deleted_slot) {
+    // find three ids starting their probe at the same slot of the initial table
+    std::vector<std::string> ids;
+    const unsigned int slot = IDHandleMap<int>::computeHash("veh0") & 15;
+    for (int i = 0; ids.size() < 3; ++i) {
+        const std::string id = "veh" + toString(i);
+        if ((IDHandleMap<int>::computeHash(id) & 15) == slot) {
+            ids.push_back(id);
+        }
+    }
+    IDHandleMap<int> map;
+    map.insert(ids[0], 0);
+    map.insert(ids[1], 1);
+    map.insert(ids[2], 2);
+    EXPECT_TRUE(map.erase(ids[1]));
+    // the entry behind the deleted slot is still found and can not be added twice
+    EXPECT_EQ(2, map.get(map.find(ids[2])));
+    EXPECT_EQ(IDHandleMap<int>::INVALID_HANDLE, map.insert(ids[2], 3));
+    EXPECT_EQ(IDHandleMap<int>::INVALID_HANDLE, map.find(ids[1]));
+    // the deleted slot and the handle are reused
+    EXPECT_EQ(1u, map.insert(ids[1], 4));
+    EXPECT_EQ(4, map.get(map.find(ids[1])));
+    EXPECT_EQ(2, map.get(map.find(ids[2])));
+    EXPECT_EQ(3u, map.size());
+}
+
+
+/* Tests that the table is rebuilt without the deleted markers if entries are replaced all the time. */
+TEST(IDHandleMap, test_rehash_deleted_slots) {
+    IDHandleMap<int> map;
+    // a few entries present at a time, so the table does not grow while the deleted markers fill it
+    for (int i = 0; i < 4; ++i) {
+        map.insert("veh" + toString(i), i);
+    }
+    for (int i = 4; i < 1000; ++i) {
+        const std::string removed = "veh" + toString(i - 4);
+        ASSERT_TRUE(map.erase(removed));
+        const IDHandleMap<int>::Handle h = map.insert("veh" + toString(i), i);
+        // the handle of the removed entry is reused
+        EXPECT_GT(4u, h);
+        EXPECT_EQ(IDHandleMap<int>::INVALID_HANDLE, map.find(removed));
+        for (int j = i - 3; j <= i; ++j) {
+            const IDHandleMap<int>::Handle found = map.find("veh" + toString(j));
+            ASSERT_NE(IDHandleMap<int>::INVALID_HANDLE, found);
+            EXPECT_EQ(j, map.get(found));
+        }
+    }
+    EXPECT_EQ(4u, map.size());
+    EXPECT_EQ(4u, map.handleCount());
+}
+
+
+/* Compares random insertions and deletions (including table growth and deleted markers) against a std::map. */
+TEST(IDHandleMap, test_against_map) {
+    IDHandleMap<int> map;
+    std::map<std::string, int> reference;
+    srand(42);
+    for (int i = 0; i < 100000; ++i) {
+        const std::string id = "veh" + toString(rand() % 3000);
+        if (rand() % 3 != 0) {
+            const bool added = map.insert(id, i) != IDHandleMap<int>::INVALID_HANDLE;
+            EXPECT_EQ(reference.insert(std::make_pair(id, i)).second, added);
+        } else {
+            EXPECT_EQ(reference.erase(id) == 1, map.erase(id));
+        }
+        const IDHandleMap<int>::Handle h = map.find(id);
+        ASSERT_EQ(reference.count(id) == 1, h != IDHandleMap<int>::INVALID_HANDLE);
+        if (h != IDHandleMap<int>::INVALID_HANDLE) {
+            EXPECT_EQ(reference[id], map.get(h));
+        }
+    }
+    EXPECT_EQ(reference.size(), map.size());
+    size_t num = 0;
+    for (IDHandleMap<int>::const_iterator i = map.begin(); i != map.end(); ++i) {
+        EXPECT_EQ(reference[i->first], i->second);
+        num++;
+    }
+    EXPECT_EQ(reference.size(), num);
+}
+
+
+/* Compares the map with a std::map for a vehicle-like workload: 1M vehicles
+ * are added and removed with 100k present at a time, each one looked up
+ * ten times. Run with --gtest_also_run_disabled_tests. */
+TEST(IDHandleMap, DISABLED_benchmark_vehicles) {
+    const int numVehicles = 1000000;
+    const int numPresent = 100000;
+    const int lookups = 10;
+    std::vector<std::string> ids;
+    for (int i = 0; i < numVehicles; ++i) {
+        ids.push_back("flow_" + toString(i % 100) + "." + toString(i));
+    }
+    long sum = 0;
+    long begin = SysUtils::getCurrentMillis();
+    std::map<std::string, int> map;
+    for (int i = 0; i < numVehicles; ++i) {
+        map[ids[i]] = i;
+        for (int j = 0; j < lookups; ++j) {
+            sum += map.find(ids[i - (j * 7919) % (MIN2(i, numPresent - 1) + 1)])->second;
+        }
+        if (i >= numPresent) {
+            map.erase(ids[i - numPresent]);
+        }
+    }
+    const long durationMap = SysUtils::getCurrentMillis() - begin;
+    begin = SysUtils::getCurrentMillis();
+    IDHandleMap<int> hashMap;
+    for (int i = 0; i < numVehicles; ++i) {
+        hashMap.insert(ids[i], i);
+        for (int j = 0; j < lookups; ++j) {
+            sum -= hashMap.get(hashMap.find(ids[i - (j * 7919) % (MIN2(i, numPresent - 1) + 1)]));
+        }
+        if (i >= numPresent) {
+            hashMap.erase(ids[i - numPresent]);
+        }
+    }
+    const long durationHash = SysUtils::getCurrentMillis() - begin;
+    EXPECT_EQ(0, sum);
+    EXPECT_EQ(numPresent, (int) hashMap.size());
+    std::cout << "std::map: " << durationMap << "ms, IDHandleMap: " << durationHash << "ms, handles: " << hashMap.handleCount() << std::endl;
+}
+
+
+/****************************************************************************/
+
@@ -0,0 +1,138 @@
+/****************************************************************************/
+/// @file    IndexedHeapTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests IndexedHeap class from <SUMO>/src/utils/common
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+#include <utils/common/IndexedHeap.h>
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+struct HeapItem {
+    HeapItem(int id_, int key_) : id(id_), key(key_), heapIndex(-1) {}
+    int id;
+    int key;
+    int heapIndex;
+};
+
+/* Removes the item with the smaller key first, breaks ties by the id (like the routers) */
+struct HeapItemComparator {
+    bool operator()(const HeapItem* a, const HeapItem* b) const {
+        if (a->key == b->key) {
+            return a->id > b->id;
+        }
+        return a->key > b->key;
+    }
+};
+
+typedef IndexedHeap<HeapItem, HeapItemComparator> ItemHeap;
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Test that the items are removed in the order of their keys and that the positions are kept up to date. */
+TEST(IndexedHeap, test_order) {
+    std::vector<HeapItem> items;
+    srand(42);
+    for (int i = 0; i < 1000; ++i) {
+        items.push_back(HeapItem(i, rand() % 100));
+    }
+    ItemHeap heap;
+    for (std::vector<HeapItem>::iterator i = items.begin(); i != items.end(); ++i) {
+        heap.push(&*i);
+    }
+    EXPECT_EQ(1000u, heap.size());
+    for (ItemHeap::const_iterator i = heap.begin(); i != heap.end(); ++i) {
+        EXPECT_EQ(i - heap.begin(), (*i)->heapIndex);
+    }
+    HeapItemComparator comp;
+    HeapItem* last = heap.top();
+    heap.pop();
+    EXPECT_EQ(-1, last->heapIndex);
+    while (!heap.empty()) {
+        HeapItem* const next = heap.top();
+        EXPECT_TRUE(comp(next, last));
+        heap.pop();
+        last = next;
+    }
+}
+
+
+/* Test decreasing the keys of items within the heap. */
+TEST(IndexedHeap, test_update) {
+    std::vector<HeapItem> items;
+    for (int i = 0; i < 100; ++i) {
+        items.push_back(HeapItem(i, 1000 + i));
+    }
+    ItemHeap heap;
+    for (std::vector<HeapItem>::iterator i = items.begin(); i != items.end(); ++i) {
+        heap.push(&*i);
+    }
+    EXPECT_EQ(0, heap.top()->id);
+    items[77].key = 5;
+    heap.update(&items[77]);
+    items[33].key = 5;
+    heap.update(&items[33]);
+    items[50].key = 999;
+    heap.update(&items[50]);
+    EXPECT_EQ(33, heap.top()->id);
+    heap.pop();
+    EXPECT_EQ(77, heap.top()->id);
+    heap.pop();
+    EXPECT_EQ(50, heap.top()->id);
+    heap.pop();
+    EXPECT_EQ(0, heap.top()->id);
+    EXPECT_EQ(97u, heap.size());
+}
+
+
+/* Test that clearing the heap resets the positions. */
+TEST(IndexedHeap, test_clear) {
+    HeapItem a(0, 3);
+    HeapItem b(1, 2);
+    ItemHeap heap;
+    heap.push(&a);
+    heap.push(&b);
+    EXPECT_EQ(0, b.heapIndex);
+    EXPECT_EQ(1, a.heapIndex);
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_EQ(-1, a.heapIndex);
+    EXPECT_EQ(-1, b.heapIndex);
+    heap.push(&a);
+    EXPECT_EQ(&a, heap.top());
+}
+
+
+/****************************************************************************/
+
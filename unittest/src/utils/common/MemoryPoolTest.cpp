@@ -0,0 +1,132 @@
+/****************************************************************************/
+/// @file    MemoryPoolTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests MemoryPool class from <SUMO>/src/utils/common
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <algorithm>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+#include <utils/common/MemoryPool.h>
+#include <utils/common/SUMOVehicleParameter.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Test that given back blocks are reused and the counters are updated. */
+TEST(MemoryPool, test_reuse) {
+    MemoryPool pool("test", 4);
+    void* a = pool.allocate(40);
+    void* b = pool.allocate(40);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(2u, pool.getInUseNo());
+    pool.deallocate(a, 40);
+    EXPECT_EQ(1u, pool.getInUseNo());
+    void* c = pool.allocate(40);
+    EXPECT_EQ(a, c);
+    EXPECT_EQ(3ul, pool.getAllocationNo());
+    EXPECT_EQ(1ul, pool.getReuseNo());
+    EXPECT_EQ(2u, pool.getMaxInUseNo());
+    pool.deallocate(b, 40);
+    pool.deallocate(c, 40);
+    pool.deallocate(0, 40);
+    EXPECT_EQ(0u, pool.getInUseNo());
+}
+
+
+/* Test that blocks of different sizes do not overlap and are aligned. */
+TEST(MemoryPool, test_sizes) {
+    MemoryPool pool("test", 3);
+    std::vector<std::pair<char*, size_t> > blocks;
+    for (size_t i = 0; i < 50; ++i) {
+        const size_t size = 8 + (i % 5) * 24;
+        char* block = static_cast<char*>(pool.allocate(size));
+        EXPECT_EQ(0u, reinterpret_cast<size_t>(block) % sizeof(void*));
+        std::fill(block, block + size, (char) i);
+        blocks.push_back(std::make_pair(block, size));
+    }
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        for (size_t j = 0; j < blocks[i].second; ++j) {
+            EXPECT_EQ((char) i, blocks[i].first[j]);
+        }
+        pool.deallocate(blocks[i].first, blocks[i].second);
+    }
+    EXPECT_EQ(0u, pool.getInUseNo());
+    EXPECT_GE(pool.getReservedBytes(), 50u * 8);
+}
+
+
+/* Test that the pools are registered and pooled classes use their pool. */
+TEST(MemoryPool, test_registry) {
+    size_t before = MemoryPool::getPools().size();
+    {
+        MemoryPool pool("test");
+        EXPECT_EQ(before + 1, MemoryPool::getPools().size());
+        EXPECT_EQ(&pool, MemoryPool::getPools().back());
+    }
+    EXPECT_EQ(before, MemoryPool::getPools().size());
+#ifndef CHECK_MEMORY_LEAKS
+    const MemoryPool* parameterPool = 0;
+    SUMOVehicleParameter* pars = new SUMOVehicleParameter();
+    for (std::vector<MemoryPool*>::const_iterator i = MemoryPool::getPools().begin(); i != MemoryPool::getPools().end(); ++i) {
+        if ((*i)->getName() == "vehicle parameter") {
+            parameterPool = *i;
+        }
+    }
+    ASSERT_TRUE(parameterPool != 0);
+    const unsigned long allocations = parameterPool->getAllocationNo();
+    delete pars;
+    pars = new SUMOVehicleParameter();
+    EXPECT_EQ(allocations + 1, parameterPool->getAllocationNo());
+    EXPECT_LE(1ul, parameterPool->getReuseNo());
+    delete pars;
+#endif
+}
+
+
+/* Test that a released pool is deleted when the last block is given back. */
+TEST(MemoryPool, test_release) {
+    size_t before = MemoryPool::getPools().size();
+    MemoryPool* pool = new MemoryPool("test", 4);
+    void* a = pool->allocate(40);
+    void* b = pool->allocate(24);
+    pool->release();
+    EXPECT_EQ(before + 1, MemoryPool::getPools().size());
+    pool->deallocate(a, 40);
+    EXPECT_EQ(before + 1, MemoryPool::getPools().size());
+    pool->deallocate(b, 24);
+    EXPECT_EQ(before, MemoryPool::getPools().size());
+    pool = new MemoryPool("test", 4);
+    pool->release();
+    EXPECT_EQ(before, MemoryPool::getPools().size());
+}
+
+
+/****************************************************************************/
+
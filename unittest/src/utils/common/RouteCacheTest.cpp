@@ -0,0 +1,216 @@
+/****************************************************************************/
+/// @file    RouteCacheTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests RouteCache class from <SUMO>/src/utils/common
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <vector>
+#include <gtest/gtest.h>
+#include <utils/common/RouteCache.h>
+
+
+// ===========================================================================
+// helper classes and functions
+// ===========================================================================
+class CacheEdge {
+public:
+    CacheEdge(int id) : myID(id) {}
+    int getNumericalID() const {
+        return myID;
+    }
+private:
+    int myID;
+};
+
+typedef RouteCache<CacheEdge, int> IntRouteCache;
+
+/// @brief the values released by the cache
+std::vector<int> releasedValues;
+
+void releaseValue(int value) {
+    releasedValues.push_back(value);
+}
+
+
+class RouteCacheTest : public testing::Test {
+protected:
+    virtual void SetUp() {
+        releasedValues.clear();
+        for (int i = 0; i < 10; i++) {
+            edges.push_back(new CacheEdge(i));
+        }
+    }
+
+    virtual void TearDown() {
+        for (std::vector<CacheEdge*>::iterator i = edges.begin(); i != edges.end(); ++i) {
+            delete *i;
+        }
+    }
+
+    IntRouteCache::Key key(int from, int to, int vClass = 0, unsigned int epoch = 0) {
+        IntRouteCache::Key k;
+        k.from = edges[from];
+        k.to = edges[to];
+        k.vClass = vClass;
+        k.epoch = epoch;
+        return k;
+    }
+
+    /// @brief the route over the edges from "from" to "to"
+    std::vector<const CacheEdge*> route(int from, int to) {
+        std::vector<const CacheEdge*> ret;
+        for (int i = from; i <= to; i++) {
+            ret.push_back(edges[i]);
+        }
+        return ret;
+    }
+
+    std::vector<CacheEdge*> edges;
+};
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests lookups with all parts of the key and the counters. */
+TEST_F(RouteCacheTest, test_get_insert) {
+    IntRouteCache cache(1 << 20, &releaseValue);
+    int value = -1;
+    EXPECT_FALSE(cache.get(key(0, 3), value));
+    cache.insert(key(0, 3), 1, route(0, 3));
+    cache.insert(key(0, 3, 1), 2, route(0, 3));
+    EXPECT_TRUE(cache.get(key(0, 3), value));
+    EXPECT_EQ(1, value);
+    EXPECT_TRUE(cache.get(key(0, 3, 1), value));
+    EXPECT_EQ(2, value);
+    EXPECT_FALSE(cache.get(key(0, 4), value));
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_EQ(2ul, cache.getHitNo());
+    EXPECT_EQ(2ul, cache.getMissNo());
+    // replacing releases the old value
+    cache.insert(key(0, 3), 3, route(0, 3));
+    ASSERT_EQ(1u, releasedValues.size());
+    EXPECT_EQ(1, releasedValues[0]);
+    EXPECT_TRUE(cache.get(key(0, 3), value));
+    EXPECT_EQ(3, value);
+    EXPECT_EQ(2u, cache.size());
+}
+
+
+/* Tests that the least recently used routes are evicted to keep the budget. */
+TEST_F(RouteCacheTest, test_eviction) {
+    IntRouteCache cache(3 * IntRouteCache::computeMemory(2), &releaseValue);
+    cache.insert(key(0, 1), 1, route(0, 1));
+    cache.insert(key(1, 2), 2, route(1, 2));
+    cache.insert(key(2, 3), 3, route(2, 3));
+    int value;
+    // makes the first route the most recently used one
+    EXPECT_TRUE(cache.get(key(0, 1), value));
+    cache.insert(key(3, 4), 4, route(3, 4));
+    EXPECT_EQ(3u, cache.size());
+    EXPECT_EQ(1ul, cache.getEvictedNo());
+    ASSERT_EQ(1u, releasedValues.size());
+    EXPECT_EQ(2, releasedValues[0]);
+    EXPECT_FALSE(cache.get(key(1, 2), value));
+    EXPECT_TRUE(cache.get(key(0, 1), value));
+    EXPECT_LE(cache.getMemory(), 3 * IntRouteCache::computeMemory(2));
+    // a route larger than the budget is not stored
+    std::vector<const CacheEdge*> loop;
+    for (int i = 0; i < 10; i++) {
+        std::vector<const CacheEdge*> r = route(0, 9);
+        loop.insert(loop.end(), r.begin(), r.end());
+    }
+    ASSERT_GT(IntRouteCache::computeMemory(loop.size()), 3 * IntRouteCache::computeMemory(2));
+    cache.insert(key(0, 9), 5, loop);
+    EXPECT_FALSE(cache.get(key(0, 9), value));
+    EXPECT_EQ(3u, cache.size());
+    EXPECT_EQ(5, releasedValues.back());
+}
+
+
+/* Tests the removal of the routes containing an edge. */
+TEST_F(RouteCacheTest, test_invalidate) {
+    IntRouteCache cache(1 << 20, &releaseValue);
+    cache.insert(key(0, 3), 1, route(0, 3));
+    cache.insert(key(2, 5), 2, route(2, 5));
+    cache.insert(key(4, 6), 3, route(4, 6));
+    EXPECT_EQ(2u, cache.invalidate(edges[3]));
+    EXPECT_EQ(1u, cache.size());
+    EXPECT_EQ(2ul, cache.getInvalidatedNo());
+    int value;
+    EXPECT_FALSE(cache.get(key(0, 3), value));
+    EXPECT_TRUE(cache.get(key(4, 6), value));
+    EXPECT_EQ(0u, cache.invalidate(edges[3]));
+    EXPECT_EQ(0u, cache.invalidate(edges[9]));
+    // a reused entry is not removed by the references of its former route
+    cache.insert(key(7, 9), 4, route(7, 9));
+    EXPECT_EQ(0u, cache.invalidate(edges[0]));
+    EXPECT_TRUE(cache.get(key(7, 9), value));
+    EXPECT_EQ(1u, cache.invalidate(edges[8]));
+    cache.clear();
+    EXPECT_EQ(0u, cache.size());
+    EXPECT_EQ(0u, cache.getMemory());
+    EXPECT_EQ(4u, releasedValues.size());
+}
+
+
+/* Tests that the routes of older epochs are not found and evicted first. */
+TEST_F(RouteCacheTest, test_epoch) {
+    IntRouteCache cache(2 * IntRouteCache::computeMemory(4), &releaseValue);
+    cache.insert(key(0, 3, 0, 0), 1, route(0, 3));
+    int value;
+    EXPECT_FALSE(cache.get(key(0, 3, 0, 1), value));
+    cache.insert(key(0, 3, 0, 1), 2, route(0, 3));
+    EXPECT_EQ(2u, cache.size());
+    EXPECT_TRUE(cache.get(key(0, 3, 0, 1), value));
+    EXPECT_EQ(2, value);
+    // the route of the old epoch is the least recently used one
+    cache.insert(key(1, 4, 0, 1), 3, route(1, 4));
+    EXPECT_EQ(2u, cache.size());
+    ASSERT_EQ(1u, releasedValues.size());
+    EXPECT_EQ(1, releasedValues[0]);
+    EXPECT_FALSE(cache.get(key(0, 3, 0, 0), value));
+}
+
+
+/* Tests many insertions with a small budget against the counters. */
+TEST_F(RouteCacheTest, test_many_insertions) {
+    IntRouteCache cache(50 * IntRouteCache::computeMemory(1), &releaseValue);
+    int value;
+    for (int i = 0; i < 10000; i++) {
+        const int from = i % 10;
+        const int to = from;
+        if (!cache.get(key(from, to, i / 100), value)) {
+            cache.insert(key(from, to, i / 100), i, route(from, to));
+        }
+    }
+    EXPECT_EQ(10000ul, cache.getHitNo() + cache.getMissNo());
+    EXPECT_EQ(1000ul, cache.getMissNo());
+    EXPECT_EQ(50u, cache.size());
+    EXPECT_EQ(950ul, cache.getEvictedNo());
+    EXPECT_EQ(950u, releasedValues.size());
+}
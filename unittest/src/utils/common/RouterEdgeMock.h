@@ -0,0 +1,235 @@
+/****************************************************************************/
+/// @file    RouterEdgeMock.h
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Mock edges and vehicles for testing the routers on a synthetic grid network
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+#ifndef RouterEdgeMock_h
+#define RouterEdgeMock_h
+
+#include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
+#include <utils/common/StdDefs.h>
+#include <utils/common/ToString.h>
+#include <utils/common/SUMOVehicleClass.h>
+#include <utils/common/ValueTimeLine.h>
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class RouterVehicleMock
+ * Mock vehicle for the router tests
+ */
+class RouterVehicleMock {
+public:
+    RouterVehicleMock(SUMOReal maxSpeed, SUMOVehicleClass vClass = SVC_PASSENGER)
+        : myMaxSpeed(maxSpeed), myVClass(vClass) {}
+
+    SUMOReal getMaxSpeed() const {
+        return myMaxSpeed;
+    }
+
+    SUMOVehicleClass getVClass() const {
+        return myVClass;
+    }
+
+private:
+    SUMOReal myMaxSpeed;
+    SUMOVehicleClass myVClass;
+};
+
+
+/**
+ * @class RouterEdgeMock
+ * Mock edge for the router tests
+ *
+ * The edges form a grid of nodes in a distance of 100m, each pair of
+ *  neighboring nodes being connected by an edge in both directions. The
+ *  edges are longer than the distance of their nodes by a pseudo random
+ *  factor between 1 and 1.5 and have one of three speeds, so that the
+ *  shortest paths differ from the straight line while the A* heuristic
+ *  stays admissible for vehicles driving at least 30m/s. Optionally, every
+ *  n-th row and column of the grid is an arterial road where all edges have
+ *  the maximum speed, which gives the network a hierarchy like a real one.
+ */
+class RouterEdgeMock {
+public:
+    RouterEdgeMock(unsigned int numericalID, SUMOReal fromX, SUMOReal fromY, SUMOReal toX, SUMOReal toY,
+                   SUMOReal length, SUMOReal speed)
+        : myNumericalID(numericalID), myID(toString(numericalID)),
+          myFromX(fromX), myFromY(fromY), myToX(toX), myToY(toY), myLength(length), mySpeed(speed),
+          myPermissions(~0), myMinTravelTime(std::numeric_limits<SUMOReal>::max()) {}
+
+    unsigned int getNumericalID() const {
+        return myNumericalID;
+    }
+
+    const std::string& getID() const {
+        return myID;
+    }
+
+    unsigned int getNoFollowing() const {
+        return (unsigned int) myFollowers.size();
+    }
+
+    const RouterEdgeMock* getFollower(unsigned int i) const {
+        return myFollowers[i];
+    }
+
+    SUMOReal getLength() const {
+        return myLength;
+    }
+
+    SUMOReal getSpeed() const {
+        return mySpeed;
+    }
+
+    /// @brief The straight line distance from the end of this edge to the begin of the other
+    SUMOReal getDistanceTo(const RouterEdgeMock* other) const {
+        const SUMOReal dx = myToX - other->myFromX;
+        const SUMOReal dy = myToY - other->myFromY;
+        return sqrt(dx * dx + dy * dy);
+    }
+
+    bool prohibits(const RouterVehicleMock* const veh) const {
+        return (myPermissions & veh->getVClass()) != veh->getVClass();
+    }
+
+    void setPermissions(SVCPermissions permissions) {
+        myPermissions = permissions;
+    }
+
+    /// @brief The travel time at the allowed speed (the free-flow travel time if no vehicle is given)
+    SUMOReal getTravelTime(const RouterVehicleMock* const veh, SUMOReal) const {
+        return veh == 0 ? myLength / mySpeed : myLength / MIN2(mySpeed, veh->getMaxSpeed());
+    }
+
+    /// @brief A lower bound of both travel times, regarding the loaded ones like ROEdge
+    SUMOReal getMinimumTravelTime(const RouterVehicleMock* const veh) const {
+        const SUMOReal ret = MIN2(myLength / mySpeed, myMinTravelTime);
+        return veh == 0 ? ret : MAX2(myLength / veh->getMaxSpeed(), ret);
+    }
+
+    /// @brief Adds a travel time to the time line used by getTimeLineTravelTime
+    void addTravelTime(SUMOReal value, SUMOReal timeBegin, SUMOReal timeEnd) {
+        myTravelTimes.add(timeBegin, timeEnd, value);
+        myMinTravelTime = MIN2(myMinTravelTime, value);
+    }
+
+    /// @brief Builds the dense table of the time line used by getTimeLineTravelTime
+    bool buildTravelTimeTable() {
+        return myTravelTimes.buildDenseTable();
+    }
+
+    /// @brief The travel time from the time line as looked up by the edges of the routers
+    SUMOReal getTimeLineTravelTime(const RouterVehicleMock* const veh, SUMOReal time) const {
+        if (!myTravelTimes.describesTime(time)) {
+            return getTravelTime(veh, time);
+        }
+        return MAX2(myLength / veh->getMaxSpeed(), myTravelTimes.getValue(time));
+    }
+
+    /// @brief An effort which is not the travel time
+    SUMOReal getLengthEffort(const RouterVehicleMock* const, SUMOReal) const {
+        return myLength;
+    }
+
+    static SUMOReal getTravelTimeStatic(const RouterEdgeMock* const edge, const RouterVehicleMock* const veh, SUMOReal time) {
+        return edge->getTravelTime(veh, time);
+    }
+
+    static RouterEdgeMock* dictionary(size_t numericalID) {
+        return getEdges()[numericalID];
+    }
+
+    static size_t dictSize() {
+        return getEdges().size();
+    }
+
+    /// @brief Builds a grid of the given size, replacing the existing edges
+    static void buildGrid(unsigned int width, unsigned int height, unsigned int seed, unsigned int arterialSpacing = 0) {
+        clear();
+        std::vector<RouterEdgeMock*>& edges = getEdges();
+        // outgoing edges per node
+        std::vector<std::vector<RouterEdgeMock*> > outgoing(width * height);
+        std::vector<unsigned int> toNode;
+        for (unsigned int y = 0; y < height; ++y) {
+            for (unsigned int x = 0; x < width; ++x) {
+                const int dx[] = {1, -1, 0, 0};
+                const int dy[] = {0, 0, 1, -1};
+                for (int d = 0; d < 4; ++d) {
+                    const int nx = (int) x + dx[d];
+                    const int ny = (int) y + dy[d];
+                    if (nx < 0 || ny < 0 || nx >= (int) width || ny >= (int) height) {
+                        continue;
+                    }
+                    seed = seed * 1103515245u + 12345u;
+                    const SUMOReal factor = 1. + (SUMOReal)((seed >> 16) % 500) / 1000.;
+                    SUMOReal speed = (SUMOReal)(10 * (1 + (seed >> 8) % 3));
+                    if (arterialSpacing > 0 && ((dy[d] == 0 && y % arterialSpacing == 0) || (dx[d] == 0 && x % arterialSpacing == 0))) {
+                        speed = 30;
+                    } else if (arterialSpacing > 0) {
+                        speed = MIN2(speed, (SUMOReal) 20);
+                    }
+                    RouterEdgeMock* edge = new RouterEdgeMock((unsigned int) edges.size(),
+                            (SUMOReal)(100 * x), (SUMOReal)(100 * y), (SUMOReal)(100 * nx), (SUMOReal)(100 * ny),
+                            100 * factor, speed);
+                    edges.push_back(edge);
+                    outgoing[y * width + x].push_back(edge);
+                    toNode.push_back(ny * width + nx);
+                }
+            }
+        }
+        for (size_t i = 0; i < edges.size(); ++i) {
+            edges[i]->myFollowers.assign(outgoing[toNode[i]].begin(), outgoing[toNode[i]].end());
+        }
+    }
+
+    static void clear() {
+        std::vector<RouterEdgeMock*>& edges = getEdges();
+        for (std::vector<RouterEdgeMock*>::iterator i = edges.begin(); i != edges.end(); ++i) {
+            delete *i;
+        }
+        edges.clear();
+    }
+
+private:
+    static std::vector<RouterEdgeMock*>& getEdges() {
+        static std::vector<RouterEdgeMock*> edges;
+        return edges;
+    }
+
+private:
+    unsigned int myNumericalID;
+    std::string myID;
+    SUMOReal myFromX, myFromY, myToX, myToY;
+    SUMOReal myLength;
+    SUMOReal mySpeed;
+    SVCPermissions myPermissions;
+    ValueTimeLine<SUMOReal> myTravelTimes;
+    SUMOReal myMinTravelTime;
+    std::vector<const RouterEdgeMock*> myFollowers;
+
+};
+
+
+#endif
+
+/****************************************************************************/
+
@@ -0,0 +1,648 @@
+/****************************************************************************/
+/// @file    RouterTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the router templates from <SUMO>/src/utils/common
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <set>
+#include <vector>
+#include <gtest/gtest.h>
+#include <utils/common/DijkstraRouterTT.h>
+#include <utils/common/DijkstraRouterEffort.h>
+#include <utils/common/AStarRouter.h>
+#include <utils/common/CHRouter.h>
+#include <utils/common/SysUtils.h>
+#include "RouterEdgeMock.h"
+
+
+// ===========================================================================
+// type definitions
+// ===========================================================================
+typedef prohibited_noRestrictions<RouterEdgeMock, RouterVehicleMock> NoRestrictions;
+typedef DijkstraRouterTT_Direct<RouterEdgeMock, RouterVehicleMock, NoRestrictions> TTRouter;
+typedef DijkstraRouterEffort_Direct<RouterEdgeMock, RouterVehicleMock, NoRestrictions> EffortRouter;
+typedef AStarRouterTT_Direct<RouterEdgeMock, RouterVehicleMock, NoRestrictions> AStarRouter;
+typedef AStarRouterEffort_Direct<RouterEdgeMock, RouterVehicleMock, NoRestrictions> AStarEffortRouter;
+typedef LandmarkLookupTable<RouterEdgeMock, RouterVehicleMock> Landmarks;
+typedef CHRouter_Direct<RouterEdgeMock, RouterVehicleMock, NoRestrictions> CHRouter;
+typedef prohibited_withRestrictions<RouterEdgeMock, RouterVehicleMock> WithRestrictions;
+typedef CHRouterWrapper<RouterEdgeMock, RouterVehicleMock, CHRouter_Direct<RouterEdgeMock, RouterVehicleMock, WithRestrictions> > CHWrapper;
+typedef std::vector<const RouterEdgeMock*> MockRoute;
+
+
+// ===========================================================================
+// class definitions
+// ===========================================================================
+/**
+ * @class LegacyRouter
+ * The Dijkstra router as it was before the indexed heap: a binary std heap
+ *  whose decrease-key searches the element linearly
+ */
+class LegacyRouter {
+public:
+    LegacyRouter() {
+        for (size_t i = 0; i < RouterEdgeMock::dictSize(); ++i) {
+            myInfos.push_back(Info(RouterEdgeMock::dictionary(i)));
+        }
+    }
+
+    void compute(const RouterEdgeMock* from, const RouterEdgeMock* to, const RouterVehicleMock* const veh, MockRoute& into) {
+        for (std::vector<Info>::iterator i = myInfos.begin(); i != myInfos.end(); ++i) {
+            (*i).traveltime = std::numeric_limits<SUMOReal>::max();
+            (*i).visited = false;
+        }
+        myFrontier.clear();
+        Info* const fromInfo = &myInfos[from->getNumericalID()];
+        fromInfo->traveltime = 0;
+        fromInfo->prev = 0;
+        myFrontier.push_back(fromInfo);
+        while (!myFrontier.empty()) {
+            Info* const minimumInfo = myFrontier.front();
+            std::pop_heap(myFrontier.begin(), myFrontier.end(), InfoComparator());
+            myFrontier.pop_back();
+            if (minimumInfo->edge == to) {
+                MockRoute tmp;
+                for (Info* i = minimumInfo; i != 0; i = i->prev) {
+                    tmp.push_back(i->edge);
+                }
+                into.insert(into.end(), tmp.rbegin(), tmp.rend());
+                return;
+            }
+            minimumInfo->visited = true;
+            const SUMOReal traveltime = minimumInfo->traveltime + minimumInfo->edge->getTravelTime(veh, 0);
+            for (unsigned int i = 0; i < minimumInfo->edge->getNoFollowing(); ++i) {
+                Info* const followerInfo = &myInfos[minimumInfo->edge->getFollower(i)->getNumericalID()];
+                const SUMOReal oldEffort = followerInfo->traveltime;
+                if (!followerInfo->visited && traveltime < oldEffort) {
+                    followerInfo->traveltime = traveltime;
+                    followerInfo->prev = minimumInfo;
+                    if (oldEffort == std::numeric_limits<SUMOReal>::max()) {
+                        myFrontier.push_back(followerInfo);
+                        std::push_heap(myFrontier.begin(), myFrontier.end(), InfoComparator());
+                    } else {
+                        std::push_heap(myFrontier.begin(), std::find(myFrontier.begin(), myFrontier.end(), followerInfo) + 1, InfoComparator());
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    struct Info {
+        Info(const RouterEdgeMock* e) : edge(e), traveltime(0), prev(0), visited(false) {}
+        const RouterEdgeMock* edge;
+        SUMOReal traveltime;
+        Info* prev;
+        bool visited;
+    };
+
+    struct InfoComparator {
+        bool operator()(const Info* nod1, const Info* nod2) const {
+            if (nod1->traveltime == nod2->traveltime) {
+                return nod1->edge->getNumericalID() > nod2->edge->getNumericalID();
+            }
+            return nod1->traveltime > nod2->traveltime;
+        }
+    };
+
+    std::vector<Info> myInfos;
+    std::vector<Info*> myFrontier;
+};
+
+
+/* Draws pseudo random origin destination pairs */
+static void
+buildQueries(size_t num, std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> >& into) {
+    srand(42);
+    const size_t numEdges = RouterEdgeMock::dictSize();
+    for (size_t i = 0; i < num; ++i) {
+        const RouterEdgeMock* from = RouterEdgeMock::dictionary(rand() % numEdges);
+        const RouterEdgeMock* to = RouterEdgeMock::dictionary(rand() % numEdges);
+        into.push_back(std::make_pair(from, to));
+    }
+}
+
+
+/* Checks that each edge of the route follows its predecessor */
+static bool
+isConnected(const MockRoute& route) {
+    for (size_t i = 1; i < route.size(); ++i) {
+        bool found = false;
+        for (unsigned int j = 0; j < route[i - 1]->getNoFollowing(); ++j) {
+            found |= route[i - 1]->getFollower(j) == route[i];
+        }
+        if (!found) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Test that the routers find the same routes as the router with the linear decrease-key. */
+TEST(Router, test_same_routes) {
+    RouterEdgeMock::buildGrid(12, 9, 7);
+    const RouterVehicleMock veh(30);
+    std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> > queries;
+    buildQueries(500, queries);
+    LegacyRouter legacy;
+    TTRouter tt(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    EffortRouter effort(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime, &RouterEdgeMock::getTravelTime);
+    AStarRouter astar(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        MockRoute expected, ttRoute, effortRoute, astarRoute;
+        legacy.compute(queries[i].first, queries[i].second, &veh, expected);
+        tt.compute(queries[i].first, queries[i].second, &veh, 0, ttRoute);
+        effort.compute(queries[i].first, queries[i].second, &veh, 0, effortRoute);
+        astar.compute(queries[i].first, queries[i].second, &veh, 0, astarRoute);
+        ASSERT_FALSE(expected.empty());
+        EXPECT_EQ(expected, ttRoute);
+        EXPECT_EQ(expected, effortRoute);
+        // A* may find another route of the same length
+        EXPECT_DOUBLE_EQ(tt.recomputeCosts(expected, &veh, 0), tt.recomputeCosts(astarRoute, &veh, 0));
+        EXPECT_EQ(queries[i].first, astarRoute.front());
+        EXPECT_EQ(queries[i].second, astarRoute.back());
+    }
+    RouterEdgeMock::clear();
+}
+
+
+/* Test that A* using landmarks finds routes as short as Dijkstra's and that the tables survive saving. */
+TEST(Router, test_landmarks) {
+    RouterEdgeMock::buildGrid(12, 9, 7, 4);
+    const RouterVehicleMock veh(30);
+    std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> > queries;
+    buildQueries(500, queries);
+    Landmarks landmarks(RouterEdgeMock::dictSize(), 6, &RouterEdgeMock::getMinimumTravelTime);
+    EXPECT_EQ(6u, landmarks.getLandmarks().size());
+    TTRouter tt(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    AStarRouter astar(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime, &landmarks);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        MockRoute expected, astarRoute;
+        tt.compute(queries[i].first, queries[i].second, &veh, 0, expected);
+        astar.compute(queries[i].first, queries[i].second, &veh, 0, astarRoute);
+        const SUMOReal costs = tt.recomputeCosts(expected, &veh, 0);
+        EXPECT_LE(landmarks.lowerBound(queries[i].first, queries[i].second), costs + 1e-6);
+        EXPECT_NEAR(costs, astar.recomputeCosts(astarRoute, &veh, 0), 1e-6);
+        EXPECT_TRUE(isConnected(astarRoute));
+    }
+    const std::string file = "landmarks_test.bin";
+    landmarks.save(file);
+    Landmarks loaded(RouterEdgeMock::dictSize(), file);
+    std::remove(file.c_str());
+    EXPECT_EQ(landmarks.getLandmarks(), loaded.getLandmarks());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_EQ(landmarks.lowerBound(queries[i].first, queries[i].second), loaded.lowerBound(queries[i].first, queries[i].second));
+    }
+    RouterEdgeMock::clear();
+}
+
+
+/* Test that A* using landmarks still finds the shortest routes if loaded travel times are below the free-flow ones. */
+TEST(Router, test_landmarks_loaded_weights) {
+    RouterEdgeMock::buildGrid(12, 9, 7, 4);
+    const RouterVehicleMock veh(30);
+    for (size_t i = 0; i < RouterEdgeMock::dictSize(); ++i) {
+        RouterEdgeMock* const edge = RouterEdgeMock::dictionary(i);
+        const SUMOReal freeFlow = edge->getLength() / edge->getSpeed();
+        if (i % 3 == 0) {
+            edge->addTravelTime(freeFlow / 3, 0, 3600);
+        } else if (i % 3 == 1) {
+            edge->addTravelTime(freeFlow * 2, 0, 3600);
+        }
+    }
+    std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> > queries;
+    buildQueries(500, queries);
+    Landmarks landmarks(RouterEdgeMock::dictSize(), 6, &RouterEdgeMock::getMinimumTravelTime);
+    TTRouter tt(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTimeLineTravelTime);
+    AStarRouter astar(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTimeLineTravelTime, &landmarks);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        MockRoute expected, astarRoute;
+        tt.compute(queries[i].first, queries[i].second, &veh, 0, expected);
+        astar.compute(queries[i].first, queries[i].second, &veh, 0, astarRoute);
+        const SUMOReal costs = tt.recomputeCosts(expected, &veh, 0);
+        EXPECT_LE(landmarks.lowerBound(queries[i].first, queries[i].second), costs + 1e-6);
+        EXPECT_NEAR(costs, tt.recomputeCosts(astarRoute, &veh, 0), 1e-6);
+    }
+    RouterEdgeMock::clear();
+}
+
+
+/* Test that landmark distances referring to unknown edges are refused. */
+TEST(Router, test_landmarks_corrupt) {
+    RouterEdgeMock::buildGrid(3, 3, 7);
+    const std::string file = "landmarks_corrupt.bin";
+    std::ofstream out(file.c_str(), std::ios::out | std::ios::binary);
+    FileHelpers::writeUInt(out, 1);
+    FileHelpers::writeUInt(out, (unsigned int) RouterEdgeMock::dictSize());
+    FileHelpers::writeUInt(out, 1);
+    for (size_t i = 0; i < RouterEdgeMock::dictSize(); ++i) {
+        FileHelpers::writeString(out, RouterEdgeMock::dictionary(i)->getID());
+    }
+    FileHelpers::writeUInt(out, (unsigned int) RouterEdgeMock::dictSize());
+    out.close();
+    EXPECT_THROW(Landmarks(RouterEdgeMock::dictSize(), file), ProcessError);
+    std::remove(file.c_str());
+    RouterEdgeMock::clear();
+}
+
+
+/* Test A* routing by an effort other than the travel time. */
+TEST(Router, test_astar_effort) {
+    RouterEdgeMock::buildGrid(12, 9, 7);
+    const RouterVehicleMock veh(30);
+    std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> > queries;
+    buildQueries(200, queries);
+    EffortRouter effort(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getLengthEffort, &RouterEdgeMock::getTravelTime);
+    AStarEffortRouter astar(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getLengthEffort, &RouterEdgeMock::getTravelTime);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        MockRoute expected, astarRoute;
+        effort.compute(queries[i].first, queries[i].second, &veh, 0, expected);
+        astar.compute(queries[i].first, queries[i].second, &veh, 0, astarRoute);
+        EXPECT_NEAR(effort.recomputeCosts(expected, &veh, 0), astar.recomputeCosts(astarRoute, &veh, 0), 1e-6);
+    }
+    RouterEdgeMock::clear();
+}
+
+
+/* Test that the contraction hierarchy finds routes as short as Dijkstra's. */
+TEST(Router, test_ch_routes) {
+    RouterEdgeMock::buildGrid(12, 9, 7);
+    const RouterVehicleMock veh(30);
+    std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> > queries;
+    buildQueries(500, queries);
+    TTRouter tt(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    CHRouter ch(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime, 0, SUMOTime_MAX);
+    for (size_t i = 0; i < queries.size(); ++i) {
+        MockRoute expected, chRoute;
+        tt.compute(queries[i].first, queries[i].second, &veh, 0, expected);
+        ch.compute(queries[i].first, queries[i].second, &veh, 0, chRoute);
+        ASSERT_FALSE(chRoute.empty());
+        EXPECT_EQ(queries[i].first, chRoute.front());
+        EXPECT_EQ(queries[i].second, chRoute.back());
+        EXPECT_TRUE(isConnected(chRoute));
+        EXPECT_NEAR(tt.recomputeCosts(expected, &veh, 0), ch.recomputeCosts(chRoute, &veh, 0), 1e-6);
+    }
+    EXPECT_GT(ch.getShortcutNo(), 0u);
+    RouterEdgeMock::clear();
+}
+
+
+/* Test the per class hierarchies and prohibited edges. */
+TEST(Router, test_ch_restrictions) {
+    RouterEdgeMock::buildGrid(12, 9, 7);
+    for (size_t i = 0; i < RouterEdgeMock::dictSize(); i += 3) {
+        RouterEdgeMock::dictionary(i)->setPermissions(SVC_PASSENGER);
+    }
+    const RouterVehicleMock car(30, SVC_PASSENGER);
+    const RouterVehicleMock bus(30, SVC_BUS);
+    std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> > queries;
+    buildQueries(200, queries);
+    DijkstraRouterTT_Direct<RouterEdgeMock, RouterVehicleMock, WithRestrictions> tt(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    CHWrapper ch(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime, 0, SUMOTime_MAX);
+    for (int prohibit = 0; prohibit < 2; ++prohibit) {
+        std::vector<RouterEdgeMock*> prohibited;
+        if (prohibit == 1) {
+            for (size_t i = 1; i < RouterEdgeMock::dictSize(); i += 7) {
+                prohibited.push_back(RouterEdgeMock::dictionary(i));
+            }
+        }
+        tt.prohibit(prohibited);
+        ch.prohibit(prohibited);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            for (int v = 0; v < 2; ++v) {
+                const RouterVehicleMock* const veh = v == 0 ? &car : &bus;
+                MockRoute expected, chRoute;
+                tt.compute(queries[i].first, queries[i].second, veh, 0, expected);
+                ch.compute(queries[i].first, queries[i].second, veh, 0, chRoute);
+                ASSERT_EQ(expected.empty(), chRoute.empty());
+                if (!chRoute.empty()) {
+                    EXPECT_TRUE(isConnected(chRoute));
+                    EXPECT_NEAR(tt.recomputeCosts(expected, veh, 0), ch.recomputeCosts(chRoute, veh, 0), 1e-6);
+                }
+            }
+        }
+    }
+    RouterEdgeMock::clear();
+}
+
+
+/* Test that a single hierarchy with restrictions refuses vehicles of another class
+   while one without restrictions serves all classes. */
+TEST(Router, test_ch_class_change) {
+    RouterEdgeMock::buildGrid(6, 6, 7);
+    const RouterVehicleMock car(30, SVC_PASSENGER);
+    const RouterVehicleMock bus(20, SVC_BUS);
+    const RouterEdgeMock* const from = RouterEdgeMock::dictionary(0);
+    const RouterEdgeMock* const to = RouterEdgeMock::dictionary(RouterEdgeMock::dictSize() - 1);
+    MockRoute route;
+    CHRouter_Direct<RouterEdgeMock, RouterVehicleMock, WithRestrictions> restricted(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime, 0, SUMOTime_MAX);
+    restricted.compute(from, to, &car, 0, route);
+    EXPECT_FALSE(route.empty());
+    EXPECT_THROW(restricted.compute(from, to, &bus, 0, route), ProcessError);
+    CHRouter ch(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime, 0, SUMOTime_MAX);
+    MockRoute carRoute, busRoute;
+    ch.compute(from, to, &car, 0, carRoute);
+    ch.compute(from, to, &bus, 0, busRoute);
+    EXPECT_EQ(carRoute, busRoute);
+    RouterEdgeMock::clear();
+}
+
+
+/* Test the one-to-many queries against single queries and the cost matrix. */
+TEST(Router, test_one_to_many) {
+    RouterEdgeMock::buildGrid(12, 12, 5);
+    const RouterVehicleMock veh(30);
+    TTRouter tt(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    AStarRouter astar(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    std::vector<const RouterEdgeMock*> destinations;
+    for (size_t i = 0; i < RouterEdgeMock::dictSize(); i += 7) {
+        destinations.push_back(RouterEdgeMock::dictionary(i));
+    }
+    // destinations may occur twice and contain the origin
+    destinations.push_back(destinations.front());
+    std::vector<const RouterEdgeMock*> origins;
+    origins.push_back(RouterEdgeMock::dictionary(0));
+    origins.push_back(RouterEdgeMock::dictionary(100));
+    origins.push_back(RouterEdgeMock::dictionary(RouterEdgeMock::dictSize() - 1));
+    for (std::vector<const RouterEdgeMock*>::const_iterator from = origins.begin(); from != origins.end(); ++from) {
+        std::vector<MockRoute> ttRoutes;
+        std::vector<MockRoute> astarRoutes;
+        tt.computeOneToMany(*from, destinations, &veh, 0, ttRoutes);
+        astar.computeOneToMany(*from, destinations, &veh, 0, astarRoutes);
+        ASSERT_EQ(destinations.size(), ttRoutes.size());
+        ASSERT_EQ(destinations.size(), astarRoutes.size());
+        for (size_t i = 0; i < destinations.size(); ++i) {
+            MockRoute expected;
+            tt.compute(*from, destinations[i], &veh, 0, expected);
+            EXPECT_EQ(expected, ttRoutes[i]);
+            EXPECT_NEAR(tt.recomputeCosts(expected, &veh, 0), tt.recomputeCosts(astarRoutes[i], &veh, 0), 1e-6);
+        }
+    }
+    std::vector<std::vector<SUMOReal> > matrix;
+    tt.computeMatrix(origins, destinations, &veh, 0, matrix);
+    ASSERT_EQ(origins.size(), matrix.size());
+    for (size_t i = 0; i < origins.size(); ++i) {
+        ASSERT_EQ(destinations.size(), matrix[i].size());
+        for (size_t j = 0; j < destinations.size(); ++j) {
+            MockRoute expected;
+            tt.compute(origins[i], destinations[j], &veh, 0, expected);
+            EXPECT_DOUBLE_EQ(tt.recomputeCosts(expected, &veh, 0), matrix[i][j]);
+        }
+    }
+    EXPECT_DOUBLE_EQ(origins[0]->getTravelTime(&veh, 0), matrix[0][0]);
+    RouterEdgeMock::clear();
+}
+
+
+/* Test that unreachable destinations of one-to-many queries get empty routes without affecting the others. */
+TEST(Router, test_one_to_many_unreachable) {
+    RouterEdgeMock::buildGrid(8, 8, 5);
+    const RouterVehicleMock car(30, SVC_PASSENGER);
+    DijkstraRouterTT_Direct<RouterEdgeMock, RouterVehicleMock, WithRestrictions> tt(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    AStarRouterTT_Direct<RouterEdgeMock, RouterVehicleMock, WithRestrictions> astar(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    const RouterEdgeMock* const from = RouterEdgeMock::dictionary(0);
+    // every fifth destination is closed for cars, the first and the last one among them
+    std::vector<const RouterEdgeMock*> destinations;
+    for (size_t i = 3; i < RouterEdgeMock::dictSize(); i += 11) {
+        destinations.push_back(RouterEdgeMock::dictionary(i));
+    }
+    std::set<const RouterEdgeMock*> closed;
+    for (size_t i = 0; i < destinations.size(); i += 5) {
+        closed.insert(destinations[i]);
+    }
+    closed.insert(destinations.back());
+    for (std::set<const RouterEdgeMock*>::const_iterator i = closed.begin(); i != closed.end(); ++i) {
+        RouterEdgeMock::dictionary((*i)->getNumericalID())->setPermissions(SVC_BUS);
+    }
+    // the same unreachable destination twice
+    destinations.push_back(destinations.front());
+    std::vector<MockRoute> ttRoutes;
+    std::vector<MockRoute> astarRoutes;
+    tt.computeOneToMany(from, destinations, &car, 0, ttRoutes);
+    astar.computeOneToMany(from, destinations, &car, 0, astarRoutes);
+    ASSERT_EQ(destinations.size(), ttRoutes.size());
+    ASSERT_EQ(destinations.size(), astarRoutes.size());
+    size_t numUnreachable = 0;
+    for (size_t i = 0; i < destinations.size(); ++i) {
+        const bool reachable = closed.count(destinations[i]) == 0;
+        EXPECT_EQ(!reachable, ttRoutes[i].empty());
+        EXPECT_EQ(!reachable, astarRoutes[i].empty());
+        if (reachable) {
+            MockRoute expected;
+            tt.compute(from, destinations[i], &car, 0, expected);
+            EXPECT_EQ(expected, ttRoutes[i]);
+            EXPECT_TRUE(isConnected(ttRoutes[i]));
+            EXPECT_NEAR(tt.recomputeCosts(expected, &car, 0), tt.recomputeCosts(astarRoutes[i], &car, 0), 1e-6);
+        } else {
+            ++numUnreachable;
+        }
+    }
+    EXPECT_LT(2u, numUnreachable);
+    // the cost matrix marks them with -1
+    std::vector<std::vector<SUMOReal> > matrix;
+    tt.computeMatrix(std::vector<const RouterEdgeMock*>(1, from), destinations, &car, 0, matrix);
+    ASSERT_EQ(1u, matrix.size());
+    ASSERT_EQ(destinations.size(), matrix[0].size());
+    for (size_t j = 0; j < destinations.size(); ++j) {
+        EXPECT_EQ(ttRoutes[j].empty(), matrix[0][j] == -1);
+    }
+    RouterEdgeMock::clear();
+}
+
+
+/* Benchmark: routes from 100 origins to 200 destinations each, by single queries and by one-to-many queries. */
+TEST(Router, DISABLED_benchmark_one_to_many) {
+    RouterEdgeMock::buildGrid(50, 50, 7);
+    const RouterVehicleMock veh(30);
+    std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> > queries;
+    buildQueries(300, queries);
+    std::vector<const RouterEdgeMock*> destinations;
+    for (size_t i = 100; i < queries.size(); ++i) {
+        destinations.push_back(queries[i].second);
+    }
+    TTRouter router(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+    size_t singleEdges = 0;
+    long begin = SysUtils::getCurrentMillis();
+    for (size_t i = 0; i < 100; ++i) {
+        for (size_t j = 0; j < destinations.size(); ++j) {
+            MockRoute route;
+            router.compute(queries[i].first, destinations[j], &veh, 0, route);
+            singleEdges += route.size();
+        }
+    }
+    const long durationSingle = SysUtils::getCurrentMillis() - begin;
+    size_t batchEdges = 0;
+    begin = SysUtils::getCurrentMillis();
+    for (size_t i = 0; i < 100; ++i) {
+        std::vector<MockRoute> routes;
+        router.computeOneToMany(queries[i].first, destinations, &veh, 0, routes);
+        for (size_t j = 0; j < routes.size(); ++j) {
+            batchEdges += routes[j].size();
+        }
+    }
+    const long durationBatch = SysUtils::getCurrentMillis() - begin;
+    EXPECT_EQ(singleEdges, batchEdges);
+    std::cout << 100 * destinations.size() << " routes, " << RouterEdgeMock::dictSize() << " edges\n"
+              << "  single queries:      " << durationSingle << "ms\n"
+              << "  one-to-many queries: " << durationBatch << "ms\n";
+    RouterEdgeMock::clear();
+}
+
+
+/* Benchmark: 100,000 random queries on a grid of 50x50 nodes (9800 edges). */
+TEST(Router, DISABLED_benchmark_queries) {
+    RouterEdgeMock::buildGrid(50, 50, 7);
+    const RouterVehicleMock veh(30);
+    std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> > queries;
+    buildQueries(100000, queries);
+    size_t legacyEdges = 0;
+    long begin = SysUtils::getCurrentMillis();
+    {
+        LegacyRouter router;
+        for (size_t i = 0; i < queries.size(); ++i) {
+            MockRoute route;
+            router.compute(queries[i].first, queries[i].second, &veh, route);
+            legacyEdges += route.size();
+        }
+    }
+    const long durationLegacy = SysUtils::getCurrentMillis() - begin;
+    size_t ttEdges = 0;
+    begin = SysUtils::getCurrentMillis();
+    {
+        TTRouter router(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            MockRoute route;
+            router.compute(queries[i].first, queries[i].second, &veh, 0, route);
+            ttEdges += route.size();
+        }
+    }
+    const long durationTT = SysUtils::getCurrentMillis() - begin;
+    size_t astarEdges = 0;
+    begin = SysUtils::getCurrentMillis();
+    {
+        AStarRouter router(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            MockRoute route;
+            router.compute(queries[i].first, queries[i].second, &veh, 0, route);
+            astarEdges += route.size();
+        }
+    }
+    const long durationAStar = SysUtils::getCurrentMillis() - begin;
+    size_t altEdges = 0;
+    begin = SysUtils::getCurrentMillis();
+    long durationALTBuild = 0;
+    {
+        Landmarks landmarks(RouterEdgeMock::dictSize(), 16, &RouterEdgeMock::getMinimumTravelTime);
+        durationALTBuild = SysUtils::getCurrentMillis() - begin;
+        AStarRouter router(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime, &landmarks);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            MockRoute route;
+            router.compute(queries[i].first, queries[i].second, &veh, 0, route);
+            altEdges += route.size();
+        }
+    }
+    const long durationALT = SysUtils::getCurrentMillis() - begin;
+    size_t chEdges = 0;
+    begin = SysUtils::getCurrentMillis();
+    long durationCHBuild = 0;
+    {
+        CHRouter router(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTravelTime, 0, SUMOTime_MAX);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            MockRoute route;
+            router.compute(queries[i].first, queries[i].second, &veh, 0, route);
+            chEdges += route.size();
+            if (i == 0) {
+                durationCHBuild = SysUtils::getCurrentMillis() - begin;
+            }
+        }
+    }
+    const long durationCH = SysUtils::getCurrentMillis() - begin;
+    EXPECT_EQ(legacyEdges, ttEdges);
+    std::cout << queries.size() << " queries, " << RouterEdgeMock::dictSize() << " edges\n"
+              << "  linear decrease-key: " << durationLegacy << "ms\n"
+              << "  DijkstraRouterTT:    " << durationTT << "ms\n"
+              << "  AStarRouterTT:       " << durationAStar << "ms (" << astarEdges << " route edges)\n"
+              << "  AStarRouterTT (ALT): " << durationALT << "ms including " << durationALTBuild << "ms preprocessing (" << altEdges << " route edges)\n"
+              << "  CHRouter:            " << durationCH << "ms including " << durationCHBuild << "ms preprocessing (" << chEdges << " route edges)\n";
+    RouterEdgeMock::clear();
+}
+
+
+/* Benchmark: 10,000 queries over a day of 15 minute travel times, searching the time lines and using their tables. */
+TEST(Router, DISABLED_benchmark_timeline_queries) {
+    RouterEdgeMock::buildGrid(50, 50, 7);
+    const RouterVehicleMock veh(30);
+    unsigned int seed = 11;
+    for (size_t i = 0; i < RouterEdgeMock::dictSize(); ++i) {
+        RouterEdgeMock* edge = RouterEdgeMock::dictionary(i);
+        for (int begin = 0; begin < 86400; begin += 900) {
+            seed = seed * 1103515245u + 12345u;
+            const SUMOReal factor = 1. + (SUMOReal)((seed >> 16) % 1000) / 1000.;
+            edge->addTravelTime(factor * edge->getLength() / edge->getSpeed(), begin, begin + 900);
+        }
+    }
+    std::vector<std::pair<const RouterEdgeMock*, const RouterEdgeMock*> > queries;
+    buildQueries(10000, queries);
+    long durations[2];
+    SUMOReal costs[2];
+    for (int dense = 0; dense < 2; ++dense) {
+        if (dense == 1) {
+            for (size_t i = 0; i < RouterEdgeMock::dictSize(); ++i) {
+                ASSERT_TRUE(RouterEdgeMock::dictionary(i)->buildTravelTimeTable());
+            }
+        }
+        costs[dense] = 0;
+        const long begin = SysUtils::getCurrentMillis();
+        TTRouter router(RouterEdgeMock::dictSize(), true, &RouterEdgeMock::getTimeLineTravelTime);
+        for (size_t i = 0; i < queries.size(); ++i) {
+            const SUMOTime depart = (SUMOTime)(i * 86400 / queries.size());
+            MockRoute route;
+            router.compute(queries[i].first, queries[i].second, &veh, depart, route);
+            costs[dense] += router.recomputeCosts(route, &veh, depart);
+        }
+        durations[dense] = MAX2(SysUtils::getCurrentMillis() - begin, 1L);
+    }
+    EXPECT_DOUBLE_EQ(costs[0], costs[1]);
+    std::cout << queries.size() << " queries, " << RouterEdgeMock::dictSize() << " edges, 96 intervals per edge\n"
+              << "  map lookup:   " << durations[0] << "ms (" << queries.size() * 1000 / durations[0] << " queries/s)\n"
+              << "  dense table:  " << durations[1] << "ms (" << queries.size() * 1000 / durations[1] << " queries/s)\n";
+    RouterEdgeMock::clear();
+}
+
+
+/****************************************************************************/
+
@@ -0,0 +1,108 @@
+/****************************************************************************/
+/// @file    SUMOVehicleParameterTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the state I/O of SUMOVehicleParameter from <SUMO>/src/utils/common
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <utils/common/SUMOVehicleParameter.h>
+#include <utils/iodevices/BinaryInputDevice.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests that a saved parameter set is restored completely, including stops and long strings. */
+TEST(SUMOVehicleParameter, test_state_roundtrip) {
+    const std::string file = "SUMOVehicleParameterTest.bin";
+    SUMOVehicleParameter pars;
+    pars.id = "veh0";
+    pars.routeid = "r0";
+    pars.vtypeid = "t0";
+    pars.depart = 12000;
+    pars.departProcedure = DEPART_GIVEN;
+    pars.departLane = 1;
+    pars.departLaneProcedure = DEPART_LANE_GIVEN;
+    pars.departPos = 5;
+    pars.departPosProcedure = DEPART_POS_GIVEN;
+    pars.arrivalSpeed = 3;
+    pars.arrivalSpeedProcedure = ARRIVAL_SPEED_GIVEN;
+    pars.repetitionNumber = 4;
+    pars.repetitionsDone = 2;
+    pars.line = std::string(3000, 'x');
+    SUMOVehicleParameter::Stop stop;
+    stop.lane = "e0_0";
+    stop.startPos = 10;
+    stop.endPos = 20;
+    stop.duration = 5000;
+    stop.until = -1;
+    stop.triggered = false;
+    stop.parking = true;
+    stop.index = 0;
+    pars.stops.push_back(stop);
+    pars.setParameter = VEHPARS_DEPARTLANE_SET | VEHPARS_LINE_SET;
+    {
+        std::ofstream strm(file.c_str(), std::fstream::out | std::fstream::binary);
+        pars.saveState(strm);
+    }
+    SUMOVehicleParameter loaded;
+    {
+        BinaryInputDevice bis(file);
+        loaded.loadState(bis);
+        EXPECT_TRUE(bis.good());
+        EXPECT_EQ(EOF, bis.peek());
+    }
+    remove(file.c_str());
+    EXPECT_EQ(pars.id, loaded.id);
+    EXPECT_EQ(pars.routeid, loaded.routeid);
+    EXPECT_EQ(pars.vtypeid, loaded.vtypeid);
+    EXPECT_EQ(pars.depart, loaded.depart);
+    EXPECT_EQ(pars.departProcedure, loaded.departProcedure);
+    EXPECT_EQ(pars.departLane, loaded.departLane);
+    EXPECT_EQ(pars.departLaneProcedure, loaded.departLaneProcedure);
+    EXPECT_EQ(pars.departPos, loaded.departPos);
+    EXPECT_EQ(pars.departPosProcedure, loaded.departPosProcedure);
+    EXPECT_EQ(pars.arrivalSpeed, loaded.arrivalSpeed);
+    EXPECT_EQ(pars.arrivalSpeedProcedure, loaded.arrivalSpeedProcedure);
+    EXPECT_EQ(pars.repetitionNumber, loaded.repetitionNumber);
+    EXPECT_EQ(pars.repetitionsDone, loaded.repetitionsDone);
+    EXPECT_EQ(pars.line, loaded.line);
+    EXPECT_EQ(pars.setParameter, loaded.setParameter);
+    ASSERT_EQ(1, (int) loaded.stops.size());
+    EXPECT_EQ("e0_0", loaded.stops[0].lane);
+    EXPECT_EQ(20, loaded.stops[0].endPos);
+    EXPECT_EQ(5000, loaded.stops[0].duration);
+    EXPECT_EQ(-1, loaded.stops[0].until);
+    EXPECT_TRUE(loaded.stops[0].parking);
+}
+
+
+/****************************************************************************/
+
@@ -29,6 +29,8 @@
 #include <config.h>
 #endif
 
+#include <cstdlib>
+#include <set>
 #include <gtest/gtest.h>
 #include <utils/common/ValueTimeLine.h>
 
@@ -216,3 +218,168 @@ TEST(ValueTimeLine, test_fill_gaps_nobounds) {
 }
 
 
+
+
+// --------------------------------
+// dense table tests
+// --------------------------------
+
+/* Tests that the dense table gives the same answers as the map for aligned intervals and gaps. */
+TEST(ValueTimeLine, test_dense_aligned) {
+    ValueTimeLine<int> vtl;
+    vtl.add(0, 900, 1);
+    vtl.add(900, 1800, 2);
+    vtl.add(2700, 4500, 3);
+    vtl.fillGaps(4);
+    ValueTimeLine<int> dense = vtl;
+    EXPECT_TRUE(dense.buildDenseTable());
+    for (SUMOReal t = -1; t < 6000; t += 0.25) {
+        EXPECT_EQ(vtl.getValue(t), dense.getValue(t)) << "The values should be equal at " << t << ".";
+        EXPECT_EQ(vtl.describesTime(t), dense.describesTime(t)) << "The validity should be equal at " << t << ".";
+        EXPECT_EQ(vtl.getSplitTime(t, t + 450), dense.getSplitTime(t, t + 450)) << "The split times should be equal at " << t << ".";
+        EXPECT_EQ(vtl.getSplitTime(t, t + 1000), dense.getSplitTime(t, t + 1000)) << "The split times should be equal at " << t << ".";
+    }
+    EXPECT_FALSE(dense.describesTime(-2));
+    EXPECT_EQ(2700, dense.getSplitTime(2000, 3000));
+}
+
+
+/* Tests that the dense table gives the same answers as the map for intervals not sharing a period. */
+TEST(ValueTimeLine, test_dense_unaligned) {
+    ValueTimeLine<int> vtl;
+    vtl.add(10, 100, 1);
+    vtl.add(130, 170, 2);
+    vtl.add(175, 400, 3);
+    vtl.add(333.3, 334, 4);
+    vtl.fillGaps(5, true);
+    ValueTimeLine<int> dense = vtl;
+    EXPECT_TRUE(dense.buildDenseTable(100));
+    for (SUMOReal t = -1; t < 500; t += 0.125) {
+        EXPECT_EQ(vtl.getValue(t), dense.getValue(t)) << "The values should be equal at " << t << ".";
+        EXPECT_EQ(vtl.describesTime(t), dense.describesTime(t)) << "The validity should be equal at " << t << ".";
+        EXPECT_EQ(vtl.getSplitTime(t, t + 30), dense.getSplitTime(t, t + 30)) << "The split times should be equal at " << t << ".";
+    }
+    // too many cells for the given limit
+    EXPECT_FALSE(dense.buildDenseTable());
+    EXPECT_EQ(4, dense.getValue(333.75));
+    // adding discards the table
+    EXPECT_TRUE(dense.buildDenseTable(100));
+    dense.add(0, 50, 6);
+    EXPECT_EQ(6, dense.getValue(20));
+    EXPECT_EQ(1, dense.getValue(50));
+}
+
+
+/* Tests the dense table of time lines with a single interval. */
+TEST(ValueTimeLine, test_dense_single) {
+    ValueTimeLine<int> vtl;
+    vtl.add(0, 100, 2);
+    EXPECT_TRUE(vtl.buildDenseTable());
+    EXPECT_EQ(2, vtl.getValue(0));
+    EXPECT_EQ(2, vtl.getValue(99));
+    EXPECT_TRUE(vtl.describesTime(50));
+    EXPECT_FALSE(vtl.describesTime(100));
+    vtl.fillGaps(4, true);
+    EXPECT_TRUE(vtl.buildDenseTable());
+    EXPECT_EQ(2, vtl.getValue(-1));
+    EXPECT_EQ(2, vtl.getValue(1000));
+    EXPECT_FALSE(vtl.describesTime(-1));
+    EXPECT_TRUE(vtl.describesTime(1000));
+}
+
+
+/* Tests the dense table of time lines with gaps between the intervals which were not filled. */
+TEST(ValueTimeLine, test_dense_unfilled_gaps) {
+    ValueTimeLine<int> vtl;
+    vtl.add(0, 100, 1);
+    vtl.add(200, 300, 2);
+    vtl.add(300, 350, 3);
+    ValueTimeLine<int> dense = vtl;
+    EXPECT_TRUE(dense.buildDenseTable());
+    EXPECT_FALSE(dense.describesTime(-0.5));
+    EXPECT_TRUE(dense.describesTime(0));
+    EXPECT_TRUE(dense.describesTime(99.9));
+    EXPECT_FALSE(dense.describesTime(100));
+    EXPECT_FALSE(dense.describesTime(199.9));
+    EXPECT_TRUE(dense.describesTime(200));
+    EXPECT_FALSE(dense.describesTime(350));
+    EXPECT_FALSE(dense.describesTime(1e9));
+    EXPECT_EQ(1, dense.getValue(0));
+    EXPECT_EQ(2, dense.getValue(200));
+    EXPECT_EQ(3, dense.getValue(300));
+    for (SUMOReal t = 0; t < 400; t += 0.5) {
+        EXPECT_EQ(vtl.getValue(t), dense.getValue(t)) << "The values should be equal at " << t << ".";
+    }
+    // the gap counts as an interval of its own
+    EXPECT_EQ(100, dense.getSplitTime(50, 150));
+    EXPECT_EQ(-1, dense.getSplitTime(50, 250));
+    EXPECT_EQ(200, dense.getSplitTime(150, 250));
+}
+
+
+/* Tests the split times at the boundaries of the intervals and outside of them. */
+TEST(ValueTimeLine, test_dense_split_time_boundaries) {
+    ValueTimeLine<int> vtl;
+    vtl.add(0, 100, 1);
+    vtl.add(100, 200, 2);
+    vtl.fillGaps(4);
+    EXPECT_TRUE(vtl.buildDenseTable());
+    // the end of an interval belongs to the next one
+    EXPECT_EQ(100, vtl.getSplitTime(99, 100));
+    EXPECT_EQ(-1, vtl.getSplitTime(100, 199));
+    EXPECT_EQ(200, vtl.getSplitTime(100, 200));
+    EXPECT_EQ(-1, vtl.getSplitTime(0, 200));
+    EXPECT_EQ(-1, vtl.getSplitTime(50, 50));
+    // behind the last interval
+    EXPECT_EQ(200, vtl.getSplitTime(150, 1e6));
+    EXPECT_EQ(-1, vtl.getSplitTime(200, 1e6));
+    EXPECT_EQ(4, vtl.getValue(1e6));
+    // before the first interval (the filled one starting at -1)
+    EXPECT_EQ(0, vtl.getSplitTime(-1, 0));
+    EXPECT_EQ(4, vtl.getValue(-0.5));
+    EXPECT_FALSE(vtl.describesTime(-0.5));
+}
+
+
+/* Tests that the dense table gives the same answers as the map for random time lines. */
+TEST(ValueTimeLine, test_dense_random) {
+    srand(42);
+    for (int run = 0; run < 50; ++run) {
+        ValueTimeLine<int> vtl;
+        std::set<SUMOReal> boundaries;
+        const int numIntervals = 1 + rand() % 20;
+        for (int i = 0; i < numIntervals; ++i) {
+            const SUMOReal begin = (SUMOReal)(rand() % 2000) / 2;
+            const SUMOReal end = begin + (SUMOReal)(1 + rand() % 400) / 2;
+            vtl.add(begin, end, i);
+            boundaries.insert(begin);
+            boundaries.insert(end);
+        }
+        const int fill = run % 3;
+        if (fill > 0) {
+            vtl.fillGaps(-1, fill == 2);
+        }
+        ValueTimeLine<int> dense = vtl;
+        ASSERT_TRUE(dense.buildDenseTable(1000)) << "The table should be built in run " << run << ".";
+        // without filling, the values before the first interval are undefined
+        const SUMOReal first = fill > 0 ? -1 : *boundaries.begin();
+        std::set<SUMOReal> times = boundaries;
+        for (SUMOReal t = first; t < *boundaries.rbegin() + 100; t += (SUMOReal) 0.75) {
+            times.insert(t);
+        }
+        for (std::set<SUMOReal>::const_iterator it = boundaries.begin(); it != boundaries.end(); ++it) {
+            times.insert(*it - (SUMOReal) 0.001);
+            times.insert(*it + (SUMOReal) 0.001);
+        }
+        for (std::set<SUMOReal>::const_iterator it = times.begin(); it != times.end(); ++it) {
+            const SUMOReal t = *it;
+            EXPECT_EQ(vtl.describesTime(t), dense.describesTime(t)) << "The validity should be equal at " << t << " in run " << run << ".";
+            if (t < first) {
+                continue;
+            }
+            EXPECT_EQ(vtl.getValue(t), dense.getValue(t)) << "The values should be equal at " << t << " in run " << run << ".";
+            EXPECT_EQ(vtl.getSplitTime(t, t + 1), dense.getSplitTime(t, t + 1)) << "The split times should be equal at " << t << " in run " << run << ".";
+            EXPECT_EQ(vtl.getSplitTime(t, t + 50), dense.getSplitTime(t, t + 50)) << "The split times should be equal at " << t << " in run " << run << ".";
+        }
+    }
+}
@@ -0,0 +1,148 @@
+/****************************************************************************/
+/// @file    ColumnarFCDTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests ColumnarFCDWriter and ColumnarFCDReader from <SUMO>/src/utils/iodevices
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <utils/iodevices/OutputDevice.h>
+#include <utils/iodevices/ColumnarFCDWriter.h>
+#include <utils/iodevices/ColumnarFCDReader.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests that the written steps are read back with the stored precision. */
+TEST(ColumnarFCD, test_round_trip) {
+    const std::string file = "columnarFCDTest.bin";
+    OutputDevice& dev = OutputDevice::getDevice(file, "", true);
+    ColumnarFCDWriter writer(2, 2);
+    writer.add("veh0", "car", 10.004, -5.5, 90., 13.889);
+    writer.add("veh1", "car", 1234567.891, 0., -180., 0.);
+    writer.writeStep(dev, 1000);
+    writer.writeStep(dev, 2000);
+    writer.add("veh1", "car", 1.5, 2.5, 45., 1.);
+    writer.add("veh2", "bus", 3., 4., 0., 2.);
+    writer.writeStep(dev, 3000);
+    dev.close();
+
+    ColumnarFCDReader reader(file);
+    EXPECT_TRUE(reader.readStep());
+    EXPECT_EQ(1000, reader.getTime());
+    EXPECT_EQ(2u, reader.size());
+    EXPECT_EQ("veh0", reader.getID(0));
+    EXPECT_EQ("car", reader.getType(0));
+    EXPECT_DOUBLE_EQ(10., reader.getX(0));
+    EXPECT_DOUBLE_EQ(-5.5, reader.getY(0));
+    EXPECT_DOUBLE_EQ(90., reader.getAngle(0));
+    EXPECT_DOUBLE_EQ(13.89, reader.getSpeed(0));
+    EXPECT_EQ("veh1", reader.getID(1));
+    EXPECT_DOUBLE_EQ(1234567.89, reader.getX(1));
+    EXPECT_DOUBLE_EQ(-180., reader.getAngle(1));
+
+    EXPECT_TRUE(reader.readStep());
+    EXPECT_EQ(2000, reader.getTime());
+    EXPECT_EQ(0u, reader.size());
+
+    EXPECT_TRUE(reader.readStep());
+    EXPECT_EQ(3000, reader.getTime());
+    EXPECT_EQ(2u, reader.size());
+    EXPECT_EQ("veh1", reader.getID(0));
+    EXPECT_EQ("veh2", reader.getID(1));
+    EXPECT_EQ("bus", reader.getType(1));
+    EXPECT_EQ(2u, reader.getIDHandles()[0]);
+    EXPECT_EQ(4u, reader.getTypeHandles()[1]);
+    EXPECT_DOUBLE_EQ(45., reader.getAngle(0));
+
+    EXPECT_FALSE(reader.readStep());
+    remove(file.c_str());
+}
+
+
+/* Tests that vehicles added by key get the right strings if the key is reused and the dictionary starts anew. */
+TEST(ColumnarFCD, test_keys_and_dictionary_reset) {
+    const std::string file = "columnarFCDKeyTest.bin";
+    OutputDevice& dev = OutputDevice::getDevice(file, "", true);
+    ColumnarFCDWriter writer(2, 2, 3);
+    writer.add(0, "veh0", "car", 1., 1., 0., 1.);
+    writer.add(1, "veh1", "car", 2., 2., 0., 2.);
+    writer.writeStep(dev, 1000);
+    // the dictionary holds three strings, it may still grow
+    writer.add(1, "veh1", "car", 3., 3., 0., 3.);
+    writer.add(0, "veh2", "bus", 4., 4., 0., 4.);
+    writer.writeStep(dev, 2000);
+    // the dictionary is full and starts anew
+    writer.add(0, "veh2", "bus", 5., 5., 0., 5.);
+    writer.add(1, "veh1", "car", 6., 6., 0., 6.);
+    writer.writeStep(dev, 3000);
+    dev.close();
+
+    ColumnarFCDReader reader(file);
+    EXPECT_TRUE(reader.readStep());
+    EXPECT_EQ(2u, reader.size());
+    EXPECT_EQ("veh0", reader.getID(0));
+    EXPECT_EQ("veh1", reader.getID(1));
+    EXPECT_EQ("car", reader.getType(1));
+
+    EXPECT_TRUE(reader.readStep());
+    EXPECT_EQ(2u, reader.size());
+    EXPECT_EQ("veh1", reader.getID(0));
+    EXPECT_EQ("veh2", reader.getID(1));
+    EXPECT_EQ("bus", reader.getType(1));
+    EXPECT_EQ(3u, reader.getIDHandles()[1]);
+
+    EXPECT_TRUE(reader.readStep());
+    EXPECT_EQ(3000, reader.getTime());
+    EXPECT_EQ(2u, reader.size());
+    EXPECT_EQ("veh2", reader.getID(0));
+    EXPECT_EQ("bus", reader.getType(0));
+    EXPECT_EQ("veh1", reader.getID(1));
+    EXPECT_EQ("car", reader.getType(1));
+    EXPECT_EQ(0u, reader.getIDHandles()[0]);
+    EXPECT_EQ(3u, reader.getTypeHandles()[1]);
+    EXPECT_DOUBLE_EQ(6., reader.getSpeed(1));
+
+    EXPECT_FALSE(reader.readStep());
+    remove(file.c_str());
+}
+
+
+/* Tests that other files are rejected. */
+TEST(ColumnarFCD, test_invalid_file) {
+    const std::string file = "columnarFCDTest.xml";
+    OutputDevice& dev = OutputDevice::getDevice(file);
+    dev.writeXMLHeader("fcd-export");
+    dev.close();
+    EXPECT_THROW(ColumnarFCDReader reader(file), IOError);
+    EXPECT_THROW(ColumnarFCDReader reader("columnarFCDTest.missing"), IOError);
+    remove(file.c_str());
+}
+
+/****************************************************************************/
+
@@ -0,0 +1,90 @@
+/****************************************************************************/
+/// @file    OutputDevice_AsyncFileTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests the class OutputDevice_AsyncFile
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#ifdef HAVE_FOX
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <utils/common/UtilExceptions.h>
+#include <utils/iodevices/OutputDevice_AsyncFile.h>
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests that output much larger than the buffers and the memory limit is written completely and in order. */
+TEST(OutputDevice_AsyncFile, test_large_output) {
+    const std::string file = "asyncFileTest.txt";
+    OutputDevice_AsyncFile::enable(1000, 5000);
+    OutputDevice::setFileDeviceBuilder(0);
+    OutputDevice* dev = OutputDevice_AsyncFile::build(file, false);
+    std::ostringstream expected;
+    for (int i = 0; i < 100000; ++i) {
+        (*dev) << "line " << i << "\n";
+        expected << "line " << i << "\n";
+    }
+    EXPECT_TRUE(dev->ok());
+    delete dev;
+    std::ifstream strm(file.c_str());
+    std::ostringstream written;
+    written << strm.rdbuf();
+    strm.close();
+    std::remove(file.c_str());
+    EXPECT_EQ(expected.str(), written.str());
+}
+
+
+#ifndef WIN32
+/* Tests that a failure of the writing thread is passed to the caller. */
+TEST(OutputDevice_AsyncFile, test_write_failure) {
+    OutputDevice_AsyncFile::enable(1000, 5000);
+    OutputDevice::setFileDeviceBuilder(0);
+    OutputDevice* dev = OutputDevice_AsyncFile::build("/dev/full", false);
+    bool thrown = false;
+    for (int i = 0; i < 100000 && !thrown; ++i) {
+        try {
+            (*dev) << "line " << i << "\n";
+        } catch (IOError&) {
+            thrown = true;
+        }
+    }
+    EXPECT_TRUE(thrown);
+    EXPECT_FALSE(dev->ok());
+    delete dev;
+}
+#endif
+
+#endif
+
+
+/****************************************************************************/
+
@@ -0,0 +1,158 @@
+/****************************************************************************/
+/// @file    PlainXMLFormatterTest.cpp
+/// @author  agent
+/// @date    Oct 2026
+/// @version $Id$
+///
+// Tests PlainXMLFormatter class from <SUMO>/src/utils/iodevices
+/****************************************************************************/
+// SUMO, Simulation of Urban MObility; see http://sumo.sourceforge.net/
+// Copyright (C) 2001-2026 DLR (http://www.dlr.de/) and contributors
+/****************************************************************************/
+//
+//   This file is part of SUMO.
+//   SUMO is free software: you can redistribute it and/or modify
+//   it under the terms of the GNU General Public License as published by
+//   the Free Software Foundation, either version 3 of the License, or
+//   (at your option) any later version.
+//
+/****************************************************************************/
+
+
+// ===========================================================================
+// included modules
+// ===========================================================================
+#ifdef _MSC_VER
+#include <windows_config.h>
+#else
+#include <config.h>
+#endif
+
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <gtest/gtest.h>
+#include <utils/common/ToString.h>
+#include <utils/iodevices/PlainXMLFormatter.h>
+
+
+// ===========================================================================
+// helper functions
+// ===========================================================================
+/* Writes the attribute the way PlainXMLFormatter did before the overloads. */
+template <class T>
+void writeStreamAttr(std::ostream& into, const SumoXMLAttr attr, const T& val) {
+    into << " " << toString(attr) << "=\"" << toString(val, into.precision()) << "\"";
+}
+
+
+/* Returns a random value spanning several orders of magnitude. */
+SUMOReal randomValue() {
+    const SUMOReal mantissa = (SUMOReal) rand() / RAND_MAX;
+    const SUMOReal value = mantissa * pow(10., rand() % 10 - 3);
+    return rand() % 4 == 0 ? -value : value;
+}
+
+
+// ===========================================================================
+// test definitions
+// ===========================================================================
+/* Tests that the formatted values equal the stream output. */
+TEST(PlainXMLFormatter, test_formatReal) {
+    const SUMOReal values[] = { 0., -0., 1., -1., 0.5, 0.125, 0.995, 1.005, 2.675, 9.995, 99.999999999,
+                                -0.001, 123456.789, 4294967294.4, 4294967295., 1e300, -1e300, 1e-300,
+                                std::numeric_limits<SUMOReal>::infinity(), std::numeric_limits<SUMOReal>::quiet_NaN()
+                              };
+    char buffer[32];
+    for (int precision = 0; precision <= 10; ++precision) {
+        for (int i = 0; i < (int)(sizeof(values) / sizeof(SUMOReal)); ++i) {
+            const int length = PlainXMLFormatter::formatReal(buffer, values[i], precision);
+            if (length > 0) {
+                EXPECT_EQ(toString(values[i], precision), std::string(buffer, length));
+            }
+        }
+    }
+    srand(42);
+    int formatted = 0;
+    for (int i = 0; i < 100000; ++i) {
+        const SUMOReal value = randomValue();
+        const int precision = rand() % 9;
+        const int length = PlainXMLFormatter::formatReal(buffer, value, precision);
+        if (length > 0) {
+            ASSERT_EQ(toString(value, precision), std::string(buffer, length));
+            formatted++;
+        }
+    }
+    EXPECT_LT(99000, formatted);
+    EXPECT_EQ(0, PlainXMLFormatter::formatReal(buffer, 0.125, 2));
+    EXPECT_EQ(0, PlainXMLFormatter::formatReal(buffer, 1., 9));
+    EXPECT_EQ(0, PlainXMLFormatter::formatReal(buffer, 4294967295., 2));
+}
+
+
+/* Tests that the attribute overloads write the same as the stream. */
+TEST(PlainXMLFormatter, test_writeAttr) {
+    PlainXMLFormatter formatter;
+    const SUMOReal reals[] = { 0., 13.8889, -2.5, 0.125, 1e20, 12345678901234. };
+    const int ints[] = { 0, 7, -7, 2147483647, -2147483647 - 1 };
+    for (int precision = 0; precision <= 6; precision += 2) {
+        std::ostringstream fast, slow;
+        fast << std::setprecision(precision) << std::setiosflags(std::ios::fixed);
+        slow << std::setprecision(precision) << std::setiosflags(std::ios::fixed);
+        for (int i = 0; i < (int)(sizeof(reals) / sizeof(SUMOReal)); ++i) {
+            PlainXMLFormatter::writeAttr(fast, SUMO_ATTR_X, reals[i]);
+            writeStreamAttr(slow, SUMO_ATTR_X, reals[i]);
+        }
+        for (int i = 0; i < (int)(sizeof(ints) / sizeof(int)); ++i) {
+            PlainXMLFormatter::writeAttr(fast, SUMO_ATTR_BEGIN, ints[i]);
+            writeStreamAttr(slow, SUMO_ATTR_BEGIN, ints[i]);
+        }
+        PlainXMLFormatter::writeAttr(fast, SUMO_ATTR_NUMBER, 4294967295u);
+        writeStreamAttr(slow, SUMO_ATTR_NUMBER, 4294967295u);
+        PlainXMLFormatter::writeAttr(fast, SUMO_ATTR_ID, std::string("veh0"));
+        writeStreamAttr(slow, SUMO_ATTR_ID, std::string("veh0"));
+        PlainXMLFormatter::writeAttr(fast, SUMO_ATTR_TYPE, 'c');
+        writeStreamAttr(slow, SUMO_ATTR_TYPE, 'c');
+        EXPECT_EQ(slow.str(), fast.str());
+        EXPECT_EQ(precision, fast.precision());
+    }
+}
+
+
+/* Benchmarks writing 10M real valued attributes. */
+TEST(PlainXMLFormatter, DISABLED_benchmark_writeAttr) {
+    PlainXMLFormatter formatter;
+    const int number = 10000000;
+    std::vector<SUMOReal> values;
+    srand(42);
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(randomValue());
+    }
+    std::ostringstream fast, slow;
+    fast << std::setprecision(OUTPUT_ACCURACY) << std::setiosflags(std::ios::fixed);
+    slow << std::setprecision(OUTPUT_ACCURACY) << std::setiosflags(std::ios::fixed);
+    clock_t begin = clock();
+    for (int i = 0; i < number; ++i) {
+        writeStreamAttr(slow, SUMO_ATTR_SPEED, values[i % 1000]);
+        if (i % 1000 == 999) {
+            slow.str("");
+        }
+    }
+    const double slowTime = (double)(clock() - begin) / CLOCKS_PER_SEC;
+    begin = clock();
+    for (int i = 0; i < number; ++i) {
+        PlainXMLFormatter::writeAttr(fast, SUMO_ATTR_SPEED, values[i % 1000]);
+        if (i % 1000 == 999) {
+            fast.str("");
+        }
+    }
+    const double fastTime = (double)(clock() - begin) / CLOCKS_PER_SEC;
+    std::cout << "stream: " << slowTime << "s, fast path: " << fastTime << "s" << std::endl;
+    EXPECT_LT(fastTime, slowTime);
+}
+
+/****************************************************************************/
+